@@ -2,7 +2,7 @@
  *
  * IMCC call-in routines for use with the Parrot embedding API
  *
- * Copyright (C) 2011, Parrot Foundation.
+ * Copyright (C) 2011-2012, Parrot Foundation.
  */
 
 /*
@@ -124,6 +124,30 @@ imcc_get_pasm_compreg_api(Parrot_PMC interp_pmc, int add_compreg, ARGOUT(Parrot_
 
 /*
 
+=item C<Parrot_Int imcc_set_optimization_level_api(Parrot_PMC interp_pmc,
+Parrot_PMC compiler, const char *opts)>
+
+Set the optimization level of the given IMCCompiler PMC, as the C<-O> command
+line option does. See C<imcc_set_optimization_level> for C<opts>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+Parrot_Int
+imcc_set_optimization_level_api(Parrot_PMC interp_pmc, Parrot_PMC compiler,
+        ARGIN(const char *opts))
+{
+    ASSERT_ARGS(imcc_set_optimization_level_api)
+    IMCC_API_CALLIN(interp_pmc, interp)
+    imc_info_t * const imcc = (imc_info_t *)VTABLE_get_pointer(interp, compiler);
+    imcc_set_optimization_level(imcc, opts);
+    IMCC_API_CALLOUT(interp_pmc, interp)
+}
+
+/*
+
 =item C<static PMC * get_compreg_pmc(PARROT_INTERP, int is_pasm, int
 add_compreg)>
 
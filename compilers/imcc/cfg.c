@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2002-2011, Parrot Foundation.
+ * Copyright (C) 2002-2012, Parrot Foundation.
  */
 
 /*
@@ -1258,6 +1258,76 @@ search_predecessors_not_in(ARGIN(const Basic_block *node), ARGMOD(Set *s))
     }
 }
 
+/*
+
+=item C<void find_unfollowed_blocks(imc_info_t *imcc, const IMC_Unit *unit, Set
+*roots, Set *reached)>
+
+Adds to C<roots> the basic blocks which may be entered without the control
+flow graph knowing: the targets of C<push_eh>, C<set_addr> and the like, and
+blocks no other block leads to. Adds them and all the blocks reached from them
+to C<reached>.
+
+=cut
+
+*/
+
+void
+find_unfollowed_blocks(ARGMOD(imc_info_t *imcc), ARGIN(const IMC_Unit *unit),
+        ARGMOD(Set *roots), ARGMOD(Set *reached))
+{
+    ASSERT_ARGS(find_unfollowed_blocks)
+    const unsigned int  n_blocks = unit->n_basic_blocks;
+    unsigned int       *todo     = mem_gc_allocate_n_typed(imcc->interp, n_blocks + 1,
+                                        unsigned int);
+    const Instruction  *ins;
+    unsigned int        i, n_todo = 0;
+
+    for (i = 1; i < n_blocks; i++) {
+        if (!unit->bb_list[i]->pred_list)
+            set_add(roots, i);
+    }
+
+    for (ins = unit->instructions; ins; ins = ins->next) {
+        const SymReg *label;
+
+        if (!(ins->type & ITBRANCH)
+        ||  !(STREQ(ins->opname, "push_eh")
+        ||    STREQ(ins->opname, "set_addr")
+        ||    STREQ(ins->opname, "set_label")
+        ||    STREQ(ins->opname, "local_branch")
+        ||    STREQ(ins->opname, "runinterp")))
+            continue;
+
+        label = get_branch_reg(ins);
+        if (label)
+            label = find_sym(imcc, label->name);
+
+        if (label && (label->type & VTADDRESS) && label->first_ins)
+            set_add(roots, label->first_ins->bbindex);
+    }
+
+    for (i = 0; i < n_blocks; i++) {
+        if (set_contains(roots, i) && !set_contains(reached, i)) {
+            set_add(reached, i);
+            todo[n_todo++] = i;
+        }
+    }
+
+    while (n_todo) {
+        const Edge *e;
+
+        for (e = unit->bb_list[todo[--n_todo]]->succ_list; e; e = e->succ_next) {
+            if (!set_contains(reached, e->to->index)) {
+                set_add(reached, e->to->index);
+                todo[n_todo++] = e->to->index;
+            }
+        }
+    }
+
+    mem_sys_free(todo);
+}
+
 /*** Utility functions ***/
 
 /*
@@ -1275,7 +1345,7 @@ init_basic_blocks(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
 {
     ASSERT_ARGS(init_basic_blocks)
 
-    if (!unit->bb_list)
+    if (unit->bb_list)
         clear_basic_blocks(unit);
 
     unit->n_basic_blocks = 0;
@@ -92,6 +92,19 @@ void find_loops(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
         FUNC_MODIFIES(*imcc)
         FUNC_MODIFIES(*unit);
 
+void find_unfollowed_blocks(
+    ARGMOD(imc_info_t *imcc),
+    ARGIN(const IMC_Unit *unit),
+    ARGMOD(Set *roots),
+    ARGMOD(Set *reached))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*roots)
+        FUNC_MODIFIES(*reached);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_PURE_FUNCTION
 int natural_preheader(
@@ -126,6 +139,11 @@ void search_predecessors_not_in(
 #define ASSERT_ARGS_find_loops __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_find_unfollowed_blocks __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(roots) \
+    , PARROT_ASSERT_ARG(reached))
 #define ASSERT_ARGS_natural_preheader __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(unit) \
     , PARROT_ASSERT_ARG(loop_info))
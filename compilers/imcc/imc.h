@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2002-2011, Parrot Foundation.
+ * Copyright (C) 2002-2012, Parrot Foundation.
  */
 
 #ifndef PARROT_IMCC_IMC_H_GUARD
@@ -388,6 +388,7 @@ typedef enum _enum_opt {
     OPT_PRE,
     OPT_CFG  = 0x002,
     OPT_SUB  = 0x004,
+    OPT_SSA  = 0x008,
     OPT_PASM = 0x100,
     OPT_J    = 0x200
 } enum_opt_t;
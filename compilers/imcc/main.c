@@ -263,6 +263,9 @@ imcc_set_optimization_level(ARGMOD(imc_info_t *imcc), ARGIN(const char *opts))
     if (strchr(opts, '2')) {
         imcc->optimizer_level |= (OPT_PRE | OPT_CFG);
     }
+    if (strchr(opts, '3')) {
+        imcc->optimizer_level |= (OPT_PRE | OPT_CFG | OPT_SSA);
+    }
 }
 
 /*
@@ -53,6 +53,10 @@ used_once ... deletes assignments, when LHS is unused
 
 constant_propagation
 
+ssa_optimize (-O3) ... numbers the values of the registers as in SSA form,
+then propagates copies, eliminates common subexpressions, moves loop
+invariant code to the loop preheaders and removes dead definitions
+
 post_optimizer: currently pcc_optimize in pcc.c
 ---------------
 
@@ -75,6 +79,63 @@ e.g. eliminate new Px .PerlUndef because Px where different before
 #include "pmc/pmc_callcontext.h"
 #include "parrot/oplib/core_ops.h"
 
+/* the most arguments of the ops ssa_optimize looks into */
+#define SSA_MAX_ARGS 4
+
+/* a value of a register */
+typedef struct SSA_version {
+    SymReg       *copy_of;  /* register this was copied from, or NULL */
+    unsigned int  copy_ver; /* version of copy_of when copied */
+    unsigned int  block;    /* block defining this version */
+    int           hoist;    /* loop invariant computing this, or -1 */
+    int           by_ins;   /* written by an instruction, not merged */
+} SSA_version;
+
+/* a pure operation computed before */
+typedef struct SSA_expr {
+    const op_info_t *op;
+    const SymReg    *konst[SSA_MAX_ARGS]; /* constant arguments */
+    unsigned int     ver[SSA_MAX_ARGS];   /* versions of register arguments */
+    unsigned int     hash;
+    SymReg          *reg;                 /* register holding the result */
+    unsigned int     reg_ver;             /* its version */
+    int              next;                /* next expression in the bucket */
+} SSA_expr;
+
+/* an instruction which may be moved out of its loop */
+typedef struct SSA_hoist {
+    Instruction  *ins;
+    unsigned int  reg;                    /* register written */
+    int           loop;
+    int           ok;                     /* will be moved */
+    int           dep[SSA_MAX_ARGS];      /* invariants computing arguments */
+} SSA_hoist;
+
+typedef struct SSA_info {
+    IMC_Unit     *unit;
+    unsigned int  n_regs;
+    char         *tracked;   /* registers numbered */
+    char         *bad;       /* registers read where maybe not written */
+    unsigned int *n_writes;  /* instructions writing each register */
+    unsigned int *cur;       /* current version of each register */
+    int          *loop_of;   /* innermost loop of each block, or -1 */
+    Set          *fresh;     /* blocks where all registers get new versions */
+    Set         **phi;       /* registers getting new versions in each block */
+    unsigned int *buf;       /* registers written by an instruction */
+    unsigned int  buf_size;
+    SSA_version  *vers;
+    unsigned int  n_vers, vers_size;
+    unsigned int *log;       /* (register, previous version) pairs */
+    unsigned int  n_log, log_size;
+    SSA_expr     *exprs;
+    unsigned int  n_exprs, exprs_size;
+    int          *buckets;   /* hash table of exprs */
+    unsigned int  n_buckets;
+    SSA_hoist    *hoists;
+    unsigned int  n_hoists, hoists_size;
+    int           changed;
+} SSA_info;
+
 /* HEADERIZER HFILE: compilers/imcc/optimizer.h */
 
 /* HEADERIZER BEGIN: static */
@@ -152,6 +213,140 @@ static int if_branch(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
         FUNC_MODIFIES(*imcc)
         FUNC_MODIFIES(*unit);
 
+static void ssa_add_expr(
+    ARGMOD(imc_info_t *imcc),
+    ARGMOD(SSA_info *ssa),
+    ARGIN(const Instruction *ins),
+    unsigned int dest)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*ssa);
+
+static unsigned int ssa_expr_key(
+    ARGIN(const SSA_info *ssa),
+    ARGIN(const Instruction *ins),
+    ARGOUT(SSA_expr *e))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*e);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static SSA_expr * ssa_find_expr(
+    ARGMOD(imc_info_t *imcc),
+    ARGMOD(SSA_info *ssa),
+    ARGIN(const Instruction *ins))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*ssa);
+
+static void ssa_find_loops(ARGMOD(SSA_info *ssa))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*ssa);
+
+static void ssa_hoist_invariants(
+    ARGMOD(imc_info_t *imcc),
+    ARGMOD(SSA_info *ssa))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*ssa);
+
+PARROT_WARN_UNUSED_RESULT
+static int ssa_is_copy(ARGIN(const Instruction *ins))
+        __attribute__nonnull__(1);
+
+PARROT_WARN_UNUSED_RESULT
+static int ssa_is_pure(ARGIN(const Instruction *ins), int may_move)
+        __attribute__nonnull__(1);
+
+static int ssa_loop_invariant(
+    ARGMOD(imc_info_t *imcc),
+    ARGMOD(SSA_info *ssa),
+    ARGMOD(Instruction *ins),
+    unsigned int dest)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*ssa)
+        FUNC_MODIFIES(*ins);
+
+static unsigned int ssa_new_version(
+    ARGMOD(imc_info_t *imcc),
+    ARGMOD(SSA_info *ssa),
+    unsigned int k,
+    unsigned int block)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*ssa);
+
+static int ssa_optimize(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*unit);
+
+static void ssa_place_phis(ARGMOD(imc_info_t *imcc), ARGMOD(SSA_info *ssa))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*ssa);
+
+PARROT_WARN_UNUSED_RESULT
+static int ssa_reads_only(
+    ARGMOD(imc_info_t *imcc),
+    ARGIN(const Instruction *ins),
+    int i)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*imcc);
+
+PARROT_WARN_UNUSED_RESULT
+static int ssa_reg(ARGIN(const SSA_info *ssa), ARGIN(const SymReg *r))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void ssa_remove_dead(ARGMOD(imc_info_t *imcc), ARGMOD(SSA_info *ssa))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*ssa);
+
+static void ssa_rename_block(
+    ARGMOD(imc_info_t *imcc),
+    ARGMOD(SSA_info *ssa),
+    ARGMOD(Basic_block *bb))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*ssa)
+        FUNC_MODIFIES(*bb);
+
+static void ssa_undo(
+    ARGMOD(SSA_info *ssa),
+    unsigned int n_log,
+    unsigned int n_exprs)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*ssa);
+
+static unsigned int ssa_writes(
+    ARGMOD(imc_info_t *imcc),
+    ARGMOD(SSA_info *ssa),
+    ARGIN(const Instruction *ins))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*ssa);
+
 static int strength_reduce(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
@@ -199,6 +394,59 @@ static int used_once(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
 #define ASSERT_ARGS_if_branch __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_ssa_add_expr __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(ssa) \
+    , PARROT_ASSERT_ARG(ins))
+#define ASSERT_ARGS_ssa_expr_key __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ssa) \
+    , PARROT_ASSERT_ARG(ins) \
+    , PARROT_ASSERT_ARG(e))
+#define ASSERT_ARGS_ssa_find_expr __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(ssa) \
+    , PARROT_ASSERT_ARG(ins))
+#define ASSERT_ARGS_ssa_find_loops __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ssa))
+#define ASSERT_ARGS_ssa_hoist_invariants __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(ssa))
+#define ASSERT_ARGS_ssa_is_copy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ins))
+#define ASSERT_ARGS_ssa_is_pure __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ins))
+#define ASSERT_ARGS_ssa_loop_invariant __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(ssa) \
+    , PARROT_ASSERT_ARG(ins))
+#define ASSERT_ARGS_ssa_new_version __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(ssa))
+#define ASSERT_ARGS_ssa_optimize __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_ssa_place_phis __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(ssa))
+#define ASSERT_ARGS_ssa_reads_only __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(ins))
+#define ASSERT_ARGS_ssa_reg __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ssa) \
+    , PARROT_ASSERT_ARG(r))
+#define ASSERT_ARGS_ssa_remove_dead __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(ssa))
+#define ASSERT_ARGS_ssa_rename_block __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(ssa) \
+    , PARROT_ASSERT_ARG(bb))
+#define ASSERT_ARGS_ssa_undo __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ssa))
+#define ASSERT_ARGS_ssa_writes __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(ssa) \
+    , PARROT_ASSERT_ARG(ins))
 #define ASSERT_ARGS_strength_reduce __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
@@ -279,6 +527,8 @@ Runs after the CFG is built and handles constant propagation.
 
 used_once ... deletes assignments, when LHS is unused
 
+With C<-O3>, also runs the SSA passes of C<ssa_optimize>.
+
 =cut
 
 */
@@ -294,6 +544,8 @@ optimize(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
         if (used_once(imcc, unit))
             return 1;
     }
+    if (!any && (imcc->optimizer_level & OPT_SSA) && !unit->pasm_file)
+        any = ssa_optimize(imcc, unit);
     return any;
 }
 
@@ -725,6 +977,13 @@ constant_propagation(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
                                 &found);
                             if (found) {
                                 const Instruction * const prev = ins2->prev;
+                                if (prev && !tmp) {
+                                    /* a branch which is never taken */
+                                    IMCC_debug(imcc, DEBUG_OPT2, " deleted\n");
+                                    ins2 = delete_ins(unit, ins2);
+                                    any  = 1;
+                                    goto next_constant;
+                                }
                                 if (prev) {
                                     subst_ins(unit, ins2, tmp, 1);
                                     any = 1;
@@ -1612,6 +1871,1121 @@ used_once(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
 
 /*
 
+=item C<static int ssa_optimize(imc_info_t *imcc, IMC_Unit *unit)>
+
+Numbers the values of the registers as if the unit were in SSA form: each
+instruction writing a register gives it a new version, and so does each
+block in the iterated dominance frontier of the blocks writing it, where
+an SSA form would have a phi function. The unit itself stays in register
+form, so there is nothing to convert back.
+
+Walking the dominator tree with these versions, C<ssa_rename_block>
+propagates copies and eliminates common subexpressions. Then loop invariant
+instructions are moved to the loop preheaders, and pure instructions
+setting registers which are never read are removed.
+
+Only registers whose values the control flow graph follows are optimized:
+not lexicals, and not registers written in blocks reached from exception
+handlers or other labels whose address is taken.
+
+Returns TRUE if anything was changed.
+
+=cut
+
+*/
+
+static int
+ssa_optimize(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
+{
+    ASSERT_ARGS(ssa_optimize)
+    const unsigned int  n_blocks = unit->n_basic_blocks;
+    const unsigned int  n_regs   = unit->n_symbols;
+    SSA_info            ssa;
+    INTVAL             *colors;
+    unsigned int       *stack, *first_child, *next_child, *stack_log, *stack_exprs;
+    Set                *reached, *visited;
+    Instruction        *ins;
+    unsigned int        i, k, sp;
+    int                 changed;
+
+    if (!n_blocks || !n_regs)
+        return 0;
+
+    IMCC_info(imcc, 2, "\tssa_optimize\n");
+
+    memset(&ssa, 0, sizeof (SSA_info));
+    ssa.unit     = unit;
+    ssa.n_regs   = n_regs;
+    ssa.tracked  = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_regs, char);
+    ssa.bad      = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_regs, char);
+    ssa.n_writes = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_regs, unsigned int);
+    ssa.cur      = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_regs, unsigned int);
+    ssa.loop_of  = mem_gc_allocate_n_typed(imcc->interp, n_blocks, int);
+    ssa.fresh    = set_make(imcc, n_blocks);
+    ssa.phi      = mem_gc_allocate_n_typed(imcc->interp, n_blocks, Set *);
+
+    for (i = 0; i < n_blocks; i++)
+        ssa.phi[i] = set_make(imcc, n_regs);
+
+    ssa.n_buckets = 256;
+    while (ssa.n_buckets < 2 * n_regs)
+        ssa.n_buckets *= 2;
+
+    ssa.buckets = mem_gc_allocate_n_typed(imcc->interp, ssa.n_buckets, int);
+    for (i = 0; i < ssa.n_buckets; i++)
+        ssa.buckets[i] = -1;
+
+    /* registers are numbered by their position in the register list */
+    colors = mem_gc_allocate_n_typed(imcc->interp, n_regs, INTVAL);
+    for (k = 0; k < n_regs; k++) {
+        SymReg * const r = unit->reglist[k];
+
+        colors[k] = r->color;
+        r->color  = k;
+
+        if (strchr("INSP", r->set)
+        &&  (r->type & (VTREG | VTIDENTIFIER))
+        && !(r->type & VTPASM)
+        && !(r->usage & U_LEXICAL))
+            ssa.tracked[k] = 1;
+    }
+
+    /* values written where the CFG doesn't follow can't be numbered */
+    reached = set_make(imcc, n_blocks);
+    find_unfollowed_blocks(imcc, unit, ssa.fresh, reached);
+    set_add(ssa.fresh, 0);
+
+    for (ins = unit->instructions; ins; ins = ins->next) {
+        const unsigned int n = ssa_writes(imcc, &ssa, ins);
+
+        for (i = 0; i < n; i++) {
+            ssa.n_writes[ssa.buf[i]]++;
+
+            if (set_contains(reached, ins->bbindex))
+                ssa.tracked[ssa.buf[i]] = 0;
+        }
+    }
+
+    ssa_place_phis(imcc, &ssa);
+    ssa_find_loops(&ssa);
+
+    /* walk the dominator tree */
+    first_child = mem_gc_allocate_n_typed(imcc->interp, n_blocks, unsigned int);
+    next_child  = mem_gc_allocate_n_typed(imcc->interp, n_blocks, unsigned int);
+    stack       = mem_gc_allocate_n_typed(imcc->interp, n_blocks, unsigned int);
+    stack_log   = mem_gc_allocate_n_typed(imcc->interp, n_blocks, unsigned int);
+    stack_exprs = mem_gc_allocate_n_typed(imcc->interp, n_blocks, unsigned int);
+    visited     = set_make(imcc, n_blocks);
+
+    for (i = 0; i < n_blocks; i++)
+        first_child[i] = next_child[i] = n_blocks;
+
+    for (i = n_blocks - 1; i > 0; i--) {
+        const unsigned int parent = unit->idoms[i];
+        next_child[i]       = first_child[parent];
+        first_child[parent] = i;
+    }
+
+    for (k = 0; k < n_regs; k++)
+        ssa.cur[k] = ssa_new_version(imcc, &ssa, 0, 0);
+
+    sp             = 0;
+    stack[sp]      = 0;
+    stack_log[sp]  = ssa.n_log;
+    stack_exprs[sp] = ssa.n_exprs;
+    sp++;
+    set_add(visited, 0);
+    ssa_rename_block(imcc, &ssa, unit->bb_list[0]);
+
+    while (sp) {
+        const unsigned int b     = stack[sp - 1];
+        const unsigned int child = first_child[b];
+
+        if (child < n_blocks) {
+            first_child[b] = next_child[child];
+
+            if (!set_contains(visited, child)) {
+                set_add(visited, child);
+                stack[sp]       = child;
+                stack_log[sp]   = ssa.n_log;
+                stack_exprs[sp] = ssa.n_exprs;
+                sp++;
+                ssa_rename_block(imcc, &ssa, unit->bb_list[child]);
+            }
+        }
+        else {
+            sp--;
+            ssa_undo(&ssa, stack_log[sp], stack_exprs[sp]);
+        }
+    }
+
+    /* moving code needs to know all reads of the registers */
+    for (i = 0; i < n_blocks; i++) {
+        if (!set_contains(visited, i))
+            memset(ssa.bad, 1, n_regs);
+    }
+
+    ssa_hoist_invariants(imcc, &ssa);
+    ssa_remove_dead(imcc, &ssa);
+
+    changed = ssa.changed;
+
+    for (k = 0; k < n_regs; k++)
+        unit->reglist[k]->color = colors[k];
+
+    for (i = 0; i < n_blocks; i++)
+        set_free(ssa.phi[i]);
+
+    set_free(visited);
+    set_free(reached);
+    set_free(ssa.fresh);
+    mem_sys_free(ssa.phi);
+    mem_sys_free(stack_exprs);
+    mem_sys_free(stack_log);
+    mem_sys_free(stack);
+    mem_sys_free(next_child);
+    mem_sys_free(first_child);
+    mem_sys_free(colors);
+    mem_sys_free(ssa.loop_of);
+    mem_sys_free(ssa.buckets);
+    mem_sys_free(ssa.cur);
+    mem_sys_free(ssa.n_writes);
+    mem_sys_free(ssa.bad);
+    mem_sys_free(ssa.tracked);
+
+    if (ssa.buf)
+        mem_sys_free(ssa.buf);
+    if (ssa.vers)
+        mem_sys_free(ssa.vers);
+    if (ssa.log)
+        mem_sys_free(ssa.log);
+    if (ssa.exprs)
+        mem_sys_free(ssa.exprs);
+    if (ssa.hoists)
+        mem_sys_free(ssa.hoists);
+
+    return changed;
+}
+
+/*
+
+=item C<static int ssa_reg(const SSA_info *ssa, const SymReg *r)>
+
+Returns the number of C<r> if the SSA passes track it, otherwise -1.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+ssa_reg(ARGIN(const SSA_info *ssa), ARGIN(const SymReg *r))
+{
+    ASSERT_ARGS(ssa_reg)
+    const unsigned int k = (unsigned int)r->color;
+
+    if (!REG_NEEDS_ALLOC(r) || r->color < 0 || k >= ssa->n_regs
+    ||  ssa->unit->reglist[k] != r || !ssa->tracked[k])
+        return -1;
+
+    return (int)k;
+}
+
+/*
+
+=item C<static unsigned int ssa_writes(imc_info_t *imcc, SSA_info *ssa, const
+Instruction *ins)>
+
+Stores the numbers of the registers C<ins> writes in C<< ssa->buf >>, and
+returns how many there are. A sub call writes the registers of its
+C<get_results>.
+
+=cut
+
+*/
+
+static unsigned int
+ssa_writes(ARGMOD(imc_info_t *imcc), ARGMOD(SSA_info *ssa), ARGIN(const Instruction *ins))
+{
+    ASSERT_ARGS(ssa_writes)
+    op_lib_t * const   core_ops = PARROT_GET_CORE_OPLIB(imcc->interp);
+    const Instruction *results  = NULL;
+    unsigned int       n        = 0;
+    unsigned int       size     = ins->symreg_count;
+    int                i;
+
+    if (ins->type & ITPCCSUB) {
+        if (ins->next
+        &&  ins->next->op == &core_ops->op_info_table[PARROT_OP_get_results_pc])
+            results = ins->next;
+        else {
+            for (results = ins->prev; results; results = results->next)
+                if (results->op == &core_ops->op_info_table[PARROT_OP_get_results_pc])
+                    break;
+        }
+
+        if (results)
+            size += results->symreg_count;
+    }
+
+    if (size > ssa->buf_size) {
+        ssa->buf_size = size;
+        ssa->buf      = mem_gc_realloc_n_typed(imcc->interp, ssa->buf, size,
+                            unsigned int);
+    }
+
+    for (i = 0; i < ins->symreg_count; i++) {
+        const SymReg * const r = ins->symregs[i];
+        const unsigned int   k = (unsigned int)r->color;
+
+        if (REG_NEEDS_ALLOC(r) && r->color >= 0 && k < ssa->n_regs
+        &&  ssa->unit->reglist[k] == r && instruction_writes(ins, r))
+            ssa->buf[n++] = k;
+    }
+
+    if (results) {
+        for (i = 0; i < results->symreg_count; i++) {
+            const SymReg * const r = results->symregs[i];
+            const unsigned int   k = (unsigned int)r->color;
+
+            if (REG_NEEDS_ALLOC(r) && r->color >= 0 && k < ssa->n_regs
+            &&  ssa->unit->reglist[k] == r)
+                ssa->buf[n++] = k;
+        }
+    }
+
+    return n;
+}
+
+/*
+
+=item C<static unsigned int ssa_new_version(imc_info_t *imcc, SSA_info *ssa,
+unsigned int k, unsigned int block)>
+
+Gives register C<k> a new version defined in C<block>, remembering the old one
+so C<ssa_undo> can restore it, and returns the new version.
+
+=cut
+
+*/
+
+static unsigned int
+ssa_new_version(ARGMOD(imc_info_t *imcc), ARGMOD(SSA_info *ssa), unsigned int k,
+        unsigned int block)
+{
+    ASSERT_ARGS(ssa_new_version)
+    SSA_version *v;
+
+    if (ssa->n_vers == ssa->vers_size) {
+        ssa->vers_size = ssa->vers_size ? 2 * ssa->vers_size : 2 * ssa->n_regs;
+        ssa->vers      = mem_gc_realloc_n_typed(imcc->interp, ssa->vers,
+                            ssa->vers_size, SSA_version);
+    }
+
+    if (ssa->n_log + 2 > ssa->log_size) {
+        ssa->log_size = ssa->log_size ? 2 * ssa->log_size : 4 * ssa->n_regs;
+        ssa->log      = mem_gc_realloc_n_typed(imcc->interp, ssa->log,
+                            ssa->log_size, unsigned int);
+    }
+
+    ssa->log[ssa->n_log++] = k;
+    ssa->log[ssa->n_log++] = ssa->cur[k];
+
+    v           = ssa->vers + ssa->n_vers;
+    v->copy_of  = NULL;
+    v->copy_ver = 0;
+    v->block    = block;
+    v->hoist    = -1;
+    v->by_ins   = 0;
+
+    ssa->cur[k] = ssa->n_vers;
+
+    return ssa->n_vers++;
+}
+
+/*
+
+=item C<static void ssa_undo(SSA_info *ssa, unsigned int n_log, unsigned int
+n_exprs)>
+
+Restores the versions of the registers and the known expressions to what
+they were when the log had C<n_log> and the expressions C<n_exprs> entries.
+
+=cut
+
+*/
+
+static void
+ssa_undo(ARGMOD(SSA_info *ssa), unsigned int n_log, unsigned int n_exprs)
+{
+    ASSERT_ARGS(ssa_undo)
+
+    while (ssa->n_log > n_log) {
+        ssa->n_log -= 2;
+        ssa->cur[ssa->log[ssa->n_log]] = ssa->log[ssa->n_log + 1];
+    }
+
+    /* expressions are removed in reverse, so each is first in its bucket */
+    while (ssa->n_exprs > n_exprs) {
+        const SSA_expr * const e = ssa->exprs + --ssa->n_exprs;
+        ssa->buckets[e->hash & (ssa->n_buckets - 1)] = e->next;
+    }
+}
+
+/*
+
+=item C<static void ssa_place_phis(imc_info_t *imcc, SSA_info *ssa)>
+
+Finds the blocks where registers get a new version because different values
+of them meet, from the iterated dominance frontiers of the blocks writing
+them. All registers get a new version in the blocks which are entered from
+where the CFG doesn't know, and in their iterated dominance frontier.
+
+=cut
+
+*/
+
+static void
+ssa_place_phis(ARGMOD(imc_info_t *imcc), ARGMOD(SSA_info *ssa))
+{
+    ASSERT_ARGS(ssa_place_phis)
+    const IMC_Unit * const unit     = ssa->unit;
+    const unsigned int     n_blocks = unit->n_basic_blocks;
+    unsigned int          *df_start = mem_gc_allocate_n_typed(imcc->interp, n_blocks + 1,
+                                            unsigned int);
+    unsigned int          *df;
+    unsigned int          *todo     = mem_gc_allocate_n_typed(imcc->interp, n_blocks,
+                                            unsigned int);
+    unsigned int          *stamp    = mem_gc_allocate_n_zeroed_typed(imcc->interp,
+                                            n_blocks, unsigned int);
+    Set                  **def      = mem_gc_allocate_n_typed(imcc->interp, n_blocks, Set *);
+    const Instruction     *ins;
+    unsigned int           i, j, k, n_df = 0, n_todo;
+
+    /* the dominance frontiers as lists */
+    for (i = 0; i < n_blocks; i++)
+        for (j = 0; j < n_blocks; j++)
+            if (set_contains(unit->dominance_frontiers[i], j))
+                n_df++;
+
+    df   = mem_gc_allocate_n_typed(imcc->interp, n_df + 1, unsigned int);
+    n_df = 0;
+
+    for (i = 0; i < n_blocks; i++) {
+        df_start[i] = n_df;
+
+        for (j = 0; j < n_blocks; j++)
+            if (set_contains(unit->dominance_frontiers[i], j))
+                df[n_df++] = j;
+    }
+
+    df_start[n_blocks] = n_df;
+
+    for (i = 0; i < n_blocks; i++)
+        def[i] = set_make(imcc, ssa->n_regs);
+
+    for (ins = unit->instructions; ins; ins = ins->next) {
+        const unsigned int n = ssa_writes(imcc, ssa, ins);
+
+        for (i = 0; i < n; i++)
+            set_add(def[ins->bbindex], ssa->buf[i]);
+    }
+
+    /* all registers get new versions where the fresh ones meet others */
+    n_todo = 0;
+    for (i = 0; i < n_blocks; i++)
+        if (set_contains(ssa->fresh, i))
+            todo[n_todo++] = i;
+
+    while (n_todo) {
+        const unsigned int b = todo[--n_todo];
+
+        for (j = df_start[b]; j < df_start[b + 1]; j++) {
+            if (!set_contains(ssa->fresh, df[j])) {
+                set_add(ssa->fresh, df[j]);
+                todo[n_todo++] = df[j];
+            }
+        }
+    }
+
+    /* blocks in the worklist of register k are stamped with k + 1 */
+    for (k = 0; k < ssa->n_regs; k++) {
+        if (!ssa->tracked[k])
+            continue;
+
+        n_todo = 0;
+        for (i = 0; i < n_blocks; i++) {
+            if (set_contains(def[i], k)) {
+                stamp[i]       = k + 1;
+                todo[n_todo++] = i;
+            }
+        }
+
+        while (n_todo) {
+            const unsigned int b = todo[--n_todo];
+
+            for (j = df_start[b]; j < df_start[b + 1]; j++) {
+                const unsigned int y = df[j];
+
+                set_add(ssa->phi[y], k);
+
+                if (stamp[y] != k + 1) {
+                    stamp[y]       = k + 1;
+                    todo[n_todo++] = y;
+                }
+            }
+        }
+    }
+
+    for (i = 0; i < n_blocks; i++)
+        set_free(def[i]);
+
+    mem_sys_free(def);
+    mem_sys_free(stamp);
+    mem_sys_free(todo);
+    mem_sys_free(df_start);
+    mem_sys_free(df);
+}
+
+/*
+
+=item C<static void ssa_find_loops(SSA_info *ssa)>
+
+Finds the innermost loop of each block, if that loop has a preheader
+instructions can be moved to.
+
+=cut
+
+*/
+
+static void
+ssa_find_loops(ARGMOD(SSA_info *ssa))
+{
+    ASSERT_ARGS(ssa_find_loops)
+    const IMC_Unit * const unit = ssa->unit;
+    unsigned int           i;
+    int                    l;
+
+    for (i = 0; i < unit->n_basic_blocks; i++) {
+        ssa->loop_of[i] = -1;
+
+        for (l = 0; l < unit->n_loops; l++) {
+            const Loop_info * const li = unit->loop_info[l];
+
+            if (set_contains(li->loop, i)
+            &&  (ssa->loop_of[i] < 0
+            ||   li->size < unit->loop_info[ssa->loop_of[i]]->size))
+                ssa->loop_of[i] = l;
+        }
+    }
+
+    /* preheaders must end in a plain branch or fall into the header label */
+    for (i = 0; i < unit->n_basic_blocks; i++) {
+        const Loop_info   *li;
+        const Instruction *end;
+
+        if (ssa->loop_of[i] < 0)
+            continue;
+
+        li = unit->loop_info[ssa->loop_of[i]];
+
+        if (li->preheader >= unit->n_basic_blocks
+        ||  set_contains(li->loop, li->preheader)) {
+            ssa->loop_of[i] = -1;
+            continue;
+        }
+
+        end = unit->bb_list[li->preheader]->end;
+
+        if ((end->type & (ITPCCSUB | ITPCCYIELD | ITPCCRET))
+        ||  ((end->type & ITBRANCH) && ((end->flags >> 16) || !end->prev))
+        ||  (!(end->type & ITBRANCH)
+        &&   !(unit->bb_list[li->header]->start->type & ITLABEL)))
+            ssa->loop_of[i] = -1;
+    }
+}
+
+/*
+
+=item C<static int ssa_is_pure(const Instruction *ins, int may_move)>
+
+Returns TRUE if C<ins> only computes its first argument, an C<I>, C<N> or
+C<S> register, from the others, without side effects. If C<may_move> is
+set, it must not throw exceptions either, so it can run where it would not
+have before.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+ssa_is_pure(ARGIN(const Instruction *ins), int may_move)
+{
+    ASSERT_ARGS(ssa_is_pure)
+    PARROT_OBSERVER static const char * const pure_ops[] = {
+        "set", "null", "length",
+        "add", "sub", "mul", "neg", "abs",
+        "band", "bor", "bxor", "bnot", "shl", "shr", "lsr",
+        "not", "and", "or", "xor",
+        "iseq", "isne", "islt", "isle", "isgt", "isge", "cmp"
+    };
+    PARROT_OBSERVER static const char * const throwing_ops[] = {
+        "div", "fdiv", "mod", "cmod", "pow", "concat", "repeat"
+    };
+    size_t i;
+    int    found = 0, strings = 0;
+
+    if (!ins->op || ins->keys || ins->symreg_count < 1
+    ||  ins->symreg_count > SSA_MAX_ARGS
+    ||  (ins->type & (ITBRANCH | ITPCCSUB | ITPCCYIELD | ITPCCRET | ITLABEL)))
+        return 0;
+
+    for (i = 0; !found && i < N_ELEMENTS(pure_ops); i++)
+        found = STREQ(ins->opname, pure_ops[i]);
+
+    for (i = 0; !found && !may_move && i < N_ELEMENTS(throwing_ops); i++)
+        found = STREQ(ins->opname, throwing_ops[i]);
+
+    if (!found)
+        return 0;
+
+    /* the first argument is written only, the others are read only */
+    if ((ins->flags & (IF_r0_read | IF_r0_write)) != IF_r0_write)
+        return 0;
+
+    for (i = 0; i < (size_t)ins->symreg_count; i++) {
+        const SymReg * const r = ins->symregs[i];
+
+        if (!strchr("INS", r->set) || (r->type & VT_CONSTP))
+            return 0;
+
+        if (i && ((ins->flags & (1 << (16 + i))) || !(r->type & (VTCONST | VTREGISTER))))
+            return 0;
+
+        if (i && r->set == 'S')
+            strings = 1;
+    }
+
+    /* string comparisons may throw for incompatible encodings */
+    if (strings && may_move && !STREQ(ins->opname, "set")
+    &&  !STREQ(ins->opname, "length"))
+        return 0;
+
+    return 1;
+}
+
+/*
+
+=item C<static int ssa_is_copy(const Instruction *ins)>
+
+Returns TRUE if C<ins> copies a register to another one of the same kind.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+ssa_is_copy(ARGIN(const Instruction *ins))
+{
+    ASSERT_ARGS(ssa_is_copy)
+
+    return ins->op
+        && !ins->keys
+        && ins->symreg_count == 2
+        && STREQ(ins->opname, "set")
+        && (ins->flags & (IF_r0_read | IF_r0_write | IF_r1_write)) == IF_r0_write
+        && (ins->symregs[1]->type & VTREGISTER)
+        && !(ins->symregs[1]->type & VT_CONSTP)
+        && ins->symregs[0]->set == ins->symregs[1]->set;
+}
+
+/*
+
+=item C<static int ssa_reads_only(imc_info_t *imcc, const Instruction *ins, int
+i)>
+
+Returns TRUE if C<ins> reads but doesn't write its argument number C<i>, so
+another register with the same value may be used instead.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+ssa_reads_only(ARGMOD(imc_info_t *imcc), ARGIN(const Instruction *ins), int i)
+{
+    ASSERT_ARGS(ssa_reads_only)
+    op_lib_t * const core_ops = PARROT_GET_CORE_OPLIB(imcc->interp);
+
+    if (ins->op == &core_ops->op_info_table[PARROT_OP_set_args_pc]
+    ||  ins->op == &core_ops->op_info_table[PARROT_OP_set_returns_pc])
+        return 1;
+
+    if (ins->op == &core_ops->op_info_table[PARROT_OP_get_params_pc]
+    ||  ins->op == &core_ops->op_info_table[PARROT_OP_get_results_pc])
+        return 0;
+
+    return (ins->flags & (1 << i)) && !(ins->flags & (1 << (16 + i)));
+}
+
+/*
+
+=item C<static void ssa_rename_block(imc_info_t *imcc, SSA_info *ssa,
+Basic_block *bb)>
+
+Numbers the values of the registers in C<bb>, after its dominators. On the
+way, replaces registers read with the registers they were copied from, if
+those still hold the same value, and pure operations computed before in a
+dominating instruction with a copy of that result. Remembers loop
+invariant instructions.
+
+=cut
+
+*/
+
+static void
+ssa_rename_block(ARGMOD(imc_info_t *imcc), ARGMOD(SSA_info *ssa), ARGMOD(Basic_block *bb))
+{
+    ASSERT_ARGS(ssa_rename_block)
+    IMC_Unit * const unit = ssa->unit;
+    const int        all  = set_contains(ssa->fresh, bb->index);
+    Instruction     *ins, *next;
+    unsigned int     k;
+
+    for (k = 0; k < ssa->n_regs; k++) {
+        if (ssa->tracked[k] && (all || set_contains(ssa->phi[bb->index], k)))
+            ssa_new_version(imcc, ssa, k, bb->index);
+    }
+
+    for (ins = bb->start; ins; ins = next) {
+        const int    last     = ins == bb->end;
+        SSA_expr    *expr     = NULL;
+        int          copy_src = -1, dest = -1, hoist = -1;
+        unsigned int copy_ver = 0, n, i;
+
+        next = ins->next;
+
+        /* propagate copies into the arguments read */
+        for (i = 0; i < (unsigned int)ins->symreg_count; i++) {
+            const SymReg *r = ins->symregs[i];
+            const int     j = ssa_reg(ssa, r);
+
+            if (j >= 0 && ssa_reads_only(imcc, ins, i)) {
+                const SSA_version *v = ssa->vers + ssa->cur[j];
+                SymReg            *by = NULL;
+
+                while (v->copy_of && ssa->cur[v->copy_of->color] == v->copy_ver) {
+                    by = v->copy_of;
+                    v  = ssa->vers + v->copy_ver;
+                }
+
+                if (by && by != r) {
+                    IMCC_debug(imcc, DEBUG_OPT2, "propagating copy %s => %s in %s\n",
+                            r->name, by->name, ins->opname);
+                    ins->symregs[i] = by;
+                    ssa->changed    = 1;
+                    unit->ostat.copies_propagated++;
+                }
+            }
+        }
+
+        /* note registers read where no instruction defined them */
+        for (i = 0; i < (unsigned int)ins->symreg_count; i++) {
+            const SymReg * const r = ins->symregs[i];
+            const SymReg        *key;
+            int                  j = ssa_reg(ssa, r);
+
+            if (j >= 0 && instruction_reads(ins, r) && !ssa->vers[ssa->cur[j]].by_ins)
+                ssa->bad[j] = 1;
+
+            if (r->set == 'K')
+                for (key = r->nextkey; key; key = key->nextkey)
+                    if (key->reg && (j = ssa_reg(ssa, key->reg)) >= 0
+                    &&  !ssa->vers[ssa->cur[j]].by_ins)
+                        ssa->bad[j] = 1;
+        }
+
+        if (ssa_is_copy(ins)) {
+            copy_src = ssa_reg(ssa, ins->symregs[1]);
+            if (copy_src >= 0)
+                copy_ver = ssa->cur[copy_src];
+        }
+        else if (ssa_is_pure(ins, 0) && (dest = ssa_reg(ssa, ins->symregs[0])) >= 0) {
+            expr = ssa_find_expr(imcc, ssa, ins);
+
+            /* the result must still be where it was computed */
+            if (expr && (expr->reg == ins->symregs[0]
+            ||  ssa->cur[expr->reg->color] != expr->reg_ver))
+                expr = NULL;
+
+            if (!expr)
+                hoist = ssa_loop_invariant(imcc, ssa, ins, (unsigned int)dest);
+        }
+
+        n = ssa_writes(imcc, ssa, ins);
+        for (i = 0; i < n; i++) {
+            if (ssa->tracked[ssa->buf[i]]) {
+                const unsigned int v = ssa_new_version(imcc, ssa, ssa->buf[i], bb->index);
+                ssa->vers[v].by_ins = 1;
+            }
+        }
+
+        if (copy_src >= 0 && copy_src != ssa_reg(ssa, ins->symregs[0])
+        &&  ssa_reg(ssa, ins->symregs[0]) >= 0) {
+            SSA_version * const v = ssa->vers + ssa->cur[ins->symregs[0]->color];
+            v->copy_of  = ins->symregs[1];
+            v->copy_ver = copy_ver;
+        }
+        else if (expr) {
+            SSA_version * const v    = ssa->vers + ssa->cur[dest];
+            SymReg             *regs[2];
+            Instruction        *tmp;
+
+            regs[0] = ins->symregs[0];
+            regs[1] = expr->reg;
+            tmp     = INS(imcc, unit, "set", "", regs, 2, 0, 0);
+
+            IMCC_debug(imcc, DEBUG_OPT2, "common subexpression %s => %s\n",
+                    ins->opname, expr->reg->name);
+
+            tmp->bbindex = bb->index;
+            if (bb->start == ins)
+                bb->start = tmp;
+            if (bb->end == ins)
+                bb->end = tmp;
+
+            subst_ins(unit, ins, tmp, 1);
+
+            v->copy_of   = expr->reg;
+            v->copy_ver  = expr->reg_ver;
+            ssa->changed = 1;
+            unit->ostat.subexprs_eliminated++;
+        }
+        else if (dest >= 0) {
+            ssa_add_expr(imcc, ssa, ins, (unsigned int)dest);
+
+            if (hoist >= 0)
+                ssa->vers[ssa->cur[dest]].hoist = hoist;
+        }
+
+        if (last)
+            break;
+    }
+}
+
+/*
+
+=item C<static unsigned int ssa_expr_key(const SSA_info *ssa, const Instruction
+*ins, SSA_expr *e)>
+
+Fills in C<e> with the op and the current argument values of the pure
+instruction C<ins>, and returns its hash value.
+
+=cut
+
+*/
+
+static unsigned int
+ssa_expr_key(ARGIN(const SSA_info *ssa), ARGIN(const Instruction *ins), ARGOUT(SSA_expr *e))
+{
+    ASSERT_ARGS(ssa_expr_key)
+    unsigned int hash = (unsigned int)((size_t)ins->op >> 3);
+    int          i;
+
+    memset(e, 0, sizeof (SSA_expr));
+    e->op = ins->op;
+
+    for (i = 1; i < ins->symreg_count; i++) {
+        const SymReg * const r = ins->symregs[i];
+
+        if (r->type & VTCONST) {
+            e->konst[i] = r;
+            hash        = hash * 31 + (unsigned int)((size_t)r >> 3);
+        }
+        else {
+            e->ver[i] = ssa->cur[r->color];
+            hash      = hash * 31 + e->ver[i];
+        }
+    }
+
+    e->hash = hash;
+
+    return hash;
+}
+
+/*
+
+=item C<static SSA_expr * ssa_find_expr(imc_info_t *imcc, SSA_info *ssa, const
+Instruction *ins)>
+
+Returns the known expression computing the same as the pure instruction
+C<ins>, or NULL. Returns NULL too if an argument is a register the SSA passes
+don't track.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static SSA_expr *
+ssa_find_expr(ARGMOD(imc_info_t *imcc), ARGMOD(SSA_info *ssa), ARGIN(const Instruction *ins))
+{
+    ASSERT_ARGS(ssa_find_expr)
+    SSA_expr key;
+    int      i;
+
+    UNUSED(imcc);
+
+    for (i = 1; i < ins->symreg_count; i++) {
+        if (!(ins->symregs[i]->type & VTCONST) && ssa_reg(ssa, ins->symregs[i]) < 0)
+            return NULL;
+    }
+
+    for (i = ssa->buckets[ssa_expr_key(ssa, ins, &key) & (ssa->n_buckets - 1)];
+         i >= 0; i = ssa->exprs[i].next) {
+        SSA_expr * const e = ssa->exprs + i;
+
+        if (e->hash == key.hash && e->op == key.op
+        &&  !memcmp(e->konst, key.konst, sizeof (key.konst))
+        &&  !memcmp(e->ver, key.ver, sizeof (key.ver)))
+            return e;
+    }
+
+    return NULL;
+}
+
+/*
+
+=item C<static void ssa_add_expr(imc_info_t *imcc, SSA_info *ssa, const
+Instruction *ins, unsigned int dest)>
+
+Remembers that register C<dest> now holds the result of the pure instruction
+C<ins>, which has just given it a new version.
+
+=cut
+
+*/
+
+static void
+ssa_add_expr(ARGMOD(imc_info_t *imcc), ARGMOD(SSA_info *ssa), ARGIN(const Instruction *ins),
+        unsigned int dest)
+{
+    ASSERT_ARGS(ssa_add_expr)
+    SSA_expr    *e;
+    unsigned int b;
+    int          i, regs = 0;
+
+    /* the arguments must be known, and not the result itself */
+    for (i = 1; i < ins->symreg_count; i++) {
+        if (ins->symregs[i]->type & VTCONST)
+            continue;
+
+        if (ssa_reg(ssa, ins->symregs[i]) < 0 || ins->symregs[i] == ins->symregs[0])
+            return;
+
+        regs++;
+    }
+
+    /* loading constants is no dearer than a copy, and constant_propagation
+     * would only turn the copy back */
+    if (!regs)
+        return;
+
+    if (ssa->n_exprs == ssa->exprs_size) {
+        ssa->exprs_size = ssa->exprs_size ? 2 * ssa->exprs_size : 64;
+        ssa->exprs      = mem_gc_realloc_n_typed(imcc->interp, ssa->exprs,
+                            ssa->exprs_size, SSA_expr);
+    }
+
+    e = ssa->exprs + ssa->n_exprs;
+    ssa_expr_key(ssa, ins, e);
+    e->reg     = ins->symregs[0];
+    e->reg_ver = ssa->cur[dest];
+
+    b                = e->hash & (ssa->n_buckets - 1);
+    e->next          = ssa->buckets[b];
+    ssa->buckets[b]  = ssa->n_exprs++;
+}
+
+/*
+
+=item C<static int ssa_loop_invariant(imc_info_t *imcc, SSA_info *ssa,
+Instruction *ins, unsigned int dest)>
+
+If the pure instruction C<ins> computes the same in each iteration of its
+innermost loop, and is the only instruction writing register C<dest>,
+remembers it as a candidate for moving to the loop preheader, and returns
+its number. Otherwise returns -1.
+
+=cut
+
+*/
+
+static int
+ssa_loop_invariant(ARGMOD(imc_info_t *imcc), ARGMOD(SSA_info *ssa),
+        ARGMOD(Instruction *ins), unsigned int dest)
+{
+    ASSERT_ARGS(ssa_loop_invariant)
+    const int  loop = ssa->loop_of[ins->bbindex];
+    SSA_hoist *h;
+    int        dep[SSA_MAX_ARGS];
+    int        i;
+
+    if (loop < 0 || ssa->n_writes[dest] != 1 || !ssa_is_pure(ins, 1))
+        return -1;
+
+    for (i = 0; i < SSA_MAX_ARGS; i++)
+        dep[i] = -1;
+
+    for (i = 1; i < ins->symreg_count; i++) {
+        const SymReg      * const r = ins->symregs[i];
+        const SSA_version *v;
+        int                j;
+
+        if (r->type & VTCONST)
+            continue;
+
+        j = ssa_reg(ssa, r);
+        if (j < 0)
+            return -1;
+
+        v = ssa->vers + ssa->cur[j];
+
+        if (v->hoist >= 0 && ssa->hoists[v->hoist].loop == loop)
+            dep[i] = v->hoist;
+        else if (set_contains(ssa->unit->loop_info[loop]->loop, v->block))
+            return -1;
+    }
+
+    if (ssa->n_hoists == ssa->hoists_size) {
+        ssa->hoists_size = ssa->hoists_size ? 2 * ssa->hoists_size : 16;
+        ssa->hoists      = mem_gc_realloc_n_typed(imcc->interp, ssa->hoists,
+                                ssa->hoists_size, SSA_hoist);
+    }
+
+    h       = ssa->hoists + ssa->n_hoists;
+    h->ins  = ins;
+    h->reg  = dest;
+    h->loop = loop;
+    h->ok   = 0;
+    memcpy(h->dep, dep, sizeof (dep));
+
+    return (int)ssa->n_hoists++;
+}
+
+/*
+
+=item C<static void ssa_hoist_invariants(imc_info_t *imcc, SSA_info *ssa)>
+
+Moves the loop invariant instructions to the preheaders of their loops, if
+the registers they write are read only where the instruction dominates the
+read, and the instructions computing their arguments are moved as well.
+
+=cut
+
+*/
+
+static void
+ssa_hoist_invariants(ARGMOD(imc_info_t *imcc), ARGMOD(SSA_info *ssa))
+{
+    ASSERT_ARGS(ssa_hoist_invariants)
+    IMC_Unit * const unit = ssa->unit;
+    unsigned int     i;
+    int              j;
+
+    for (i = 0; i < ssa->n_hoists; i++) {
+        SSA_hoist       * const h   = ssa->hoists + i;
+        const Loop_info * const li  = unit->loop_info[h->loop];
+        Instruction     * const end = unit->bb_list[li->preheader]->end;
+        Instruction     *next;
+
+        h->ok = !ssa->bad[h->reg];
+        for (j = 0; h->ok && j < SSA_MAX_ARGS; j++)
+            if (h->dep[j] >= 0 && !ssa->hoists[h->dep[j]].ok)
+                h->ok = 0;
+
+        if (!h->ok)
+            continue;
+
+        IMCC_debug(imcc, DEBUG_OPT2, "moving invariant %s %s out of loop\n",
+                h->ins->opname, h->ins->symregs[0]->name);
+
+        /* keep them in order, and before a final branch to the header */
+        next = _delete_ins(unit, h->ins);
+        UNUSED(next);
+
+        if (end->type & ITBRANCH)
+            prepend_ins(unit, end, h->ins);
+        else
+            prepend_ins(unit, unit->bb_list[li->header]->start, h->ins);
+
+        ssa->changed = 1;
+        unit->ostat.invariants_moved++;
+    }
+}
+
+/*
+
+=item C<static void ssa_remove_dead(imc_info_t *imcc, SSA_info *ssa)>
+
+Removes copies and pure instructions which don't throw exceptions, if no
+instruction reads the register they write.
+
+=cut
+
+*/
+
+static void
+ssa_remove_dead(ARGMOD(imc_info_t *imcc), ARGMOD(SSA_info *ssa))
+{
+    ASSERT_ARGS(ssa_remove_dead)
+    IMC_Unit * const unit = ssa->unit;
+    char           *used  = mem_gc_allocate_n_zeroed_typed(imcc->interp, ssa->n_regs, char);
+    Instruction    *ins;
+
+    for (ins = unit->instructions; ins; ins = ins->next) {
+        const int dead_def = ssa_is_copy(ins) || ssa_is_pure(ins, 1);
+        int       i;
+
+        for (i = 0; i < ins->symreg_count; i++) {
+            const SymReg * const r = ins->symregs[i];
+            const SymReg        *key;
+            int                  j;
+
+            if ((j = ssa_reg(ssa, r)) >= 0 && !(dead_def && i == 0))
+                used[j] = 1;
+
+            if (r->set == 'K')
+                for (key = r->nextkey; key; key = key->nextkey)
+                    if (key->reg && (j = ssa_reg(ssa, key->reg)) >= 0)
+                        used[j] = 1;
+        }
+    }
+
+    for (ins = unit->instructions; ins;) {
+        int j;
+
+        if ((ssa_is_copy(ins) || ssa_is_pure(ins, 1))
+        &&  (j = ssa_reg(ssa, ins->symregs[0])) >= 0 && !used[j]) {
+            IMCC_debug(imcc, DEBUG_OPT2, "dead %s %s deleted\n",
+                    ins->opname, ins->symregs[0]->name);
+            ins          = delete_ins(unit, ins);
+            ssa->changed = 1;
+            unit->ostat.deleted_ins++;
+        }
+        else
+            ins = ins->next;
+    }
+
+    mem_sys_free(used);
+}
+
+/*
+
 =back
 
 =cut
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2002-2010, Parrot Foundation.
+ * Copyright (C) 2002-2012, Parrot Foundation.
  */
 
 #include "imc.h"
@@ -767,6 +767,10 @@ bytecode_map_op(ARGMOD(imc_info_t * imcc), op_info_t *info) {
     PackFile_ByteCode_OpMappingEntry *om;
     opcode_t i;
 
+    /* new ops go after the mapped ones, where the fused ops are */
+    if (bc->fused_table_ops)
+        Parrot_pf_unfuse_ops(imcc->interp, bc);
+
     for (i = 0; i < bc->op_mapping.n_libs; i++) {
         if (lib == bc->op_mapping.libs[i].lib) {
             om = &bc->op_mapping.libs[i];
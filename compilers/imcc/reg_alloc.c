@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2003-2011, Parrot Foundation.
+ * Copyright (C) 2003-2012, Parrot Foundation.
 */
 
 /*
@@ -12,14 +12,10 @@ compilers/imcc/reg_alloc.c
 
 Register allocator:
 
-This is a brute force register allocator. It uses a graph-coloring
-algorithm, but the implementation is very kludgy.
-
-It is a partial implementation of a Briggs-style register allocator
-The following parts are just missing:
-
- - Renumbering
- - Coalescing
+Without optimization, every virtual register gets a Parrot register of its
+own. With C<-O1> and above, a linear scan over the live ranges of the
+registers lets registers which are never live at the same time share a
+Parrot register, so subs need smaller register frames.
 
 =head2 Functions
 
@@ -32,6 +28,15 @@ The following parts are just missing:
 #include <string.h>
 #include "imc.h"
 #include "optimizer.h"
+#include "parrot/oplib/core_ops.h"
+
+/* The instructions a register is live in, by index; holes are filled in */
+typedef struct live_range_t {
+    SymReg       *reg;
+    unsigned int  start;
+    unsigned int  end;
+    unsigned int  index;    /* position of reg in the register list */
+} Live_range;
 
 /* HEADERIZER HFILE: compilers/imcc/imc.h */
 
@@ -65,6 +70,17 @@ static void compute_du_chain(ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
         FUNC_MODIFIES(*unit);
 
+static void compute_live_ranges(
+    ARGMOD(imc_info_t * imcc),
+    ARGMOD(IMC_Unit *unit),
+    ARGOUT(Live_range *ranges))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(* imcc)
+        FUNC_MODIFIES(*unit)
+        FUNC_MODIFIES(*ranges);
+
 static void compute_one_du_chain(ARGMOD(SymReg *r), ARGIN(IMC_Unit *unit))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
@@ -85,6 +101,19 @@ static void imc_stat_init(ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
         FUNC_MODIFIES(*unit);
 
+static void linear_scan_reg_alloc(
+    ARGMOD(imc_info_t * imcc),
+    ARGMOD(IMC_Unit *unit))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(* imcc)
+        FUNC_MODIFIES(*unit);
+
+PARROT_WARN_UNUSED_RESULT
+static int live_range_sort_f(ARGIN(const void *a), ARGIN(const void *b))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static void make_stat(
     ARGMOD(IMC_Unit *unit),
     ARGMOD_NULLOK(int *sets),
@@ -94,6 +123,32 @@ static void make_stat(
         FUNC_MODIFIES(*sets)
         FUNC_MODIFIES(*cols);
 
+static void note_ins_regs(
+    ARGIN(const IMC_Unit *unit),
+    ARGIN(const Instruction *ins),
+    ARGMOD(Set *use),
+    ARGMOD(Set *def))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*use)
+        FUNC_MODIFIES(*def);
+
+static void note_reg(
+    ARGIN(const IMC_Unit *unit),
+    ARGIN(const Instruction *ins),
+    ARGIN(const SymReg *r),
+    ARGMOD(Set *use),
+    ARGMOD(Set *def))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*use)
+        FUNC_MODIFIES(*def);
+
 static void print_stat(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
@@ -128,6 +183,10 @@ static void vanilla_reg_alloc(
     , PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_compute_du_chain __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_compute_live_ranges __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(ranges))
 #define ASSERT_ARGS_compute_one_du_chain __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(r) \
     , PARROT_ASSERT_ARG(unit))
@@ -136,8 +195,25 @@ static void vanilla_reg_alloc(
     , PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_imc_stat_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_linear_scan_reg_alloc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_live_range_sort_f __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
 #define ASSERT_ARGS_make_stat __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_note_ins_regs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(ins) \
+    , PARROT_ASSERT_ARG(use) \
+    , PARROT_ASSERT_ARG(def))
+#define ASSERT_ARGS_note_reg __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(ins) \
+    , PARROT_ASSERT_ARG(r) \
+    , PARROT_ASSERT_ARG(use) \
+    , PARROT_ASSERT_ARG(def))
 #define ASSERT_ARGS_print_stat __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
@@ -222,8 +298,10 @@ imc_reg_alloc(ARGMOD(imc_info_t * imcc), ARGIN_NULLOK(IMC_Unit *unit))
     if (imcc->debug & DEBUG_IMC)
         dump_symreg(unit);
 
-    /* TODO add option for a better allocator */
-    vanilla_reg_alloc(imcc, unit);
+    if ((imcc->optimizer_level & OPT_PRE) && !imcc->dont_optimize)
+        linear_scan_reg_alloc(imcc, unit);
+    else
+        vanilla_reg_alloc(imcc, unit);
 
     if (imcc->debug & DEBUG_IMC)
         dump_instructions(imcc, unit);
@@ -376,6 +454,8 @@ print_stat(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
               unit->ostat.used_once);
     IMCC_info(imcc, 1, "\t%d invariants_moved\n",
               unit->ostat.invariants_moved);
+    IMCC_info(imcc, 1, "\t%d copies propagated, %d subexpressions eliminated\n",
+              unit->ostat.copies_propagated, unit->ostat.subexprs_eliminated);
     IMCC_info(imcc, 1, "\tregisters needed:\t I%d, N%d, S%d, P%d\n",
             sets[0], sets[1], sets[2], sets[3]);
     IMCC_info(imcc, 1,
@@ -764,6 +844,338 @@ vanilla_reg_alloc(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
 
 /*
 
+=item C<static void linear_scan_reg_alloc(imc_info_t * imcc, IMC_Unit *unit)>
+
+Linear scan register allocator - gives each virtual register the lowest
+Parrot register which no virtual register with an overlapping live range has
+got yet, going through the registers by the start of their live ranges.
+
+=cut
+
+*/
+
+static void
+linear_scan_reg_alloc(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
+{
+    ASSERT_ARGS(linear_scan_reg_alloc)
+    const char          type[]    = "INSP";
+    const unsigned int  n_symbols = unit->n_symbols;
+    SymHash            *hsh       = &unit->hash;
+    Live_range         *ranges;
+    unsigned int       *color_end;
+    unsigned int        i, j;
+
+    /* Until they get their colors, the registers are numbered by their
+     * position in the register list */
+    for (i = 0; i < hsh->size; i++) {
+        SymReg *r;
+        for (r = hsh->data[i]; r; r = r->next) {
+            if (REG_NEEDS_ALLOC(r))
+                r->color = -1;
+        }
+    }
+
+    for (i = 0; i < n_symbols; i++)
+        unit->reglist[i]->color = i;
+
+    ranges = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_symbols + 1, Live_range);
+    compute_live_ranges(imcc, unit, ranges);
+
+    for (i = 0; i < n_symbols; i++)
+        unit->reglist[i]->color = -1;
+
+    qsort(ranges, n_symbols, sizeof (Live_range), live_range_sort_f);
+
+    /* One past the end of the live range which got each color last */
+    color_end = mem_gc_allocate_n_typed(imcc->interp, n_symbols + 1, unsigned int);
+
+    for (j = 0; j < 4; j++) {
+        int n_colors = 0;
+
+        memset(color_end, 0, (n_symbols + 1) * sizeof (unsigned int));
+
+        for (i = 0; i < n_symbols; i++) {
+            const Live_range * const lr = ranges + i;
+            unsigned int             color;
+
+            if (lr->reg->set != type[j])
+                continue;
+
+            for (color = 0; color_end[color] > lr->start; color++)
+                ;
+
+            color_end[color] = lr->end + 1;
+            lr->reg->color   = color;
+
+            if ((int)color >= n_colors)
+                n_colors = color + 1;
+
+            IMCC_debug(imcc, DEBUG_IMC, "live range %c '%s' %u-%u color %d\n",
+                    type[j], lr->reg->name, lr->start, lr->end, color);
+        }
+
+        /* Registers which no instruction uses just get the next one */
+        for (i = 0; i < hsh->size; i++) {
+            SymReg *r;
+            for (r = hsh->data[i]; r; r = r->next) {
+                if (r->set == type[j] && REG_NEEDS_ALLOC(r) && r->color == -1)
+                    r->color = n_colors++;
+            }
+        }
+
+        unit->first_avail[j] = n_colors;
+    }
+
+    mem_sys_free(color_end);
+    mem_sys_free(ranges);
+}
+
+/*
+
+=item C<static void compute_live_ranges(imc_info_t * imcc, IMC_Unit *unit,
+Live_range *ranges)>
+
+Computes which registers are live at the start and the end of each basic
+block, and from that the live range of each register in the register list.
+The registers must be numbered by their C<color>.
+
+Registers whose value the control flow graph can't follow are live for the
+whole compilation unit, so they get a Parrot register of their own. These are
+lexicals, registers which are read before they are written, and registers
+used in blocks reached from a label whose address is taken, like exception
+handlers, or from no other block at all.
+
+=cut
+
+*/
+
+static void
+compute_live_ranges(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit),
+        ARGOUT(Live_range *ranges))
+{
+    ASSERT_ARGS(compute_live_ranges)
+    const unsigned int  n_symbols = unit->n_symbols;
+    const unsigned int  n_blocks  = unit->n_basic_blocks;
+    Set               **use       = mem_gc_allocate_n_typed(imcc->interp, n_blocks, Set *);
+    Set               **def       = mem_gc_allocate_n_typed(imcc->interp, n_blocks, Set *);
+    Set               **live_in   = mem_gc_allocate_n_typed(imcc->interp, n_blocks, Set *);
+    Set               **live_out  = mem_gc_allocate_n_typed(imcc->interp, n_blocks, Set *);
+    Set                *own       = set_make(imcc, n_symbols);
+    Set                *tmp       = set_make(imcc, n_symbols);
+    Set                *roots     = set_make(imcc, n_blocks);
+    Set                *reached   = set_make(imcc, n_blocks);
+    const Instruction  *ins;
+    unsigned int        i, k, last = 0;
+    int                 changed;
+
+    for (i = 0; i < n_blocks; i++) {
+        use[i]      = set_make(imcc, n_symbols);
+        def[i]      = set_make(imcc, n_symbols);
+        live_in[i]  = set_make(imcc, n_symbols);
+        live_out[i] = set_make(imcc, n_symbols);
+    }
+
+    for (ins = unit->instructions; ins; ins = ins->next) {
+        note_ins_regs(unit, ins, use[ins->bbindex], def[ins->bbindex]);
+        last = ins->index;
+    }
+
+    /* live_in = use + (live_out - def), live_out = live_in of successors */
+    do {
+        changed = 0;
+
+        for (i = n_blocks; i-- > 0;) {
+            const Edge *e;
+
+            set_clear(live_out[i]);
+            for (e = unit->bb_list[i]->succ_list; e; e = e->succ_next)
+                set_union_inplace(live_out[i], live_in[e->to->index]);
+
+            set_clear(tmp);
+            set_union_inplace(tmp, live_out[i]);
+            set_minus_inplace(tmp, def[i]);
+            set_union_inplace(tmp, use[i]);
+
+            if (!set_equal(tmp, live_in[i])) {
+                Set * const old = live_in[i];
+                live_in[i]      = tmp;
+                tmp             = old;
+                changed         = 1;
+            }
+        }
+    } while (changed);
+
+    if (n_blocks)
+        set_union_inplace(own, live_in[0]);
+
+    /* Registers used where the CFG doesn't follow the flow get their own */
+    find_unfollowed_blocks(imcc, unit, roots, reached);
+
+    for (i = 0; i < n_blocks; i++) {
+        if (set_contains(reached, i)) {
+            set_union_inplace(own, live_in[i]);
+            set_union_inplace(own, use[i]);
+            set_union_inplace(own, def[i]);
+        }
+    }
+
+    for (k = 0; k < n_symbols; k++) {
+        Live_range   * const lr = ranges + k;
+        const SymReg * const r  = unit->reglist[k];
+
+        lr->reg   = unit->reglist[k];
+        lr->index = k;
+
+        if (!r->first_ins || (r->usage & U_LEXICAL) || set_contains(own, k)) {
+            lr->start = 0;
+            lr->end   = last;
+            continue;
+        }
+
+        lr->start = r->first_ins->index;
+        lr->end   = r->last_ins->index;
+
+        for (i = 0; i < n_blocks; i++) {
+            const Basic_block * const bb = unit->bb_list[i];
+
+            if (set_contains(live_in[i], k) && bb->start->index < lr->start)
+                lr->start = bb->start->index;
+
+            if (set_contains(live_out[i], k) && bb->end->index > lr->end)
+                lr->end = bb->end->index;
+        }
+    }
+
+    for (i = 0; i < n_blocks; i++) {
+        set_free(use[i]);
+        set_free(def[i]);
+        set_free(live_in[i]);
+        set_free(live_out[i]);
+    }
+
+    mem_sys_free(use);
+    mem_sys_free(def);
+    mem_sys_free(live_in);
+    mem_sys_free(live_out);
+    set_free(own);
+    set_free(tmp);
+    set_free(roots);
+    set_free(reached);
+}
+
+/*
+
+=item C<static void note_ins_regs(const IMC_Unit *unit, const Instruction *ins,
+Set *use, Set *def)>
+
+Adds the registers which C<ins> reads before they are written in its basic
+block to C<use>, and the registers it writes to C<def>.
+
+=cut
+
+*/
+
+static void
+note_ins_regs(ARGIN(const IMC_Unit *unit), ARGIN(const Instruction *ins),
+        ARGMOD(Set *use), ARGMOD(Set *def))
+{
+    ASSERT_ARGS(note_ins_regs)
+    op_lib_t * const   core_ops = PARROT_GET_CORE_OPLIB(NULL);
+    const Instruction *pcc;
+    int                i;
+
+    for (i = 0; i < ins->symreg_count; i++) {
+        const SymReg * const r = ins->symregs[i];
+
+        note_reg(unit, ins, r, use, def);
+
+        if (r->set == 'K') {
+            const SymReg *key;
+            for (key = r->nextkey; key; key = key->nextkey)
+                if (key->reg)
+                    note_reg(unit, ins, key->reg, use, def);
+        }
+    }
+
+    /* a sub call reads the previous args and writes the next results */
+    if (ins->type & ITPCCSUB) {
+        for (pcc = ins; pcc; pcc = pcc->prev)
+            if (pcc->op == &core_ops->op_info_table[PARROT_OP_set_args_pc])
+                break;
+
+        if (pcc)
+            for (i = 0; i < pcc->symreg_count; i++)
+                note_reg(unit, ins, pcc->symregs[i], use, def);
+
+        for (pcc = ins->prev; pcc; pcc = pcc->next)
+            if (pcc->op == &core_ops->op_info_table[PARROT_OP_get_results_pc])
+                break;
+
+        if (pcc)
+            for (i = 0; i < pcc->symreg_count; i++)
+                note_reg(unit, ins, pcc->symregs[i], use, def);
+    }
+}
+
+/*
+
+=item C<static void note_reg(const IMC_Unit *unit, const Instruction *ins, const
+SymReg *r, Set *use, Set *def)>
+
+Adds C<r> to C<use> if C<ins> reads it and it isn't in C<def> yet, and to
+C<def> if C<ins> writes it.
+
+=cut
+
+*/
+
+static void
+note_reg(ARGIN(const IMC_Unit *unit), ARGIN(const Instruction *ins),
+        ARGIN(const SymReg *r), ARGMOD(Set *use), ARGMOD(Set *def))
+{
+    ASSERT_ARGS(note_reg)
+    const unsigned int k = (unsigned int)r->color;
+
+    if (!REG_NEEDS_ALLOC(r) || r->color < 0
+    ||  k >= unit->n_symbols  || unit->reglist[k] != r)
+        return;
+
+    if (instruction_reads(ins, r) && !set_contains(def, k))
+        set_add(use, k);
+
+    if (instruction_writes(ins, r))
+        set_add(def, k);
+}
+
+/*
+
+=item C<static int live_range_sort_f(const void *a, const void *b)>
+
+sort live ranges by start, then by register list position
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+live_range_sort_f(ARGIN(const void *a), ARGIN(const void *b))
+{
+    ASSERT_ARGS(live_range_sort_f)
+    const Live_range * const ra = (const Live_range *)a;
+    const Live_range * const rb = (const Live_range *)b;
+
+    if (ra->start != rb->start)
+        return ra->start < rb->start ? -1 : 1;
+
+    if (ra->index != rb->index)
+        return ra->index < rb->index ? -1 : 1;
+
+    return 0;
+}
+
+/*
+
 =item C<static void allocate_lexicals(imc_info_t * imcc, IMC_Unit *unit)>
 
 Allocate registers for lexical variables. These must have unique registers
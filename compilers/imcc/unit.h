@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2003-2010, Parrot Foundation.
+ * Copyright (C) 2003-2012, Parrot Foundation.
  */
 
 #ifndef PARROT_IMCC_UNIT_H_GUARD
@@ -29,6 +29,8 @@ struct imcc_ostat {
     int invariants_moved;
     int deleted_ins;
     int used_once;
+    int copies_propagated;
+    int subexprs_eliminated;
 } ;
 
 struct IMC_Unit {
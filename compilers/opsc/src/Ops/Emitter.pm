@@ -147,7 +147,8 @@ method emit_opsenum_h_body($fh) {
 
     my $max_op_num := 0;
     for self.ops_file.ops -> $op {
-        if !self.ops_file<core> || !self.ops_file.oplib.op_skip_table.exists( $op.full_name ) {
+        if !self.ops_file<core>
+        || !self.ops_file.oplib.op_skip_table.exists( $op.full_name ) && !$op.fused {
             my $space := pir::repeat__SsI(' ', 30 - pir::length__Is($op.full_name));
             $fh.print("    enum_ops_" ~ $op.full_name ~ $space ~ "=");
             $space := pir::repeat__SsI(' ', 5 - pir::length__Is(~$max_op_num));
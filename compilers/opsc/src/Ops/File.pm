@@ -202,6 +202,8 @@ method new(*@files, :$oplib, :$core!, :$nolines, :$quiet? = 0) {
 
     for @files { self.read_ops( $_, $nolines ) }
 
+    self._fuse_ops() if $core;
+
     self._calculate_op_codes();
 
     self;
@@ -259,7 +261,7 @@ method compile_ops($str, :$experimental? = 0) {
 
     for @($past<ops>) {
         $_.experimental($experimental);
-        $_.deprecated($_.flags<deprecated> ?? 1 !! 0);
+        $_.deprecated($_<flags><deprecated> ?? 1 !! 0);
         self<ops>.push($_);
         #say($_.full_name ~ " is number " ~ self<op_order>);
         self<op_order>++;
@@ -285,6 +287,76 @@ method version_major() { self<version_major> }
 method version_minor() { self<version_minor> }
 method version_patch() { self<version_patch> }
 
+=begin
+
+=item C<_fuse_ops()>
+
+Appends a fused op for every sequence listed in the oplib's F<ops.fuse>.
+Fused ops come after all other ops, so they don't change the numbers of
+existing ops.  Every part but the last must fall through to the next op, so
+C<:flow> ops (which includes the variable-length calling convention ops) may
+only end a sequence.  Sequences using ops from files that were not read are
+skipped.
+
+=item C<_fused_op(@parts)>
+
+Creates the fused op running the ops C<@parts> one after the other.  It
+takes the arguments of the first op.
+
+=end
+
+method _fuse_ops() {
+    my %ops;
+    for self<ops> -> $op {
+        %ops{$op.full_name} := $op;
+    }
+
+    for self<oplib>.op_fuse_list -> @names {
+        die("Can't fuse '" ~ join(' ', |@names) ~ "': only 2 or 3 ops can be fused")
+            if +@names > 3;
+
+        my @parts;
+        for @names -> $name {
+            @parts.push(%ops{$name}) if %ops{$name};
+        }
+
+        # some of the ops live in files that were not read
+        self<ops>.push(self._fused_op(@parts)) if +@parts == +@names;
+    }
+}
+
+method _fused_op(@parts) {
+    my @names;
+    for @parts -> $op {
+        if $op<flags><flow> && +@names < +@parts - 1 {
+            die("Can't fuse '" ~ $op.full_name
+                ~ "': only the last op of a sequence may be :flow");
+        }
+        @names.push($op.full_name);
+    }
+
+    my $first := @parts[0];
+    my $fused := Ops::Op.new(
+        :name(join('__', |@names)),
+    );
+
+    $fused<flags>           := hash();
+    $fused<args>            := $first<args>;
+    $fused<type>            := $first<type>;
+    $fused<normalized_args> := $first<normalized_args>;
+    $fused<arg_types>       := $first<arg_types>;
+    $fused.fused(@parts);
+
+    # The jump flags describe the op's own arguments (disassemblers take
+    # the last ic argument of a relative jump for a label), so only the
+    # flags of the first op apply.
+    if $first.jump {
+        $fused.add_jump($_) for $first.jump;
+    }
+
+    $fused;
+}
+
 method _calculate_op_codes() {
 
     my $code := 0;
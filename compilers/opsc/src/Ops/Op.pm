@@ -124,6 +124,12 @@ Set or get "experimental" flag for Op.
 
 Set or get "deprecated" flag for Op.
 
+=item C<fused()>
+
+Set or get the list of ops a fused op (a superinstruction) runs one after
+another.  A fused op takes the arguments of its first op; the following ops
+read their own arguments, which stay in the bytecode after it.
+
 =end
 
 method code($code?) { self.attr('code', $code, defined($code)) }
@@ -138,6 +144,8 @@ method experimental($args?) { self.attr('experimental', $args, defined($args)) }
 
 method deprecated($args?) { self.attr('deprecated', $args, defined($args)) }
 
+method fused($ops?) { self.attr('fused', $ops, defined($ops)) }
+
 method need_write_barrier() {
     my $need := 0;
     # We need write barriers only for (in)out PMC|STR
@@ -164,6 +172,9 @@ method arg_type($arg_num) {
 }
 
 method full_name() {
+    # Fused ops are named after the full names of their parts.
+    return self.name if self.fused;
+
     my $name      := self.name;
     my @arg_types := self.arg_types;
 
@@ -281,7 +292,7 @@ C<$trans> (a subclass of C<Ops::Trans>).
 method source( $trans ) {
 
     my $prelude := $trans.body_prelude;
-    return $prelude ~ self.get_body( $trans );
+    return $prelude ~ (self.fused ?? self.get_fused_body( $trans ) !! self.get_body( $trans ));
 }
 
 =begin
@@ -297,17 +308,59 @@ method >> >>> to C<VTABLE_I<method>>.
 
 =end
 
-method get_body( $trans ) {
+method get_body( $trans, :$level? = 0 ) {
 
     my %context := hash(
         trans => $trans,
-        level => 0,
+        level => $level,
     );
 
     #work through the op_body tree
     self.join_children(self, %context);
 }
 
+=begin
+
+=item C<get_fused_body($trans)>
+
+Builds the body of a fused op from the bodies of its parts.  In all but the
+last part, C<goto NEXT()> steps C<cur_opcode> over the part and falls through
+to the body of the next part instead of dispatching.  Any other branch leaves
+the fused op as usual; since the following ops are still in the bytecode, the
+runloop simply continues with them.
+
+=end
+
+method get_fused_body( $trans ) {
+    my @parts := self.fused;
+    my $last  := +@parts - 1;
+    my $i     := 0;
+    my @res;
+
+    @res.push("\{\n");
+
+    for @parts -> $op {
+        if $i {
+            @res.push('  FUSED_' ~ self.code ~ '_' ~ $i ~ ":\n");
+        }
+
+        if $i < $last {
+            $trans.fuse_label('FUSED_' ~ self.code ~ '_' ~ ($i + 1), $op.size);
+        }
+        else {
+            $trans.fuse_label('', 0);
+        }
+
+        @res.push('    /* ' ~ $op.full_name ~ " */\n    ");
+        @res.push($op.get_body( $trans, :level(1) ));
+        @res.push("\n");
+        $i++;
+    }
+
+    @res.push('}');
+    @res.join('');
+}
+
 # Recursively process body chunks returning string.
 our multi method to_c(PAST::Val $val, %c) {
     $val.value;
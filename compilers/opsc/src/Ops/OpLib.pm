@@ -15,8 +15,8 @@ C<Ops::OpLib> - library of Parrot Operations.
 
 =begin DESCRIPTION
 
-Responsible for loading F<src/ops/ops.skip> files, parse F<.ops> files, sort
-them, etc.
+Responsible for loading F<src/ops/ops.skip> and F<src/ops/ops.fuse> files,
+parse F<.ops> files, sort them, etc.
 
 Heavily inspired by Perl5 Parrot::Ops2pm.
 
@@ -26,6 +26,7 @@ Heavily inspired by Perl5 Parrot::Ops2pm.
 
     my $oplib := Ops::OpLib.new(
         :skip_file('../../src/ops/ops.skip'),
+        :fuse_file('../../src/ops/ops.fuse'),
     ));
 
 =end SYNOPSIS
@@ -48,6 +49,16 @@ Reference to a 'seen-hash' of skipped opcodes.
 As F<src/ops/ops.skip> states, these are "... opcodes that should not ever to be
 generated or implemented because they are useless and/or silly."
 
+=item * C<@.op_fuse_list>
+
+List of op sequences, each a list of full op names, for which a fused op
+(a superinstruction) is generated.
+
+  'op_fuse_list' => [
+    [ 'set_i_ic', 'lt_i_ic_ic' ],
+    # ...
+  ],
+
 =back
 
 =end ATTRIBUTES
@@ -64,12 +75,14 @@ Build OpLib.
 
 =end METHODS
 
-method new(:$skip_file, :$quiet? = 0) {
+method new(:$skip_file, :$fuse_file, :$quiet? = 0) {
     self<skip_file>  := $skip_file // './src/ops/ops.skip';
+    self<fuse_file>  := $fuse_file // './src/ops/ops.fuse';
     self<quiet>      := $quiet;
 
     # Initialize self.
     self<op_skip_table> := hash();
+    self<op_fuse_list>  := list();
     self<ops_past>      := list();
     self<regen_ops_num> := 0;
 
@@ -82,12 +95,13 @@ method new(:$skip_file, :$quiet? = 0) {
 
 =item C<load_op_map_files>
 
-Load ops.skip.
+Load ops.skip and ops.fuse.
 
 =end METHODS
 
 method load_op_map_files() {
     self._load_skip_file;
+    self._load_fuse_file;
 }
 
 method _load_skip_file() {
@@ -111,6 +125,32 @@ method _load_skip_file() {
     }
 }
 
+method _load_fuse_file() {
+    my $buf     := slurp(self<fuse_file>);
+    grammar FUSE {
+        token TOP { <.ws> [ <seq> <.ws> ]* $ }
+
+        token seq { <name=.opname> [ <.sp> <name=.opname> ]+ }
+        token opname { \w+ }
+        token sp { \h+ }
+        token ws {
+            [
+            | \s+
+            | '#' \N*
+            ]*
+        }
+    }
+
+    my $lines := FUSE.parse($buf);
+    die("Can't parse " ~ self<fuse_file>) unless $lines;
+
+    for $lines<seq> {
+        my @names;
+        @names.push(~$_) for $_<name>;
+        self<op_fuse_list>.push(@names);
+    }
+}
+
 
 =begin ACCESSORS
 
@@ -120,9 +160,12 @@ Various methods for accessing internals.
 
 =item * C<op_skip_table>
 
+=item * C<op_fuse_list>
+
 =end ACCESSORS
 
 method op_skip_table()  { self<op_skip_table>; }
+method op_fuse_list()   { self<op_fuse_list>; }
 
 # Local Variables:
 #   mode: perl6
@@ -66,12 +66,45 @@ method prepare_ops($emitter, $ops_file) {
     self<op_protos>     := @op_protos;
     self<op_func_table> := @op_func_table;
     self<num_entries>   := +@op_funcs + 1;
+
+    self<cg_labels> := list();
+    self<cg_ops>    := list();
+
+    # The computed goto core and the superinstructions are only generated for
+    # the core oplib.
+    if $emitter.flags<core> {
+        self._prepare_cgoto_ops($emitter, $ops_file);
+        self<fuse_proto> := "\nPARROT_DATA const op_fuse_t "
+                          ~ self.op_fuse($emitter) ~ "[];\n";
+    }
+}
+
+method _prepare_cgoto_ops($emitter, $ops_file) {
+    my $cgoto := Ops::Trans::CGoto.new();
+    my $index := 0;
+    my @cg_labels;
+    my @cg_ops;
+
+    for $ops_file.ops -> $op {
+        @cg_labels.push(sprintf( "        %-20s /* %6ld */\n", "&&PC_$index,", $index ));
+        @cg_ops.push(join('', "PC_$index: /* ", $op.full_name, " */\n", $op.source( $cgoto ), "\n\n"));
+        $index++;
+    }
+
+    self<cg_labels> := @cg_labels;
+    self<cg_ops>    := @cg_ops;
+    self<cg_proto>  := "\n#ifdef PARROT_HAS_COMPUTED_GOTO\n"
+                     ~ "PARROT_CAN_RETURN_NULL\n"
+                     ~ "opcode_t * " ~ self.cg_core($emitter) ~ "(opcode_t *, PARROT_INTERP);\n"
+                     ~ "#endif\n";
 }
 
 method emit_c_op_funcs_header_part($fh) {
     for self<op_protos> -> $proto {
         $fh.print($proto);
     }
+    $fh.print(self<cg_proto>) if self<cg_proto>;
+    $fh.print(self<fuse_proto>) if self<fuse_proto>;
 }
 
 method access_arg($type, $num) {
@@ -90,7 +123,35 @@ method restart_offset($offset) {
 
 method goto_address($addr) { "return (opcode_t *)$addr"; }
 
-method goto_offset($offset) { "return cur_opcode + $offset"; }
+method goto_offset($offset) {
+    self.goto_fused_next($offset) || "return cur_opcode + $offset";
+}
+
+=begin
+
+=item C<fuse_label($label, $size)>
+
+Sets the label that C<goto NEXT()> jumps to while translating a part of a
+fused op of C<$size> words (see C<Ops::Op.get_fused_body>).  An empty
+C<$label> restores normal dispatch.
+
+=item C<goto_fused_next($offset)>
+
+Returns the jump to the next part of a fused op if C<$offset> is the
+C<NEXT()> of the part being translated, or an empty string otherwise.
+
+=end
+
+method fuse_label($label, $size) {
+    self<fuse_label> := $label;
+    self<fuse_size>  := ~$size;
+}
+
+method goto_fused_next($offset) {
+    self<fuse_label> && $offset eq self<fuse_size>
+        ?? 'do { cur_opcode += ' ~ $offset ~ '; goto ' ~ self<fuse_label> ~ '; } while (0)'
+        !! '';
+}
 
 method expr_address($addr) { $addr; }
 
@@ -117,7 +178,7 @@ method defines($emitter) {
 #define NCONST(i) Parrot_pcc_get_num_constants(interp, interp->ctx)[cur_opcode[i]]
 #define SCONST(i) Parrot_pcc_get_str_constants(interp, interp->ctx)[cur_opcode[i]]
 #undef  PCONST
-#define PCONST(i) Parrot_pcc_get_pmc_constants(interp, interp->ctx)[cur_opcode[i]]
+#define PCONST(i) Parrot_pcc_get_pmc_constant(interp, interp->ctx, cur_opcode[i])
 
 static int get_op(PARROT_INTERP, const char * name, int full);
 |;
@@ -126,6 +187,8 @@ static int get_op(PARROT_INTERP, const char * name, int full);
 method op_info($emitter) { $emitter.bs ~ 'op_info_table' }
 method op_func($emitter) { $emitter.bs ~ 'op_func_table' }
 method getop($emitter)   { 'get_op' };
+method cg_core($emitter) { $emitter.bs ~ 'cg_core' }
+method op_fuse($emitter) { $emitter.bs ~ 'op_fuse_table' }
 
 method body_prelude()    { '' }
 
@@ -133,6 +196,8 @@ method emit_source_part($emitter, $fh) {
     self._emit_op_func_table($emitter, $fh);
     self._emit_op_info_table($emitter, $fh);
     self._emit_op_function_definitions($emitter, $fh);
+    self._emit_cgoto_core($emitter, $fh) if +self<cg_ops>;
+    self._emit_op_fuse_table($emitter, $fh) if $emitter.flags<core>;
 }
 
 method _emit_op_func_table($emitter, $fh) {
@@ -246,6 +311,154 @@ method _emit_op_function_definitions($emitter, $fh) {
     }
 }
 
+=begin
+
+=item C<_emit_cgoto_core($emitter, $fh)>
+
+Emits the direct-threaded runcore: every op body becomes a label inside a
+single function, and ops dispatch to each other through the threaded code
+built for the current segment (see F<src/runcore/cores.c>).
+
+=end
+
+method _emit_cgoto_core($emitter, $fh) {
+    my $bs := $emitter.bs;
+
+    $fh.print(q|
+
+/*
+** Computed goto core:
+*/
+
+#ifdef PARROT_HAS_COMPUTED_GOTO
+
+/* defines - Ops::Trans::CGoto */
+#define CG_NEXT() goto *cg_threaded[cur_opcode - cg_base]
+#define CG_BRANCH() do { \
+        if (cg_seg->save_func_table) \
+            return cur_opcode; \
+        CG_NEXT(); \
+    } while (0)
+#define CG_JUMP() do { \
+        if (!cur_opcode) \
+            return NULL; \
+        if (cg_seg != interp->code) \
+            return cur_opcode; \
+        CG_BRANCH(); \
+    } while (0)
+
+/*
+ * Runs ops from the current code segment until an op halts, leaves the
+ * segment or event checking takes over the op function table; returns the
+ * pc to continue at.  Called with a NULL pc, returns the label table
+ * instead: one entry per op, followed by the decode and dynop labels.
+ */
+
+PARROT_CAN_RETURN_NULL
+opcode_t *
+| ~ self.cg_core($emitter) ~ q|(opcode_t *cur_opcode, PARROT_INTERP)
+{
+    static void *cg_labels[] = {
+|);
+
+    for self<cg_labels> {
+        $fh.print($_);
+    }
+
+    $fh.print(q|        &&cg_decode,
+        &&cg_dynop
+    };
+
+    union {
+        void     **labels;
+        opcode_t  *pc;
+    } cg_table;
+    PackFile_ByteCode *cg_seg;
+    void             **cg_threaded;
+    opcode_t          *cg_base;
+
+    /* Handed out through a union, as a cast would pun the label table */
+    if (cur_opcode == NULL) {
+        cg_table.labels = cg_labels;
+        return cg_table.pc;
+    }
+
+    cg_seg      = interp->code;
+    cg_threaded = cg_seg->threaded_code;
+    cg_base     = cg_seg->base.data;
+    CG_NEXT();
+
+  cg_decode:
+    {
+        /* first visit of this op: replace the threaded code entry with the
+         * label of the op, or with the dynop trampoline */
+        const op_info_t * const info = cg_seg->op_info_table[*cur_opcode];
+        void           ** const slot = cg_threaded + (cur_opcode - cg_base);
+
+        *slot = info->lib == &| ~ $bs ~ q|op_lib
+              ? cg_labels[OP_INFO_OPNUM(info)]
+              : &&cg_dynop;
+        goto **slot;
+    }
+
+  cg_dynop:
+    cur_opcode = (cg_seg->op_func_table[*cur_opcode])(cur_opcode, interp);
+    CG_JUMP();
+
+|);
+
+    for self<cg_ops> -> $op {
+        $fh.print($op);
+    }
+
+    $fh.print(q|}
+
+#undef CG_NEXT
+#undef CG_BRANCH
+#undef CG_JUMP
+
+#endif /* PARROT_HAS_COMPUTED_GOTO */
+
+|);
+}
+
+=begin
+
+=item C<_emit_op_fuse_table($emitter, $fh)>
+
+Emits the table of fused ops the bytecode loader uses to rewrite op
+sequences (see C<Parrot_pf_fuse_ops> in F<src/packfile/segments.c>).
+
+=end
+
+method _emit_op_fuse_table($emitter, $fh) {
+    $fh.print(q|
+
+/*
+** Superinstructions (see src/ops/ops.fuse):
+*/
+
+const op_fuse_t | ~ self.op_fuse($emitter) ~ q|[] = {
+|);
+
+    for $emitter.ops_file.ops -> $op {
+        if $op.fused {
+            my @parts := $op.fused;
+            my @codes;
+            for @parts { @codes.push($_.code) }
+            while +@codes < 3 { @codes.push(0) }
+
+            $fh.print(sprintf("  \{ %4d, %d, \{ %4d, %4d, %4d \} \}, /* %s */\n",
+                $op.code, +@parts, |@codes, $op.full_name));
+        }
+    }
+
+    $fh.print(q|  {    0, 0, {    0,    0,    0 } }
+};
+
+|);
+}
+
 method emit_op_lookup($emitter, $fh) {
 
     if !$emitter.flags<core> {
@@ -0,0 +1,36 @@
+#! nqp
+# Copyright (C) 2012, Parrot Foundation.
+
+class Ops::Trans::CGoto is Ops::Trans::C;
+
+=begin
+
+Transformation used for the bodies of the computed goto core.
+
+Every op body becomes a label inside one big C function (see
+C<Ops::Trans::C._emit_cgoto_core>).  Instead of returning the next
+C<cur_opcode> to the runloop, the op jumps directly to the label of the
+next op through the threaded code of the current segment.
+
+Branches with a constant offset (C<goto NEXT()>) dispatch without any
+checks.  Other relative branches check whether event checking has
+hijacked the op function table, and absolute jumps additionally leave
+the core when they halt or switch code segments.
+
+=end
+
+method suffix() { '' };
+
+method goto_address($addr) {
+    'do { cur_opcode = (opcode_t *)(' ~ $addr ~ '); CG_JUMP(); } while (0)';
+}
+
+method goto_offset($offset) {
+    my $next := self.goto_fused_next($offset);
+    return $next if $next;
+
+    my $dispatch := $offset ~~ /^\s*\d+\s*$/ ?? 'CG_NEXT()' !! 'CG_BRANCH()';
+    'do { cur_opcode += ' ~ $offset ~ '; ' ~ $dispatch ~ '; } while (0)';
+}
+
+# vim: expandtab shiftwidth=4 ft=perl6:
@@ -0,0 +1,67 @@
+# Copyright (C) 2001-2012, Parrot Foundation.
+
+=head1 NAME
+
+config/auto/cgoto.pm - Computed C<goto>
+
+=head1 DESCRIPTION
+
+Determines whether the compiler supports computed C<goto> (labels as
+values).  If it does, opsc emits the direct-threaded C<cgoto> runcore
+into F<src/ops/core_ops.c>.
+
+=cut
+
+package auto::cgoto;
+
+use strict;
+use warnings;
+
+use base qw(Parrot::Configure::Step);
+
+use Parrot::Configure::Utils ':auto';
+
+
+sub _init {
+    my $self = shift;
+    my %data;
+    $data{description} = q{Does your compiler support computed goto};
+    $data{result}      = q{};
+    return \%data;
+}
+
+sub runstep {
+    my ( $self, $conf ) = @_;
+
+    $conf->cc_gen('config/auto/cgoto/test_c.in');
+    eval { $conf->cc_build(); };
+    my $fail_message = $@;
+    if (! $fail_message) {
+        $fail_message = 'cannot run test' if $conf->cc_run() !~ /ok/;
+    }
+    $conf->cc_clean();
+    $self->_handle_cgoto($conf, $fail_message);
+
+    return 1;
+}
+
+sub _handle_cgoto {
+    my ($self, $conf, $fail_message) = @_;
+    if ($fail_message) {
+        $conf->data->set( HAS_COMPUTED_GOTO => 0 );
+        $self->set_result('no');
+    }
+    else {
+        $conf->data->set( HAS_COMPUTED_GOTO => 1 );
+        $self->set_result('yes');
+    }
+}
+
+1;
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -58,6 +58,7 @@ sub _set_implementations {
         error.c
         asm.s
         entropy.c
+        poller.c
         /;
     my @impl_files;
 
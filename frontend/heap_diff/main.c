@@ -0,0 +1,676 @@
+/*
+
+Copyright (C) 2012, Parrot Foundation.
+
+=head1 NAME
+
+heap_diff - compare two heap snapshots
+
+=head1 SYNOPSIS
+
+heap_diff [-s] old.json new.json
+
+=head1 DESCRIPTION
+
+C<heap_diff> reads two heap snapshots written by the C<heap_snapshot> method
+of C<ParrotInterpreter> and prints how many objects of each type, and how
+many bytes, were added or removed between them.  Types which grew the most
+come first; types which did not change are left out.
+
+The bytes of an object are its header, its PMC attributes and its string or
+buffer data.  Sizes are shallow: an object is charged for its own memory
+only, not for what it refers to.
+
+=head1 OPTIONS
+
+=over 4
+
+=item B<-?>, B<--help>
+
+Displays usage and help information.
+
+=item B<-s>, B<--sites>
+
+Group PMCs by the Sub and opcode offset which allocated them instead of by
+type.  The snapshots must have been taken with C<--gc-alloc-sites>.
+
+=back
+
+=head1 STATIC FUNCTIONS
+
+=over 4
+
+=cut
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parrot/parrot.h"
+#include "parrot/longopt.h"
+
+/* Longopts option table */
+static struct longopt_opt_decl options[] = {
+    { '?', '?', (OPTION_flags)0, { "--help"  } },
+    { 's', 's', (OPTION_flags)0, { "--sites" } },
+    {  0 ,  0,  (OPTION_flags)0, { NULL      } }
+};
+
+/* Objects of one type, or from one site, in both snapshots */
+typedef struct Heap_Group {
+    char          *name;
+    unsigned long  count[2];
+    unsigned long  bytes[2];
+} Heap_Group;
+
+/* Groups by name, open addressing */
+typedef struct Heap_Groups {
+    Heap_Group *groups;
+    size_t      size;
+    size_t      used;
+} Heap_Groups;
+
+/* Objects counted by site id while reading one snapshot, since the sites
+   come after the objects */
+typedef struct Site_Counts {
+    unsigned long *count;
+    unsigned long *bytes;
+    size_t         size;
+} Site_Counts;
+
+/* HEADERIZER HFILE: none */
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static void add_to_group(
+    ARGMOD(Heap_Groups *groups),
+    ARGIN(const char *name),
+    int which,
+    unsigned long count,
+    unsigned long bytes)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*groups);
+
+static int compare_groups(ARGIN(const void *a), ARGIN(const void *b))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void count_site(
+    ARGMOD(Site_Counts *counts),
+    unsigned long site,
+    unsigned long bytes)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*counts);
+
+static unsigned long field_number(
+    ARGIN(const char *line),
+    ARGIN(const char *field))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_CAN_RETURN_NULL
+static const char * find_field(
+    ARGIN(const char *line),
+    ARGIN(const char *field))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_CANNOT_RETURN_NULL
+static Heap_Group * find_group(
+    ARGIN(const Heap_Groups *groups),
+    ARGIN(const char *name))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void help(void);
+static void print_groups(
+    ARGMOD(Heap_Groups *groups),
+    ARGIN(const char *what))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*groups);
+
+static int read_line(
+    ARGMOD(FILE *in),
+    ARGMOD(char **line),
+    ARGMOD(size_t *size))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*in)
+        FUNC_MODIFIES(*line)
+        FUNC_MODIFIES(*size);
+
+static void read_snapshot(
+    ARGMOD(Heap_Groups *groups),
+    ARGIN(const char *file),
+    int which,
+    int sites)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*groups);
+
+static void read_string(
+    ARGIN_NULLOK(const char *value),
+    ARGOUT(char *buf),
+    size_t size)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*buf);
+
+#define ASSERT_ARGS_add_to_group __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(groups) \
+    , PARROT_ASSERT_ARG(name))
+#define ASSERT_ARGS_compare_groups __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_count_site __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(counts))
+#define ASSERT_ARGS_field_number __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(line) \
+    , PARROT_ASSERT_ARG(field))
+#define ASSERT_ARGS_find_field __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(line) \
+    , PARROT_ASSERT_ARG(field))
+#define ASSERT_ARGS_find_group __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(groups) \
+    , PARROT_ASSERT_ARG(name))
+#define ASSERT_ARGS_help __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_print_groups __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(groups) \
+    , PARROT_ASSERT_ARG(what))
+#define ASSERT_ARGS_read_line __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(in) \
+    , PARROT_ASSERT_ARG(line) \
+    , PARROT_ASSERT_ARG(size))
+#define ASSERT_ARGS_read_snapshot __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(groups) \
+    , PARROT_ASSERT_ARG(file))
+#define ASSERT_ARGS_read_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(buf))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<int main(int argc, const char *argv[])>
+
+Execution entry point. Reads both snapshots and prints the difference.
+
+=cut
+
+*/
+
+int
+main(int argc, const char *argv[])
+{
+    struct longopt_opt_info opt    = LONGOPT_OPT_INFO_INIT;
+    Heap_Groups             groups = { NULL, 0, 0 };
+    int                     sites  = 0;
+    int                     status;
+
+    while ((status = longopt_get(argc, argv, options, &opt)) > 0) {
+        switch (opt.opt_id) {
+          case 's':
+            sites = 1;
+            break;
+          case '?':
+          default:
+            help();
+            exit(EXIT_SUCCESS);
+        }
+    }
+
+    if (status == -1) {
+        help();
+        exit(EXIT_FAILURE);
+    }
+
+    argc -= opt.opt_index;
+    argv += opt.opt_index;
+
+    if (argc != 2) {
+        help();
+        exit(EXIT_FAILURE);
+    }
+
+    read_snapshot(&groups, argv[0], 0, sites);
+    read_snapshot(&groups, argv[1], 1, sites);
+    print_groups(&groups, sites ? "site" : "type");
+
+    return 0;
+}
+
+/*
+
+=item C<static void help(void)>
+
+Print out the user help info.
+
+=cut
+
+*/
+
+static void
+help(void)
+{
+    printf("heap_diff - compare two heap snapshots\n\n");
+    printf("Usage:\n");
+    printf("heap_diff [-s] old.json new.json\n\n");
+    printf("  -s --sites   group PMCs by allocation site\n");
+    printf("  -? --help    print this help\n");
+}
+
+/*
+
+=item C<static void read_snapshot(Heap_Groups *groups, const char *file, int
+which, int sites)>
+
+Add the objects in the snapshot C<file> to C<groups>, as the old snapshot if
+C<which> is 0 and as the new one if it is 1.  With C<sites> PMCs are grouped
+by allocation site, and strings and buffers are left out.
+
+=cut
+
+*/
+
+static void
+read_snapshot(ARGMOD(Heap_Groups *groups), ARGIN(const char *file), int which,
+        int sites)
+{
+    ASSERT_ARGS(read_snapshot)
+    FILE        * const in     = fopen(file, "r");
+    Site_Counts         counts = { NULL, NULL, 0 };
+    char               *line   = NULL;
+    size_t              size   = 0;
+    int                 seen_sites = 0;
+
+    if (!in) {
+        fprintf(stderr, "heap_diff: cannot open '%s'\n", file);
+        exit(EXIT_FAILURE);
+    }
+
+    while (read_line(in, &line, &size)) {
+        const char   *kind = find_field(line, "kind");
+        char          name[256];
+        unsigned long bytes;
+
+        /* A site: {"id":3,"sub":"main","pc":12} */
+        if (!kind) {
+            const char * const sub = find_field(line, "sub");
+            unsigned long      id;
+
+            if (!sub || !find_field(line, "id"))
+                continue;
+
+            seen_sites = 1;
+            id         = strtoul(find_field(line, "id"), NULL, 10);
+
+            if (id < counts.size && counts.count[id]) {
+                read_string(sub, name, sizeof (name) - 24);
+                if (!*name)
+                    strcpy(name, "(no sub)");
+                sprintf(name + strlen(name), "@%ld",
+                        strtol(find_field(line, "pc"), NULL, 10));
+                add_to_group(groups, name, which, counts.count[id], counts.bytes[id]);
+            }
+
+            continue;
+        }
+
+        bytes = field_number(line, "size") + field_number(line, "attr")
+              + field_number(line, "data");
+
+        if (!strncmp(kind, "\"pmc\"", 5)) {
+            if (sites) {
+                count_site(&counts, field_number(line, "site"), bytes);
+                continue;
+            }
+
+            read_string(find_field(line, "type"), name, sizeof (name));
+        }
+        else if (sites)
+            continue;
+        else if (!strncmp(kind, "\"string\"", 8))
+            strcpy(name, "(string)");
+        else if (!strncmp(kind, "\"buffer\"", 8))
+            strcpy(name, "(buffer)");
+        else
+            continue;
+
+        add_to_group(groups, name, which, 1, bytes);
+    }
+
+    if (sites && !seen_sites) {
+        fprintf(stderr, "heap_diff: no allocation sites in '%s',"
+                " run with --gc-alloc-sites\n", file);
+        exit(EXIT_FAILURE);
+    }
+
+    fclose(in);
+    free(line);
+    free(counts.count);
+    free(counts.bytes);
+}
+
+/*
+
+=item C<static int read_line(FILE *in, char **line, size_t *size)>
+
+Read the next line of C<in> into C<*line>, growing it as needed.  Returns 0
+at the end of the file.
+
+=cut
+
+*/
+
+static int
+read_line(ARGMOD(FILE *in), ARGMOD(char **line), ARGMOD(size_t *size))
+{
+    ASSERT_ARGS(read_line)
+    size_t len = 0;
+
+    if (!*line) {
+        *size = 4096;
+        *line = (char *)malloc(*size);
+    }
+
+    while (fgets(*line + len, (int)(*size - len), in)) {
+        len += strlen(*line + len);
+
+        if ((*line)[len - 1] == '\n')
+            return 1;
+
+        *size *= 2;
+        *line  = (char *)realloc(*line, *size);
+    }
+
+    return len > 0;
+}
+
+/*
+
+=item C<static const char * find_field(const char *line, const char *field)>
+
+Return the start of the value of C<field> in C<line>, or NULL.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static const char *
+find_field(ARGIN(const char *line), ARGIN(const char *field))
+{
+    ASSERT_ARGS(find_field)
+    const size_t len = strlen(field);
+    const char  *p   = line;
+
+    while ((p = strchr(p, '"')) != NULL) {
+        if (!strncmp(p + 1, field, len) && p[len + 1] == '"' && p[len + 2] == ':')
+            return p + len + 3;
+        ++p;
+    }
+
+    return NULL;
+}
+
+/*
+
+=item C<static unsigned long field_number(const char *line, const char *field)>
+
+Return the number in C<field> of C<line>, or 0 if there is none.
+
+=cut
+
+*/
+
+static unsigned long
+field_number(ARGIN(const char *line), ARGIN(const char *field))
+{
+    ASSERT_ARGS(field_number)
+    const char * const value = find_field(line, field);
+
+    return value ? strtoul(value, NULL, 10) : 0;
+}
+
+/*
+
+=item C<static void read_string(const char *value, char *buf, size_t size)>
+
+Copy the JSON string starting at C<value> into C<buf> without its quotes,
+undoing the escapes of the snapshot writer.  Long strings are cut.
+
+=cut
+
+*/
+
+static void
+read_string(ARGIN_NULLOK(const char *value), ARGOUT(char *buf), size_t size)
+{
+    ASSERT_ARGS(read_string)
+    size_t len = 0;
+
+    if (value && *value == '"') {
+        for (++value; *value && *value != '"' && len + 1 < size; ++value) {
+            if (*value == '\\' && value[1] == 'u') {
+                buf[len++] = (char)strtoul(value + 2, NULL, 16);
+                value     += 5;
+            }
+            else {
+                if (*value == '\\')
+                    ++value;
+                buf[len++] = *value;
+            }
+        }
+    }
+
+    buf[len] = '\0';
+}
+
+/*
+
+=item C<static void count_site(Site_Counts *counts, unsigned long site, unsigned
+long bytes)>
+
+Count a PMC of C<bytes> bytes allocated at C<site>.
+
+=cut
+
+*/
+
+static void
+count_site(ARGMOD(Site_Counts *counts), unsigned long site, unsigned long bytes)
+{
+    ASSERT_ARGS(count_site)
+
+    if (site >= counts->size) {
+        size_t new_size = counts->size ? counts->size : 256;
+
+        while (new_size <= site)
+            new_size *= 2;
+
+        counts->count = (unsigned long *)realloc(counts->count,
+                            new_size * sizeof (unsigned long));
+        counts->bytes = (unsigned long *)realloc(counts->bytes,
+                            new_size * sizeof (unsigned long));
+        memset(counts->count + counts->size, 0,
+                (new_size - counts->size) * sizeof (unsigned long));
+        memset(counts->bytes + counts->size, 0,
+                (new_size - counts->size) * sizeof (unsigned long));
+        counts->size = new_size;
+    }
+
+    ++counts->count[site];
+    counts->bytes[site] += bytes;
+}
+
+/*
+
+=item C<static void add_to_group(Heap_Groups *groups, const char *name, int
+which, unsigned long count, unsigned long bytes)>
+
+Add C<count> objects of C<bytes> bytes to the group C<name> of snapshot
+C<which>.
+
+=cut
+
+*/
+
+static void
+add_to_group(ARGMOD(Heap_Groups *groups), ARGIN(const char *name), int which,
+        unsigned long count, unsigned long bytes)
+{
+    ASSERT_ARGS(add_to_group)
+    Heap_Group *group;
+
+    /* Keep at least half of the slots empty */
+    if (2 * (groups->used + 1) > groups->size) {
+        const Heap_Groups old = *groups;
+        size_t            i;
+
+        groups->size   = old.size ? old.size * 2 : 256;
+        groups->groups = (Heap_Group *)calloc(groups->size, sizeof (Heap_Group));
+
+        for (i = 0; i < old.size; ++i)
+            if (old.groups[i].name)
+                *find_group(groups, old.groups[i].name) = old.groups[i];
+
+        free(old.groups);
+    }
+
+    group = find_group(groups, name);
+
+    if (!group->name) {
+        group->name = (char *)malloc(strlen(name) + 1);
+        strcpy(group->name, name);
+        ++groups->used;
+    }
+
+    group->count[which] += count;
+    group->bytes[which] += bytes;
+}
+
+/*
+
+=item C<static Heap_Group * find_group(const Heap_Groups *groups, const char
+*name)>
+
+Return the group called C<name>, or the empty slot where it belongs.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static Heap_Group *
+find_group(ARGIN(const Heap_Groups *groups), ARGIN(const char *name))
+{
+    ASSERT_ARGS(find_group)
+    const size_t        mask = groups->size - 1;
+    size_t              hash = 5381;
+    const char         *p;
+
+    for (p = name; *p; ++p)
+        hash = hash * 33 + (unsigned char)*p;
+
+    for (hash &= mask; groups->groups[hash].name; hash = (hash + 1) & mask)
+        if (!strcmp(groups->groups[hash].name, name))
+            break;
+
+    return &groups->groups[hash];
+}
+
+/*
+
+=item C<static int compare_groups(const void *a, const void *b)>
+
+Order groups by growth in bytes, largest first.
+
+=cut
+
+*/
+
+static int
+compare_groups(ARGIN(const void *a), ARGIN(const void *b))
+{
+    ASSERT_ARGS(compare_groups)
+    const Heap_Group * const ga = (const Heap_Group *)a;
+    const Heap_Group * const gb = (const Heap_Group *)b;
+    const long da = (long)ga->bytes[1] - (long)ga->bytes[0];
+    const long db = (long)gb->bytes[1] - (long)gb->bytes[0];
+
+    return da < db ? 1 : da > db ? -1 : strcmp(ga->name, gb->name);
+}
+
+/*
+
+=item C<static void print_groups(Heap_Groups *groups, const char *what)>
+
+Print the groups which changed, and the totals.  C<what> heads the column
+of group names.
+
+=cut
+
+*/
+
+static void
+print_groups(ARGMOD(Heap_Groups *groups), ARGIN(const char *what))
+{
+    ASSERT_ARGS(print_groups)
+    unsigned long count[2] = { 0, 0 };
+    unsigned long bytes[2] = { 0, 0 };
+    size_t        i, n = 0;
+
+    /* Pack the used slots to the front */
+    for (i = 0; i < groups->size; ++i) {
+        if (groups->groups[i].name) {
+            const Heap_Group * const g = &groups->groups[i];
+
+            count[0] += g->count[0];
+            count[1] += g->count[1];
+            bytes[0] += g->bytes[0];
+            bytes[1] += g->bytes[1];
+
+            if (g->count[0] != g->count[1] || g->bytes[0] != g->bytes[1])
+                groups->groups[n++] = *g;
+        }
+    }
+
+    qsort(groups->groups, n, sizeof (Heap_Group), compare_groups);
+
+    printf("%12s %12s %14s %14s  %s\n", "count", "delta", "bytes", "delta", what);
+
+    for (i = 0; i < n; ++i) {
+        const Heap_Group * const g = &groups->groups[i];
+
+        printf("%12lu %+12ld %14lu %+14ld  %s\n", g->count[1],
+                (long)g->count[1] - (long)g->count[0], g->bytes[1],
+                (long)g->bytes[1] - (long)g->bytes[0], g->name);
+    }
+
+    printf("%12lu %+12ld %14lu %+14ld  %s\n", count[1],
+            (long)count[1] - (long)count[0], bytes[1],
+            (long)bytes[1] - (long)bytes[0], "total");
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/gc/heap_snapshot.c>, F<src/pmc/parrotinterpreter.pmc>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
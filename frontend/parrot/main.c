@@ -36,6 +36,7 @@ struct init_args_t {
     Parrot_Int have_pasm_file;
     Parrot_Int turn_gc_off;
     Parrot_Int preprocess_only;
+    const char *optimize;
 };
 
 extern int Parrot_set_config_hash(Parrot_PMC interp_pmc);
@@ -254,6 +255,10 @@ run_imcc(Parrot_PMC interp, Parrot_String sourcefile, ARGIN(struct init_args_t *
     if (!(imcc_get_pir_compreg_api(interp, 1, &pir_compiler) &&
           imcc_get_pasm_compreg_api(interp, 1, &pasm_compiler)))
         show_last_error_and_exit(interp);
+    if (flags->optimize
+    && !(imcc_set_optimization_level_api(interp, pir_compiler, flags->optimize) &&
+         imcc_set_optimization_level_api(interp, pasm_compiler, flags->optimize)))
+        show_last_error_and_exit(interp);
     if (flags->preprocess_only) {
         Parrot_Int r = imcc_preprocess_file_api(interp, pir_compiler, sourcefile);
         exit(r ? EXIT_SUCCESS : EXIT_FAILURE);
@@ -514,7 +519,7 @@ help(void)
     "       --hash-seed F00F  specify hex value to use as hash seed\n"
     "    -X --dynext add path to dynamic extension search\n"
     "   <Run core options>\n"
-    "    -R --runcore slow|bounds|fast\n"
+    "    -R --runcore slow|bounds|fast|cgoto\n"
     "    -R --runcore trace|profiling|gcdebug\n"
     "    -t --trace [flags]\n"
     "   <VM options>\n"
@@ -529,6 +534,17 @@ help(void)
     "       --gc-min-threshold=KB\n"
     "       <GC GMS options>\n"
     "       --gc-nursery-size=percent of sysmem  size of gen0 (default 2)\n"
+    "       --gc-max-heap=KB                     collect old generations beyond\n"
+    "       --gc-pause-goal=ms                   longest nursery collection\n"
+    "       --gc-throughput-goal=percent         least run time outside GC\n"
+    "       <GC GMS and MS2 options>\n"
+    "       --gc-mark-threads=N                  helper threads for marking\n"
+    "       <GC MS and GMS options>\n"
+    "       --gc-lazy-sweep                      free dead PMCs on allocation\n"
+    "       <GC options>\n"
+    "       --gc-log=FILE                        write collections to FILE\n"
+    "       --gc-compact-limit=KB                most string data moved at once\n"
+    "       --gc-alloc-sites                     record where PMCs are allocated\n"
     "       --gc-debug\n"
     "       --leak-test|--destroy-at-end\n"
     "    -. --wait    Read a keystroke before starting\n"
@@ -582,6 +598,14 @@ Parrot_cmd_options(void)
         { '\0', OPT_GC_NURSERY_SIZE, OPTION_required_FLAG, { "--gc-nursery-size" } },
         { '\0', OPT_GC_DYNAMIC_THRESHOLD, OPTION_required_FLAG, { "--gc-dynamic-threshold" } },
         { '\0', OPT_GC_MIN_THRESHOLD, OPTION_required_FLAG, { "--gc-min-threshold" } },
+        { '\0', OPT_GC_MAX_HEAP, OPTION_required_FLAG, { "--gc-max-heap" } },
+        { '\0', OPT_GC_PAUSE_GOAL, OPTION_required_FLAG, { "--gc-pause-goal" } },
+        { '\0', OPT_GC_THROUGHPUT_GOAL, OPTION_required_FLAG, { "--gc-throughput-goal" } },
+        { '\0', OPT_GC_MARK_THREADS, OPTION_required_FLAG, { "--gc-mark-threads" } },
+        { '\0', OPT_GC_LAZY_SWEEP, (OPTION_flags)0, { "--gc-lazy-sweep" } },
+        { '\0', OPT_GC_LOG, OPTION_required_FLAG, { "--gc-log" } },
+        { '\0', OPT_GC_COMPACT_LIMIT, OPTION_required_FLAG, { "--gc-compact-limit" } },
+        { '\0', OPT_GC_ALLOC_SITES, (OPTION_flags)0, { "--gc-alloc-sites" } },
         { '\0', OPT_GC_DEBUG, (OPTION_flags)0, { "--gc-debug" } },
         { 'V', 'V', (OPTION_flags)0, { "--version" } },
         { 'X', 'X', OPTION_required_FLAG, { "--dynext" } },
@@ -696,6 +720,70 @@ parseflags_minimal(ARGMOD(Parrot_Init_Args * initargs), int argc, ARGIN(const ch
                 exit(EXIT_FAILURE);
             }
             break;
+          case OPT_GC_MAX_HEAP:
+            if (opt.opt_arg && is_all_digits(opt.opt_arg)) {
+                initargs->gc_max_heap = strtoul(opt.opt_arg, NULL, 10) * 1024;
+            }
+            else {
+                fprintf(stderr, "error: invalid GC max heap specified:"
+                        "'%s'\n", opt.opt_arg);
+                exit(EXIT_FAILURE);
+            }
+            break;
+          case OPT_GC_PAUSE_GOAL:
+            if (opt.opt_arg && is_float(opt.opt_arg)) {
+                initargs->gc_pause_goal = (float)strtod(opt.opt_arg, NULL);
+            }
+            else {
+                fprintf(stderr, "error: invalid GC pause goal specified:"
+                        "'%s'\n", opt.opt_arg);
+                exit(EXIT_FAILURE);
+            }
+            break;
+          case OPT_GC_THROUGHPUT_GOAL:
+            if (opt.opt_arg && is_float(opt.opt_arg)) {
+                initargs->gc_throughput_goal = (float)strtod(opt.opt_arg, NULL);
+
+                if (initargs->gc_throughput_goal >= 100) {
+                    fprintf(stderr, "error: GC throughput goal must be below 100%%\n");
+                    exit(EXIT_FAILURE);
+                }
+            }
+            else {
+                fprintf(stderr, "error: invalid GC throughput goal specified:"
+                        "'%s'\n", opt.opt_arg);
+                exit(EXIT_FAILURE);
+            }
+            break;
+          case OPT_GC_MARK_THREADS:
+            if (opt.opt_arg && is_all_digits(opt.opt_arg)) {
+                initargs->gc_mark_threads = strtol(opt.opt_arg, NULL, 10);
+            }
+            else {
+                fprintf(stderr, "error: invalid GC mark threads specified:"
+                        "'%s'\n", opt.opt_arg);
+                exit(EXIT_FAILURE);
+            }
+            break;
+          case OPT_GC_LAZY_SWEEP:
+            initargs->gc_lazy_sweep = 1;
+            break;
+          case OPT_GC_LOG:
+            initargs->gc_log = opt.opt_arg;
+            break;
+          case OPT_GC_COMPACT_LIMIT:
+            if (opt.opt_arg && is_all_digits(opt.opt_arg)) {
+                initargs->gc_compact_limit = strtoul(opt.opt_arg, NULL, 10) * 1024;
+            }
+            else {
+                fprintf(stderr, "error: invalid GC compact limit specified:"
+                        "'%s'\n", opt.opt_arg);
+                exit(EXIT_FAILURE);
+            }
+            break;
+          case OPT_GC_ALLOC_SITES:
+            initargs->gc_alloc_sites = 1;
+            break;
 
           case OPT_HASH_SEED:
             if (opt.opt_arg && is_all_hex_digits(opt.opt_arg)) {
@@ -746,6 +834,7 @@ parseflags(Parrot_PMC interp, int argc, ARGIN(const char *argv[]),
     args->outfile = NULL;
     args->sourcefile = NULL;
     args->preprocess_only = 0;
+    args->optimize = NULL;
 
     if (argc == 1) {
         usage(stderr);
@@ -761,11 +850,22 @@ parseflags(Parrot_PMC interp, int argc, ARGIN(const char *argv[]),
           case OPT_GC_NURSERY_SIZE:
           case OPT_GC_DYNAMIC_THRESHOLD:
           case OPT_GC_MIN_THRESHOLD:
+          case OPT_GC_MAX_HEAP:
+          case OPT_GC_PAUSE_GOAL:
+          case OPT_GC_THROUGHPUT_GOAL:
+          case OPT_GC_MARK_THREADS:
+          case OPT_GC_LAZY_SWEEP:
+          case OPT_GC_LOG:
+          case OPT_GC_COMPACT_LIMIT:
+          case OPT_GC_ALLOC_SITES:
             /* Handled in parseflags_minimal */
             break;
           case 'G':
             args->turn_gc_off = 1;
             break;
+          case 'O':
+            args->optimize = opt.opt_arg ? opt.opt_arg : "1";
+            break;
           case 't':
             if (opt.opt_arg && is_all_hex_digits(opt.opt_arg)) {
                 const unsigned long _temp = strtoul(opt.opt_arg, NULL, 16);
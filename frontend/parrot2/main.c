@@ -30,6 +30,7 @@ struct init_args_t {
     const char *run_core_name;
     Parrot_Int trace;
     Parrot_Int turn_gc_off;
+    const char *optimize;
     const char ** argv;
     int argc;
 };
@@ -87,7 +88,9 @@ static void print_parrot_string(
         FUNC_MODIFIES(*vector);
 
 PARROT_CANNOT_RETURN_NULL
-static void setup_imcc(Parrot_PMC interp);
+static void setup_imcc(
+    Parrot_PMC interp,
+    ARGIN_NULLOK(const char *optimize));
 
 static void show_last_error_and_exit(Parrot_PMC interp);
 static void usage(ARGMOD(FILE *fp))
@@ -160,7 +163,7 @@ main(int argc, const char *argv[])
         show_last_error_and_exit(interp);
 
     Parrot_api_toggle_gc(interp, 0);
-    setup_imcc(interp);
+    setup_imcc(interp, parsed_flags.optimize);
     if (!parsed_flags.turn_gc_off)
         Parrot_api_toggle_gc(interp, 1);
 
@@ -178,9 +181,10 @@ main(int argc, const char *argv[])
 
 /*
 
-=item C<static void setup_imcc(Parrot_PMC interp)>
+=item C<static void setup_imcc(Parrot_PMC interp, const char *optimize)>
 
-Call into IMCC to either compile or preprocess the input.
+Call into IMCC to either compile or preprocess the input. C<optimize> is the
+argument of the C<-O> option, if there was one.
 
 =cut
 
@@ -188,7 +192,7 @@ Call into IMCC to either compile or preprocess the input.
 
 PARROT_CANNOT_RETURN_NULL
 static void
-setup_imcc(Parrot_PMC interp)
+setup_imcc(Parrot_PMC interp, ARGIN_NULLOK(const char *optimize))
 {
     ASSERT_ARGS(setup_imcc)
     Parrot_PMC pir_compiler = NULL;
@@ -197,6 +201,11 @@ setup_imcc(Parrot_PMC interp)
     if (!(imcc_get_pir_compreg_api(interp, 1, &pir_compiler) &&
           imcc_get_pasm_compreg_api(interp, 1, &pasm_compiler)))
         show_last_error_and_exit(interp);
+
+    if (optimize
+    && !(imcc_set_optimization_level_api(interp, pir_compiler, optimize) &&
+         imcc_set_optimization_level_api(interp, pasm_compiler, optimize)))
+        show_last_error_and_exit(interp);
 }
 
 
@@ -346,7 +355,7 @@ usage(ARGMOD(FILE *fp))
     ASSERT_ARGS(usage)
     fprintf(fp,
             "parrot -[acEGhrtVwy.] [-D [FLAGS]]"
-            "[-R runcore] [-o FILE] <file>\n");
+            "[-O [level]] [-R runcore] [-o FILE] <file>\n");
 }
 
 /*
@@ -409,11 +418,20 @@ Parrot_cmd_options(void)
         { '\0', OPT_HASH_SEED, OPTION_required_FLAG, { "--hash-seed" } },
         { 'I', 'I', OPTION_required_FLAG, { "--include" } },
         { 'L', 'L', OPTION_required_FLAG, { "--library" } },
+        { 'O', 'O', OPTION_optional_FLAG, { "--optimize" } },
         { 'R', 'R', OPTION_required_FLAG, { "--runcore" } },
         { 'g', 'g', OPTION_required_FLAG, { "--gc" } },
         { '\0', OPT_GC_NURSERY_SIZE, OPTION_required_FLAG, { "--gc-nursery-size" } },
         { '\0', OPT_GC_DYNAMIC_THRESHOLD, OPTION_required_FLAG, { "--gc-dynamic-threshold" } },
         { '\0', OPT_GC_MIN_THRESHOLD, OPTION_required_FLAG, { "--gc-min-threshold" } },
+        { '\0', OPT_GC_MAX_HEAP, OPTION_required_FLAG, { "--gc-max-heap" } },
+        { '\0', OPT_GC_PAUSE_GOAL, OPTION_required_FLAG, { "--gc-pause-goal" } },
+        { '\0', OPT_GC_THROUGHPUT_GOAL, OPTION_required_FLAG, { "--gc-throughput-goal" } },
+        { '\0', OPT_GC_MARK_THREADS, OPTION_required_FLAG, { "--gc-mark-threads" } },
+        { '\0', OPT_GC_LAZY_SWEEP, (OPTION_flags)0, { "--gc-lazy-sweep" } },
+        { '\0', OPT_GC_LOG, OPTION_required_FLAG, { "--gc-log" } },
+        { '\0', OPT_GC_COMPACT_LIMIT, OPTION_required_FLAG, { "--gc-compact-limit" } },
+        { '\0', OPT_GC_ALLOC_SITES, (OPTION_flags)0, { "--gc-alloc-sites" } },
         { '\0', OPT_GC_DEBUG, (OPTION_flags)0, { "--gc-debug" } },
         { 'V', 'V', (OPTION_flags)0, { "--version" } },
         { 'X', 'X', OPTION_required_FLAG, { "--dynext" } },
@@ -498,6 +516,70 @@ parseflags_minimal(ARGMOD(Parrot_Init_Args * initargs), int argc, ARGIN(const ch
                 exit(EXIT_FAILURE);
             }
             break;
+          case OPT_GC_MAX_HEAP:
+            if (opt.opt_arg && is_all_digits(opt.opt_arg)) {
+                initargs->gc_max_heap = strtoul(opt.opt_arg, NULL, 10) * 1024;
+            }
+            else {
+                fprintf(stderr, "error: invalid GC max heap specified:"
+                        "'%s'\n", opt.opt_arg);
+                exit(EXIT_FAILURE);
+            }
+            break;
+          case OPT_GC_PAUSE_GOAL:
+            if (opt.opt_arg && is_float(opt.opt_arg)) {
+                initargs->gc_pause_goal = (float)strtod(opt.opt_arg, NULL);
+            }
+            else {
+                fprintf(stderr, "error: invalid GC pause goal specified:"
+                        "'%s'\n", opt.opt_arg);
+                exit(EXIT_FAILURE);
+            }
+            break;
+          case OPT_GC_THROUGHPUT_GOAL:
+            if (opt.opt_arg && is_float(opt.opt_arg)) {
+                initargs->gc_throughput_goal = (float)strtod(opt.opt_arg, NULL);
+
+                if (initargs->gc_throughput_goal >= 100) {
+                    fprintf(stderr, "error: GC throughput goal must be below 100%%\n");
+                    exit(EXIT_FAILURE);
+                }
+            }
+            else {
+                fprintf(stderr, "error: invalid GC throughput goal specified:"
+                        "'%s'\n", opt.opt_arg);
+                exit(EXIT_FAILURE);
+            }
+            break;
+          case OPT_GC_MARK_THREADS:
+            if (opt.opt_arg && is_all_digits(opt.opt_arg)) {
+                initargs->gc_mark_threads = strtol(opt.opt_arg, NULL, 10);
+            }
+            else {
+                fprintf(stderr, "error: invalid GC mark threads specified:"
+                        "'%s'\n", opt.opt_arg);
+                exit(EXIT_FAILURE);
+            }
+            break;
+          case OPT_GC_LAZY_SWEEP:
+            initargs->gc_lazy_sweep = 1;
+            break;
+          case OPT_GC_LOG:
+            initargs->gc_log = opt.opt_arg;
+            break;
+          case OPT_GC_COMPACT_LIMIT:
+            if (opt.opt_arg && is_all_digits(opt.opt_arg)) {
+                initargs->gc_compact_limit = strtoul(opt.opt_arg, NULL, 10) * 1024;
+            }
+            else {
+                fprintf(stderr, "error: invalid GC compact limit specified:"
+                        "'%s'\n", opt.opt_arg);
+                exit(EXIT_FAILURE);
+            }
+            break;
+          case OPT_GC_ALLOC_SITES:
+            initargs->gc_alloc_sites = 1;
+            break;
 
           case OPT_HASH_SEED:
             if (opt.opt_arg && is_all_hex_digits(opt.opt_arg)) {
@@ -552,6 +634,7 @@ parseflags(Parrot_PMC interp, int argc, ARGIN(const char *argv[]),
     args->run_core_name = "fast";
     args->trace = 0;
     args->turn_gc_off = 0;
+    args->optimize = NULL;
     pargs[nargs++] = argv[0];
 
     while ((status = longopt_get(argc, argv, Parrot_cmd_options(), &opt)) > 0) {
@@ -563,11 +646,22 @@ parseflags(Parrot_PMC interp, int argc, ARGIN(const char *argv[]),
           case OPT_GC_NURSERY_SIZE:
           case OPT_GC_DYNAMIC_THRESHOLD:
           case OPT_GC_MIN_THRESHOLD:
+          case OPT_GC_MAX_HEAP:
+          case OPT_GC_PAUSE_GOAL:
+          case OPT_GC_THROUGHPUT_GOAL:
+          case OPT_GC_MARK_THREADS:
+          case OPT_GC_LAZY_SWEEP:
+          case OPT_GC_LOG:
+          case OPT_GC_COMPACT_LIMIT:
+          case OPT_GC_ALLOC_SITES:
             /* Handled in parseflags_minimal */
             break;
           case 'G':
             args->turn_gc_off = 1;
             break;
+          case 'O':
+            args->optimize = opt.opt_arg ? opt.opt_arg : "1";
+            break;
           case 't':
             if (opt.opt_arg && is_all_hex_digits(opt.opt_arg)) {
                 const unsigned long _temp = strtoul(opt.opt_arg, NULL, 16);
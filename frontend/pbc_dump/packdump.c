@@ -65,7 +65,8 @@ static void pobj_flag_dump(PARROT_INTERP, long flags)
 =item C<void PackFile_ConstTable_dump(PARROT_INTERP, const PackFile_ConstTable
 *self)>
 
-Dumps the constant table C<self>.
+Dumps the constant table C<self>.  PMC constants still frozen in the image are
+thawed for it, which only fills in the table's cache of thawed constants.
 
 =cut
 
@@ -76,6 +77,8 @@ void
 PackFile_ConstTable_dump(PARROT_INTERP, ARGIN(const PackFile_ConstTable *self))
 {
     ASSERT_ARGS(PackFile_ConstTable_dump)
+    DECL_CONST_CAST;
+    PackFile_ConstTable * const ct = PARROT_const_cast(PackFile_ConstTable *, self);
     opcode_t i;
 
     for (i = 0; i < self->num.const_count; i++) {
@@ -90,7 +93,7 @@ PackFile_ConstTable_dump(PARROT_INTERP, ARGIN(const PackFile_ConstTable *self))
 
     for (i = 0; i < self->pmc.const_count; i++) {
         Parrot_io_printf(interp, "    # %x:\n", (long)i);
-        PackFile_Constant_dump_pmc(interp, self, self->pmc.constants[i]);
+        PackFile_Constant_dump_pmc(interp, self, PF_PMC_CONSTANT(interp, ct, i));
     }
 }
 
@@ -431,7 +431,7 @@ pbc_merge_constants(PARROT_INTERP, ARGMOD(pbc_merge_input **inputs),
         }
 
         for (j = 0; j < in_seg->pmc.const_count; j++) {
-            pmc_constants[pmc_cursor] = in_seg->pmc.constants[j];
+            pmc_constants[pmc_cursor] = PF_PMC_CONSTANT(interp, in_seg, j);
             inputs[i]->pmc.const_map[j] = pmc_cursor;
             pmc_cursor++;
         }
@@ -754,7 +754,7 @@ pbc_fixup_bytecode(PARROT_INTERP, ARGMOD(pbc_merge_input **inputs),
             op_func == core_ops->op_func_table[PARROT_OP_get_params_pc]  ||
             op_func == core_ops->op_func_table[PARROT_OP_set_returns_pc]) {
             /* Get the signature. */
-            PMC * const sig = bc->const_table->pmc.constants[op_ptr[1]];
+            PMC * const sig = PF_PMC_CONSTANT(interp, bc->const_table, op_ptr[1]);
 
             /* Loop over the arguments to locate any that need a fixup. */
             const int sig_items = VTABLE_elements(interp, sig);
@@ -806,7 +806,7 @@ pbc_fixup_constants(PARROT_INTERP, ARGMOD(pbc_merge_input **inputs), int num_inp
         PackFile_ConstTable * const in_seg = inputs[i]->pf->cur_cs->const_table;
 
         for (j = 0; j < in_seg->pmc.const_count; j++) {
-            PMC * const v = in_seg->pmc.constants[j];
+            PMC * const v = PF_PMC_CONSTANT(interp, in_seg, j);
 
             /* If it's a sub PMC, need to deal with offsets. */
             switch (v->vtable->base_type) {
@@ -77,6 +77,14 @@ typedef struct _Parrot_Init_Args {
     Parrot_Int gc_dynamic_threshold;
     Parrot_Int gc_min_threshold;
     Parrot_UInt hash_seed;
+    Parrot_Int gc_max_heap;
+    Parrot_Float4 gc_pause_goal;
+    Parrot_Float4 gc_throughput_goal;
+    Parrot_Int gc_mark_threads;
+    Parrot_Int gc_lazy_sweep;
+    const char *gc_log;
+    Parrot_Int gc_compact_limit;
+    Parrot_Int gc_alloc_sites;
 } Parrot_Init_Args;
 
 #define GET_INIT_STRUCT(i) do {\
@@ -25,6 +25,21 @@ typedef struct _meth_cache_entry {
     struct _meth_cache_entry *next;
 } Meth_cache_entry;
 
+/*
+ * inline cache of one callmethod op: the methods found for the last
+ * METH_IC_WAYS receiver types
+ */
+#define METH_IC_WAYS 4
+
+typedef struct _meth_inline_cache {
+    STRING  *name;                  /* method name looked up */
+    UINTVAL  epoch;                 /* Caches.epoch when filled */
+    UINTVAL  next;                  /* way to replace next */
+    VTABLE  *vtable[METH_IC_WAYS];  /* receiver vtable */
+    PMC     *_class[METH_IC_WAYS];  /* receiver class, for objects */
+    PMC     *pmc[METH_IC_WAYS];     /* the method sub pmc */
+} Meth_inline_cache;
+
 /*
  * method cache, continuation freelist, stack chunk freelist, regsave cache
  */
@@ -32,6 +47,7 @@ typedef struct _Caches {
     UINTVAL mc_size;            /* sizeof table */
     Meth_cache_entry ***idx;    /* bufstart idx */
     /* PMC **hash */            /* for non-constant keys */
+    UINTVAL epoch;              /* bumped when any method may have changed */
 } Caches;
 
 #endif   /* PARROT_CACHES_H_GUARD */
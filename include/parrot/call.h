@@ -354,8 +354,8 @@ void Parrot_pcc_split_signature_string(
     ||  OPCODE_IS((interp), (seg), *(pc), _core_ops, PARROT_OP_get_results_pc)    \
     ||  OPCODE_IS((interp), (seg), *(pc), _core_ops, PARROT_OP_get_params_pc)     \
     ||  OPCODE_IS((interp), (seg), *(pc), _core_ops, PARROT_OP_set_returns_pc)) { \
-        PMC * const sig = (seg)->const_table->pmc.constants[(pc)[1]]; \
-        (n) += VTABLE_elements((interp), sig); \
+        (n) += PackFile_ConstTable_signature_elements((interp), \
+                (seg)->const_table, (pc)[1]); \
     } \
 } while (0)
 
@@ -1,5 +1,5 @@
 /* hash.h
- *  Copyright (C) 2001-2010, Parrot Foundation.
+ *  Copyright (C) 2001-2012, Parrot Foundation.
  *  Overview:
  *     Hashtable implementation
  */
@@ -21,8 +21,11 @@ typedef enum {
 typedef UINTVAL BucketIndex;
 
 #define N_BUCKETS(n) ((n))
+
+/* the index has twice as many slots as there are buckets */
+#define N_SLOTS(n) ((n) * 2)
 #define HASH_ALLOC_SIZE(n) (N_BUCKETS(n) * sizeof (HashBucket) + \
-                                     (n) * sizeof (HashBucket *))
+                                     N_SLOTS(n) * sizeof (HashSlot))
 
 /* &gen_from_enum(hash_key_type.pasm) */
 typedef enum {
@@ -37,17 +40,28 @@ typedef enum {
 /* &end_gen */
 
 typedef struct _hashbucket {
-    struct _hashbucket *next;
     void *key;
-    void *value;
+    void *value;    /* the next free bucket while on the free list */
 } HashBucket;
 
+/* An index slot refers to a bucket by number, counting from 1, and caches the
+ * low bits of the key's hash so that probing rarely has to look at keys. */
+typedef struct _hashslot {
+    Parrot_UInt4 hashval;
+    Parrot_UInt4 bucket;
+} HashSlot;
+
+#define HASH_SLOT_EMPTY   0
+#define HASH_SLOT_DELETED ((Parrot_UInt4)-1)
+#define HASH_SLOT_USED(slot) \
+    ((slot).bucket != HASH_SLOT_EMPTY && (slot).bucket != HASH_SLOT_DELETED)
+
 struct _hash {
     /* Large slab store of buckets */
     HashBucket *buckets;
 
-    /* List of Bucket pointers */
-    HashBucket **index;
+    /* Open addressed index into the buckets, probed linearly */
+    HashSlot *index;
 
     /* Store for empty buckets */
     HashBucket *free_list;
@@ -55,6 +69,9 @@ struct _hash {
     /* Number of values stored in hashtable */
     UINTVAL entries;
 
+    /* Number of index slots left behind by deleted keys */
+    UINTVAL deleted;
+
     /* alloced - 1 */
     UINTVAL mask;
 
@@ -69,6 +86,15 @@ struct _hash {
 
 };
 
+/* Running state of the string hash, see Parrot_hash_buffer */
+typedef struct _hash_state {
+    UHUGEINTVAL v0, v1, v2, v3;
+
+    /* codepoints not yet hashed, one per byte */
+    UHUGEINTVAL tail;
+    unsigned int tail_len;
+} HashState;
+
 /* Utility macros - use them, do not reinvent the wheel */
 
 #define parrot_hash_iterate_linear(_hash, _code)                            \
@@ -84,17 +110,21 @@ do {                                                                        \
     }                                                                       \
 } while (0)
 
+/* Integer and pointer keys may be 0, so a bucket without a key is only free
+ * if it isn't the one holding that key.  Walking the buckets rather than the
+ * index keeps the order stable when the index is compacted or rebuilt. */
 #define parrot_hash_iterate_indexed(_hash, _code)                           \
 do {                                                                        \
-    if ((_hash)->entries) {                                                 \
-        UINTVAL _loc;                                                       \
-        for (_loc = 0; _loc <= (_hash)->mask; ++_loc) {                     \
-            HashBucket *_bucket = (_hash)->index[_loc];                     \
-            while (_bucket) {                                               \
-                _code                                                       \
-                _bucket = _bucket->next;                                    \
-            }                                                               \
+    const HashBucket * const _null_bucket =                                 \
+                            Parrot_hash_null_key_bucket(interp, (_hash));   \
+    HashBucket *_bucket = (_hash)->buckets;                                 \
+    UINTVAL     _found  = 0;                                                \
+    while (_found < (_hash)->entries){                                      \
+        if (_bucket->key || _bucket == _null_bucket){                       \
+            _code                                                           \
+            _found++;                                                       \
         }                                                                   \
+       _bucket++;                                                           \
     }                                                                       \
 } while (0)
 
@@ -140,6 +170,15 @@ Hash * Parrot_hash_create(PARROT_INTERP,
     Hash_key_type hkey_type)
         __attribute__nonnull__(1);
 
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+Hash * Parrot_hash_create_sized(PARROT_INTERP,
+    PARROT_DATA_TYPE val_type,
+    Hash_key_type hkey_type,
+    UINTVAL size)
+        __attribute__nonnull__(1);
+
 PARROT_EXPORT
 void Parrot_hash_delete(PARROT_INTERP,
     ARGMOD(Hash *hash),
@@ -212,6 +251,14 @@ PARROT_CANNOT_RETURN_NULL
 Hash * Parrot_hash_new_pointer_hash(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+HashBucket * Parrot_hash_null_key_bucket(PARROT_INTERP,
+    ARGIN(const Hash *hash))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_EXPORT
 PARROT_IGNORABLE_RESULT
 PARROT_CAN_RETURN_NULL
@@ -268,14 +315,6 @@ void Parrot_hash_clone_prunable(PARROT_INTERP,
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*dest);
 
-PARROT_CANNOT_RETURN_NULL
-PARROT_WARN_UNUSED_RESULT
-Hash * Parrot_hash_create_sized(PARROT_INTERP,
-    PARROT_DATA_TYPE val_type,
-    Hash_key_type hkey_type,
-    UINTVAL size)
-        __attribute__nonnull__(1);
-
 void Parrot_hash_flatten_hash_into(
      PARROT_INTERP,
     ARGIN(PMC * const dest),
@@ -342,6 +381,36 @@ size_t Parrot_hash_pointer(
     ARGIN_NULLOK(const void * const p),
     size_t hashval);
 
+PARROT_HOT
+void Parrot_hash_state_add_bytes(
+    ARGMOD(HashState *state),
+    ARGIN_NULLOK(const unsigned char *buf),
+    size_t len)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*state);
+
+PARROT_HOT
+void Parrot_hash_state_add_codepoint(ARGMOD(HashState *state), UINTVAL c)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*state);
+
+PARROT_HOT
+void Parrot_hash_state_add_ucs4(
+    ARGMOD(HashState *state),
+    ARGIN_NULLOK(const Parrot_Int4 *buf),
+    size_t len)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*state);
+
+PARROT_WARN_UNUSED_RESULT
+size_t Parrot_hash_state_finish(ARGMOD(HashState *state), size_t len)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*state);
+
+void Parrot_hash_state_init(ARGOUT(HashState *state), size_t seed)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*state);
+
 PARROT_CANNOT_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
 Hash * Parrot_hash_thaw(PARROT_INTERP, ARGMOD(PMC *info))
@@ -409,6 +478,8 @@ STRING* Parrot_hash_value_to_string(PARROT_INTERP,
     , PARROT_ASSERT_ARG(dest))
 #define ASSERT_ARGS_Parrot_hash_create __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_hash_create_sized __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_hash_delete __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(hash))
@@ -439,6 +510,9 @@ STRING* Parrot_hash_value_to_string(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_hash_new_pointer_hash __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_hash_null_key_bucket __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(hash))
 #define ASSERT_ARGS_Parrot_hash_put __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(hash))
@@ -461,8 +535,6 @@ STRING* Parrot_hash_value_to_string(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(hash) \
     , PARROT_ASSERT_ARG(dest))
-#define ASSERT_ARGS_Parrot_hash_create_sized __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_hash_flatten_hash_into __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(dest) \
     , PARROT_ASSERT_ARG(src))
@@ -492,6 +564,17 @@ STRING* Parrot_hash_value_to_string(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(hash))
 #define ASSERT_ARGS_Parrot_hash_pointer __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_Parrot_hash_state_add_bytes __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(state))
+#define ASSERT_ARGS_Parrot_hash_state_add_codepoint \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(state))
+#define ASSERT_ARGS_Parrot_hash_state_add_ucs4 __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(state))
+#define ASSERT_ARGS_Parrot_hash_state_finish __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(state))
+#define ASSERT_ARGS_Parrot_hash_state_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(state))
 #define ASSERT_ARGS_Parrot_hash_thaw __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(info))
@@ -57,6 +57,7 @@ typedef enum {
     PARROT_SLOW_CORE,                       /* slow bounds/trace core */
     PARROT_FUNCTION_CORE    = PARROT_SLOW_CORE,
     PARROT_FAST_CORE        = 0x01,         /* fast DO_OP core */
+    PARROT_CGOTO_CORE       = 0x02,         /* direct-threaded computed goto core */
     PARROT_EXEC_CORE        = 0x20,         /* TODO Parrot_exec_run variants */
     PARROT_GC_DEBUG_CORE    = 0x40,         /* run GC before each op */
     PARROT_DEBUGGER_CORE    = 0x80,         /* used by parrot debugger */
@@ -193,6 +194,8 @@ struct parrot_interp_t {
     size_t             resume_offset;
 
     PackFile_ByteCode  *code;                 /* The code we are executing */
+    struct PackFile_RetiredImage *retired_images; /* mapped PBC images of
+                                               * destroyed packfiles */
 
     Hash               *op_hash;              /* mapping from op names to op_info_t */
 
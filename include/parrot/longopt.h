@@ -49,6 +49,14 @@ struct longopt_opt_info {
 #define OPT_GC_DYNAMIC_THRESHOLD  134
 #define OPT_GC_MIN_THRESHOLD      135
 #define OPT_GC_NURSERY_SIZE       136
+#define OPT_GC_MAX_HEAP           137
+#define OPT_GC_PAUSE_GOAL         138
+#define OPT_GC_THROUGHPUT_GOAL    139
+#define OPT_GC_MARK_THREADS       140
+#define OPT_GC_LAZY_SWEEP         141
+#define OPT_GC_LOG                142
+#define OPT_GC_COMPACT_LIMIT      143
+#define OPT_GC_ALLOC_SITES        144
 
 /* HEADERIZER BEGIN: src/longopt.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
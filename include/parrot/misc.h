@@ -1,5 +1,5 @@
 /* misc.h
- *  Copyright (C) 2001-2011, Parrot Foundation.
+ *  Copyright (C) 2001-2012, Parrot Foundation.
  *  Overview:
  *     Miscellaneous functions, mainly the Parrot_sprintf family
  *  Data Structure and Algorithms:
@@ -90,6 +90,17 @@ PARROT_CONST_FUNCTION
 PARROT_WARN_UNUSED_RESULT
 INTVAL Parrot_util_intval_mod(INTVAL i2, INTVAL i3);
 
+void Parrot_util_mergesort(PARROT_INTERP,
+    ARGMOD(void **data),
+    UINTVAL n,
+    ARGIN(PMC *cmp),
+    ARGIN(const char * cmp_signature))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*data);
+
 void Parrot_util_quicksort(PARROT_INTERP,
     ARGMOD(void **data),
     UINTVAL n,
@@ -101,6 +112,28 @@ void Parrot_util_quicksort(PARROT_INTERP,
         __attribute__nonnull__(5)
         FUNC_MODIFIES(*data);
 
+void Parrot_util_sort_floatvals(PARROT_INTERP,
+    ARGMOD(FLOATVAL *data),
+    UINTVAL n,
+    ARGIN_NULLOK(PMC *cmp))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*data);
+
+void Parrot_util_sort_intvals(PARROT_INTERP,
+    ARGMOD(INTVAL *data),
+    UINTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*data);
+
+void Parrot_util_sort_strings(PARROT_INTERP,
+    ARGMOD(STRING **data),
+    UINTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*data);
+
 #define ASSERT_ARGS_Parrot_util_byte_index __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(base) \
     , PARROT_ASSERT_ARG(search))
@@ -117,11 +150,25 @@ void Parrot_util_quicksort(PARROT_INTERP,
 #define ASSERT_ARGS_Parrot_util_uint_rand __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_Parrot_util_floatval_mod __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_Parrot_util_intval_mod __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_Parrot_util_mergesort __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(data) \
+    , PARROT_ASSERT_ARG(cmp) \
+    , PARROT_ASSERT_ARG(cmp_signature))
 #define ASSERT_ARGS_Parrot_util_quicksort __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(data) \
     , PARROT_ASSERT_ARG(cmp) \
     , PARROT_ASSERT_ARG(cmp_signature))
+#define ASSERT_ARGS_Parrot_util_sort_floatvals __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(data))
+#define ASSERT_ARGS_Parrot_util_sort_intvals __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(data))
+#define ASSERT_ARGS_Parrot_util_sort_strings __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(data))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/utils.c */
 
@@ -82,6 +82,22 @@ typedef struct op_info_t {
 #define OPCODE_IS(interp, seg, opnum, lib, oplibnum) \
     ((seg)->op_func_table[(opnum)] == (lib)->op_func_table[(oplibnum)])
 
+/*
+** op_fuse_t
+**
+** Describes a fused op (a superinstruction): an op of the same library that
+** runs the ops in ops[] one after another.  A table of these ends with an
+** entry whose n_ops is 0.
+*/
+
+#define PARROT_MAX_FUSED_OPS 3
+
+typedef struct op_fuse_t {
+    opcode_t fused;
+    opcode_t n_ops;
+    opcode_t ops[PARROT_MAX_FUSED_OPS];
+} op_fuse_t;
+
 #endif /* PARROT_OP_H_GUARD */
 
 /*
@@ -1146,6 +1146,19 @@ op_lib_t *Parrot_DynOp_core_4_8_0(PARROT_INTERP, long init);
  opcode_t * Parrot_wait_p(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_wait_pc(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_pass(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_set_i_ic__lt_i_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_inc_i__lt_i_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_inc_i__lt_i_i_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_i_i_i__lt_i_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_sub_i_i_i__if_i_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_dec_i__if_i_ic(opcode_t *, PARROT_INTERP);
+
+#ifdef PARROT_HAS_COMPUTED_GOTO
+PARROT_CAN_RETURN_NULL
+opcode_t * core_cg_core(opcode_t *, PARROT_INTERP);
+#endif
+
+PARROT_DATA const op_fuse_t core_op_fuse_table[];
 
 
 #endif /* PARROT_OPLIB_CORE_OPS_H_GUARD */
@@ -1139,7 +1139,13 @@ typedef enum {
     PARROT_OP_receive_p,                       /* 1121 */
     PARROT_OP_wait_p,                          /* 1122 */
     PARROT_OP_wait_pc,                         /* 1123 */
-    PARROT_OP_pass                             /* 1124 */
+    PARROT_OP_pass,                            /* 1124 */
+    PARROT_OP_set_i_ic__lt_i_ic_ic,            /* 1125 */
+    PARROT_OP_inc_i__lt_i_ic_ic,               /* 1126 */
+    PARROT_OP_inc_i__lt_i_i_ic,                /* 1127 */
+    PARROT_OP_add_i_i_i__lt_i_ic_ic,           /* 1128 */
+    PARROT_OP_sub_i_i_i__if_i_ic,              /* 1129 */
+    PARROT_OP_dec_i__if_i_ic                   /* 1130 */
 
 } parrot_opcode_enums;
 
@@ -44,11 +44,13 @@
 **   parrot, pbc_merge, parrot_debugger use 0
 **   pbc_dump, pbc_disassemble use 1 to skip the version check
 **   pbc_dump -h requires 2
+**   files read from disk add 8, as their image outlives the packfile
 */
 #define PFOPT_NONE            0
 #define PFOPT_UTILS           1
 #define PFOPT_HEADERONLY      2
 #define PFOPT_PMC_FREEZE_ONLY 4
+#define PFOPT_LAZY_CONSTANTS  8
 
 /*
 ** Enumerated constants
@@ -186,6 +188,7 @@ typedef struct PackFile_ConstTable {
     struct {
         opcode_t        const_count;
         PMC           **constants;
+        const opcode_t **frozen;    /* images of constants thawed on first use */
     } pmc;
     PackFile_ByteCode     *code;        /* where this segment belongs to */
     Hash                  *string_hash; /* Hash for lookup of string indices */
@@ -194,6 +197,13 @@ typedef struct PackFile_ConstTable {
     opcode_t               ntags;       /* Number of tags */
 } PackFile_ConstTable;
 
+/* PMC constant idx of ct; constants left frozen by PackFile_ConstTable_unpack
+ * are NULL until this thaws them. */
+#define PF_PMC_CONSTANT(interp, ct, idx) \
+    ((ct)->pmc.constants[(idx)] \
+        ? (ct)->pmc.constants[(idx)] \
+        : PackFile_ConstTable_thaw_pmc((interp), (ct), (idx)))
+
 typedef struct PackFile_ByteCode_OpMappingEntry {
     op_lib_t *lib;       /* library for this entry */
     opcode_t  n_ops;     /* number of ops used */
@@ -219,6 +229,14 @@ struct PackFile_ByteCode {
     op_info_t                   **op_info_table;
     size_t                        n_libdeps;       /* number of library dependancies */
     STRING                      **libdeps;         /* names of prerequisite libraries */
+    void                        **threaded_code;   /* op labels for the cgoto core */
+    size_t                        threaded_size;   /* code size threaded_code covers */
+    size_t                        fused_size;      /* code size Parrot_pf_fuse_ops covered */
+    size_t                        n_fused;         /* number of ops replaced by fused ops */
+    opcode_t                     *unfused_ops;     /* offset and original op of each */
+    size_t                        fused_table_ops; /* fused ops at the end of the op table */
+    struct _meth_inline_cache   **method_caches;   /* per callmethod op, by offset */
+    size_t                        method_caches_size; /* code size method_caches covers */
 };
 
 typedef struct PackFile_DebugFilenameMapping {
@@ -268,6 +286,14 @@ typedef struct PackFile_Directory {
 } PackFile_Directory;
 
 
+/* A mapped image outliving its packfile, because constant STRINGs may still
+ * point into it. Unmapped when the interpreter owning the GC goes away. */
+typedef struct PackFile_RetiredImage {
+    struct PackFile_RetiredImage *next;
+    void                         *src;
+    size_t                        size;
+} PackFile_RetiredImage;
+
 typedef opcode_t (*packfile_fetch_op_t)(ARGIN(const unsigned char *));
 typedef INTVAL   (*packfile_fetch_iv_t)(ARGIN(const unsigned char *));
 typedef void     (*packfile_fetch_nv_t)(ARGOUT(unsigned char *), ARGIN(const unsigned char *));
@@ -279,6 +305,8 @@ typedef struct PackFile {
     const opcode_t      *src;         /* possible mmap()ed start of the PF */
     size_t               size;        /* size in bytes */
     INTVAL               is_mmap_ped; /* don't free it, munmap it at destroy */
+    INTVAL               owns_src;    /* src was read in for us, free it at destroy */
+    UINTVAL              n_mapped_strings; /* constant STRINGs using src in place */
 
     PackFile_Header     *header;
 
@@ -298,6 +326,13 @@ typedef struct PackFile {
     packfile_fetch_nv_t  fetch_nv;
 } PackFile;
 
+/* Data at ptr lies in the mmap()ed image of pf and is in host format, so it
+ * can be used in place instead of being copied. */
+#define PF_IN_MAPPED_IMAGE(pf, ptr) \
+    ((pf) && (pf)->is_mmap_ped && !(pf)->need_endianize && !(pf)->need_wordsize \
+    && (const char *)(ptr) >= (const char *)(pf)->src \
+    && (const char *)(ptr) <  (const char *)(pf)->src + (pf)->size)
+
 
 typedef enum {
     PBC_MAIN   = 1,
@@ -791,6 +826,9 @@ void Parrot_pf_mark_packfile(PARROT_INTERP, ARGMOD_NULLOK(PackFile * pf))
         __attribute__nonnull__(1)
         FUNC_MODIFIES(* pf);
 
+void Parrot_pf_unmap_retired_images(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 #define ASSERT_ARGS_do_sub_pragmas __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pfpmc))
@@ -924,6 +962,9 @@ void Parrot_pf_mark_packfile(PARROT_INTERP, ARGMOD_NULLOK(PackFile * pf))
     , PARROT_ASSERT_ARG(pbc))
 #define ASSERT_ARGS_Parrot_pf_mark_packfile __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_pf_unmap_retired_images \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/packfile/api.c */
 
@@ -1040,6 +1081,24 @@ void PackFile_ConstTable_clear(PARROT_INTERP,
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*self);
 
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+INTVAL PackFile_ConstTable_signature_elements(PARROT_INTERP,
+    ARGMOD(PackFile_ConstTable *ct),
+    INTVAL idx)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*ct);
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PMC * PackFile_ConstTable_thaw_pmc(PARROT_INTERP,
+    ARGMOD(PackFile_ConstTable *ct),
+    INTVAL idx)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*ct);
+
 PARROT_EXPORT
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
@@ -1117,6 +1176,18 @@ const opcode_t * PackFile_Segment_unpack(PARROT_INTERP,
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*self);
 
+PARROT_EXPORT
+void Parrot_pf_fuse_ops(PARROT_INTERP, ARGMOD(PackFile_ByteCode *bc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*bc);
+
+PARROT_EXPORT
+void Parrot_pf_unfuse_ops(PARROT_INTERP, ARGMOD(PackFile_ByteCode *bc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*bc);
+
 void default_dump_header(PARROT_INTERP, ARGIN(const PackFile_Segment *self))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
@@ -1167,6 +1238,13 @@ void pf_register_standard_funcs(PARROT_INTERP, ARGMOD(PackFile *pf))
 #define ASSERT_ARGS_PackFile_ConstTable_clear __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_PackFile_ConstTable_signature_elements \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ct))
+#define ASSERT_ARGS_PackFile_ConstTable_thaw_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ct))
 #define ASSERT_ARGS_PackFile_ConstTable_unpack __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(seg) \
@@ -1196,6 +1274,12 @@ void pf_register_standard_funcs(PARROT_INTERP, ARGMOD(PackFile *pf))
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(self) \
     , PARROT_ASSERT_ARG(cursor))
+#define ASSERT_ARGS_Parrot_pf_fuse_ops __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(bc))
+#define ASSERT_ARGS_Parrot_pf_unfuse_ops __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(bc))
 #define ASSERT_ARGS_default_dump_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(self))
@@ -110,6 +110,30 @@ INTVAL Parrot_io_internal_send(PARROT_INTERP, PIOHANDLE handle, ARGIN(const char
 INTVAL Parrot_io_internal_recv(PARROT_INTERP, PIOHANDLE handle, ARGOUT(char *buf), size_t len);
 INTVAL Parrot_io_internal_poll(PARROT_INTERP, PIOHANDLE handle, int which, int sec, int usec);
 INTVAL Parrot_io_internal_close_socket(PARROT_INTERP, PIOHANDLE handle);
+INTVAL Parrot_io_internal_connect_start(PARROT_INTERP, PIOHANDLE handle, ARGIN(void *addr),
+            INTVAL addr_len);
+void Parrot_io_internal_connect_finish(PARROT_INTERP, PIOHANDLE handle);
+
+/*
+ * Waiting for many handles at once
+ */
+
+/* Conditions to wait for, also used by Parrot_io_internal_poll */
+#define PIO_POLL_READ  1
+#define PIO_POLL_WRITE 2
+#define PIO_POLL_ERROR 4
+
+typedef struct Parrot_io_poller Parrot_io_poller;
+
+PARROT_CAN_RETURN_NULL
+Parrot_io_poller *Parrot_io_internal_poller_new(PARROT_INTERP);
+void Parrot_io_internal_poller_free(PARROT_INTERP, ARGFREE_NOTNULL(Parrot_io_poller *poller));
+INTVAL Parrot_io_internal_poller_add(PARROT_INTERP, ARGMOD(Parrot_io_poller *poller),
+            PIOHANDLE handle, INTVAL which);
+void Parrot_io_internal_poller_remove(PARROT_INTERP, ARGMOD(Parrot_io_poller *poller),
+            PIOHANDLE handle);
+INTVAL Parrot_io_internal_poller_wait(PARROT_INTERP, ARGMOD(Parrot_io_poller *poller),
+            FLOATVAL timeout, ARGOUT(PIOHANDLE *ready), INTVAL size);
 
 /*
  * Files and directories
@@ -305,6 +329,9 @@ INTVAL Parrot_intval_time(void);
 PARROT_EXPORT
 FLOATVAL Parrot_floatval_time(void);
 
+PARROT_EXPORT
+FLOATVAL Parrot_floatval_monotonic_time(void);
+
 PARROT_EXPORT
 struct tm * Parrot_gmtime_r(const time_t *, struct tm *);
 
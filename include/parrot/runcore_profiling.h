@@ -100,6 +100,10 @@ struct profiling_runcore_t {
     UINTVAL         time_size;  /* how big is the following array */
     UHUGEINTVAL    *time;       /* time spent between DO_OP and start/end of a runcore */
     Hash           *line_cache; /* hash for caching pc -> line mapping */
+    Hash           *fuse_seqs;  /* op sequence -> count, for fusion candidates */
+    STRING         *fuse_filename;
+    op_info_t      *fuse_prev[PARROT_MAX_FUSED_OPS - 1]; /* ops that ran up to fuse_next */
+    opcode_t       *fuse_next;  /* pc that continues the sequence in fuse_prev */
 };
 
 #define Profiling_flag_SET(runcore, flag) \
@@ -53,7 +53,10 @@ typedef enum {
 typedef enum {
     TASK_active_FLAG     = PObj_private0_FLAG,
     TASK_in_preempt_FLAG = PObj_private1_FLAG,
-    TASK_recv_block_FLAG = PObj_private2_FLAG
+    TASK_recv_block_FLAG = PObj_private2_FLAG,
+    TASK_io_wait_FLAG    = PObj_private3_FLAG,
+    TASK_io_ready_FLAG   = PObj_private4_FLAG,
+    TASK_on_worker_FLAG  = PObj_private5_FLAG
 } task_flags_enum;
 
 #define TASK_get_FLAGS(o) (PObj_get_FLAGS(o))
@@ -77,6 +80,24 @@ typedef enum {
 #define TASK_recv_block_SET(o)   TASK_flag_SET(recv_block, o)
 #define TASK_recv_block_CLEAR(o) TASK_flag_CLEAR(recv_block, o)
 
+/* Flag is set iff the runloop is ending because the current task is
+ * waiting for a handle to become ready */
+#define TASK_io_wait_TEST(o)  TASK_flag_TEST(io_wait, o)
+#define TASK_io_wait_SET(o)   TASK_flag_SET(io_wait, o)
+#define TASK_io_wait_CLEAR(o) TASK_flag_CLEAR(io_wait, o)
+
+/* Flag is set if the handle the task waited for is ready, and the method
+ * which waited for it is about to be called again. */
+#define TASK_io_ready_TEST(o)  TASK_flag_TEST(io_ready, o)
+#define TASK_io_ready_SET(o)   TASK_flag_SET(io_ready, o)
+#define TASK_io_ready_CLEAR(o) TASK_flag_CLEAR(io_ready, o)
+
+/* Flag is set while a worker thread runs the task; its result is not
+ * collected yet. */
+#define TASK_on_worker_TEST(o)  TASK_flag_TEST(on_worker, o)
+#define TASK_on_worker_SET(o)   TASK_flag_SET(on_worker, o)
+#define TASK_on_worker_CLEAR(o) TASK_flag_CLEAR(on_worker, o)
+
 
 #endif /* PARROT_SCHEDULER_PRIVATE_H_GUARD */
 
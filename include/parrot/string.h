@@ -79,6 +79,23 @@ typedef struct string_iterator_t {
     UINTVAL charpos;
 } String_iter;
 
+/*
+ * character index of a long string in a variable width encoding: the byte
+ * offset of every STR_INDEX_STRIDEth character, filled in as far as it has
+ * been asked for.  It belongs to one STRING header and is freed with it.
+ */
+#define STR_INDEX_STRIDE     64
+#define STR_INDEX_MIN_LENGTH 256
+
+typedef struct _str_index {
+    UINTVAL                   bufused;   /* string the index was made for */
+    UINTVAL                   strlen;
+    const struct _str_vtable *encoding;
+    UINTVAL                   count;     /* entries filled in */
+    UINTVAL                   size;      /* entries allocated */
+    UINTVAL                  *bytepos;   /* offset of character n * STRIDE */
+} Str_index;
+
 typedef struct _Parrot_String_Bounds {
     UINTVAL bytes;
     INTVAL  chars;
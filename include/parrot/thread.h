@@ -0,0 +1,83 @@
+/* thread.h
+ *  Copyright (C) 2012, Parrot Foundation.
+ *  Overview:
+ *     Worker interpreters running tasks in their own threads
+ *  Data Structure and Algorithms:
+ *     See src/thread.c
+ */
+
+#ifndef PARROT_THREAD_H_GUARD
+#define PARROT_THREAD_H_GUARD
+
+/* HEADERIZER BEGIN: src/thread.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_CAN_RETURN_NULL
+PMC * Parrot_thread_pool_collect(PARROT_INTERP,
+    ARGMOD(Parrot_thread_pool *pool),
+    FLOATVAL timeout,
+    ARGOUT(INTVAL *id))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*pool)
+        FUNC_MODIFIES(*id);
+
+size_t Parrot_thread_pool_default_size(void);
+void Parrot_thread_pool_destroy(PARROT_INTERP,
+    ARGFREE_NOTNULL(Parrot_thread_pool *pool))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_CAN_RETURN_NULL
+Parrot_thread_pool * Parrot_thread_pool_new(PARROT_INTERP, size_t count)
+        __attribute__nonnull__(1);
+
+PARROT_PURE_FUNCTION
+INTVAL Parrot_thread_pool_pending(ARGIN(const Parrot_thread_pool *pool))
+        __attribute__nonnull__(1);
+
+PARROT_PURE_FUNCTION
+size_t Parrot_thread_pool_size(ARGIN(const Parrot_thread_pool *pool))
+        __attribute__nonnull__(1);
+
+void Parrot_thread_pool_submit(PARROT_INTERP,
+    ARGMOD(Parrot_thread_pool *pool),
+    INTVAL id,
+    ARGIN(PMC *sub),
+    ARGIN_NULLOK(PMC *arg))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*pool);
+
+#define ASSERT_ARGS_Parrot_thread_pool_collect __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pool) \
+    , PARROT_ASSERT_ARG(id))
+#define ASSERT_ARGS_Parrot_thread_pool_default_size \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_Parrot_thread_pool_destroy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pool))
+#define ASSERT_ARGS_Parrot_thread_pool_new __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_thread_pool_pending __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pool))
+#define ASSERT_ARGS_Parrot_thread_pool_size __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pool))
+#define ASSERT_ARGS_Parrot_thread_pool_submit __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pool) \
+    , PARROT_ASSERT_ARG(sub))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/thread.c */
+
+#endif /* PARROT_THREAD_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
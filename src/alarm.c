@@ -207,7 +207,8 @@ Parrot_alarm_check(ARGMOD(UINTVAL* last_serial))
 
 =item C<void Parrot_alarm_set(FLOATVAL when)>
 
-Sets an alarm to trigger at time 'when'.
+Sets an alarm to trigger at time 'when', on the clock of
+C<Parrot_floatval_monotonic_time>.
 
 =cut
 
@@ -221,7 +222,7 @@ Parrot_alarm_set(FLOATVAL when)
 #ifdef _WIN32
     /* TODO: Implement on Windows */
 #else
-    const FLOATVAL now = Parrot_floatval_time();
+    const FLOATVAL now = Parrot_floatval_monotonic_time();
 
     /* Better late than early */
     when += 0.0001;
@@ -1,5 +1,5 @@
 /*
-Copyright (C) 2001-2011, Parrot Foundation.
+Copyright (C) 2001-2012, Parrot Foundation.
 
 =head1 NAME
 
@@ -97,6 +97,15 @@ static void fill_params(PARROT_INTERP,
         __attribute__nonnull__(5)
         FUNC_MODIFIES(*call_object);
 
+static INTVAL fill_simple_params_from_op(PARROT_INTERP,
+    ARGIN(PMC *call_object),
+    ARGIN(PMC *raw_sig),
+    ARGIN(const opcode_t *raw_params))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
 PARROT_WARN_UNUSED_RESULT
 static INTVAL intval_constant_from_op(PARROT_INTERP,
     ARGIN(const opcode_t *raw_params),
@@ -209,6 +218,17 @@ static void set_call_from_varargs(PARROT_INTERP,
         __attribute__nonnull__(4)
         FUNC_MODIFIES(*args);
 
+static INTVAL set_simple_positionals_from_op(PARROT_INTERP,
+    ARGMOD(PMC *call_object),
+    ARGIN(const INTVAL *int_array),
+    INTVAL arg_count,
+    ARGIN(const opcode_t *raw_args))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*call_object);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static STRING* string_constant_from_op(PARROT_INTERP,
@@ -258,6 +278,11 @@ static STRING** string_param_from_op(PARROT_INTERP,
     , PARROT_ASSERT_ARG(raw_sig) \
     , PARROT_ASSERT_ARG(arg_info) \
     , PARROT_ASSERT_ARG(accessor))
+#define ASSERT_ARGS_fill_simple_params_from_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(call_object) \
+    , PARROT_ASSERT_ARG(raw_sig) \
+    , PARROT_ASSERT_ARG(raw_params))
 #define ASSERT_ARGS_intval_constant_from_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(raw_params))
 #define ASSERT_ARGS_intval_constant_from_varargs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -299,6 +324,12 @@ static STRING** string_param_from_op(PARROT_INTERP,
     , PARROT_ASSERT_ARG(signature) \
     , PARROT_ASSERT_ARG(sig) \
     , PARROT_ASSERT_ARG(args))
+#define ASSERT_ARGS_set_simple_positionals_from_op \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(call_object) \
+    , PARROT_ASSERT_ARG(int_array) \
+    , PARROT_ASSERT_ARG(raw_args))
 #define ASSERT_ARGS_string_constant_from_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(raw_params))
@@ -352,6 +383,12 @@ Parrot_pcc_build_sig_object_from_op(PARROT_INTERP, ARGIN_NULLOK(PMC *signature),
     GETATTR_FixedIntegerArray_size(interp, raw_sig, arg_count);
     GETATTR_FixedIntegerArray_int_array(interp, raw_sig, int_array);
 
+    /* Most calls pass positionals only; copy those straight into the cells */
+    if (!arg_count
+    ||  set_simple_positionals_from_op(interp, call_object, int_array,
+            arg_count, raw_args))
+        return call_object;
+
     for (; arg_index < arg_count; ++arg_index) {
         const INTVAL arg_flags = int_array[arg_index];
         const int constant = 0 != PARROT_ARG_CONSTANT_ISSET(arg_flags);
@@ -422,6 +459,76 @@ Parrot_pcc_build_sig_object_from_op(PARROT_INTERP, ARGIN_NULLOK(PMC *signature),
 
 /*
 
+=item C<static INTVAL set_simple_positionals_from_op(PARROT_INTERP, PMC
+*call_object, const INTVAL *int_array, INTVAL arg_count, const opcode_t
+*raw_args)>
+
+Stores the arguments of a set_args opcode as the positionals of the
+CallContext PMC, unless some of them are named or flattened. Returns 0 and
+stores nothing in that case.
+
+=cut
+
+*/
+
+static INTVAL
+set_simple_positionals_from_op(PARROT_INTERP, ARGMOD(PMC *call_object),
+        ARGIN(const INTVAL *int_array), INTVAL arg_count,
+        ARGIN(const opcode_t *raw_args))
+{
+    ASSERT_ARGS(set_simple_positionals_from_op)
+    PMC * const ctx = CURRENT_CONTEXT(interp);
+    Pcc_cell   *cells;
+    INTVAL      i;
+
+    for (i = 0; i < arg_count; ++i)
+        if (int_array[i] & (PARROT_ARG_NAME | PARROT_ARG_FLATTEN)
+        ||  PARROT_ARG_TYPE_MASK_MASK(int_array[i]) > PARROT_ARG_FLOATVAL)
+            return 0;
+
+    cells = Parrot_pcc_reserve_positionals(interp, call_object, arg_count);
+
+    for (i = 0; i < arg_count; ++i) {
+        const INTVAL arg_flags = int_array[i];
+        const int    constant  = 0 != PARROT_ARG_CONSTANT_ISSET(arg_flags);
+        const INTVAL raw_index = raw_args[i + 2];
+
+        switch (PARROT_ARG_TYPE_MASK_MASK(arg_flags)) {
+          case PARROT_ARG_INTVAL:
+            cells[i].u.i  = constant
+                          ? raw_index
+                          : CTX_REG_INT(interp, ctx, raw_index);
+            cells[i].type = INTCELL;
+            break;
+          case PARROT_ARG_FLOATVAL:
+            cells[i].u.n  = constant
+                          ? Parrot_pcc_get_num_constant(interp, ctx, raw_index)
+                          : CTX_REG_NUM(interp, ctx, raw_index);
+            cells[i].type = FLOATCELL;
+            break;
+          case PARROT_ARG_STRING:
+            cells[i].u.s  = constant
+                          ? Parrot_pcc_get_string_constant(interp, ctx, raw_index)
+                          : CTX_REG_STR(interp, ctx, raw_index);
+            cells[i].type = STRINGCELL;
+            break;
+          case PARROT_ARG_PMC:
+          default:
+            cells[i].u.p  = constant
+                          ? Parrot_pcc_get_pmc_constant(interp, ctx, raw_index)
+                          : CTX_REG_PMC(interp, ctx, raw_index);
+            cells[i].type = PMCCELL;
+            break;
+        }
+    }
+
+    SETATTR_CallContext_num_positionals(interp, call_object, arg_count);
+
+    return 1;
+}
+
+/*
+
 =item C<static void extract_named_arg_from_op(PARROT_INTERP, PMC *call_object,
 STRING *name, PMC *raw_sig, opcode_t *raw_args, INTVAL arg_index)>
 
@@ -1322,11 +1429,93 @@ Parrot_pcc_fill_params_from_op(PARROT_INTERP, ARGMOD_NULLOK(PMC *call_object),
         (pmc_func_t)pmc_constant_from_op,
     };
 
+    if (!PMC_IS_NULL(call_object)
+    &&  fill_simple_params_from_op(interp, call_object, raw_sig, raw_params))
+        return;
+
     fill_params(interp, call_object, raw_sig, raw_params, &function_pointers, direction);
 }
 
 /*
 
+=item C<static INTVAL fill_simple_params_from_op(PARROT_INTERP, PMC
+*call_object, PMC *raw_sig, const opcode_t *raw_params)>
+
+Copies the positionals of C<call_object> straight into the registers of a
+get_params or get_results opcode, if there is one positional of the same
+type for each parameter and no named ones. Returns 0 if there isn't, and
+C<fill_params> has to sort the arguments out.
+
+This only saves the accessor call for each parameter; the CallContext and
+its cells have already been allocated by the caller.
+
+=cut
+
+*/
+
+static INTVAL
+fill_simple_params_from_op(PARROT_INTERP, ARGIN(PMC *call_object),
+        ARGIN(PMC *raw_sig), ARGIN(const opcode_t *raw_params))
+{
+    ASSERT_ARGS(fill_simple_params_from_op)
+    PMC * const ctx = CURRENT_CONTEXT(interp);
+    const Pcc_cell *cells     = NULL;
+    const INTVAL   *int_array = NULL;
+    Hash           *named     = NULL;
+    INTVAL          param_count, positional_count, i;
+
+    GETATTR_CallContext_hash(interp, call_object, named);
+    if (named && named->entries)
+        return 0;
+
+    GETATTR_FixedIntegerArray_size(interp, raw_sig, param_count);
+    GETATTR_CallContext_num_positionals(interp, call_object, positional_count);
+    if (param_count != positional_count)
+        return 0;
+
+    GETATTR_FixedIntegerArray_int_array(interp, raw_sig, int_array);
+    GETATTR_CallContext_positionals(interp, call_object, cells);
+
+    /* Stop at the first parameter needing more than a copy; fill_params
+     * fills all of them again then */
+    for (i = 0; i < param_count; ++i) {
+        const INTVAL param_flags = int_array[i];
+        const INTVAL raw_index   = raw_params[i + 2];
+
+        if (param_flags & ~(PARROT_ARG_TYPE_MASK | PARROT_ARG_INVOCANT))
+            return 0;
+
+        switch (PARROT_ARG_TYPE_MASK_MASK(param_flags)) {
+          case PARROT_ARG_INTVAL:
+            if (cells[i].type != INTCELL)
+                return 0;
+            CTX_REG_INT(interp, ctx, raw_index) = cells[i].u.i;
+            break;
+          case PARROT_ARG_FLOATVAL:
+            if (cells[i].type != FLOATCELL)
+                return 0;
+            CTX_REG_NUM(interp, ctx, raw_index) = cells[i].u.n;
+            break;
+          case PARROT_ARG_STRING:
+            if (cells[i].type != STRINGCELL)
+                return 0;
+            CTX_REG_STR(interp, ctx, raw_index) = cells[i].u.s;
+            break;
+          case PARROT_ARG_PMC:
+            if (cells[i].type != PMCCELL)
+                return 0;
+            CTX_REG_PMC(interp, ctx, raw_index) = cells[i].u.p;
+            break;
+          default:
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/*
+
 =item C<void Parrot_pcc_fill_params_from_c_args(PARROT_INTERP, PMC *call_object,
 const char *signature, ...)>
 
@@ -253,6 +253,7 @@ init_context(ARGMOD(PMC *pmcctx), ARGIN_NULLOK(PMC *pmcold))
         ctx->num_constants     = NULL;
         ctx->str_constants     = NULL;
         ctx->pmc_constants     = NULL;
+        ctx->const_table       = NULL;
         ctx->warns             = 0;
         ctx->errors            = 0;
         ctx->trace_flags       = 0;
@@ -266,6 +267,7 @@ init_context(ARGMOD(PMC *pmcctx), ARGIN_NULLOK(PMC *pmcold))
         ctx->num_constants     = old->num_constants;
         ctx->str_constants     = old->str_constants;
         ctx->pmc_constants     = old->pmc_constants;
+        ctx->const_table       = old->const_table;
         ctx->warns             = old->warns;
         ctx->errors            = old->errors;
         ctx->trace_flags       = old->trace_flags;
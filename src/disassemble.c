@@ -53,7 +53,7 @@ static void
 print_constant_table(PARROT_INTERP, ARGIN(PMC *output))
 {
     ASSERT_ARGS(print_constant_table)
-    const PackFile_ConstTable *ct = interp->code->const_table;
+    PackFile_ConstTable * const ct = interp->code->const_table;
     INTVAL i;
 
     /* TODO: would be nice to print the name of the file as well */
@@ -66,7 +66,7 @@ print_constant_table(PARROT_INTERP, ARGIN(PMC *output))
         Parrot_io_fprintf(interp, output, "STR_CONST(%d): %S\n", i, ct->str.constants[i]);
 
     for (i = 0; i < ct->pmc.const_count; i++) {
-        PMC * const c = ct->pmc.constants[i];
+        PMC * const c = PF_PMC_CONSTANT(interp, ct, i);
         Parrot_io_fprintf(interp, output, "PMC_CONST(%d): ", i);
 
         switch (c->vtable->base_type) {
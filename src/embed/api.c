@@ -143,6 +143,14 @@ Parrot_api_make_interpreter(Parrot_PMC parent, Parrot_Int flags,
             gc_args.nursery_size      = args->gc_nursery_size;
             gc_args.dynamic_threshold = args->gc_dynamic_threshold;
             gc_args.min_threshold     = args->gc_min_threshold;
+            gc_args.max_heap          = args->gc_max_heap;
+            gc_args.pause_goal        = args->gc_pause_goal;
+            gc_args.throughput_goal   = args->gc_throughput_goal;
+            gc_args.mark_threads      = args->gc_mark_threads;
+            gc_args.lazy_sweep        = args->gc_lazy_sweep;
+            gc_args.log_file          = args->gc_log;
+            gc_args.compact_limit     = args->gc_compact_limit;
+            gc_args.alloc_sites       = args->gc_alloc_sites;
 
             if (args->hash_seed)
                 interp_raw->hash_seed = args->hash_seed;
@@ -188,6 +196,8 @@ Parrot_api_set_runcore(Parrot_PMC interp_pmc, ARGIN(const char * corename),
             Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "slow"));
         else if (STREQ(corename, "fast") || STREQ(corename, "jit") || STREQ(corename, "function"))
             Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "fast"));
+        else if (STREQ(corename, "cgoto"))
+            Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "cgoto"));
         else if (STREQ(corename, "subprof_sub"))
             Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "subprof_sub"));
         else if (STREQ(corename, "subprof_hll") || STREQ(corename, "subprof"))
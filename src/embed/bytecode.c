@@ -185,8 +185,9 @@ Parrot_api_disassemble_bytecode(Parrot_PMC interp_pmc, Parrot_PMC pbc,
     if (!pf)
         Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_UNEXPECTED_NULL,
             "Could not get packfile.");
+    /* only switch to the code: preparing it to run could rewrite ops */
     if (pf->cur_cs)
-        Parrot_pf_set_current_packfile(interp, pbc);
+        Parrot_switch_to_cs(interp, pf->cur_cs, 0);
     Parrot_disassemble(interp, outfile, (Parrot_disassemble_options)opts);
     EMBED_API_CALLOUT(interp_pmc, interp);
 }
@@ -116,8 +116,9 @@ Parrot_gc_mark_PObj_alive(PARROT_INTERP, ARGMOD(PObj *obj))
 {
     ASSERT_ARGS(Parrot_gc_mark_PObj_alive)
 
-    /* if object is live or on free list return */
-    if (PObj_is_live_or_free_TESTALL(obj))
+    /* if object is live or on free list return. A heap snapshot wants
+     * to see every reference, marked before or not */
+    if (PObj_is_live_or_free_TESTALL(obj) && !interp->gc_sys->heap_snapshot)
         return;
 
     if (PObj_is_PMC_TEST(obj)) {
@@ -143,7 +144,7 @@ void
 Parrot_gc_mark_PMC_alive_fun(PARROT_INTERP, ARGMOD_NULLOK(PMC *obj))
 {
     ASSERT_ARGS(Parrot_gc_mark_PMC_alive_fun)
-    if (obj)
+    if (!PMC_IS_NULL(obj))
         interp->gc_sys->mark_pmc_header(interp, obj);
 }
 
@@ -162,7 +163,7 @@ void
 Parrot_gc_mark_STRING_alive_fun(PARROT_INTERP, ARGMOD_NULLOK(STRING *obj))
 {
     ASSERT_ARGS(Parrot_gc_mark_STRING_alive_fun)
-    if (obj)
+    if (!STRING_IS_NULL(obj))
         interp->gc_sys->mark_str_header(interp, obj);
 }
 
@@ -189,7 +190,11 @@ Parrot_gc_initialize(PARROT_INTERP, ARGIN(Parrot_GC_Init_Args *args))
 
     interp->lo_var_ptr = args->stacktop;
 
-    interp->gc_sys->sys_type = PARROT_GC_DEFAULT_TYPE;
+    /* Child interpreters share the parent's GC, so they must use its type */
+    if (interp->parent_interpreter && interp->parent_interpreter->gc_sys)
+        interp->gc_sys->sys_type = interp->parent_interpreter->gc_sys->sys_type;
+    else
+        interp->gc_sys->sys_type = PARROT_GC_DEFAULT_TYPE;
 
     if (args->system != NULL) {
         if (STREQ(args->system, "gms"))
@@ -207,6 +212,11 @@ Parrot_gc_initialize(PARROT_INTERP, ARGIN(Parrot_GC_Init_Args *args))
         }
     }
 
+    Parrot_gc_event_log_init(interp, args->log_file);
+
+    if (args->alloc_sites)
+        Parrot_gc_alloc_sites_init(interp);
+
     switch (interp->gc_sys->sys_type) {
       case MS:
         Parrot_gc_ms_init(interp, args);
@@ -285,6 +295,9 @@ Parrot_gc_finalize(PARROT_INTERP)
     if (interp->gc_sys->finalize_gc_system)
         interp->gc_sys->finalize_gc_system(interp);
 
+    Parrot_gc_event_log_destroy(interp);
+    Parrot_gc_alloc_sites_destroy(interp);
+
     mem_internal_free(interp->gc_sys);
     interp->gc_sys = NULL;
 }
@@ -320,6 +333,9 @@ Parrot_gc_new_pmc_header(PARROT_INTERP, UINTVAL flags)
     PMC_data(pmc)       = NULL;
     PMC_metadata(pmc)   = PMCNULL;
 
+    if (interp->gc_sys->alloc_sites)
+        Parrot_gc_alloc_sites_record(interp, pmc);
+
     return pmc;
 }
 
@@ -704,7 +720,8 @@ Parrot_gc_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
 
 =item C<void Parrot_gc_compact_memory_pool(PARROT_INTERP)>
 
-Compact string pool if supported by GC.
+Compact string pool if supported by GC. Outside of a collection the
+compaction is recorded as a collection of its own.
 
 =cut
 
@@ -715,7 +732,14 @@ void
 Parrot_gc_compact_memory_pool(PARROT_INTERP)
 {
     ASSERT_ARGS(Parrot_gc_compact_memory_pool)
-    interp->gc_sys->compact_string_pool(interp);
+
+    if (interp->gc_sys->event)
+        interp->gc_sys->compact_string_pool(interp);
+    else {
+        Parrot_gc_event_start(interp, -1);
+        interp->gc_sys->compact_string_pool(interp);
+        Parrot_gc_event_finish(interp);
+    }
 }
 
 /*
@@ -1108,6 +1132,118 @@ Parrot_gc_sys_name(PARROT_INTERP)
 }
 
 
+/*
+
+=item C<FLOATVAL Parrot_gc_pause_percentile(PARROT_INTERP, FLOATVAL percent)>
+
+Returns the GC pause in seconds which C<percent> percent of the collections
+so far did not exceed.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+FLOATVAL
+Parrot_gc_pause_percentile(PARROT_INTERP, FLOATVAL percent)
+{
+    ASSERT_ARGS(Parrot_gc_pause_percentile)
+    return Parrot_gc_event_pause_percentile(interp, percent);
+}
+
+/*
+
+=item C<PMC * Parrot_gc_recent_events(PARROT_INTERP)>
+
+Returns an array with a hash for each of the last collections, oldest
+first.  Their keys are the fields written by C<--gc-log>, see
+F<src/gc/telemetry.c>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+PMC *
+Parrot_gc_recent_events(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_recent_events)
+    const GC_Event_Log * const log    = interp->gc_sys->event_log;
+    const size_t               count  = log->count < GC_EVENT_LOG_SIZE
+                                      ? log->count : GC_EVENT_LOG_SIZE;
+    const size_t               first  = log->count - count;
+    PMC                * const result = Parrot_pmc_new_init_int(interp,
+                                            enum_class_ResizablePMCArray, count);
+    GC_Event           * const events = mem_gc_allocate_n_typed(interp,
+                                            count ? count : 1, GC_Event);
+    size_t i;
+
+    /* Building the hashes may collect and overwrite the ring */
+    for (i = 0; i < count; ++i)
+        events[i] = log->events[(first + i) % GC_EVENT_LOG_SIZE];
+
+    for (i = 0; i < count; ++i) {
+        const GC_Event * const event = &events[i];
+        PMC            * const hash  = Parrot_pmc_new(interp, enum_class_Hash);
+
+        VTABLE_set_integer_keyed_str(interp, hash,
+                Parrot_str_new_constant(interp, "gc"), (INTVAL)(first + i + 1));
+        VTABLE_set_number_keyed_str(interp, hash,
+                Parrot_str_new_constant(interp, "start"), event->start);
+        VTABLE_set_number_keyed_str(interp, hash,
+                Parrot_str_new_constant(interp, "end"), event->end);
+        VTABLE_set_number_keyed_str(interp, hash,
+                Parrot_str_new_constant(interp, "pause"), event->end - event->start);
+        VTABLE_set_integer_keyed_str(interp, hash,
+                Parrot_str_new_constant(interp, "generation"), event->generation);
+        VTABLE_set_integer_keyed_str(interp, hash,
+                Parrot_str_new_constant(interp, "marked"), (INTVAL)event->marked);
+        VTABLE_set_integer_keyed_str(interp, hash,
+                Parrot_str_new_constant(interp, "swept"), (INTVAL)event->swept);
+        VTABLE_set_integer_keyed_str(interp, hash,
+                Parrot_str_new_constant(interp, "promoted"), (INTVAL)event->promoted);
+        VTABLE_set_number_keyed_str(interp, hash,
+                Parrot_str_new_constant(interp, "compact"), event->compact_time);
+
+        VTABLE_set_pmc_keyed_int(interp, result, (INTVAL)i, hash);
+    }
+
+    mem_gc_free(interp, events);
+    return result;
+}
+
+/*
+
+=item C<void Parrot_gc_heap_snapshot(PARROT_INTERP, STRING *file)>
+
+Writes every live object, with its type, sizes and the objects it refers
+to, into C<file>.  The format is described in F<src/gc/heap_snapshot.c>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_gc_heap_snapshot(PARROT_INTERP, ARGIN(STRING *file))
+{
+    ASSERT_ARGS(Parrot_gc_heap_snapshot)
+    char * const path = Parrot_str_to_cstring(interp, file);
+    FILE * const out  = fopen(path, "w");
+
+    Parrot_str_free_cstring(path);
+
+    if (!out)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+                "Cannot open heap snapshot '%Ss'", file);
+
+    Parrot_gc_heap_snapshot_write(interp, out);
+    fclose(out);
+}
+
 /*
 
 =back
@@ -24,6 +24,15 @@ C<PoolAllocator> used to allocate memory of particular size.
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+PARROT_CANNOT_RETURN_NULL
+static void * add_pool_arena(PARROT_INTERP,
+    ARGMOD(Pool_Allocator *pool),
+    size_t total_size,
+    size_t num_items)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pool);
+
 static void allocate_new_pool_arena(PARROT_INTERP,
     ARGMOD(Pool_Allocator *pool))
         __attribute__nonnull__(1)
@@ -74,6 +83,9 @@ static int pool_is_owned(
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+#define ASSERT_ARGS_add_pool_arena __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pool))
 #define ASSERT_ARGS_allocate_new_pool_arena __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pool))
@@ -257,6 +269,14 @@ Destroy allocated Pool - free memory for all areanas in the alocated pool
 
 Allocate from Pool
 
+=item C<void * Parrot_gc_pool_allocate_region(PARROT_INTERP, Pool_Allocator
+*pool, size_t num_items)>
+
+Allocate C<num_items> contiguous, zeroed objects from Pool. The region is owned
+by the pool (C<is_owned> accepts its objects and C<destroy> frees it), but its
+objects never go through the free list. The caller hands them out itself and
+must not pass them to C<Parrot_gc_pool_free>.
+
 =item C<void Parrot_gc_pool_free(PARROT_INTERP, Pool_Allocator *pool, void
 *data)>
 
@@ -304,6 +324,7 @@ Parrot_gc_pool_new(SHIM_INTERP, size_t object_size)
     newpool->object_size       = attrib_size;
     newpool->objects_per_alloc = num_objs;
     newpool->num_free_objects  = 0;
+    newpool->allocated_size    = 0;
     newpool->top_arena         = NULL;
     newpool->free_list         = NULL;
     newpool->lo_arena_ptr      = (void *)((size_t)-1);
@@ -344,6 +365,19 @@ Parrot_gc_pool_allocate(PARROT_INTERP, ARGMOD(Pool_Allocator * pool))
     return pool_allocate(interp, pool);
 }
 
+PARROT_CANNOT_RETURN_NULL
+PARROT_EXPORT
+void *
+Parrot_gc_pool_allocate_region(PARROT_INTERP, ARGMOD(Pool_Allocator *pool),
+        size_t num_items)
+{
+    ASSERT_ARGS(Parrot_gc_pool_allocate_region)
+    const size_t total_size = sizeof (Pool_Allocator_Arena)
+                            + num_items * pool->object_size;
+
+    return add_pool_arena(interp, pool, total_size, num_items);
+}
+
 PARROT_EXPORT
 void
 Parrot_gc_pool_free(PARROT_INTERP, ARGMOD(Pool_Allocator *pool), ARGFREE(void *data))
@@ -379,7 +413,7 @@ Parrot_gc_pool_allocated_size(SHIM_INTERP, ARGIN(const Pool_Allocator *pool))
 {
     ASSERT_ARGS(Parrot_gc_pool_allocated_size)
 
-    return pool->num_arenas * arena_size(pool);
+    return pool->allocated_size;
 }
 
 PARROT_CAN_RETURN_NULL
@@ -532,35 +566,54 @@ static void
 allocate_new_pool_arena(PARROT_INTERP, ARGMOD(Pool_Allocator *pool))
 {
     ASSERT_ARGS(allocate_new_pool_arena)
-    Pool_Allocator_Free_List *next, *last;
-    Pool_Allocator_Arena     *new_arena;
-
     const size_t num_items  = pool->objects_per_alloc;
-    const size_t item_size  = pool->object_size;
-    const size_t item_space = item_size * num_items;
-    /* Round up to 4kb */
-    const size_t total_size = arena_size(pool);
+    Pool_Allocator_Free_List *next;
 
     /* Run a GC if needed */
     Parrot_gc_maybe_mark_and_sweep(interp, GC_trace_stack_FLAG);
 
-    new_arena = (Pool_Allocator_Arena *)mem_internal_allocate_zeroed(total_size);
+    next          = (Pool_Allocator_Free_List *)add_pool_arena(interp, pool,
+                        arena_size(pool), num_items);
+    pool->newfree = next;
+    pool->newlast = (Pool_Allocator_Free_List *)
+                    ((char *)next + num_items * pool->object_size);
+
+    pool->num_free_objects += num_items;
+}
+
+/*
+
+=item C<static void * add_pool_arena(PARROT_INTERP, Pool_Allocator *pool, size_t
+total_size, size_t num_items)>
+
+Allocate an arena of C<total_size> bytes holding C<num_items> objects and
+register its bounds with the pool. Returns the first object.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static void *
+add_pool_arena(PARROT_INTERP, ARGMOD(Pool_Allocator *pool),
+        size_t total_size, size_t num_items)
+{
+    ASSERT_ARGS(add_pool_arena)
+    Pool_Allocator_Arena * const new_arena =
+        (Pool_Allocator_Arena *)mem_internal_allocate_zeroed(total_size);
+    void * const next = new_arena + 1;
+    void * const last = (char *)next + num_items * pool->object_size;
 
     interp->gc_sys->stats.memory_allocated += total_size;
+    pool->allocated_size                   += total_size;
 
     new_arena->next = pool->top_arena;
     pool->top_arena = new_arena;
-    next            = (Pool_Allocator_Free_List *)(new_arena + 1);
-    last            = (Pool_Allocator_Free_List *)((char *)next + item_space);
-    pool->newfree   = next;
-    pool->newlast   = last;
-
-    pool->num_free_objects += num_items;
 
-    if (pool->lo_arena_ptr > (void *)next)
+    if (pool->lo_arena_ptr > next)
         pool->lo_arena_ptr = next;
 
-    if (pool->hi_arena_ptr < (void *)last)
+    if (pool->hi_arena_ptr < last)
         pool->hi_arena_ptr = last;
 
     if (pool->num_arenas % ARENA_BOUNDS_PADDING == 0)
@@ -572,6 +625,8 @@ allocate_new_pool_arena(PARROT_INTERP, ARGMOD(Pool_Allocator *pool))
         pool->arena_bounds[ptr_idx + 1] = last;
     }
     ++pool->num_arenas;
+
+    return next;
 }
 
 /*
@@ -40,6 +40,7 @@ typedef struct Pool_Allocator {
     size_t object_size;
     size_t objects_per_alloc;
     size_t num_free_objects;
+    size_t allocated_size;   /* bytes in all arenas and regions */
 
     Pool_Allocator_Arena     * top_arena;
     Pool_Allocator_Free_List * free_list;
@@ -106,6 +107,15 @@ void * Parrot_gc_pool_allocate(PARROT_INTERP, ARGMOD(Pool_Allocator * pool))
         __attribute__nonnull__(2)
         FUNC_MODIFIES(* pool);
 
+PARROT_CANNOT_RETURN_NULL
+PARROT_EXPORT
+void * Parrot_gc_pool_allocate_region(PARROT_INTERP,
+    ARGMOD(Pool_Allocator *pool),
+    size_t num_items)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pool);
+
 PARROT_EXPORT
 PARROT_WARN_UNUSED_RESULT
 size_t Parrot_gc_pool_allocated_size(PARROT_INTERP,
@@ -179,6 +189,10 @@ Pool_Allocator * Parrot_gc_pool_new(PARROT_INTERP, size_t object_size);
 #define ASSERT_ARGS_Parrot_gc_pool_allocate __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pool))
+#define ASSERT_ARGS_Parrot_gc_pool_allocate_region \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pool))
 #define ASSERT_ARGS_Parrot_gc_pool_allocated_size __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(pool))
 #define ASSERT_ARGS_Parrot_gc_pool_destroy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -50,10 +50,12 @@ GC algorithm is:
         ii) objects with on_dirty_list flag set.
         iii) move objects to "work_list" for fully mark objects without recursion.
 
-1. Trigger GC (based on phase of the Moon for simplicity. We can tune Moon later).
+1. Trigger GC every time C<gc_threshold> bytes (the nursery size) were
+allocated.
 
 2. Choose K - how many collections we want to collect. Collections [0..K] will
-be collected. Remember K in C<self->gen_to_collect>.
+be collected. Remember K in C<self->gen_to_collect>. See "Collection policy"
+below.
 
 3. Move all objects from dirty_list which has all direct children in
 generations not younger than object back to original lists. Reason for this is
@@ -68,7 +70,11 @@ C<gc_gms_get_youngest_generation> which iterate over direct children only.
 5. Iterate over "dirty_set" calling VTABLE_mark on it. It will move all
 children into "work_list".
 
-6. Iterate over "work_list" calling VTABLE_mark on it.
+6. Iterate over "work_list" calling VTABLE_mark on it.  With
+C<--gc-mark-threads> helper threads take part in this.  PMCs they mark are
+claimed with an atomic operation and stay in their generation lists instead
+of moving into "work_list"; the sweep only looks at live flags anyway.  See
+F<src/gc/parallel_mark.c>.
 
 7. Soil nursery root PMCs from C-stack.
 
@@ -96,6 +102,45 @@ references between iterations. Objects from "dirty_list" which is ready to be
 collected handled by "Step 3".
 
 
+Collection policy.
+
+Every sweep measures how many bytes of each collected generation survived and
+moves them into the next generation.  A generation is collected once the bytes
+promoted into it reach its budget; for the oldest generation only bytes
+promoted since its last collection count, so it may grow in proportion to the
+live data.  Budgets adapt to the survival rate found: a collection which finds
+most of a generation alive was wasted effort and doubles the budget, one which
+frees most of it halves the budget.  Generation 1 is collected at least every
+C<GC_MAX_NURSERY_RUNS> collections, because dead objects there may keep more
+alive than they weigh.  With C<--gc-max-heap> the old generations are also
+collected when they grow beyond it.
+
+The nursery size follows the goals given on the command line.  A nursery
+collection slower than C<--gc-pause-goal> shrinks it.  When GC takes a larger
+share of the run time than C<--gc-throughput-goal> allows, or when objects die
+soon after their first promotion, it grows so objects get more time to die
+young.
+
+
+Allocation.
+
+PMC and STRING headers are bump allocated from contiguous nursery blocks of
+C<GC_NURSERY_BLOCK_OBJECTS> headers.  Headers can't move, because the C stack
+is scanned conservatively, so survivors are promoted in place and the bump
+pointer skips over them.  Objects of generation 0 are in no list: the sweep
+walks the nursery blocks up to the bump pointer, and survivors enter the list
+of generation 1 when promoted.  Slots of dead headers are only flagged free by
+the sweep.  After each collection the bump pointer restarts at the first block
+and allocates from the runs of free slots it finds; a new block is added once
+all of them are used up.
+
+With C<--gc-lazy-sweep> the sweep still destroys dead PMCs of the nursery and
+promotes the survivors, but leaves freeing their attributes and slots to the
+bump allocator.  It sweeps each PMC block when it reaches it, and what it
+didn't get to before the next collection.  Destroying them first means no
+destructor sees a slot which was handed out again.  STRING headers are always
+swept at once, since the string pool compaction relies on it.
+
 Pictures of GC steps.
 TBD
 
@@ -111,11 +156,27 @@ TBD
 
 #define PANIC_OUT_OF_MEM(size) failed_allocation(__LINE__, (size))
 
+/* Bounds of the adaptive nursery size and budgets, relative to the initial
+ * nursery size */
+#define GC_MIN_NURSERY_SHIFT    3
+#define GC_MAX_NURSERY_SHIFT    3
+#define GC_MAX_BUDGET_SHIFT     10
+
+/* How far the nursery may grow without a throughput goal */
+#define GC_MAX_TENURING_SHIFT   1
+
+/* Collect generation 1 at least every so many collections. Its budget
+ * counts only the objects in it, not what dead ones there keep alive */
+#define GC_MAX_NURSERY_RUNS     16
+
+/* Survival rates above and below which a generation's budget is adapted */
+#define GC_HIGH_SURVIVAL        0.9
+#define GC_LOW_SURVIVAL         0.5
+
 /*
  * Maximum number of collections
  * NB:
  *  1. Maximum number is 8 due limit number of bits in PMC.flags.
- *  2. Don't forget to update gc_gms_select_generation_to_collect after changing it!
  */
 #define MAX_GENERATIONS     4
 
@@ -133,6 +194,40 @@ typedef struct string_alloc_struct {
 #define PMC2PAC(p) ((pmc_alloc_struct *)((char*)(p) - sizeof (void *)))
 #define STR2PAC(p) ((string_alloc_struct *)((char*)(p) - sizeof (void *)))
 
+/* Number of headers in each nursery block */
+#define GC_NURSERY_BLOCK_OBJECTS 1024
+
+/* Is the header in this pmc_alloc_struct or string_alloc_struct free? */
+#define SLOT_IS_FREE(slot) \
+        PObj_on_free_list_TEST((PObj *)((char *)(slot) + sizeof (void *)))
+
+/* Bump allocator for headers of one kind */
+typedef struct Header_Nursery {
+    /* Allocator owning the blocks */
+    struct Pool_Allocator  *pool;
+
+    /* First slot of every block */
+    char                  **blocks;
+    size_t                  num_blocks;
+
+    /* Block holding the bump pointer */
+    size_t                  current;
+
+    /* Bump pointer and the end of the free run it allocates from */
+    char                   *next;
+    char                   *limit;
+
+    /* Blocks from swept up to sweep_end still hold dead PMCs the lazy
+     * sweep left */
+    size_t                  swept;
+    size_t                  sweep_end;
+
+    /* End of the headers destructors allocated during the last sweep,
+     * beyond where it stopped. NULL if there are none */
+    size_t                  left_block;
+    char                   *left_next;
+} Header_Nursery;
+
 
 /* Get generation from PObj->flags */
 #define POBJ2GEN(pobj)                                                  \
@@ -154,6 +249,10 @@ typedef struct MarkSweep_GC {
     /* Allocator for PMC headers */
     struct Pool_Allocator  *pmc_allocator;
 
+    /* Bump allocators for PMC and STRING headers */
+    Header_Nursery          pmc_nursery;
+    Header_Nursery          string_nursery;
+
     /* During M&S gather new live objects in this list */
     struct Parrot_Pointer_Array     *work_list;
 
@@ -166,13 +265,14 @@ typedef struct MarkSweep_GC {
      */
     size_t    youngest_child;
 
-    /* Currently allocate objects. */
+    /* Objects of generations 1 and up. Generation 0 is only in the
+     * nursery blocks */
     struct Parrot_Pointer_Array     *objects[MAX_GENERATIONS];
 
     /* Allocator for strings */
     struct Pool_Allocator           *string_allocator;
 
-    /* MAX_GENERATIONS generations of strings */
+    /* Strings of generations 1 and up, as for objects */
     struct Parrot_Pointer_Array     *strings[MAX_GENERATIONS];
 
     /* Fixed-size allocator */
@@ -184,6 +284,50 @@ typedef struct MarkSweep_GC {
     /* Amount of allocated memory before trigger gc */
     size_t                  gc_threshold;
 
+    /* Initial gc_threshold. Adapted ones stay within a factor of it */
+    size_t                  nursery_size;
+
+    /* Bytes held by each generation. For the oldest one this includes
+     * old_survivors */
+    size_t                  gen_size[MAX_GENERATIONS];
+
+    /* Collect generation once it holds this many (new) bytes */
+    size_t                  gen_budget[MAX_GENERATIONS];
+
+    /* Bytes found live and dead by the current sweep */
+    size_t                  gen_live[MAX_GENERATIONS];
+    size_t                  gen_dead[MAX_GENERATIONS];
+
+    /* Bytes of oldest generation which survived its last collection */
+    size_t                  old_survivors;
+
+    /* String storage freed since the string pool was last compacted */
+    size_t                  strings_freed;
+
+    /* Nursery only collections since generation 1 was last collected */
+    size_t                  nursery_runs;
+
+    /* Collect old generations when they hold more bytes. 0 for no limit */
+    size_t                  max_heap;
+
+    /* Longest nursery collection we aim for, in seconds. 0 for no goal */
+    FLOATVAL                pause_goal;
+
+    /* Largest share of run time to spend in GC. 0 for no goal */
+    FLOATVAL                gc_share_goal;
+
+    /* Moving average of the share of run time spent in GC */
+    FLOATVAL                gc_share;
+
+    /* When the last collection finished */
+    FLOATVAL                last_gc_end;
+
+    /* Helper threads for marking. NULL to mark in one thread */
+    struct Parallel_Mark   *parallel_mark;
+
+    /* Leave freeing dead nursery PMCs to the allocator */
+    int                     lazy_sweep;
+
     /* During GC phase - which generation we are collecting */
     size_t                  gen_to_collect;
 
@@ -208,6 +352,12 @@ typedef void (*sweep_cb)(PARROT_INTERP, PObj *obj);
 PARROT_DOES_NOT_RETURN
 static void failed_allocation(unsigned int line, size_t size);
 
+static void gc_gms_adapt_policy(PARROT_INTERP,
+    ARGMOD(MarkSweep_GC *self),
+    FLOATVAL pause)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
 PARROT_MALLOC
 PARROT_CAN_RETURN_NULL
 static Parrot_Buffer* gc_gms_allocate_buffer_header(PARROT_INTERP,
@@ -356,11 +506,70 @@ static void gc_gms_mark_pmc_header(PARROT_INTERP, ARGMOD(PMC *pmc))
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*pmc);
 
+static void gc_gms_mark_pmc_header_parallel(PARROT_INTERP, ARGMOD(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pmc);
+
 static void gc_gms_mark_str_header(PARROT_INTERP, ARGMOD(STRING *str))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*str);
 
+static void gc_gms_mark_str_header_parallel(PARROT_INTERP,
+    ARGMOD(STRING *str))
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*str);
+
+static void gc_gms_mark_work_list_parallel(PARROT_INTERP,
+    ARGIN(MarkSweep_GC *self),
+    ARGIN(Parrot_Pointer_Array *work_list))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_CANNOT_RETURN_NULL
+static void * gc_gms_nursery_allocate(PARROT_INTERP,
+    ARGMOD(Header_Nursery *nursery))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*nursery);
+
+static void gc_gms_nursery_extend(
+    ARGIN(const Header_Nursery *nursery),
+    ARGMOD(size_t *end),
+    ARGMOD(char **stop))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*end)
+        FUNC_MODIFIES(*stop);
+
+static void gc_gms_nursery_next_run(PARROT_INTERP,
+    ARGMOD(Header_Nursery *nursery))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*nursery);
+
+static void gc_gms_nursery_rewind(
+    ARGMOD(Header_Nursery *nursery),
+    size_t end,
+    ARGIN_NULLOK(char *stop))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*nursery);
+
+static void gc_gms_nursery_sweep_all(PARROT_INTERP,
+    ARGMOD(Header_Nursery *nursery))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*nursery);
+
+static void gc_gms_nursery_sweep_block(PARROT_INTERP,
+    ARGMOD(Header_Nursery *nursery))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*nursery);
+
 static void gc_gms_pmc_get_youngest_generation(PARROT_INTERP,
     ARGIN(PMC *pmc))
         __attribute__nonnull__(1)
@@ -390,6 +599,16 @@ static void gc_gms_process_work_list(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+static void gc_gms_promote_pmc(PARROT_INTERP,
+    ARGMOD(MarkSweep_GC *self),
+    ARGMOD(pmc_alloc_struct *item),
+    size_t gen)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*self)
+        FUNC_MODIFIES(*item);
+
 static void gc_gms_reallocate_buffer_storage(PARROT_INTERP,
     ARGIN(Parrot_Buffer *str),
     size_t size)
@@ -415,6 +634,20 @@ static void gc_gms_reallocate_string_storage(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void gc_gms_reclaim_pmc(PARROT_INTERP, ARGMOD(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pmc);
+
+static void gc_gms_reclaim_string(PARROT_INTERP,
+    ARGMOD(MarkSweep_GC *self),
+    ARGMOD(STRING *str))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*self)
+        FUNC_MODIFIES(*str);
+
 static void gc_gms_seal_object(PARROT_INTERP, ARGIN(PMC *pmc))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
@@ -427,6 +660,11 @@ static void gc_gms_str_get_youngest_generation(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void gc_gms_sweep_nursery(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*self);
+
 static void gc_gms_sweep_pools(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
@@ -459,6 +697,8 @@ static void gc_gms_write_barrier(PARROT_INTERP, ARGMOD(PMC *pmc))
 
 static int gen2flags(int gen);
 #define ASSERT_ARGS_failed_allocation __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_gc_gms_adapt_policy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(self))
 #define ASSERT_ARGS_gc_gms_allocate_buffer_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_gc_gms_allocate_buffer_storage \
@@ -543,9 +783,39 @@ static int gen2flags(int gen);
 #define ASSERT_ARGS_gc_gms_mark_pmc_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_gc_gms_mark_pmc_header_parallel \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
 #define ASSERT_ARGS_gc_gms_mark_str_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_gc_gms_mark_str_header_parallel \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_gc_gms_mark_work_list_parallel \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(work_list))
+#define ASSERT_ARGS_gc_gms_nursery_allocate __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(nursery))
+#define ASSERT_ARGS_gc_gms_nursery_extend __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(nursery) \
+    , PARROT_ASSERT_ARG(end) \
+    , PARROT_ASSERT_ARG(stop))
+#define ASSERT_ARGS_gc_gms_nursery_next_run __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(nursery))
+#define ASSERT_ARGS_gc_gms_nursery_rewind __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(nursery))
+#define ASSERT_ARGS_gc_gms_nursery_sweep_all __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(nursery))
+#define ASSERT_ARGS_gc_gms_nursery_sweep_block __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(nursery))
 #define ASSERT_ARGS_gc_gms_pmc_get_youngest_generation \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -565,6 +835,10 @@ static int gen2flags(int gen);
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(self) \
     , PARROT_ASSERT_ARG(work_list))
+#define ASSERT_ARGS_gc_gms_promote_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(item))
 #define ASSERT_ARGS_gc_gms_reallocate_buffer_storage \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -577,6 +851,13 @@ static int gen2flags(int gen);
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_gc_gms_reclaim_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_gc_gms_reclaim_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(str))
 #define ASSERT_ARGS_gc_gms_seal_object __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmc))
@@ -587,6 +868,9 @@ static int gen2flags(int gen);
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_gc_gms_sweep_nursery __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
 #define ASSERT_ARGS_gc_gms_sweep_pools __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(self))
@@ -730,6 +1014,9 @@ Parrot_gc_gms_init(PARROT_INTERP, ARGIN(Parrot_GC_Init_Args *args))
         self->string_allocator = Parrot_gc_pool_new(interp,
             sizeof (string_alloc_struct));
 
+        self->pmc_nursery.pool    = self->pmc_allocator;
+        self->string_nursery.pool = self->string_allocator;
+
         /* Allocate list for gray objects */
         self->work_list  = NULL;
         self->dirty_list = Parrot_pa_new(interp);
@@ -747,8 +1034,23 @@ Parrot_gc_gms_init(PARROT_INTERP, ARGIN(Parrot_GC_Init_Args *args))
          * Configured by runtime parameter (default 2%).
          */
         self->gc_threshold = Parrot_sysmem_amount(interp) * nursery_size / 100;
+        self->nursery_size = self->gc_threshold;
+
+        for (i = 1; i < MAX_GENERATIONS; i++)
+            self->gen_budget[i] = self->gc_threshold;
+
+        self->max_heap      = args->max_heap;
+        self->lazy_sweep    = args->lazy_sweep;
+        self->pause_goal    = args->pause_goal / 1000;
+        self->gc_share_goal = args->throughput_goal > 0
+                            ? (100 - args->throughput_goal) / 100
+                            : 0;
+        self->last_gc_end   = Parrot_floatval_time();
+
+        self->parallel_mark = Parrot_gc_parallel_mark_new(interp,
+                                                          args->mark_threads);
 
-        Parrot_gc_str_initialize(interp, &self->string_gc);
+        Parrot_gc_str_initialize(interp, &self->string_gc, args->compact_limit);
     }
 
     interp->gc_sys->gc_private = self;
@@ -761,6 +1063,8 @@ gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     ASSERT_ARGS(gc_gms_mark_and_sweep)
     MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
     int gen = -1;
+    FLOATVAL gc_start;
+    GC_Event *event;
 
     /* GC is blocked */
     if (self->gc_mark_block_level)
@@ -774,9 +1078,14 @@ gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     if (flags & GC_strings_cb_FLAG)
         return;
 
+    /* Free what the allocator didn't get to since the last run */
+    gc_gms_nursery_sweep_all(interp, &self->pmc_nursery);
+
     /* Block further GC calls */
     ++self->gc_mark_block_level;
     self->work_list = Parrot_pa_new(interp);
+    event           = Parrot_gc_event_start(interp, 0);
+    gc_start        = event->start;
 
     interp->gc_sys->stats.gc_mark_runs++;
 
@@ -788,6 +1097,7 @@ gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     will be collected. Remember K in C<self->gen_to_collect>.
     */
     self->gen_to_collect = gen = gc_gms_select_generation_to_collect(interp);
+    event->generation    = gen;
 
     /*
     3. Move all objects from collections younger K from dirty_list
@@ -802,7 +1112,8 @@ gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     4. Trace root objects. According to "0. Pre-requirements" we will ignore all
     "old" objects. All relevant objects are moved into "work_list".
     */
-    gc_gms_mark_pmc_header(interp, PMCNULL);
+    if (!Interp_flags_TEST(interp, PARROT_IS_THREAD))
+        gc_gms_mark_pmc_header(interp, PMCNULL);
     Parrot_gc_trace_root(interp, NULL, GC_TRACE_FULL);
 
     if (interp->pdb && interp->pdb->debugger)
@@ -844,9 +1155,14 @@ gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     /* We swept all dead objects */
     self->num_early_gc_PMCs                      = 0;
 
-    /* Don't compact after nursery collection */
-    if (gen)
+    /* Don't compact after nursery collection, unless it freed a lot of
+     * string storage. Nothing else will give it back */
+    if (gen || self->strings_freed >= self->gc_threshold) {
         gc_gms_compact_memory_pool(interp);
+        self->strings_freed = 0;
+    }
+
+    gc_gms_adapt_policy(interp, self, Parrot_floatval_time() - gc_start);
 
     gc_gms_check_sanity(interp);
 
@@ -856,13 +1172,18 @@ gc_gms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     self->work_list = NULL;
 
     gc_gms_validate_objects(interp);
+
+    Parrot_gc_event_finish(interp);
 }
 
 /*
 
 =item C<static size_t gc_gms_select_generation_to_collect(PARROT_INTERP)>
 
-Select how many generations we do want to collect.
+Select how many generations we do want to collect: the oldest one which used
+up its budget, or all of them when the old generations outgrew the maximum
+heap size.  Generation 1 is collected at least every C<GC_MAX_NURSERY_RUNS>
+collections.
 
 =cut
 
@@ -871,28 +1192,128 @@ static size_t
 gc_gms_select_generation_to_collect(PARROT_INTERP)
 {
     ASSERT_ARGS(gc_gms_select_generation_to_collect)
-    /* TODO Use less naive approach. E.g. count amount of allocated memory in
-     * older generations */
-    size_t runs = interp->gc_sys->stats.gc_mark_runs;
+    MarkSweep_GC * const self     = (MarkSweep_GC *)interp->gc_sys->gc_private;
+    const size_t         oldest   = MAX_GENERATIONS - 1;
+    size_t               old_size = self->gen_size[oldest];
+    size_t               gen      = 0;
+    size_t               i;
+
+    if (++self->nursery_runs >= GC_MAX_NURSERY_RUNS)
+        gen = 1;
+
+    for (i = 1; i < oldest; i++) {
+        if (self->gen_size[i] >= self->gen_budget[i])
+            gen = i;
+        old_size += self->gen_size[i];
+    }
+
+    if (self->gen_size[oldest] - self->old_survivors >= self->gen_budget[oldest])
+        gen = oldest;
+
+    /* Don't collect over and over when live data alone exceed the limit */
+    if (self->max_heap && old_size > self->max_heap
+    &&  old_size - self->old_survivors >= self->nursery_size >> GC_MIN_NURSERY_SHIFT)
+        gen = oldest;
+
+    return gen;
+}
+
 /*
-    if (runs % 100000000 == 0)
-        return 8;
-    if (runs % 10000000 == 0)
-        return 7;
-    if (runs % 1000000 == 0)
-        return 6;
-    if (runs % 100000 == 0)
-        return 5;
-    if (runs % 10000 == 0)
-        return 4;
+
+=item C<static void gc_gms_adapt_policy(PARROT_INTERP, MarkSweep_GC *self,
+FLOATVAL pause)>
+
+Update generation sizes with the bytes the last sweep found live, adapt the
+budgets of the collected generations to their survival rates and the nursery
+size to the pause and throughput goals.  C<pause> is how long the collection
+took, in seconds.
+
+=cut
+
 */
-    if (runs % 1000 == 0)
-        return 3;
-    if (runs % 100 == 0)
-        return 2;
-    if (runs % 10 == 0)
-        return 1;
-    return 0;
+static void
+gc_gms_adapt_policy(SHIM_INTERP, ARGMOD(MarkSweep_GC *self), FLOATVAL pause)
+{
+    ASSERT_ARGS(gc_gms_adapt_policy)
+    const size_t   oldest       = MAX_GENERATIONS - 1;
+    const size_t   min_budget   = self->nursery_size >> GC_MIN_NURSERY_SHIFT;
+    const size_t   max_budget   = self->nursery_size << GC_MAX_BUDGET_SHIFT;
+    const size_t   max_nursery  = self->nursery_size << (self->gc_share_goal > 0
+                                ? GC_MAX_NURSERY_SHIFT : GC_MAX_TENURING_SHIFT);
+    const FLOATVAL now          = Parrot_floatval_time();
+    const size_t   gen          = self->gen_to_collect;
+    int            grow_nursery = 0;
+    INTVAL         i;
+
+    if (gen)
+        self->nursery_runs = 0;
+
+    /* Survivors moved into the next generation, or stay in the oldest */
+    for (i = gen; i >= 0; i--) {
+        if ((size_t)i == oldest) {
+            self->gen_size[i]    = self->gen_live[i];
+            self->old_survivors  = self->gen_live[i];
+        }
+        else {
+            self->gen_size[i]      = 0;
+            self->gen_size[i + 1] += self->gen_live[i];
+        }
+    }
+
+    for (i = 1; (size_t)i <= gen; i++) {
+        const size_t total = self->gen_live[i] + self->gen_dead[i];
+        FLOATVAL     survival;
+
+        if (!total)
+            continue;
+
+        survival = (FLOATVAL)self->gen_live[i] / total;
+
+        if (survival > GC_HIGH_SURVIVAL) {
+            if (self->gen_budget[i] < max_budget)
+                self->gen_budget[i] *= 2;
+        }
+        else if (survival < GC_LOW_SURVIVAL) {
+            if (self->gen_budget[i] / 2 >= min_budget)
+                self->gen_budget[i] /= 2;
+
+            /* Objects die soon after promotion. Keep them in the nursery
+             * for longer */
+            if (i == 1)
+                grow_nursery = 1;
+        }
+    }
+
+    if (now > self->last_gc_end)
+        self->gc_share = (3 * self->gc_share
+                       + pause / (now - self->last_gc_end)) / 4;
+    self->last_gc_end = now;
+
+    if (self->gc_share_goal > 0 && self->gc_share > self->gc_share_goal)
+        grow_nursery = 1;
+
+    if (self->pause_goal > 0) {
+        if (pause > self->pause_goal) {
+            /* Old collection too slow. Collect in smaller steps */
+            if (gen) {
+                if (self->gen_budget[gen] / 2 >= min_budget)
+                    self->gen_budget[gen] /= 2;
+            }
+            else if (self->gc_threshold - self->gc_threshold / 4 >= min_budget) {
+                self->gc_threshold -= self->gc_threshold / 4;
+            }
+
+            return;
+        }
+
+        /* Recover from an earlier slow collection */
+        if (!gen && pause < self->pause_goal / 2
+        &&  self->gc_threshold < self->nursery_size)
+            grow_nursery = 1;
+    }
+
+    if (grow_nursery && self->gc_threshold + self->gc_threshold / 4 <= max_nursery)
+        self->gc_threshold += self->gc_threshold / 4;
 }
 
 /*
@@ -1008,14 +1429,19 @@ gc_gms_process_work_list(PARROT_INTERP,
 {
     ASSERT_ARGS(gc_gms_process_work_list)
 
-    POINTER_ARRAY_ITER(work_list,
-        PMC * const pmc = &((pmc_alloc_struct *)ptr)->pmc;
+    if (self->parallel_mark) {
+        gc_gms_mark_work_list_parallel(interp, self, work_list);
+    }
+    else {
+        POINTER_ARRAY_ITER(work_list,
+            PMC * const pmc = &((pmc_alloc_struct *)ptr)->pmc;
 
-        if (PObj_custom_mark_TEST(pmc))
-            VTABLE_mark(interp, pmc);
+            if (PObj_custom_mark_TEST(pmc))
+                VTABLE_mark(interp, pmc);
 
-        if (PMC_metadata(pmc))
-            Parrot_gc_mark_PMC_alive(interp, PMC_metadata(pmc)););
+            if (PMC_metadata(pmc))
+                Parrot_gc_mark_PMC_alive(interp, PMC_metadata(pmc)););
+    }
 
     gc_gms_print_stats(interp, "Before cleaning work_list");
 
@@ -1028,12 +1454,48 @@ gc_gms_process_work_list(PARROT_INTERP,
         PARROT_ASSERT(!PObj_GC_on_dirty_list_TEST(pmc));
 
         Parrot_pa_remove(interp, work_list, item->ptr);
-        item->ptr = Parrot_pa_insert(self->objects[gen], item););
+        if (gen)
+            item->ptr = Parrot_pa_insert(self->objects[gen], item););
 
 }
 
 /*
 
+=item C<static void gc_gms_mark_work_list_parallel(PARROT_INTERP, MarkSweep_GC
+*self, Parrot_Pointer_Array *work_list)>
+
+Mark everything reachable from "work_list" with helper threads.  PMCs marked
+meanwhile stay in their generation lists.
+
+=cut
+
+*/
+static void
+gc_gms_mark_work_list_parallel(PARROT_INTERP,
+        ARGIN(MarkSweep_GC *self),
+        ARGIN(Parrot_Pointer_Array *work_list))
+{
+    ASSERT_ARGS(gc_gms_mark_work_list_parallel)
+    const size_t count = Parrot_pa_count_used(interp, work_list);
+    PMC        **grey  = mem_internal_allocate_n_zeroed_typed(count ? count : 1, PMC *);
+    size_t       n     = 0;
+
+    POINTER_ARRAY_ITER(work_list,
+        grey[n++] = &((pmc_alloc_struct *)ptr)->pmc;);
+
+    interp->gc_sys->mark_pmc_header = gc_gms_mark_pmc_header_parallel;
+    interp->gc_sys->mark_str_header = gc_gms_mark_str_header_parallel;
+
+    Parrot_gc_parallel_mark_run(interp, self->parallel_mark, grey, n);
+
+    interp->gc_sys->mark_pmc_header = gc_gms_mark_pmc_header;
+    interp->gc_sys->mark_str_header = gc_gms_mark_str_header;
+
+    mem_internal_free(grey);
+}
+
+/*
+
 =item C<static void gc_gms_sweep_pools(PARROT_INTERP, MarkSweep_GC *self)>
 
 Sweep generations starting from K:
@@ -1041,6 +1503,8 @@ Sweep generations starting from K:
     - Move live objects into generation max(K+1, N)
     - Paint them white.
 
+Generation 0 is swept by C<gc_gms_sweep_nursery>.
+
 =cut
 
 */
@@ -1048,68 +1512,64 @@ static void
 gc_gms_sweep_pools(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
 {
     ASSERT_ARGS(gc_gms_sweep_pools)
-
+    GC_Event * const event = interp->gc_sys->event;
     INTVAL i;
 
-    for (i = self->gen_to_collect; i >= 0; i--) {
+    for (i = self->gen_to_collect; i > 0; i--) {
         /* Don't move to generation beyond last */
         const int move_to_old = (i + 1) != MAX_GENERATIONS;
 
+        self->gen_live[i] = 0;
+        self->gen_dead[i] = 0;
+
         POINTER_ARRAY_ITER(self->objects[i],
             pmc_alloc_struct * const item = (pmc_alloc_struct *)ptr;
             PMC              * const pmc  = &(item->pmc);
+            const size_t             size = sizeof (PMC) + pmc->vtable->attr_size;
 
             PARROT_ASSERT(PObj_constant_TEST(pmc) || (int)POBJ2GEN(pmc) == i);
 
             /* Paint live objects white */
             if (PObj_live_TEST(pmc) || PObj_constant_TEST(pmc)) {
                 PObj_live_CLEAR(pmc);
+                self->gen_live[i] += size;
+                ++event->marked;
 
                 if (move_to_old) {
-                    SET_GEN_FLAGS(pmc, i + 1);
-
+                    event->promoted += size;
                     Parrot_pa_remove(interp, self->objects[i], item->ptr);
-                    /* If this was freshly allocated object in C stack - move it to dirty list */
-                    if (PObj_GC_soil_root_TEST(pmc)) {
-                        item->ptr = Parrot_pa_insert(self->dirty_list, item);
-                        PObj_GC_soil_root_CLEAR(pmc);
-                        PObj_GC_on_dirty_list_SET(pmc);
-                    }
-                    else {
-                        item->ptr = Parrot_pa_insert(self->objects[i + 1], item);
-                        gc_gms_seal_object(interp, pmc);
-                    }
+                    gc_gms_promote_pmc(interp, self, item, i + 1);
                 }
             }
             else {
                 Parrot_pa_remove(interp, self->objects[i], item->ptr);
 
+                self->gen_dead[i] += size;
+                ++event->swept;
                 interp->gc_sys->stats.memory_used -= sizeof (PMC);
 
                 /* this is manual inlining of Parrot_pmc_destroy() */
                 if (PObj_custom_destroy_TEST(pmc))
                     VTABLE_destroy(interp, pmc);
 
-                if (pmc->vtable->attr_size && PMC_data(pmc))
-                    Parrot_gc_free_pmc_attributes(interp, pmc);
-                PMC_data(pmc) = NULL;
-
-                PObj_on_free_list_SET(pmc);
-                PObj_gc_CLEAR(pmc);
-
-                Parrot_gc_pool_free(interp, self->pmc_allocator, ptr);
+                gc_gms_reclaim_pmc(interp, pmc);
             });
 
         POINTER_ARRAY_ITER(self->strings[i],
             string_alloc_struct * const item = (string_alloc_struct *)ptr;
-            STRING * const str = &(item->str);
+            STRING * const str  = &(item->str);
+            const size_t   size = sizeof (STRING)
+                                + (PObj_external_TEST(str) ? 0 : Buffer_buflen(str));
 
             PARROT_ASSERT(!PObj_on_free_list_TEST(str));
 
             /* Paint live objects white */
             if (PObj_live_TEST(str) || PObj_constant_TEST(str)) {
                 PObj_live_CLEAR(str);
+                self->gen_live[i] += size;
+                ++event->marked;
                 if (move_to_old) {
+                    event->promoted += size;
                     Parrot_pa_remove(interp, self->strings[i], item->ptr);
                     item->ptr = Parrot_pa_insert(self->strings[i + 1], item);
                     SET_GEN_FLAGS(str, i + 1);
@@ -1118,18 +1578,208 @@ gc_gms_sweep_pools(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
 
             else {
                 Parrot_pa_remove(interp, self->strings[i], item->ptr);
-                if (Buffer_bufstart(str) && !PObj_external_TEST(str))
-                    Parrot_gc_str_free_buffer_storage(
-                        interp, &self->string_gc, (Parrot_Buffer*)str);
+                self->gen_dead[i] += size;
+                ++event->swept;
+                gc_gms_reclaim_string(interp, self, str);
+            });
+    }
+
+    gc_gms_sweep_nursery(interp, self);
+}
 
-                interp->gc_sys->stats.memory_used -= sizeof (STRING);
+/*
 
-                PObj_on_free_list_SET(str);
+=item C<static void gc_gms_sweep_nursery(PARROT_INTERP, MarkSweep_GC *self)>
 
-                Parrot_gc_pool_free(interp, self->string_allocator, ptr);
-            });
+Sweep generation 0.  Its objects are in no list, so walk the nursery blocks
+up to the bump pointers; beyond them are older objects, and the ones
+destructors allocate meanwhile.  Survivors move into the list of generation
+1, dead objects are destroyed and their slots flagged free.  Then allocation
+restarts at the first block.
+
+With C<--gc-lazy-sweep> dead PMCs are only destroyed, and their blocks left
+to C<gc_gms_nursery_sweep_block>.  Except for the last one, which may hold
+objects allocated by destructors.
+
+=cut
+
+*/
+static void
+gc_gms_sweep_nursery(PARROT_INTERP, ARGMOD(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_gms_sweep_nursery)
+    GC_Event       * const event    = interp->gc_sys->event;
+    Header_Nursery * const pmcs     = &self->pmc_nursery;
+    Header_Nursery * const strings  = &self->string_nursery;
+    const size_t           pmc_size = pmcs->pool->object_size;
+    const size_t           str_size = strings->pool->object_size;
+    size_t                 pmc_end  = pmcs->num_blocks ? pmcs->current + 1 : 0;
+    size_t                 str_end  = strings->num_blocks ? strings->current + 1 : 0;
+    char                  *pmc_stop = pmcs->next;
+    char                  *str_stop = strings->next;
+    size_t                 b;
+
+    gc_gms_nursery_extend(pmcs, &pmc_end, &pmc_stop);
+    gc_gms_nursery_extend(strings, &str_end, &str_stop);
+
+    self->gen_live[0] = 0;
+    self->gen_dead[0] = 0;
+
+    for (b = 0; b < pmc_end; b++) {
+        char * const block = pmcs->blocks[b];
+        char * const end   = b + 1 < pmc_end
+                           ? block + GC_NURSERY_BLOCK_OBJECTS * pmc_size
+                           : pmc_stop;
+        char        *slot;
+
+        for (slot = block; slot < end; slot += pmc_size) {
+            pmc_alloc_struct * const item = (pmc_alloc_struct *)slot;
+            PMC              * const pmc  = &(item->pmc);
+            size_t                   size;
+
+            if (SLOT_IS_FREE(slot) || POBJ2GEN(pmc))
+                continue;
+
+            size = sizeof (PMC) + pmc->vtable->attr_size;
+
+            /* Paint live objects white */
+            if (PObj_live_TEST(pmc) || PObj_constant_TEST(pmc)) {
+                PObj_live_CLEAR(pmc);
+                self->gen_live[0] += size;
+                event->promoted   += size;
+                ++event->marked;
+                gc_gms_promote_pmc(interp, self, item, 1);
+            }
+            else {
+                self->gen_dead[0] += size;
+                ++event->swept;
+                interp->gc_sys->stats.memory_used -= sizeof (PMC);
+
+                if (PObj_custom_destroy_TEST(pmc))
+                    VTABLE_destroy(interp, pmc);
+
+                if (self->lazy_sweep && b + 1 < pmc_end)
+                    PObj_custom_destroy_CLEAR(pmc);
+                else
+                    gc_gms_reclaim_pmc(interp, pmc);
+            }
+        }
+    }
+
+    for (b = 0; b < str_end; b++) {
+        char * const block = strings->blocks[b];
+        char * const end   = b + 1 < str_end
+                           ? block + GC_NURSERY_BLOCK_OBJECTS * str_size
+                           : str_stop;
+        char        *slot;
+
+        for (slot = block; slot < end; slot += str_size) {
+            string_alloc_struct * const item = (string_alloc_struct *)slot;
+            STRING              * const str  = &(item->str);
+            size_t                      size;
+
+            if (SLOT_IS_FREE(slot) || POBJ2GEN(str))
+                continue;
+
+            size = sizeof (STRING)
+                 + (PObj_external_TEST(str) ? 0 : Buffer_buflen(str));
+
+            /* Paint live objects white */
+            if (PObj_live_TEST(str) || PObj_constant_TEST(str)) {
+                PObj_live_CLEAR(str);
+                self->gen_live[0] += size;
+                event->promoted   += size;
+                ++event->marked;
+                item->ptr = Parrot_pa_insert(self->strings[1], item);
+                SET_GEN_FLAGS(str, 1);
+            }
+            else {
+                self->gen_dead[0] += size;
+                ++event->swept;
+                gc_gms_reclaim_string(interp, self, str);
+            }
+        }
+    }
+
+    /* Reuse the slots freed above, remembering what destructors allocated */
+    gc_gms_nursery_rewind(pmcs, pmc_end, pmc_stop);
+    gc_gms_nursery_rewind(strings, str_end, str_stop);
+
+    if (self->lazy_sweep && pmc_end)
+        pmcs->sweep_end = pmc_end - 1;
+}
+
+/*
+
+=item C<static void gc_gms_promote_pmc(PARROT_INTERP, MarkSweep_GC *self,
+pmc_alloc_struct *item, size_t gen)>
+
+Move a live PMC, which is in no list now, into generation C<gen>.  A PMC
+found on the C stack goes onto the dirty list instead.
+
+=item C<static void gc_gms_reclaim_pmc(PARROT_INTERP, PMC *pmc)>
+
+Free attributes and slot of a dead PMC, which was destroyed already.
+
+=item C<static void gc_gms_reclaim_string(PARROT_INTERP, MarkSweep_GC *self,
+STRING *str)>
+
+Free storage and slot of a dead STRING.
+
+=cut
+
+*/
+static void
+gc_gms_promote_pmc(PARROT_INTERP, ARGMOD(MarkSweep_GC *self),
+        ARGMOD(pmc_alloc_struct *item), size_t gen)
+{
+    ASSERT_ARGS(gc_gms_promote_pmc)
+    PMC * const pmc = &(item->pmc);
+
+    SET_GEN_FLAGS(pmc, gen);
+
+    /* If this was freshly allocated object in C stack - move it to dirty list */
+    if (PObj_GC_soil_root_TEST(pmc)) {
+        item->ptr = Parrot_pa_insert(self->dirty_list, item);
+        PObj_GC_soil_root_CLEAR(pmc);
+        PObj_GC_on_dirty_list_SET(pmc);
     }
+    else {
+        item->ptr = Parrot_pa_insert(self->objects[gen], item);
+        gc_gms_seal_object(interp, pmc);
+    }
+}
 
+static void
+gc_gms_reclaim_pmc(PARROT_INTERP, ARGMOD(PMC *pmc))
+{
+    ASSERT_ARGS(gc_gms_reclaim_pmc)
+
+    if (pmc->vtable->attr_size && PMC_data(pmc))
+        Parrot_gc_free_pmc_attributes(interp, pmc);
+    PMC_data(pmc) = NULL;
+
+    PObj_on_free_list_SET(pmc);
+    PObj_gc_CLEAR(pmc);
+}
+
+static void
+gc_gms_reclaim_string(PARROT_INTERP, ARGMOD(MarkSweep_GC *self),
+        ARGMOD(STRING *str))
+{
+    ASSERT_ARGS(gc_gms_reclaim_string)
+
+    if (!PObj_external_TEST(str))
+        self->strings_freed += Buffer_buflen(str);
+    if (str->index)
+        Parrot_str_free_index(interp, str);
+    if (Buffer_bufstart(str) && !PObj_external_TEST(str))
+        Parrot_gc_str_free_buffer_storage(
+            interp, &self->string_gc, (Parrot_Buffer*)str);
+
+    interp->gc_sys->stats.memory_used -= sizeof (STRING);
+
+    PObj_on_free_list_SET(str);
 }
 
 
@@ -1169,7 +1819,8 @@ gc_gms_mark_pmc_header(PARROT_INTERP, ARGMOD(PMC *pmc))
     /* mark it live. */
     PObj_live_SET(pmc);
 
-    Parrot_pa_remove(interp, self->objects[gen], item->ptr);
+    if (gen)
+        Parrot_pa_remove(interp, self->objects[gen], item->ptr);
     item->ptr = Parrot_pa_insert(self->work_list, item);
 }
 
@@ -1191,6 +1842,46 @@ gc_gms_mark_str_header(PARROT_INTERP, ARGMOD(STRING *str))
     PObj_live_SET(str);
 }
 
+/*
+
+=item C<static void gc_gms_mark_pmc_header_parallel(PARROT_INTERP, PMC *pmc)>
+
+=item C<static void gc_gms_mark_str_header_parallel(PARROT_INTERP, STRING *str)>
+
+Mark objects from helper threads.  Same as above, but PMCs claimed by this
+thread are pushed for scanning instead of moved into "work_list".
+
+=cut
+
+*/
+
+static void
+gc_gms_mark_pmc_header_parallel(PARROT_INTERP, ARGMOD(PMC *pmc))
+{
+    ASSERT_ARGS(gc_gms_mark_pmc_header_parallel)
+    MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+
+    PARROT_ASSERT(!PObj_on_free_list_TEST(pmc)
+        || !"Resurrecting of dead objects is not supported");
+
+    if (PObj_live_TEST(pmc)
+    ||  POBJ2GEN(pmc) > self->gen_to_collect
+    ||  PObj_GC_on_dirty_list_TEST(pmc))
+        return;
+
+    if (PObj_live_CLAIM(pmc))
+        Parrot_gc_parallel_mark_push(self->parallel_mark, pmc);
+}
+
+static void
+gc_gms_mark_str_header_parallel(SHIM_INTERP, ARGMOD(STRING *str))
+{
+    ASSERT_ARGS(gc_gms_mark_str_header_parallel)
+
+    if (!PObj_live_TEST(str))
+        (void)PObj_live_CLAIM(str);
+}
+
 
 /*
 
@@ -1327,21 +2018,25 @@ gc_gms_get_gc_info(PARROT_INTERP, Interpinfo_enum which)
 
     if (which == IMPATIENT_PMCS)
         return self->num_early_gc_PMCs;
-    if (which == TOTAL_PMCS) {
-        /* It's higher than actual number of allocated PMCs */
-        size_t ret = 0;
-        size_t i;
-        for (i = 0; i < MAX_GENERATIONS; i++) {
-            ret += Parrot_pa_count_allocated(interp, self->objects[i]);
-        }
-        return ret;
-    }
+    if (which == TOTAL_PMCS)
+        return self->pmc_nursery.num_blocks * GC_NURSERY_BLOCK_OBJECTS;
     if (which == ACTIVE_PMCS) {
-        /* It's higher than actual number of allocated PMCs */
-        size_t ret = 0;
-        size_t i;
-        for (i = 0; i < MAX_GENERATIONS; i++) {
-            ret += Parrot_pa_count_used(interp, self->objects[i]);
+        /* Dead PMCs the lazy sweep left aren't active */
+        Header_Nursery * const nursery = &self->pmc_nursery;
+        const size_t           size    = nursery->pool->object_size;
+        size_t                 ret     = 0;
+        size_t                 b;
+
+        gc_gms_nursery_sweep_all(interp, nursery);
+
+        for (b = 0; b < nursery->num_blocks; b++) {
+            char * const block = nursery->blocks[b];
+            char * const end   = block + GC_NURSERY_BLOCK_OBJECTS * size;
+            char        *slot;
+
+            for (slot = block; slot < end; slot += size)
+                if (!SLOT_IS_FREE(slot))
+                    ++ret;
         }
         return ret;
     }
@@ -1365,6 +2060,11 @@ gc_gms_finalize(PARROT_INTERP)
     MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
     size_t        i;
 
+    if (self->parallel_mark) {
+        Parrot_gc_parallel_mark_destroy(interp, self->parallel_mark);
+        self->parallel_mark = NULL;
+    }
+
     Parrot_gc_str_finalize(interp, &self->string_gc);
 
     for (i = 0; i < MAX_GENERATIONS; i++) {
@@ -1372,6 +2072,9 @@ gc_gms_finalize(PARROT_INTERP)
         Parrot_pa_destroy(interp, self->strings[i]);
     }
 
+    mem_internal_free(self->pmc_nursery.blocks);
+    mem_internal_free(self->string_nursery.blocks);
+
     Parrot_gc_pool_destroy(interp, self->pmc_allocator);
     Parrot_gc_pool_destroy(interp, self->string_allocator);
     Parrot_gc_fixed_allocator_destroy(interp, self->fixed_size_allocator);
@@ -1379,10 +2082,200 @@ gc_gms_finalize(PARROT_INTERP)
 
 /*
 
+=item C<static void * gc_gms_nursery_allocate(PARROT_INTERP, Header_Nursery
+*nursery)>
+
+Bump allocate a header slot. The slot is still flagged free; the caller
+initializes the header flags.
+
+=item C<static void gc_gms_nursery_next_run(PARROT_INTERP, Header_Nursery
+*nursery)>
+
+Move the bump pointer to the next run of free slots, adding a new block when
+there is none left.
+
+=item C<static void gc_gms_nursery_rewind(Header_Nursery *nursery, size_t end,
+char *stop)>
+
+Restart allocation at the first block, so slots freed by the last sweep are
+used again.  The sweep went up to the bump pointer C<stop> in block C<end -
+1>; headers allocated beyond it meanwhile are remembered for the next one.
+
+=item C<static void gc_gms_nursery_extend(const Header_Nursery *nursery, size_t
+*end, char **stop)>
+
+Extend the part of the nursery the sweep visits to the headers allocated
+during the last one.
+
+=item C<static void gc_gms_nursery_sweep_block(PARROT_INTERP, Header_Nursery
+*nursery)>
+
+Free the dead PMCs the lazy sweep left in the first unswept block of the PMC
+nursery.  They were destroyed already, and are the only generation 0 PMCs in
+it which aren't free, as survivors were promoted.
+
+=item C<static void gc_gms_nursery_sweep_all(PARROT_INTERP, Header_Nursery
+*nursery)>
+
+Sweep all blocks the lazy sweep left.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static void *
+gc_gms_nursery_allocate(PARROT_INTERP, ARGMOD(Header_Nursery *nursery))
+{
+    ASSERT_ARGS(gc_gms_nursery_allocate)
+    char *item;
+
+    if (nursery->next >= nursery->limit)
+        gc_gms_nursery_next_run(interp, nursery);
+
+    item           = nursery->next;
+    nursery->next += nursery->pool->object_size;
+
+    PARROT_ASSERT(SLOT_IS_FREE(item));
+
+    return item;
+}
+
+static void
+gc_gms_nursery_next_run(PARROT_INTERP, ARGMOD(Header_Nursery *nursery))
+{
+    ASSERT_ARGS(gc_gms_nursery_next_run)
+    const size_t size = nursery->pool->object_size;
+
+    while (nursery->current < nursery->num_blocks) {
+        char * const end = nursery->blocks[nursery->current]
+                         + GC_NURSERY_BLOCK_OBJECTS * size;
+        char        *run = nursery->limit;
+
+        if (nursery->current == nursery->swept
+        &&  nursery->swept < nursery->sweep_end)
+            gc_gms_nursery_sweep_block(interp, nursery);
+
+        while (run < end && !SLOT_IS_FREE(run))
+            run += size;
+
+        if (run < end) {
+            char *run_end = run + size;
+
+            while (run_end < end && SLOT_IS_FREE(run_end))
+                run_end += size;
+
+            nursery->next  = run;
+            nursery->limit = run_end;
+            return;
+        }
+
+        if (++nursery->current < nursery->num_blocks)
+            nursery->next = nursery->limit = nursery->blocks[nursery->current];
+    }
+
+    /* All blocks are full. Add a fresh one */
+    {
+        char * const block = (char *)Parrot_gc_pool_allocate_region(interp,
+                                nursery->pool, GC_NURSERY_BLOCK_OBJECTS);
+        char * const end   = block + GC_NURSERY_BLOCK_OBJECTS * size;
+        char        *slot;
+
+        for (slot = block; slot < end; slot += size)
+            PObj_on_free_list_SET((PObj *)(slot + sizeof (void *)));
+
+        mem_internal_realloc_n_typed(nursery->blocks,
+                nursery->num_blocks + 1, char *);
+        nursery->blocks[nursery->num_blocks] = block;
+        nursery->current                     = nursery->num_blocks++;
+        nursery->next                        = block;
+        nursery->limit                       = end;
+    }
+}
+
+static void
+gc_gms_nursery_rewind(ARGMOD(Header_Nursery *nursery), size_t end,
+        ARGIN_NULLOK(char *stop))
+{
+    ASSERT_ARGS(gc_gms_nursery_rewind)
+
+    if (nursery->current + 1 > end
+    || (nursery->current + 1 == end && nursery->next > stop)) {
+        nursery->left_block = nursery->current;
+        nursery->left_next  = nursery->next;
+    }
+    else
+        nursery->left_next  = NULL;
+
+    nursery->current = 0;
+    nursery->swept   = nursery->sweep_end = 0;
+    nursery->next    = nursery->limit = nursery->num_blocks
+                                      ? nursery->blocks[0]
+                                      : NULL;
+}
+
+static void
+gc_gms_nursery_extend(ARGIN(const Header_Nursery *nursery),
+        ARGMOD(size_t *end), ARGMOD(char **stop))
+{
+    ASSERT_ARGS(gc_gms_nursery_extend)
+
+    if (!nursery->left_next)
+        return;
+
+    if (nursery->left_block + 1 > *end) {
+        *end  = nursery->left_block + 1;
+        *stop = nursery->left_next;
+    }
+    else if (nursery->left_block + 1 == *end && nursery->left_next > *stop)
+        *stop = nursery->left_next;
+}
+
+static void
+gc_gms_nursery_sweep_block(PARROT_INTERP, ARGMOD(Header_Nursery *nursery))
+{
+    ASSERT_ARGS(gc_gms_nursery_sweep_block)
+    GC_Statistics * const stats = &interp->gc_sys->stats;
+    const size_t          since = stats->mem_used_last_collect;
+    const size_t          size  = nursery->pool->object_size;
+    char * const          block = nursery->blocks[nursery->swept++];
+    char * const          end   = block + GC_NURSERY_BLOCK_OBJECTS * size;
+    char                 *slot;
+
+    for (slot = block; slot < end; slot += size) {
+        PMC * const pmc = &((pmc_alloc_struct *)slot)->pmc;
+
+        if (SLOT_IS_FREE(slot) || POBJ2GEN(pmc))
+            continue;
+
+        if (pmc->vtable->attr_size && PMC_data(pmc))
+            Parrot_gc_free_pmc_attributes(interp, pmc);
+        PMC_data(pmc) = NULL;
+
+        PObj_on_free_list_SET(pmc);
+        PObj_gc_CLEAR(pmc);
+    }
+
+    /* Freeing attributes counts against the allocations since the last
+     * collection, which these weren't */
+    stats->mem_used_last_collect = since;
+}
+
+static void
+gc_gms_nursery_sweep_all(PARROT_INTERP, ARGMOD(Header_Nursery *nursery))
+{
+    ASSERT_ARGS(gc_gms_nursery_sweep_all)
+
+    while (nursery->swept < nursery->sweep_end)
+        gc_gms_nursery_sweep_block(interp, nursery);
+}
+
+/*
+
 =item C<gc_gms_maybe_mark_and_sweep(PARROT_INTERP)>
 
-Maybe M&S. Depends on total allocated memory, memory allocated since last alloc
-and phase of the Moon.
+Maybe M&S. Collects once the memory allocated since the last collection
+exceeds the nursery size.
 
 =cut
 
@@ -1405,7 +2298,6 @@ gc_gms_allocate_pmc_header(PARROT_INTERP, UINTVAL flags)
 {
     ASSERT_ARGS(gc_gms_allocate_pmc_header)
     MarkSweep_GC     * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
-    Pool_Allocator   * const pool = self->pmc_allocator;
     pmc_alloc_struct *item;
 
     gc_gms_maybe_mark_and_sweep(interp);
@@ -1416,8 +2308,9 @@ gc_gms_allocate_pmc_header(PARROT_INTERP, UINTVAL flags)
     interp->gc_sys->stats.memory_used           += sizeof (PMC);
     interp->gc_sys->stats.mem_used_last_collect += sizeof (PMC);
 
-    item         = (pmc_alloc_struct *)Parrot_gc_pool_allocate(interp, pool);
-    item->ptr    = Parrot_pa_insert(self->objects[0], item);
+    /* Nursery objects are in no list until promoted */
+    item = (pmc_alloc_struct *)gc_gms_nursery_allocate(interp,
+                &self->pmc_nursery);
 
     return &(item->pmc);
 }
@@ -1437,13 +2330,12 @@ gc_gms_free_pmc_header(PARROT_INTERP, ARGFREE(PMC *pmc))
         if (PObj_on_free_list_TEST(pmc))
             return;
 
-        Parrot_pa_remove(interp, self->objects[gen], PMC2PAC(pmc)->ptr);
+        if (gen)
+            Parrot_pa_remove(interp, self->objects[gen], PMC2PAC(pmc)->ptr);
         PObj_on_free_list_SET(pmc);
 
         Parrot_pmc_destroy(interp, pmc);
 
-        Parrot_gc_pool_free(interp, self->pmc_allocator, PMC2PAC(pmc));
-
         --interp->gc_sys->stats.header_allocs_since_last_collect;
         interp->gc_sys->stats.memory_used           -= sizeof (PMC);
         interp->gc_sys->stats.mem_used_last_collect -= sizeof (PMC);
@@ -1487,13 +2379,16 @@ gc_gms_is_pmc_ptr(PARROT_INTERP, ARGIN_NULLOK(void *ptr))
     if (PObj_GC_on_dirty_list_TEST(obj))
         return 0;
 
-    /* Pool.is_owned isn't precise enough (yet) */
-    if (Parrot_pa_is_owned(self->objects[POBJ2GEN(obj)], item, item->ptr)) {
-        if (POBJ2GEN(obj) == 0)
-            PObj_GC_soil_root_SET(obj);
+    /* Nursery objects are in no list. Pool.is_owned found a used slot */
+    if (POBJ2GEN(obj) == 0) {
+        PObj_GC_soil_root_SET(obj);
         return 1;
     }
 
+    /* Pool.is_owned isn't precise enough (yet) */
+    if (Parrot_pa_is_owned(self->objects[POBJ2GEN(obj)], item, item->ptr))
+        return 1;
+
     return 0;
 }
 
@@ -1520,7 +2415,6 @@ gc_gms_allocate_string_header(PARROT_INTERP, SHIM(UINTVAL flags))
 {
     ASSERT_ARGS(gc_gms_allocate_string_header)
     MarkSweep_GC     * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
-    Pool_Allocator   * const pool = self->string_allocator;
     string_alloc_struct *item;
     STRING              *ret;
 
@@ -1532,8 +2426,8 @@ gc_gms_allocate_string_header(PARROT_INTERP, SHIM(UINTVAL flags))
     interp->gc_sys->stats.memory_used           += sizeof (STRING);
     interp->gc_sys->stats.mem_used_last_collect += sizeof (STRING);
 
-    item = (string_alloc_struct *)Parrot_gc_pool_allocate(interp, pool);
-    item->ptr = Parrot_pa_insert(self->strings[0], item);
+    item = (string_alloc_struct *)gc_gms_nursery_allocate(interp,
+                &self->string_nursery);
 
     ret = &(item->str);
     memset(ret, 0, sizeof (STRING));
@@ -1549,7 +2443,11 @@ gc_gms_free_string_header(PARROT_INTERP, ARGFREE(STRING *s))
         MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
         const size_t         gen = POBJ2GEN(s);
 
-        Parrot_pa_remove(interp, self->strings[gen], STR2PAC(s)->ptr);
+        if (gen)
+            Parrot_pa_remove(interp, self->strings[gen], STR2PAC(s)->ptr);
+
+        if (s->index)
+            Parrot_str_free_index(interp, s);
 
         if (Buffer_bufstart(s) && !PObj_external_TEST(s))
             Parrot_gc_str_free_buffer_storage(interp,
@@ -1557,8 +2455,6 @@ gc_gms_free_string_header(PARROT_INTERP, ARGFREE(STRING *s))
 
         PObj_on_free_list_SET(s);
 
-        Parrot_gc_pool_free(interp, self->string_allocator, STR2PAC(s));
-
         --interp->gc_sys->stats.header_allocs_since_last_collect;
         interp->gc_sys->stats.memory_used           -= sizeof (STRING);
         interp->gc_sys->stats.mem_used_last_collect -= sizeof (STRING);
@@ -1614,7 +2510,9 @@ gc_gms_is_string_ptr(PARROT_INTERP, ARGIN_NULLOK(void *ptr))
     if (POBJ2GEN(&item->str) > self->gen_to_collect)
         return 0;
 
-    if (Parrot_pa_is_owned(self->strings[POBJ2GEN(obj)], item, item->ptr))
+    /* Nursery objects are in no list. Pool.is_owned found a used slot */
+    if (POBJ2GEN(obj) == 0
+    ||  Parrot_pa_is_owned(self->strings[POBJ2GEN(obj)], item, item->ptr))
         return 1;
 
     return 0;
@@ -1696,9 +2594,25 @@ gc_gms_iterate_live_strings(PARROT_INTERP,
 {
     ASSERT_ARGS(gc_gms_iterate_live_strings)
 
-    MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
-    size_t             i;
-    for (i = 0; i < MAX_GENERATIONS; i++) {
+    MarkSweep_GC   * const self    = (MarkSweep_GC *)interp->gc_sys->gc_private;
+    Header_Nursery * const nursery = &self->string_nursery;
+    const size_t           size    = nursery->pool->object_size;
+    size_t                 i;
+
+    /* Strings of generation 0 are only in the nursery */
+    for (i = 0; i < nursery->num_blocks; i++) {
+        char * const block = nursery->blocks[i];
+        char * const end   = block + GC_NURSERY_BLOCK_OBJECTS * size;
+        char        *slot;
+
+        for (slot = block; slot < end; slot += size) {
+            STRING * const s = &((string_alloc_struct *)slot)->str;
+            if (!SLOT_IS_FREE(slot) && !POBJ2GEN(s))
+                callback(interp, (Parrot_Buffer *)s, data);
+        }
+    }
+
+    for (i = 1; i < MAX_GENERATIONS; i++) {
         POINTER_ARRAY_ITER(self->strings[i],
             STRING *s = &((string_alloc_struct *)ptr)->str;
             callback(interp, (Parrot_Buffer *)s, data););
@@ -2261,11 +3175,25 @@ gc_gms_validate_objects(PARROT_INTERP)
     interp->gc_sys->mark_pmc_header = gc_gms_mark_pmc_header;
     interp->gc_sys->mark_str_header = gc_gms_mark_str_header;
 
-    for (i = 0; i < MAX_GENERATIONS; i++) {
+    for (i = 1; i < MAX_GENERATIONS; i++) {
         POINTER_ARRAY_ITER(self->objects[i],
             PMC * const pmc = &((pmc_alloc_struct *)ptr)->pmc;
             PObj_live_CLEAR(pmc););
     }
+
+    /* Generation 0 is only in the nursery */
+    for (i = 0; i < (INTVAL)self->pmc_nursery.num_blocks; i++) {
+        const size_t size  = self->pmc_nursery.pool->object_size;
+        char * const block = self->pmc_nursery.blocks[i];
+        char * const end   = block + GC_NURSERY_BLOCK_OBJECTS * size;
+        char        *slot;
+
+        for (slot = block; slot < end; slot += size) {
+            PMC * const pmc = &((pmc_alloc_struct *)slot)->pmc;
+            if (!SLOT_IS_FREE(slot) && !POBJ2GEN(pmc))
+                PObj_live_CLEAR(pmc);
+        }
+    }
 #else
     UNUSED(interp);
 #endif
@@ -1,5 +1,5 @@
 /*
-Copyright (C) 2001-2011, Parrot Foundation.
+Copyright (C) 2001-2012, Parrot Foundation.
 
 =head1 NAME
 
@@ -9,6 +9,13 @@ src/gc/gc_ms.c - Implementation of the basic mark & sweep collector
 
 This code implements the default mark and sweep garbage collector.
 
+With C<--gc-lazy-sweep> a collection only marks and sweeps the pools of
+strings and buffers, which the string pool compaction following it relies
+on.  Dead PMCs are destroyed at the end of the collection, but their arenas
+are swept by the allocator, one at a time, when the free list runs dry.
+Everything left is swept before the next mark, and at once when impatient
+PMCs ask for timely destruction.
+
 =cut
 
 */
@@ -107,6 +114,15 @@ static void gc_ms_finalize_memory_pools(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void gc_ms_finish_lazy_sweep(PARROT_INTERP,
+    ARGMOD(Memory_Pools *mem_pools),
+    ARGMOD(Fixed_Size_Pool *pool))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*mem_pools)
+        FUNC_MODIFIES(*pool);
+
 static void gc_ms_free_attributes_from_pool(
     ARGMOD(PMC_Attribute_Pool *pool),
     ARGMOD(void *data))
@@ -200,6 +216,18 @@ static void * gc_ms_reallocate_memory_chunk_zeroed(PARROT_INTERP,
     size_t newsize,
     size_t oldsize);
 
+static void gc_ms_start_lazy_sweep(PARROT_INTERP,
+    ARGMOD(Memory_Pools *mem_pools),
+    ARGMOD(Fixed_Size_Pool *pool),
+    ARGMOD(GC_Event *event))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*mem_pools)
+        FUNC_MODIFIES(*pool)
+        FUNC_MODIFIES(*event);
+
 static int gc_ms_sweep_cb(PARROT_INTERP,
     ARGIN(Memory_Pools *mem_pools),
     ARGMOD(Fixed_Size_Pool *pool),
@@ -212,6 +240,15 @@ static int gc_ms_sweep_cb(PARROT_INTERP,
         FUNC_MODIFIES(*pool)
         FUNC_MODIFIES(*arg);
 
+static void gc_ms_sweep_next_arena(PARROT_INTERP,
+    ARGMOD(Memory_Pools *mem_pools),
+    ARGMOD(Fixed_Size_Pool *pool))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*mem_pools)
+        FUNC_MODIFIES(*pool);
+
 static int gc_ms_total_sized_buffers(ARGIN(const Memory_Pools *mem_pools))
         __attribute__nonnull__(1);
 
@@ -293,6 +330,10 @@ static void Parrot_gc_initialize_fixed_size_pools(PARROT_INTERP,
 #define ASSERT_ARGS_gc_ms_finalize_memory_pools __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(mem_pools))
+#define ASSERT_ARGS_gc_ms_finish_lazy_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(mem_pools) \
+    , PARROT_ASSERT_ARG(pool))
 #define ASSERT_ARGS_gc_ms_free_attributes_from_pool \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(pool) \
@@ -337,11 +378,20 @@ static void Parrot_gc_initialize_fixed_size_pools(PARROT_INTERP,
 #define ASSERT_ARGS_gc_ms_reallocate_memory_chunk __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_gc_ms_reallocate_memory_chunk_zeroed \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_gc_ms_start_lazy_sweep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(mem_pools) \
+    , PARROT_ASSERT_ARG(pool) \
+    , PARROT_ASSERT_ARG(event))
 #define ASSERT_ARGS_gc_ms_sweep_cb __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(mem_pools) \
     , PARROT_ASSERT_ARG(pool) \
     , PARROT_ASSERT_ARG(arg))
+#define ASSERT_ARGS_gc_ms_sweep_next_arena __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(mem_pools) \
+    , PARROT_ASSERT_ARG(pool))
 #define ASSERT_ARGS_gc_ms_total_sized_buffers __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(mem_pools))
 #define ASSERT_ARGS_gc_ms_trace_active_PMCs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -406,7 +456,7 @@ C<more_object_fn>.
 */
 
 void
-Parrot_gc_ms_init(PARROT_INTERP, SHIM(Parrot_GC_Init_Args *args))
+Parrot_gc_ms_init(PARROT_INTERP, ARGIN(Parrot_GC_Init_Args *args))
 {
     ASSERT_ARGS(Parrot_gc_ms_init)
 
@@ -415,6 +465,7 @@ Parrot_gc_ms_init(PARROT_INTERP, SHIM(Parrot_GC_Init_Args *args))
     mem_pools->num_attribs        = 0;
     mem_pools->attrib_pools       = NULL;
     mem_pools->sized_header_pools = NULL;
+    mem_pools->lazy_sweep         = args->lazy_sweep;
 
     interp->gc_sys->finalize_gc_system      = gc_ms_finalize;
     interp->gc_sys->destroy_child_interp    = gc_ms_destroy_child_interp;
@@ -477,7 +528,7 @@ Parrot_gc_ms_init(PARROT_INTERP, SHIM(Parrot_GC_Init_Args *args))
     interp->gc_sys->gc_private       = mem_pools;
 
 
-    Parrot_gc_str_initialize(interp, &mem_pools->string_gc);
+    Parrot_gc_str_initialize(interp, &mem_pools->string_gc, args->compact_limit);
     initialize_fixed_size_pools(interp, mem_pools);
     Parrot_gc_initialize_fixed_size_pools(interp, mem_pools,
                                           GC_NUM_INITIAL_FIXED_SIZE_POOLS);
@@ -498,6 +549,9 @@ gc_ms_finalize(PARROT_INTERP)
     ASSERT_ARGS(gc_ms_finalize)
     Memory_Pools *mem_pools = (Memory_Pools*)interp->gc_sys->gc_private;
 
+    /* Unswept PMCs still look alive to the final sweep */
+    gc_ms_finish_lazy_sweep(interp, mem_pools, mem_pools->pmc_pool);
+
     /* buffer headers, PMCs */
     Parrot_gc_destroy_header_pools(interp, mem_pools);
 
@@ -528,6 +582,11 @@ gc_ms_destroy_child_interp(ARGMOD(Interp *dest_interp), ARGIN(Interp *source_int
 
     Memory_Pools * const dest_arena   = (Memory_Pools*)dest_interp->gc_sys->gc_private;
     Memory_Pools * const source_arena = (Memory_Pools*)source_interp->gc_sys->gc_private;
+
+    /* Free lists are merged, so they have to be complete */
+    gc_ms_finish_lazy_sweep(dest_interp, dest_arena, dest_arena->pmc_pool);
+    gc_ms_finish_lazy_sweep(source_interp, source_arena, source_arena->pmc_pool);
+
     Parrot_gc_merge_memory_pools(dest_interp, dest_arena, source_arena);
 }
 
@@ -588,11 +647,14 @@ gc_ms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
 {
     ASSERT_ARGS(gc_ms_mark_and_sweep)
     Memory_Pools * const mem_pools = (Memory_Pools *)interp->gc_sys->gc_private;
-    int total_free = 0;
+    GC_Event           *event;
 
     if (mem_pools->gc_mark_block_level)
         return;
 
+    /* Sweep what the allocator didn't get to since the last run */
+    gc_ms_finish_lazy_sweep(interp, mem_pools, mem_pools->pmc_pool);
+
     if (interp->pdb && interp->pdb->debugger) {
         /* The debugger could have performed a mark. Make sure everything is
            marked dead here, so that when we sweep it all gets collected */
@@ -606,6 +668,7 @@ gc_ms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
 
     ++mem_pools->gc_mark_block_level;
     mem_pools->lazy_gc = flags & GC_lazy_FLAG;
+    event              = Parrot_gc_event_start(interp, 0);
 
     /* tell the threading system that we're doing GC mark */
     Parrot_gc_run_init(interp, mem_pools);
@@ -621,7 +684,7 @@ gc_ms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
         /* We've done the mark, now do the sweep. Pass the sweep callback
            function to the PMC pool and all the sized pools. */
        header_pools_iterate_callback(interp, mem_pools,
-            POOL_BUFFER | POOL_PMC, (void *)&total_free, gc_ms_sweep_cb);
+            POOL_BUFFER | POOL_PMC, (void *)event, gc_ms_sweep_cb);
 
     }
     else {
@@ -639,7 +702,7 @@ gc_ms_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     --mem_pools->gc_mark_block_level;
     interp->gc_sys->stats.mem_used_last_collect = interp->gc_sys->stats.memory_used;
 
-    return;
+    Parrot_gc_event_finish(interp);
 }
 
 /*
@@ -824,6 +887,14 @@ gc_ms_free_pmc_header(PARROT_INTERP, ARGMOD(PMC *pmc))
     Parrot_pmc_destroy(interp, pmc);
 
     PObj_flags_SETTO((PObj *)pmc, PObj_on_free_list_FLAG);
+
+    /* Its arena may still have to be swept, which will put it on the free
+     * list. Otherwise the next sweep will */
+    if (pool->sweep_arena) {
+        interp->gc_sys->stats.memory_used -= pool->object_size;
+        return;
+    }
+
     pool->add_free_object(interp, mem_pools, pool, (PObj *)pmc);
     ++pool->num_free_objects;
 }
@@ -952,6 +1023,8 @@ gc_ms_free_string_header(PARROT_INTERP, ARGMOD(STRING *s))
     Memory_Pools * const mem_pools = (Memory_Pools *)interp->gc_sys->gc_private;
     if (!PObj_constant_TEST(s)) {
         Fixed_Size_Pool * const pool = mem_pools->string_header_pool;
+        if (s->index)
+            Parrot_str_free_index(interp, s);
         PObj_flags_SETTO((PObj *)s, PObj_on_free_list_FLAG);
         pool->add_free_object(interp, mem_pools, pool, s);
         ++pool->num_free_objects;
@@ -1481,9 +1554,8 @@ gc_ms_trace_active_PMCs(PARROT_INTERP, Parrot_gc_trace_type trace)
 =item C<static int gc_ms_sweep_cb(PARROT_INTERP, Memory_Pools *mem_pools,
 Fixed_Size_Pool *pool, int flag, void *arg)>
 
-Sweeps the given pool for the MS collector. This function also ends
-the profiling timer, if profiling is enabled. Returns the total number
-of objects freed.
+Sweeps the given pool for the MS collector. Counts the objects found alive
+and freed in C<arg>, the C<GC_Event> being recorded.
 
 =cut
 
@@ -1496,11 +1568,23 @@ gc_ms_sweep_cb(PARROT_INTERP,
         SHIM(int flag), ARGMOD(void *arg))
 {
     ASSERT_ARGS(gc_ms_sweep_cb)
-    int * const total_free = (int *) arg;
+    GC_Event * const event     = (GC_Event *)arg;
+    const size_t     free_before = pool->num_free_objects;
+
+    if (pool == mem_pools->pmc_pool && mem_pools->lazy_sweep) {
+        gc_ms_start_lazy_sweep(interp, mem_pools, pool, event);
+
+        /* Timely destruction can't wait for the allocator */
+        if (mem_pools->lazy_gc || mem_pools->num_early_gc_PMCs)
+            gc_ms_finish_lazy_sweep(interp, mem_pools, pool);
+
+        return 0;
+    }
 
     Parrot_gc_sweep_pool(interp, mem_pools, pool);
 
-    *total_free += pool->num_free_objects;
+    event->marked += pool->total_objects - pool->num_free_objects;
+    event->swept  += pool->num_free_objects - free_before;
 
     return 0;
 }
@@ -1563,7 +1647,7 @@ gc_ms_more_traceable_objects(PARROT_INTERP,
     /* requires that num_free_objects be updated in Parrot_gc_mark_and_sweep.
        If gc is disabled, then we must check the free list directly. */
     if ((!pool->free_list || pool->num_free_objects < pool->replenish_level)
-        && !pool->newfree)
+        && !pool->newfree && !pool->sweep_arena)
         (*pool->alloc_objects) (interp, mem_pools, pool);
 }
 
@@ -1629,6 +1713,11 @@ gc_ms_get_free_object(PARROT_INTERP,
         ptr             = free_list;
         pool->free_list = ((GC_MS_PObj_Wrapper *)ptr)->next_ptr;
     }
+    else if (pool->sweep_arena) {
+        gc_ms_sweep_next_arena(interp, mem_pools, pool);
+        free_list = (PObj *)pool->free_list;
+        goto HAVE_FREE;
+    }
     else if (pool->newfree) {
         Fixed_Size_Arena * const arena = pool->last_Arena;
         ptr           = (PObj *)pool->newfree;
@@ -1653,6 +1742,147 @@ gc_ms_get_free_object(PARROT_INTERP,
 }
 
 
+/*
+
+=item C<static void gc_ms_start_lazy_sweep(PARROT_INTERP, Memory_Pools
+*mem_pools, Fixed_Size_Pool *pool, GC_Event *event)>
+
+Leave sweeping C<pool> to the allocator.  The free list is rebuilt one arena
+at a time, newest first, so objects allocated meanwhile never come from an
+arena which is still to be swept.  Fresh slots of the newest arena are used
+only after it has been swept, for the same reason.
+
+Dead PMCs are destroyed right away, though.  A destructor may still look at
+other dead objects, which must not have been handed out again by then.  Live
+and dead objects are counted into C<event> here, as the allocator doesn't
+report them.
+
+=cut
+
+*/
+
+static void
+gc_ms_start_lazy_sweep(PARROT_INTERP,
+        ARGMOD(Memory_Pools *mem_pools),
+        ARGMOD(Fixed_Size_Pool *pool),
+        ARGMOD(GC_Event *event))
+{
+    ASSERT_ARGS(gc_ms_start_lazy_sweep)
+    const size_t      object_size = pool->object_size;
+    Fixed_Size_Arena *arena;
+
+    /* Destructors may allocate, but must not start another collection */
+    ++mem_pools->gc_mark_block_level;
+
+    for (arena = pool->last_Arena; arena; arena = arena->prev) {
+        PMC   *pmc = (PMC *)arena->start_objects;
+        size_t i;
+
+        for (i = arena->used; i; --i) {
+            if (PObj_live_TEST(pmc)) {
+                ++event->marked;
+            }
+            else if (!PObj_on_free_list_TEST(pmc)) {
+                ++event->swept;
+
+                if (PObj_custom_destroy_TEST(pmc)) {
+                    VTABLE_destroy(interp, pmc);
+                    PObj_custom_destroy_CLEAR(pmc);
+                }
+            }
+            pmc = (PMC *)((char *)pmc + object_size);
+        }
+    }
+
+    --mem_pools->gc_mark_block_level;
+
+    pool->free_list        = NULL;
+    pool->sweep_arena      = pool->last_Arena;
+    pool->num_free_objects = pool->newfree
+                           ? ((char *)pool->newlast - (char *)pool->newfree)
+                             / pool->object_size
+                           : 0;
+}
+
+/*
+
+=item C<static void gc_ms_sweep_next_arena(PARROT_INTERP, Memory_Pools
+*mem_pools, Fixed_Size_Pool *pool)>
+
+Sweep the next arena of C<pool> left by C<gc_ms_start_lazy_sweep>, putting
+its dead and free objects on the free list.
+
+=item C<static void gc_ms_finish_lazy_sweep(PARROT_INTERP, Memory_Pools
+*mem_pools, Fixed_Size_Pool *pool)>
+
+Sweep all arenas of C<pool> left by C<gc_ms_start_lazy_sweep>.
+
+=cut
+
+*/
+
+static void
+gc_ms_sweep_next_arena(PARROT_INTERP,
+        ARGMOD(Memory_Pools *mem_pools),
+        ARGMOD(Fixed_Size_Pool *pool))
+{
+    ASSERT_ARGS(gc_ms_sweep_next_arena)
+    Fixed_Size_Arena * const arena       = pool->sweep_arena;
+    GC_Statistics    * const stats       = &interp->gc_sys->stats;
+    const size_t             object_size = pool->object_size;
+    PObj                    *b           = (PObj *)arena->start_objects;
+    size_t                   dead        = 0;
+    size_t                   unused      = 0;
+    size_t                   i;
+
+    pool->sweep_arena = arena->prev;
+
+    /* Destructors may allocate, but must not start another collection */
+    ++mem_pools->gc_mark_block_level;
+
+    for (i = arena->used; i; --i) {
+        if (PObj_live_TEST(b)) {
+            PObj_live_CLEAR(b);
+        }
+        else if (PObj_on_free_list_TEST(b)) {
+            GC_MS_PObj_Wrapper * const object = (GC_MS_PObj_Wrapper *)b;
+
+            object->next_ptr = pool->free_list;
+            pool->free_list  = object;
+            ++unused;
+        }
+        else {
+            if (pool->gc_object)
+                pool->gc_object(interp, mem_pools, pool, b);
+
+            pool->add_free_object(interp, mem_pools, pool, b);
+            ++dead;
+        }
+        b = (PObj *)((char *)b + object_size);
+    }
+
+    --mem_pools->gc_mark_block_level;
+
+    pool->num_free_objects += dead + unused;
+
+    /* The garbage was counted as used after the last collection */
+    if (stats->mem_used_last_collect > dead * object_size)
+        stats->mem_used_last_collect -= dead * object_size;
+    else
+        stats->mem_used_last_collect = 0;
+}
+
+static void
+gc_ms_finish_lazy_sweep(PARROT_INTERP,
+        ARGMOD(Memory_Pools *mem_pools),
+        ARGMOD(Fixed_Size_Pool *pool))
+{
+    ASSERT_ARGS(gc_ms_finish_lazy_sweep)
+
+    while (pool->sweep_arena)
+        gc_ms_sweep_next_arena(interp, mem_pools, pool);
+}
+
 /*
 
 =item C<static void gc_ms_alloc_objects(PARROT_INTERP, Memory_Pools *mem_pools,
@@ -1799,6 +2029,8 @@ gc_ms_get_gc_info(PARROT_INTERP, Interpinfo_enum which)
     Memory_Pools * const mem_pools = (Memory_Pools *)interp->gc_sys->gc_private;
     switch (which) {
         case ACTIVE_PMCS:
+            /* Don't count garbage left for the allocator */
+            gc_ms_finish_lazy_sweep(interp, mem_pools, mem_pools->pmc_pool);
             return mem_pools->pmc_pool->total_objects -
                    mem_pools->pmc_pool->num_free_objects;
         case ACTIVE_BUFFERS:
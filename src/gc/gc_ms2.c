@@ -69,6 +69,9 @@ typedef struct MarkSweep_GC {
 
     UINTVAL num_early_gc_PMCs;    /* how many PMCs want immediate destruction */
 
+    /* Helper threads for marking. NULL to mark in one thread */
+    struct Parallel_Mark *parallel_mark;
+
 } MarkSweep_GC;
 
 /* HEADERIZER HFILE: src/gc/gc_private.h */
@@ -208,15 +211,29 @@ static void gc_ms2_mark_live_objects(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void gc_ms2_mark_parallel(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static void gc_ms2_mark_pmc_header(PARROT_INTERP, ARGMOD(PMC *pmc))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*pmc);
 
+static void gc_ms2_mark_pmc_header_parallel(PARROT_INTERP, ARGMOD(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pmc);
+
 static void gc_ms2_mark_str_header(PARROT_INTERP, ARGMOD(STRING *s))
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*s);
 
+static void gc_ms2_mark_str_header_parallel(PARROT_INTERP,
+    ARGMOD(STRING *s))
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*s);
+
 static void gc_ms2_pmc_needs_early_collection(PARROT_INTERP, PMC *pmc)
         __attribute__nonnull__(1);
 
@@ -339,11 +356,21 @@ static void gc_ms2_unblock_GC_sweep(PARROT_INTERP)
 #define ASSERT_ARGS_gc_ms2_mark_live_objects __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(self))
+#define ASSERT_ARGS_gc_ms2_mark_parallel __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self))
 #define ASSERT_ARGS_gc_ms2_mark_pmc_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_gc_ms2_mark_pmc_header_parallel \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
 #define ASSERT_ARGS_gc_ms2_mark_str_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_gc_ms2_mark_str_header_parallel \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(s))
 #define ASSERT_ARGS_gc_ms2_pmc_needs_early_collection \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
@@ -653,8 +680,10 @@ Parrot_gc_ms2_init(PARROT_INTERP, ARGIN(Parrot_GC_Init_Args *args))
                                 ? args->min_threshold
                                 : GC_DEFAULT_MIN_THRESHOLD;
         self->gc_threshold      = self->min_threshold;
+        self->parallel_mark     = Parrot_gc_parallel_mark_new(interp,
+                                                              args->mark_threads);
 
-        Parrot_gc_str_initialize(interp, &self->string_gc);
+        Parrot_gc_str_initialize(interp, &self->string_gc, args->compact_limit);
     }
 
     interp->gc_sys->gc_private = self;
@@ -679,6 +708,9 @@ gc_ms2_finalize(PARROT_INTERP)
     if (!interp->parent_interpreter) {
         MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
 
+        if (self->parallel_mark)
+            Parrot_gc_parallel_mark_destroy(interp, self->parallel_mark);
+
         Parrot_gc_str_finalize(interp, &self->string_gc);
 
         Parrot_pa_destroy(interp, self->objects);
@@ -835,6 +867,9 @@ gc_ms2_free_string_header(PARROT_INTERP, ARGFREE(STRING *s))
 
         Parrot_pa_remove(interp, self->strings, STR2PAC(s)->ptr);
 
+        if (s->index)
+            Parrot_str_free_index(interp, s);
+
         if (Buffer_bufstart(s) && !PObj_external_TEST(s))
             Parrot_gc_str_free_buffer_storage(interp,
                 &self->string_gc, (Parrot_Buffer *)s);
@@ -961,6 +996,42 @@ gc_ms2_mark_str_header(SHIM_INTERP, ARGMOD(STRING *s))
 }
 
 
+/*
+
+=item C<static void gc_ms2_mark_pmc_header_parallel(PARROT_INTERP, PMC *pmc)>
+
+=item C<static void gc_ms2_mark_str_header_parallel(PARROT_INTERP, STRING *s)>
+
+Mark objects from helper threads.  PMCs claimed by this thread are pushed for
+scanning instead of moved into new_objects.
+
+=cut
+
+*/
+
+static void
+gc_ms2_mark_pmc_header_parallel(PARROT_INTERP, ARGMOD(PMC *pmc))
+{
+    ASSERT_ARGS(gc_ms2_mark_pmc_header_parallel)
+    MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+
+    if (PObj_is_live_or_free_TESTALL(pmc))
+        return;
+
+    if (PObj_live_CLAIM(pmc) && !PObj_constant_TEST(pmc))
+        Parrot_gc_parallel_mark_push(self->parallel_mark, pmc);
+}
+
+static void
+gc_ms2_mark_str_header_parallel(SHIM_INTERP, ARGMOD(STRING *s))
+{
+    ASSERT_ARGS(gc_ms2_mark_str_header_parallel)
+
+    if (!PObj_live_TEST(s))
+        (void)PObj_live_CLAIM(s);
+}
+
+
 /*
 
 =item C<static void gc_ms2_iterate_live_strings(PARROT_INTERP,
@@ -1016,8 +1087,10 @@ gc_ms2_mark_live_objects(PARROT_INTERP, ARGIN(MarkSweep_GC *self),
         PObj_live_SET(interp->scheduler);
     }
     else {
-        /* Trace "roots" into new_objects */
-        gc_ms2_mark_pmc_header(interp, PMCNULL);
+        /* Trace "roots" into new_objects. PMCNULL belongs to the first
+         * interpreter of the process */
+        if (!Interp_flags_TEST(interp, PARROT_IS_THREAD))
+            gc_ms2_mark_pmc_header(interp, PMCNULL);
 
         Parrot_gc_trace_root(interp, NULL, GC_TRACE_FULL);
 
@@ -1026,6 +1099,11 @@ gc_ms2_mark_live_objects(PARROT_INTERP, ARGIN(MarkSweep_GC *self),
                 (Parrot_gc_trace_type)0);
     }
 
+    if (self->parallel_mark && !(flags & GC_finish_FLAG)) {
+        gc_ms2_mark_parallel(interp, self);
+        return;
+    }
+
     /* new_objects are "gray" until fully marked */
     /* Additional gray objects will append to new_objects list */
     /* So, iterate over them in one go */
@@ -1041,6 +1119,49 @@ gc_ms2_mark_live_objects(PARROT_INTERP, ARGIN(MarkSweep_GC *self),
             Parrot_gc_mark_PMC_alive(interp, PMC_metadata(pmc)););
 }
 
+/*
+
+=item C<static void gc_ms2_mark_parallel(PARROT_INTERP, MarkSweep_GC *self)>
+
+Mark everything reachable from the roots in new_objects with helper threads.
+They only set live flags, so move the PMCs they marked into new_objects
+afterwards.
+
+=cut
+
+*/
+
+static void
+gc_ms2_mark_parallel(PARROT_INTERP, ARGIN(MarkSweep_GC *self))
+{
+    ASSERT_ARGS(gc_ms2_mark_parallel)
+    const size_t count = Parrot_pa_count_used(interp, self->new_objects);
+    PMC        **grey  = mem_internal_allocate_n_zeroed_typed(count ? count : 1, PMC *);
+    size_t       n     = 0;
+
+    POINTER_ARRAY_ITER(self->new_objects,
+        grey[n++] = &((pmc_alloc_struct *)ptr)->pmc;);
+
+    interp->gc_sys->mark_pmc_header = gc_ms2_mark_pmc_header_parallel;
+    interp->gc_sys->mark_str_header = gc_ms2_mark_str_header_parallel;
+
+    Parrot_gc_parallel_mark_run(interp, self->parallel_mark, grey, n);
+
+    interp->gc_sys->mark_pmc_header = gc_ms2_mark_pmc_header;
+    interp->gc_sys->mark_str_header = gc_ms2_mark_str_header;
+
+    mem_internal_free(grey);
+
+    POINTER_ARRAY_ITER(self->objects,
+        pmc_alloc_struct * const item = (pmc_alloc_struct *)ptr;
+        PMC              * const pmc  = &(item->pmc);
+
+        if (PObj_live_TEST(pmc) && !PObj_constant_TEST(pmc)) {
+            Parrot_pa_remove(interp, self->objects, item->ptr);
+            item->ptr = Parrot_pa_insert(self->new_objects, item);
+        });
+}
+
 static void
 gc_ms2_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
 {
@@ -1058,6 +1179,7 @@ gc_ms2_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
         return;
 
     ++self->gc_mark_block_level;
+    Parrot_gc_event_start(interp, 0);
     gc_ms2_mark_live_objects(interp, self, flags);
 
     /* At this point of time new_objects contains only live PMCs */
@@ -1100,6 +1222,8 @@ gc_ms2_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
 
     self->gc_mark_block_level--;
     self->num_early_gc_PMCs = 0;
+
+    Parrot_gc_event_finish(interp);
 }
 
 
@@ -1107,7 +1231,8 @@ gc_ms2_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
 
 =item C<void Parrot_gc_maybe_mark_and_sweep(PARROT_INTERP, UINTVAL flags)>
 
-Run a GC if memory used is above threshold.
+Run a GC if memory used is above threshold. Only MS2 keeps the threshold
+here; the other collectors decide in their own allocation functions.
 
 =cut
 
@@ -1119,6 +1244,9 @@ Parrot_gc_maybe_mark_and_sweep(PARROT_INTERP, UINTVAL flags)
     ASSERT_ARGS(Parrot_gc_maybe_mark_and_sweep)
     MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
 
+    if (interp->gc_sys->sys_type != MS2)
+        return;
+
     if (!self->gc_mark_block_level
     &&   interp->gc_sys->stats.memory_used > self->gc_threshold)
         gc_ms2_mark_and_sweep(interp, flags);
@@ -1142,16 +1270,20 @@ gc_ms2_sweep_pmc_pool(PARROT_INTERP,
         ARGIN(Parrot_Pointer_Array *list))
 {
     ASSERT_ARGS(gc_ms2_sweep_pmc_pool)
+    GC_Event * const event = interp->gc_sys->event;
 
     POINTER_ARRAY_ITER(list,
         PMC *pmc = &(((pmc_alloc_struct *)ptr)->pmc);
 
         /* Paint live objects white */
-        if (PObj_live_TEST(pmc))
+        if (PObj_live_TEST(pmc)) {
             PObj_live_CLEAR(pmc);
+            ++event->marked;
+        }
 
         else if (!PObj_constant_TEST(pmc)) {
             Parrot_pa_remove(interp, list, PMC2PAC(pmc)->ptr);
+            ++event->swept;
 
             /* this is manual inlining of Parrot_pmc_destroy() */
             if (PObj_custom_destroy_TEST(pmc))
@@ -1217,7 +1349,8 @@ gc_ms2_sweep_string_pool(PARROT_INTERP,
 {
     ASSERT_ARGS(gc_ms2_sweep_string_pool)
 
-    MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
+    MarkSweep_GC * const self  = (MarkSweep_GC *)interp->gc_sys->gc_private;
+    GC_Event     * const event = interp->gc_sys->event;
 
     POINTER_ARRAY_ITER(list,
         STRING * const obj = &(((string_alloc_struct*)ptr)->str);
@@ -1225,11 +1358,16 @@ gc_ms2_sweep_string_pool(PARROT_INTERP,
         PARROT_ASSERT(!PObj_on_free_list_TEST(obj));
 
         /* Paint live objects white */
-        if (PObj_live_TEST(obj))
+        if (PObj_live_TEST(obj)) {
             PObj_live_CLEAR(obj);
+            ++event->marked;
+        }
 
         else if (!PObj_constant_TEST(obj)) {
             Parrot_pa_remove(interp, list, STR2PAC(obj)->ptr);
+            ++event->swept;
+            if (obj->index)
+                Parrot_str_free_index(interp, obj);
             if (Buffer_bufstart(obj) && !PObj_external_TEST(obj))
                 Parrot_gc_str_free_buffer_storage(interp, &self->string_gc, (Parrot_Buffer*)obj);
 
@@ -81,6 +81,22 @@ typedef struct GC_MS_PObj_Wrapper {
     struct GC_MS_PObj_Wrapper * next_ptr;
 } GC_MS_PObj_Wrapper;
 
+/* Marking with helper threads needs POSIX threads and atomic builtins. See
+   src/gc/parallel_mark.c */
+#if defined(PARROT_HAS_HEADER_PTHREAD) && defined(__GNUC__)
+#  define PARROT_GC_PARALLEL_MARK 1
+
+/* Set live flag of PObj o. True if it wasn't set before, even when other
+   threads try to set it at the same time */
+#  define PObj_live_CLAIM(o) \
+    (!(__sync_fetch_and_or(&(o)->flags, PObj_live_FLAG) & PObj_live_FLAG))
+#else
+#  define PObj_live_CLAIM(o) \
+    (PObj_live_TEST(o) ? 0 : (PObj_live_SET(o), 1))
+#endif
+
+typedef struct Parallel_Mark Parallel_Mark;
+
 /* how often to skip a full GC when this pool has nothing free */
 typedef enum _gc_skip_type_enum {
     GC_NO_SKIP = 0,
@@ -123,6 +139,48 @@ typedef struct GC_Statistics {
 
 } GC_Statistics;
 
+/* Number of recent collections kept for introspection */
+#define GC_EVENT_LOG_SIZE       256
+
+/* Pause histogram buckets. Each bucket is 2**(1/4) times as wide as the
+ * one before it, starting at one microsecond */
+#define GC_PAUSE_BUCKETS        128
+#define GC_PAUSE_BUCKET_GROWTH  1.189207115
+
+/* One collection as recorded by src/gc/telemetry.c */
+typedef struct GC_Event {
+    FLOATVAL start;         /* Parrot_floatval_time() at start and end */
+    FLOATVAL end;
+    FLOATVAL compact_time;  /* Seconds spent compacting string storage */
+    INTVAL   generation;    /* Oldest generation collected. -1 for a
+                               compaction on its own */
+    size_t   marked;        /* Objects found alive */
+    size_t   swept;         /* Objects freed */
+    size_t   promoted;      /* Bytes moved to an older generation */
+} GC_Event;
+
+typedef struct GC_Event_Log {
+    /* Last GC_EVENT_LOG_SIZE collections, oldest overwritten first */
+    GC_Event events[GC_EVENT_LOG_SIZE];
+
+    /* Number of collections recorded since start */
+    size_t   count;
+
+    /* Collection being recorded */
+    GC_Event current;
+
+    /* Number of pauses per bucket, and the longest one */
+    size_t   pauses[GC_PAUSE_BUCKETS];
+    FLOATVAL max_pause;
+
+    /* --gc-log output. NULL when not logging */
+    FILE    *log;
+} GC_Event_Log;
+
+/* Allocation sites of PMCs and heap snapshots, see src/gc/heap_snapshot.c */
+typedef struct GC_Alloc_Sites   GC_Alloc_Sites;
+typedef struct GC_Heap_Snapshot GC_Heap_Snapshot;
+
 /* Callback for live string. Use Parrot_Buffer for now... */
 typedef void (*string_iterator_callback)(PARROT_INTERP, Parrot_Buffer *str, void *data);
 
@@ -203,6 +261,18 @@ typedef struct GC_Subsystem {
     /* Statistic for GC */
     struct GC_Statistics stats;
 
+    /* Recent collections and pause times */
+    struct GC_Event_Log *event_log;
+
+    /* Collection in progress, NULL between collections */
+    struct GC_Event     *event;
+
+    /* Where PMCs were allocated. NULL unless --gc-alloc-sites */
+    struct GC_Alloc_Sites *alloc_sites;
+
+    /* Snapshot being taken, NULL otherwise */
+    struct GC_Heap_Snapshot *heap_snapshot;
+
     /* Holds system-specific data structures */
     void * gc_private;
 } GC_Subsystem;
@@ -298,6 +368,10 @@ typedef struct Fixed_Size_Pool {
                          put on free list). */
     void *newlast;    /* High water mark in arena. */
 
+    Fixed_Size_Arena *sweep_arena;      /* Next arena the allocator has to
+                                           sweep, or NULL. See lazy sweeping
+                                           in gc_ms.c */
+
 } Fixed_Size_Pool;
 
 /* String GC subsystem data */
@@ -333,6 +407,7 @@ typedef struct Memory_Pools {
                                      when we've seen all impatient PMCs */
     UINTVAL num_early_gc_PMCs;    /* how many PMCs want immediate destruction */
     UINTVAL num_early_PMCs_seen;  /* how many such PMCs has GC seen */
+    int     lazy_sweep;           /* leave sweeping PMCs to the allocator */
 
     /* private data for the GC subsystem */
     void *gc_private;             /* GC subsystem data */
@@ -588,8 +663,9 @@ size_t Parrot_gc_get_info(PARROT_INTERP,
     ARGIN(GC_Statistics *stats))
         __attribute__nonnull__(3);
 
-void Parrot_gc_ms_init(PARROT_INTERP, Parrot_GC_Init_Args *args)
-        __attribute__nonnull__(1);
+void Parrot_gc_ms_init(PARROT_INTERP, ARGIN(Parrot_GC_Init_Args *args))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
 
 PARROT_WARN_UNUSED_RESULT
 PARROT_PURE_FUNCTION
@@ -630,7 +706,8 @@ int Parrot_gc_ms_needed(PARROT_INTERP)
 #define ASSERT_ARGS_Parrot_gc_get_info __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(stats))
 #define ASSERT_ARGS_Parrot_gc_ms_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(interp))
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(args))
 #define ASSERT_ARGS_Parrot_gc_ms_needed __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
@@ -691,6 +768,109 @@ int pobj2gen(ARGIN(PObj *pmc))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/gc/gc_gms.c */
 
+/* HEADERIZER BEGIN: src/gc/parallel_mark.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+void Parrot_gc_parallel_mark_destroy(PARROT_INTERP,
+    ARGFREE_NOTNULL(Parallel_Mark *pm))
+        __attribute__nonnull__(2);
+
+PARROT_CAN_RETURN_NULL
+Parallel_Mark * Parrot_gc_parallel_mark_new(PARROT_INTERP, size_t helpers);
+
+void Parrot_gc_parallel_mark_push(ARGIN(Parallel_Mark *pm), ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+void Parrot_gc_parallel_mark_run(PARROT_INTERP,
+    ARGMOD(Parallel_Mark *pm),
+    ARGIN(PMC **grey),
+    size_t count)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*pm);
+
+#define ASSERT_ARGS_Parrot_gc_parallel_mark_destroy \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pm))
+#define ASSERT_ARGS_Parrot_gc_parallel_mark_new __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_Parrot_gc_parallel_mark_push __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pm) \
+    , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_Parrot_gc_parallel_mark_run __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pm) \
+    , PARROT_ASSERT_ARG(grey))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/gc/parallel_mark.c */
+
+/* HEADERIZER BEGIN: src/gc/telemetry.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+void Parrot_gc_event_finish(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+void Parrot_gc_event_log_destroy(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+void Parrot_gc_event_log_init(PARROT_INTERP,
+    ARGIN_NULLOK(const char *log_file))
+        __attribute__nonnull__(1);
+
+PARROT_WARN_UNUSED_RESULT
+FLOATVAL Parrot_gc_event_pause_percentile(PARROT_INTERP, FLOATVAL percent)
+        __attribute__nonnull__(1);
+
+PARROT_CANNOT_RETURN_NULL
+GC_Event * Parrot_gc_event_start(PARROT_INTERP, INTVAL generation)
+        __attribute__nonnull__(1);
+
+#define ASSERT_ARGS_Parrot_gc_event_finish __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_event_log_destroy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_event_log_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_event_pause_percentile \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_event_start __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/gc/telemetry.c */
+
+/* HEADERIZER BEGIN: src/gc/heap_snapshot.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+void Parrot_gc_alloc_sites_destroy(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+void Parrot_gc_alloc_sites_init(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+void Parrot_gc_alloc_sites_record(PARROT_INTERP, ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+void Parrot_gc_heap_snapshot_write(PARROT_INTERP, ARGMOD(FILE *out))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*out);
+
+#define ASSERT_ARGS_Parrot_gc_alloc_sites_destroy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_alloc_sites_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_gc_alloc_sites_record __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_Parrot_gc_heap_snapshot_write __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(out))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/gc/heap_snapshot.c */
+
 /* HEADERIZER BEGIN: src/gc/string_gc.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -727,7 +907,9 @@ void Parrot_gc_str_free_buffer_storage(PARROT_INTERP,
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*b);
 
-void Parrot_gc_str_initialize(PARROT_INTERP, ARGMOD(String_GC *gc))
+void Parrot_gc_str_initialize(PARROT_INTERP,
+    ARGMOD(String_GC *gc),
+    size_t compact_limit)
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*gc);
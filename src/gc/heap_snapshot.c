@@ -0,0 +1,832 @@
+/*
+Copyright (C) 2012, Parrot Foundation.
+
+=head1 NAME
+
+src/gc/heap_snapshot.c - Dumping the live heap
+
+=head1 DESCRIPTION
+
+C<Parrot_gc_heap_snapshot_write> walks everything reachable from the roots
+of the interpreter and writes it to a file.  It reuses their marking: while
+it runs, C<interp-E<gt>gc_sys-E<gt>mark_pmc_header> and C<mark_str_header>
+record the objects marked instead of marking them, so every PMC reports its
+referents through its own C<mark> VTABLE.  Collections are blocked
+meanwhile.
+
+The snapshot is one JSON object with an object or site on each line:
+
+    {"version":1,"objects":[
+    {"id":0,"kind":"roots","refs":[1,2,7]},
+    {"id":1,"kind":"pmc","type":"Hash","size":40,"attr":48,"site":3,"refs":[4,5]},
+    {"id":4,"kind":"string","size":48,"data":16},
+    ...
+    ],"sites":[
+    {"id":0,"sub":"","pc":-1},
+    {"id":3,"sub":"parrot;main","pc":12},
+    ...
+    ]}
+
+C<size> is the size of the header, C<attr> the size of the attributes of a
+PMC and C<data> the storage of a string or buffer, all in bytes.  The
+C<type> of an object is the name of its class.
+
+With C<--gc-alloc-sites> every new PMC is tagged with the Sub and the opcode
+offset running when its header was allocated, and the PMCs in the snapshot
+carry the C<site> of their allocation.  Without it C<site> and C<sites> are
+left out.  Site 0 collects PMCs allocated outside of any Sub.
+
+F<frontend/heap_diff> compares two snapshots.
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+#include "gc_private.h"
+#include "pmc/pmc_sub.h"
+#include "pmc/pmc_object.h"
+#include "pmc/pmc_class.h"
+
+/* HEADERIZER HFILE: src/gc/gc_private.h */
+
+/* Open addressing map from pointers to numbers */
+typedef struct Pointer_Map {
+    const void **keys;
+    size_t      *values;
+    size_t       size;      /* Power of two, or 0 before the first insert */
+    size_t       count;
+} Pointer_Map;
+
+typedef struct GC_Alloc_Site {
+    PackFile_ByteCode *seg;
+    opcode_t          *pc;
+} GC_Alloc_Site;
+
+struct GC_Alloc_Sites {
+    Pointer_Map    pmcs;        /* PMC header -> site */
+    Pointer_Map    pcs;         /* Opcode -> site */
+    GC_Alloc_Site *sites;
+    size_t         num_sites;
+    size_t         sites_size;
+};
+
+struct GC_Heap_Snapshot {
+    /* Objects found so far, by id. Id 0 stands for the roots */
+    Pointer_Map    ids;
+    PObj         **objects;
+    size_t         num_objects;
+    size_t         objects_size;
+
+    /* Ids of the objects marked by the one being walked */
+    size_t        *refs;
+    size_t         num_refs;
+    size_t         refs_size;
+
+    /* Type names by vtable, or by class for objects */
+    Pointer_Map    type_ids;
+    char         **types;
+    size_t         num_types;
+    size_t         types_size;
+};
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_CAN_RETURN_NULL
+static PMC * find_sub_at(PARROT_INTERP,
+    ARGIN(PackFile_ByteCode *seg),
+    size_t offset)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void pointer_map_free(ARGMOD(Pointer_Map *map))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*map);
+
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static size_t * pointer_map_get(
+    ARGIN(const Pointer_Map *map),
+    ARGIN(const void *key))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_CANNOT_RETURN_NULL
+static size_t * pointer_map_put(
+    ARGMOD(Pointer_Map *map),
+    ARGIN(const void *key),
+    ARGOUT(int *found))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*map)
+        FUNC_MODIFIES(*found);
+
+PARROT_WARN_UNUSED_RESULT
+static size_t pointer_map_slot(
+    ARGIN(const Pointer_Map *map),
+    ARGIN(const void *key))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void snapshot_add(
+    ARGMOD(GC_Heap_Snapshot *snapshot),
+    ARGIN(PObj *obj))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*snapshot);
+
+static void snapshot_mark_pmc(PARROT_INTERP, ARGMOD(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pmc);
+
+static void snapshot_mark_str(PARROT_INTERP, ARGMOD(STRING *str))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*str);
+
+PARROT_CANNOT_RETURN_NULL
+static const char * snapshot_type_name(PARROT_INTERP,
+    ARGMOD(GC_Heap_Snapshot *snapshot),
+    ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*snapshot);
+
+static void write_json_string(ARGMOD(FILE *out), ARGIN(const char *s))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*out);
+
+static void write_refs(
+    ARGMOD(FILE *out),
+    ARGIN(const GC_Heap_Snapshot *snapshot))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*out);
+
+static void write_sites(PARROT_INTERP,
+    ARGMOD(FILE *out),
+    ARGIN(const GC_Alloc_Sites *as))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*out);
+
+#define ASSERT_ARGS_find_sub_at __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(seg))
+#define ASSERT_ARGS_pointer_map_free __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(map))
+#define ASSERT_ARGS_pointer_map_get __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(map) \
+    , PARROT_ASSERT_ARG(key))
+#define ASSERT_ARGS_pointer_map_put __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(map) \
+    , PARROT_ASSERT_ARG(key) \
+    , PARROT_ASSERT_ARG(found))
+#define ASSERT_ARGS_pointer_map_slot __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(map) \
+    , PARROT_ASSERT_ARG(key))
+#define ASSERT_ARGS_snapshot_add __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(snapshot) \
+    , PARROT_ASSERT_ARG(obj))
+#define ASSERT_ARGS_snapshot_mark_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_snapshot_mark_str __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_snapshot_type_name __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(snapshot) \
+    , PARROT_ASSERT_ARG(pmc))
+#define ASSERT_ARGS_write_json_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(out) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_write_refs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(out) \
+    , PARROT_ASSERT_ARG(snapshot))
+#define ASSERT_ARGS_write_sites __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(out) \
+    , PARROT_ASSERT_ARG(as))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=head2 Allocation sites
+
+=over 4
+
+=item C<void Parrot_gc_alloc_sites_init(PARROT_INTERP)>
+
+Start tagging new PMCs with the place they are allocated at.
+
+=cut
+
+*/
+
+void
+Parrot_gc_alloc_sites_init(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_alloc_sites_init)
+    GC_Alloc_Sites * const as = mem_internal_allocate_zeroed_typed(GC_Alloc_Sites);
+
+    /* Site 0 is nowhere */
+    as->sites_size = 64;
+    as->sites      = mem_internal_allocate_n_zeroed_typed(as->sites_size, GC_Alloc_Site);
+    as->num_sites  = 1;
+
+    interp->gc_sys->alloc_sites = as;
+}
+
+/*
+
+=item C<void Parrot_gc_alloc_sites_destroy(PARROT_INTERP)>
+
+Stop tagging new PMCs and forget the tags.
+
+=cut
+
+*/
+
+void
+Parrot_gc_alloc_sites_destroy(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_alloc_sites_destroy)
+    GC_Alloc_Sites * const as = interp->gc_sys->alloc_sites;
+
+    if (!as)
+        return;
+
+    pointer_map_free(&as->pmcs);
+    pointer_map_free(&as->pcs);
+    mem_internal_free(as->sites);
+    mem_internal_free(as);
+
+    interp->gc_sys->alloc_sites = NULL;
+}
+
+/*
+
+=item C<void Parrot_gc_alloc_sites_record(PARROT_INTERP, PMC *pmc)>
+
+Tag the new PMC C<pmc> with the opcode running in the current context.
+Tags are never removed.  A header freed and allocated again gets a new tag,
+so only the tags of dead PMCs are stale, and those never show up in a
+snapshot.
+
+=cut
+
+*/
+
+void
+Parrot_gc_alloc_sites_record(PARROT_INTERP, ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(Parrot_gc_alloc_sites_record)
+    GC_Alloc_Sites * const as  = interp->gc_sys->alloc_sites;
+    PMC            * const ctx = CURRENT_CONTEXT(interp);
+    opcode_t              *pc  = NULL;
+    size_t                 site = 0;
+    int                    found;
+
+    if (ctx && !PMC_IS_NULL(ctx) && interp->code)
+        pc = Parrot_pcc_get_pc(interp, ctx);
+
+    if (pc) {
+        size_t * const slot = pointer_map_put(&as->pcs, pc, &found);
+
+        if (!found) {
+            if (as->num_sites == as->sites_size) {
+                as->sites = mem_internal_realloc_n_zeroed_typed(as->sites,
+                        as->sites_size * 2, as->sites_size, GC_Alloc_Site);
+                as->sites_size *= 2;
+            }
+
+            as->sites[as->num_sites].seg = interp->code;
+            as->sites[as->num_sites].pc  = pc;
+            *slot = as->num_sites++;
+        }
+
+        site = *slot;
+    }
+
+    *pointer_map_put(&as->pmcs, pmc, &found) = site;
+}
+
+/*
+
+=back
+
+=head2 Snapshots
+
+=over 4
+
+=item C<void Parrot_gc_heap_snapshot_write(PARROT_INTERP, FILE *out)>
+
+Write a snapshot of the live heap to C<out>.
+
+=cut
+
+*/
+
+void
+Parrot_gc_heap_snapshot_write(PARROT_INTERP, ARGMOD(FILE *out))
+{
+    ASSERT_ARGS(Parrot_gc_heap_snapshot_write)
+    GC_Subsystem     * const gc_sys = interp->gc_sys;
+    GC_Heap_Snapshot        snapshot;
+    void                  (*mark_pmc)(PARROT_INTERP, PMC *);
+    void                  (*mark_str)(PARROT_INTERP, STRING *);
+    size_t                  id, i;
+
+    Parrot_block_GC_mark(interp);
+    Parrot_block_GC_sweep(interp);
+
+    memset(&snapshot, 0, sizeof (GC_Heap_Snapshot));
+    snapshot.objects_size = 1024;
+    snapshot.objects      = mem_internal_allocate_n_zeroed_typed(
+                                snapshot.objects_size, PObj *);
+    snapshot.refs_size    = 64;
+    snapshot.refs         = mem_internal_allocate_n_zeroed_typed(
+                                snapshot.refs_size, size_t);
+
+    mark_pmc               = gc_sys->mark_pmc_header;
+    mark_str               = gc_sys->mark_str_header;
+    gc_sys->mark_pmc_header = snapshot_mark_pmc;
+    gc_sys->mark_str_header = snapshot_mark_str;
+    gc_sys->heap_snapshot   = &snapshot;
+
+    fputs("{\"version\":1,\"objects\":[\n", out);
+
+    /* Only the interpreter's roots: what the C stack happens to point at
+     * is not part of the heap, and not every collector can scan it */
+    Parrot_gc_trace_root(interp, NULL, GC_TRACE_ROOT_ONLY);
+    fputs("{\"id\":0,\"kind\":\"roots\"", out);
+    write_refs(out, &snapshot);
+    fputs("}", out);
+
+    /* Objects found while walking one are appended, and walked later */
+    for (id = 1; id <= snapshot.num_objects; ++id) {
+        PObj * const obj = snapshot.objects[id];
+
+        snapshot.num_refs = 0;
+        fprintf(out, ",\n{\"id\":%lu", (unsigned long)id);
+
+        if (PObj_is_PMC_TEST(obj)) {
+            PMC * const pmc = (PMC *)obj;
+
+            if (PObj_custom_mark_TEST(pmc))
+                VTABLE_mark(interp, pmc);
+
+            Parrot_gc_mark_PMC_alive(interp, PMC_metadata(pmc));
+
+            fputs(",\"kind\":\"pmc\",\"type\":", out);
+            write_json_string(out, snapshot_type_name(interp, &snapshot, pmc));
+            fprintf(out, ",\"size\":%lu,\"attr\":%lu",
+                    (unsigned long)sizeof (PMC),
+                    (unsigned long)pmc->vtable->attr_size);
+
+            if (gc_sys->alloc_sites) {
+                size_t * const site = pointer_map_get(&gc_sys->alloc_sites->pmcs, pmc);
+                fprintf(out, ",\"site\":%lu", site ? (unsigned long)*site : 0UL);
+            }
+
+            write_refs(out, &snapshot);
+        }
+        else {
+            fprintf(out, ",\"kind\":\"%s\",\"size\":%lu,\"data\":%lu",
+                    PObj_is_string_TEST(obj) ? "string" : "buffer",
+                    (unsigned long)(PObj_is_string_TEST(obj)
+                        ? sizeof (STRING) : sizeof (Parrot_Buffer)),
+                    (unsigned long)Buffer_buflen((Parrot_Buffer *)obj));
+        }
+
+        fputs("}", out);
+    }
+
+    gc_sys->mark_pmc_header = mark_pmc;
+    gc_sys->mark_str_header = mark_str;
+    gc_sys->heap_snapshot   = NULL;
+
+    fputs("\n]", out);
+
+    if (gc_sys->alloc_sites)
+        write_sites(interp, out, gc_sys->alloc_sites);
+
+    fputs("}\n", out);
+
+    for (i = 0; i < snapshot.num_types; ++i)
+        Parrot_str_free_cstring(snapshot.types[i]);
+
+    pointer_map_free(&snapshot.ids);
+    pointer_map_free(&snapshot.type_ids);
+    mem_internal_free(snapshot.objects);
+    mem_internal_free(snapshot.refs);
+    if (snapshot.types)
+        mem_internal_free(snapshot.types);
+
+    Parrot_unblock_GC_mark(interp);
+    Parrot_unblock_GC_sweep(interp);
+}
+
+/*
+
+=item C<static void snapshot_mark_pmc(PARROT_INTERP, PMC *pmc)>
+
+=item C<static void snapshot_mark_str(PARROT_INTERP, STRING *str)>
+
+Stand in for the collector's C<mark_pmc_header> and C<mark_str_header>
+during a snapshot.
+
+=cut
+
+*/
+
+static void
+snapshot_mark_pmc(PARROT_INTERP, ARGMOD(PMC *pmc))
+{
+    ASSERT_ARGS(snapshot_mark_pmc)
+    snapshot_add(interp->gc_sys->heap_snapshot, (PObj *)pmc);
+}
+
+static void
+snapshot_mark_str(PARROT_INTERP, ARGMOD(STRING *str))
+{
+    ASSERT_ARGS(snapshot_mark_str)
+    snapshot_add(interp->gc_sys->heap_snapshot, (PObj *)str);
+}
+
+/*
+
+=item C<static void snapshot_add(GC_Heap_Snapshot *snapshot, PObj *obj)>
+
+Note that the object being walked refers to C<obj>, and queue C<obj> to be
+walked if it is new.
+
+=cut
+
+*/
+
+static void
+snapshot_add(ARGMOD(GC_Heap_Snapshot *snapshot), ARGIN(PObj *obj))
+{
+    ASSERT_ARGS(snapshot_add)
+    size_t *slot;
+    int     found;
+
+    if (PObj_on_free_list_TEST(obj))
+        return;
+
+    slot = pointer_map_put(&snapshot->ids, obj, &found);
+
+    if (!found) {
+        if (snapshot->num_objects + 1 == snapshot->objects_size) {
+            snapshot->objects = mem_internal_realloc_n_zeroed_typed(snapshot->objects,
+                    snapshot->objects_size * 2, snapshot->objects_size, PObj *);
+            snapshot->objects_size *= 2;
+        }
+
+        *slot = ++snapshot->num_objects;
+        snapshot->objects[*slot] = obj;
+    }
+
+    if (snapshot->num_refs == snapshot->refs_size) {
+        snapshot->refs = mem_internal_realloc_n_zeroed_typed(snapshot->refs,
+                snapshot->refs_size * 2, snapshot->refs_size, size_t);
+        snapshot->refs_size *= 2;
+    }
+
+    snapshot->refs[snapshot->num_refs++] = *slot;
+}
+
+/*
+
+=item C<static const char * snapshot_type_name(PARROT_INTERP, GC_Heap_Snapshot
+*snapshot, PMC *pmc)>
+
+Return the name of the class of C<pmc>.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static const char *
+snapshot_type_name(PARROT_INTERP, ARGMOD(GC_Heap_Snapshot *snapshot), ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(snapshot_type_name)
+    const void *key  = pmc->vtable;
+    STRING     *name = pmc->vtable->whoami;
+    size_t     *slot;
+    int         found;
+
+    if (pmc->vtable->base_type == enum_class_Object) {
+        PMC * const _class = PARROT_OBJECT(pmc)->_class;
+
+        if (!PMC_IS_NULL(_class) && _class->vtable->base_type == enum_class_Class) {
+            Parrot_Class_attributes * const class_info = PARROT_CLASS(_class);
+
+            key  = _class;
+            name = class_info->fullname ? class_info->fullname : class_info->name;
+        }
+    }
+
+    slot = pointer_map_put(&snapshot->type_ids, key, &found);
+
+    if (!found) {
+        if (snapshot->num_types == snapshot->types_size) {
+            const size_t new_size = snapshot->types_size ? snapshot->types_size * 2 : 64;
+
+            snapshot->types = snapshot->types
+                ? mem_internal_realloc_n_zeroed_typed(snapshot->types,
+                        new_size, snapshot->types_size, char *)
+                : mem_internal_allocate_n_zeroed_typed(new_size, char *);
+            snapshot->types_size = new_size;
+        }
+
+        snapshot->types[snapshot->num_types] = Parrot_str_to_cstring(interp,
+                name ? name : Parrot_str_new_constant(interp, ""));
+        *slot = snapshot->num_types++;
+    }
+
+    return snapshot->types[*slot];
+}
+
+/*
+
+=item C<static void write_refs(FILE *out, const GC_Heap_Snapshot *snapshot)>
+
+Write the ids of the objects marked by the one just walked.
+
+=cut
+
+*/
+
+static void
+write_refs(ARGMOD(FILE *out), ARGIN(const GC_Heap_Snapshot *snapshot))
+{
+    ASSERT_ARGS(write_refs)
+    size_t i;
+
+    fputs(",\"refs\":[", out);
+
+    for (i = 0; i < snapshot->num_refs; ++i)
+        fprintf(out, i ? ",%lu" : "%lu", (unsigned long)snapshot->refs[i]);
+
+    fputs("]", out);
+}
+
+/*
+
+=item C<static void write_sites(PARROT_INTERP, FILE *out, const GC_Alloc_Sites
+*as)>
+
+Write the allocation sites, with the names of their Subs.
+
+=cut
+
+*/
+
+static void
+write_sites(PARROT_INTERP, ARGMOD(FILE *out), ARGIN(const GC_Alloc_Sites *as))
+{
+    ASSERT_ARGS(write_sites)
+    size_t i;
+
+    fputs(",\"sites\":[\n{\"id\":0,\"sub\":\"\",\"pc\":-1}", out);
+
+    for (i = 1; i < as->num_sites; ++i) {
+        const GC_Alloc_Site * const site   = &as->sites[i];
+        const size_t                offset = site->pc - site->seg->base.data;
+        PMC                  * const sub   = find_sub_at(interp, site->seg, offset);
+        STRING               * const name  = sub
+                                           ? Parrot_sub_full_sub_name(interp, sub)
+                                           : NULL;
+
+        fprintf(out, ",\n{\"id\":%lu,\"sub\":", (unsigned long)i);
+
+        if (name) {
+            char * const cname = Parrot_str_to_cstring(interp, name);
+            write_json_string(out, cname);
+            Parrot_str_free_cstring(cname);
+        }
+        else
+            fputs("\"\"", out);
+
+        fprintf(out, ",\"pc\":%lu}", (unsigned long)offset);
+    }
+
+    fputs("\n]", out);
+}
+
+/*
+
+=item C<static PMC * find_sub_at(PARROT_INTERP, PackFile_ByteCode *seg, size_t
+offset)>
+
+Return the Sub in the constant table of C<seg> which contains the opcode at
+C<offset>, or NULL.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static PMC *
+find_sub_at(PARROT_INTERP, ARGIN(PackFile_ByteCode *seg), size_t offset)
+{
+    ASSERT_ARGS(find_sub_at)
+    PackFile_ConstTable * const ct = seg->const_table;
+    opcode_t                    i;
+
+    if (!ct)
+        return NULL;
+
+    for (i = 0; i < ct->pmc.const_count; ++i) {
+        PMC * const pmc = ct->pmc.constants[i];
+        INTVAL      type;
+
+        if (!pmc)
+            continue;
+
+        type = pmc->vtable->base_type;
+
+        if (type == enum_class_Sub
+        ||  type == enum_class_Coroutine
+        ||  type == enum_class_Eval) {
+            const Parrot_Sub_attributes * const sub = PARROT_SUB(pmc);
+
+            if (sub->seg == seg && sub->start_offs <= offset && offset < sub->end_offs)
+                return pmc;
+        }
+    }
+
+    UNUSED(interp);
+    return NULL;
+}
+
+/*
+
+=item C<static void write_json_string(FILE *out, const char *s)>
+
+Write C<s> as a JSON string.
+
+=cut
+
+*/
+
+static void
+write_json_string(ARGMOD(FILE *out), ARGIN(const char *s))
+{
+    ASSERT_ARGS(write_json_string)
+
+    fputc('"', out);
+
+    for (; *s; ++s) {
+        const unsigned char c = (unsigned char)*s;
+
+        if (c == '"' || c == '\\')
+            fprintf(out, "\\%c", c);
+        else if (c < 0x20)
+            fprintf(out, "\\u%04x", c);
+        else
+            fputc(c, out);
+    }
+
+    fputc('"', out);
+}
+
+/*
+
+=back
+
+=head2 Pointer maps
+
+=over 4
+
+=item C<static size_t * pointer_map_get(const Pointer_Map *map, const void
+*key)>
+
+Return the value of C<key>, or NULL if there is none.
+
+=item C<static size_t * pointer_map_put(Pointer_Map *map, const void *key, int
+*found)>
+
+Return the value of C<key>, adding it if there is none.  C<found> tells
+whether there was one.  The value is good until the next C<pointer_map_put>.
+
+=item C<static size_t pointer_map_slot(const Pointer_Map *map, const void *key)>
+
+Return the slot of C<key>, or the empty one where it belongs.
+
+=item C<static void pointer_map_free(Pointer_Map *map)>
+
+Free the memory of C<map>.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static size_t *
+pointer_map_get(ARGIN(const Pointer_Map *map), ARGIN(const void *key))
+{
+    ASSERT_ARGS(pointer_map_get)
+    size_t slot;
+
+    if (!map->size)
+        return NULL;
+
+    slot = pointer_map_slot(map, key);
+    return map->keys[slot] ? &map->values[slot] : NULL;
+}
+
+PARROT_CANNOT_RETURN_NULL
+static size_t *
+pointer_map_put(ARGMOD(Pointer_Map *map), ARGIN(const void *key), ARGOUT(int *found))
+{
+    ASSERT_ARGS(pointer_map_put)
+    size_t slot;
+
+    /* Keep at least half of the slots empty */
+    if (2 * (map->count + 1) > map->size) {
+        Pointer_Map       old      = *map;
+        const size_t      new_size = old.size ? old.size * 2 : 1024;
+        size_t            i;
+
+        map->keys   = mem_internal_allocate_n_zeroed_typed(new_size, const void *);
+        map->values = mem_internal_allocate_n_zeroed_typed(new_size, size_t);
+        map->size   = new_size;
+
+        for (i = 0; i < old.size; ++i) {
+            if (old.keys[i]) {
+                slot              = pointer_map_slot(map, old.keys[i]);
+                map->keys[slot]   = old.keys[i];
+                map->values[slot] = old.values[i];
+            }
+        }
+
+        pointer_map_free(&old);
+    }
+
+    slot   = pointer_map_slot(map, key);
+    *found = map->keys[slot] != NULL;
+
+    if (!*found) {
+        map->keys[slot] = key;
+        ++map->count;
+    }
+
+    return &map->values[slot];
+}
+
+PARROT_WARN_UNUSED_RESULT
+static size_t
+pointer_map_slot(ARGIN(const Pointer_Map *map), ARGIN(const void *key))
+{
+    ASSERT_ARGS(pointer_map_slot)
+    const size_t mask = map->size - 1;
+    size_t       slot = (size_t)(((ptrcast_t)key >> 3) * 2654435761UL) & mask;
+
+    while (map->keys[slot] && map->keys[slot] != key)
+        slot = (slot + 1) & mask;
+
+    return slot;
+}
+
+static void
+pointer_map_free(ARGMOD(Pointer_Map *map))
+{
+    ASSERT_ARGS(pointer_map_free)
+
+    if (map->keys) {
+        mem_internal_free(map->keys);
+        mem_internal_free(map->values);
+    }
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/gc/gc_private.h>, F<src/gc/api.c>, F<frontend/heap_diff/main.c>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -290,6 +290,8 @@ mark_code_segment(PARROT_INTERP)
         for (i = 0; i < ct->str.const_count; i++) {
             Parrot_gc_mark_STRING_alive(interp, ct->str.constants[i]);
         }
+
+        mark_method_inline_caches(interp, bc);
     }
 }
 
@@ -691,6 +693,9 @@ free_buffer(PARROT_INTERP, ARGMOD(Memory_Pools *mem_pools),
 {
     ASSERT_ARGS(free_buffer)
 
+    if (PObj_is_string_TEST(b) && ((STRING *)b)->index)
+        Parrot_str_free_index(interp, (STRING *)b);
+
     /* If there is no allocated buffer - bail out */
     if (Buffer_buflen(b) == 0)
         return;
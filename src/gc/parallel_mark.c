@@ -0,0 +1,621 @@
+/*
+Copyright (C) 2012, Parrot Foundation.
+
+=head1 NAME
+
+src/gc/parallel_mark.c - Marking PMCs with several threads
+
+=head1 DESCRIPTION
+
+Lets a collector trace the PMC graph with helper threads while the
+interpreter is stopped.  The collector traces roots on its own and hands the
+grey PMCs it found to C<Parrot_gc_parallel_mark_run>.  The calling thread and
+the helpers then call VTABLE_mark on them and on everything they reach.
+Meanwhile the collector's C<mark_pmc_header> has to claim PMCs with
+C<PObj_live_CLAIM> and pass the ones it claimed to
+C<Parrot_gc_parallel_mark_push>, instead of moving them between its lists.
+
+Every thread keeps the PMCs it has yet to scan on a private stack.  When the
+stack is deep and the thread's public deque is empty, it moves the older half
+of the stack there.  Threads which ran out of work take it back from their own
+deque or steal half of another thread's.  Marking is finished when all
+threads are idle and no deque holds work.
+
+Parallel marking needs POSIX threads and atomic builtins of GCC.  Without
+them C<Parrot_gc_parallel_mark_new> returns NULL and collectors mark in one
+thread.
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+#include "gc_private.h"
+
+#ifdef PARROT_GC_PARALLEL_MARK
+#  include <pthread.h>
+#  include <signal.h>
+#endif
+
+/* HEADERIZER HFILE: src/gc/gc_private.h */
+
+#ifdef PARROT_GC_PARALLEL_MARK
+
+/* Share work only from stacks deeper than this */
+#  define MARK_SHARE_MIN  64
+
+/* Initial size of private stacks */
+#  define MARK_STACK_SIZE 1024
+
+typedef struct Mark_Worker {
+    struct Parallel_Mark *pm;
+
+    /* PMCs to scan. Only used by the owning thread */
+    PMC            **stack;
+    size_t           count;
+    size_t           size;
+
+    /* PMCs other threads may steal. Changed under lock only, but read
+     * without it to find out whether there is something to steal */
+    pthread_mutex_t  lock;
+    PMC            **shared;
+    volatile size_t  shared_count;
+    size_t           shared_size;
+
+    pthread_t        thread;
+} Mark_Worker;
+
+struct Parallel_Mark {
+    /* Interpreter marked by the current run */
+    Interp          *interp;
+
+    /* workers[0] is the thread running the collector, others are helpers */
+    Mark_Worker     *workers;
+    size_t           num_workers;
+
+    /* Mark_Worker of the current thread */
+    pthread_key_t    current;
+
+    pthread_mutex_t  lock;
+
+    /* Helpers wait for the next run here */
+    pthread_cond_t   start;
+
+    /* Idle workers wait for shared work here */
+    pthread_cond_t   work;
+
+    /* Collector waits for helpers to leave the run here */
+    pthread_cond_t   finish;
+
+    /* Protected by lock */
+    size_t           run;
+    size_t           idle;
+    size_t           busy_helpers;
+    int              done;
+    int              shutdown;
+};
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_CAN_RETURN_NULL
+static void * mark_helper(ARGIN(void *arg))
+        __attribute__nonnull__(1);
+
+static int mark_worker_refill(ARGMOD(Mark_Worker *w))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*w);
+
+static void mark_worker_reserve(ARGMOD(Mark_Worker *w), size_t n)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*w);
+
+static void mark_worker_run(PARROT_INTERP, ARGMOD(Mark_Worker *w))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*w);
+
+static void mark_worker_scan(PARROT_INTERP, ARGMOD(Mark_Worker *w))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*w);
+
+static void mark_worker_share(ARGMOD(Mark_Worker *w))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*w);
+
+static int mark_worker_wait(ARGMOD(Mark_Worker *w))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*w);
+
+#define ASSERT_ARGS_mark_helper __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(arg))
+#define ASSERT_ARGS_mark_worker_refill __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(w))
+#define ASSERT_ARGS_mark_worker_reserve __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(w))
+#define ASSERT_ARGS_mark_worker_run __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(w))
+#define ASSERT_ARGS_mark_worker_scan __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(w))
+#define ASSERT_ARGS_mark_worker_share __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(w))
+#define ASSERT_ARGS_mark_worker_wait __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(w))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=over 4
+
+=item C<static void mark_worker_reserve(Mark_Worker *w, size_t n)>
+
+Make room for C<n> more PMCs on the private stack of C<w>.
+
+=cut
+
+*/
+
+static void
+mark_worker_reserve(ARGMOD(Mark_Worker *w), size_t n)
+{
+    ASSERT_ARGS(mark_worker_reserve)
+
+    if (w->count + n > w->size) {
+        while (w->count + n > w->size)
+            w->size *= 2;
+        mem_internal_realloc_n_typed(w->stack, w->size, PMC *);
+    }
+}
+
+/*
+
+=item C<static void mark_worker_share(Mark_Worker *w)>
+
+Move the older half of the private stack of C<w> to its empty public deque
+and wake up idle workers to steal it.
+
+=cut
+
+*/
+
+static void
+mark_worker_share(ARGMOD(Mark_Worker *w))
+{
+    ASSERT_ARGS(mark_worker_share)
+    Parallel_Mark * const pm   = w->pm;
+    const size_t          half = w->count / 2;
+
+    pthread_mutex_lock(&w->lock);
+    if (w->shared_size < half) {
+        w->shared_size = w->size;
+        mem_internal_realloc_n_typed(w->shared, w->shared_size, PMC *);
+    }
+    mem_copy_n_typed(w->shared, w->stack, half, PMC *);
+    w->shared_count = half;
+    pthread_mutex_unlock(&w->lock);
+
+    w->count -= half;
+    mem_sys_memmove(w->stack, w->stack + half, w->count * sizeof (PMC *));
+
+    pthread_mutex_lock(&pm->lock);
+    if (pm->idle)
+        pthread_cond_broadcast(&pm->work);
+    pthread_mutex_unlock(&pm->lock);
+}
+
+/*
+
+=item C<static void mark_worker_scan(PARROT_INTERP, Mark_Worker *w)>
+
+Scan PMCs on the private stack of C<w> until it is empty.  Children claimed
+meanwhile are pushed on the same stack.
+
+=cut
+
+*/
+
+static void
+mark_worker_scan(PARROT_INTERP, ARGMOD(Mark_Worker *w))
+{
+    ASSERT_ARGS(mark_worker_scan)
+
+    while (w->count) {
+        PMC * const pmc = w->stack[--w->count];
+
+        if (PObj_custom_mark_TEST(pmc))
+            VTABLE_mark(interp, pmc);
+
+        if (PMC_metadata(pmc))
+            Parrot_gc_mark_PMC_alive(interp, PMC_metadata(pmc));
+
+        if (w->count >= MARK_SHARE_MIN && !w->shared_count)
+            mark_worker_share(w);
+    }
+}
+
+/*
+
+=item C<static int mark_worker_refill(Mark_Worker *w)>
+
+Refill the empty private stack of C<w>.  Takes back all of its own public
+deque, or half of the first other non-empty one.  Returns 0 if there was
+nothing to take.
+
+=cut
+
+*/
+
+static int
+mark_worker_refill(ARGMOD(Mark_Worker *w))
+{
+    ASSERT_ARGS(mark_worker_refill)
+    Parallel_Mark * const pm    = w->pm;
+    const size_t          first = w - pm->workers;
+    size_t                i;
+
+    for (i = 0; i < pm->num_workers; i++) {
+        Mark_Worker * const victim = &pm->workers[(first + i) % pm->num_workers];
+        size_t              n;
+
+        if (!victim->shared_count)
+            continue;
+
+        pthread_mutex_lock(&victim->lock);
+        n = victim == w
+          ? victim->shared_count
+          : (victim->shared_count + 1) / 2;
+
+        if (n) {
+            victim->shared_count -= n;
+            mark_worker_reserve(w, n);
+            mem_copy_n_typed(w->stack + w->count,
+                    victim->shared + victim->shared_count, n, PMC *);
+            w->count += n;
+        }
+        pthread_mutex_unlock(&victim->lock);
+
+        if (n)
+            return 1;
+    }
+
+    return 0;
+}
+
+/*
+
+=item C<static int mark_worker_wait(Mark_Worker *w)>
+
+Wait until some worker shares work, or until all of them are idle.  Returns 0
+when marking is finished.
+
+No deque changes while all workers are idle, so the last worker which becomes
+idle can tell that marking is finished.
+
+=cut
+
+*/
+
+static int
+mark_worker_wait(ARGMOD(Mark_Worker *w))
+{
+    ASSERT_ARGS(mark_worker_wait)
+    Parallel_Mark * const pm    = w->pm;
+    int                   found = 0;
+
+    pthread_mutex_lock(&pm->lock);
+    pm->idle++;
+
+    while (!pm->done) {
+        size_t i;
+
+        for (i = 0; i < pm->num_workers; i++)
+            if (pm->workers[i].shared_count)
+                found = 1;
+
+        if (found) {
+            pm->idle--;
+            break;
+        }
+
+        if (pm->idle == pm->num_workers) {
+            pm->done = 1;
+            pthread_cond_broadcast(&pm->work);
+            break;
+        }
+
+        pthread_cond_wait(&pm->work, &pm->lock);
+    }
+
+    pthread_mutex_unlock(&pm->lock);
+    return found;
+}
+
+/*
+
+=item C<static void mark_worker_run(PARROT_INTERP, Mark_Worker *w)>
+
+Mark with worker C<w> until marking is finished.
+
+=cut
+
+*/
+
+static void
+mark_worker_run(PARROT_INTERP, ARGMOD(Mark_Worker *w))
+{
+    ASSERT_ARGS(mark_worker_run)
+
+    do {
+        do
+            mark_worker_scan(interp, w);
+        while (mark_worker_refill(w));
+    } while (mark_worker_wait(w));
+}
+
+/*
+
+=item C<static void * mark_helper(void *arg)>
+
+Body of helper threads.  Takes part in every run of marking until the
+C<Parallel_Mark> is destroyed.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static void *
+mark_helper(ARGIN(void *arg))
+{
+    ASSERT_ARGS(mark_helper)
+    Mark_Worker   * const w   = (Mark_Worker *)arg;
+    Parallel_Mark * const pm  = w->pm;
+    size_t                run = 0;
+
+    pthread_setspecific(pm->current, w);
+
+    pthread_mutex_lock(&pm->lock);
+    for (;;) {
+        while (pm->run == run && !pm->shutdown)
+            pthread_cond_wait(&pm->start, &pm->lock);
+
+        if (pm->shutdown)
+            break;
+
+        run = pm->run;
+        pthread_mutex_unlock(&pm->lock);
+
+        mark_worker_run(pm->interp, w);
+
+        pthread_mutex_lock(&pm->lock);
+        if (!--pm->busy_helpers)
+            pthread_cond_signal(&pm->finish);
+    }
+    pthread_mutex_unlock(&pm->lock);
+
+    return NULL;
+}
+
+#endif /* PARROT_GC_PARALLEL_MARK */
+
+/*
+
+=item C<Parallel_Mark * Parrot_gc_parallel_mark_new(PARROT_INTERP, size_t
+helpers)>
+
+Start C<helpers> threads to help marking.  Returns NULL for no helpers, or
+when this platform can't mark in parallel.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+Parallel_Mark *
+Parrot_gc_parallel_mark_new(SHIM_INTERP, size_t helpers)
+{
+    ASSERT_ARGS(Parrot_gc_parallel_mark_new)
+#ifdef PARROT_GC_PARALLEL_MARK
+    Parallel_Mark *pm;
+    size_t         i;
+#  ifndef _WIN32
+    sigset_t       all, old;
+#  endif
+
+    if (!helpers)
+        return NULL;
+
+    pm              = mem_internal_allocate_zeroed_typed(Parallel_Mark);
+    pm->num_workers = helpers + 1;
+    pm->workers     = mem_internal_allocate_n_zeroed_typed(pm->num_workers,
+                                                           Mark_Worker);
+
+    pthread_key_create(&pm->current, NULL);
+    pthread_mutex_init(&pm->lock, NULL);
+    pthread_cond_init(&pm->start, NULL);
+    pthread_cond_init(&pm->work, NULL);
+    pthread_cond_init(&pm->finish, NULL);
+
+    for (i = 0; i < pm->num_workers; i++) {
+        Mark_Worker * const w = &pm->workers[i];
+
+        w->pm   = pm;
+        w->size = MARK_STACK_SIZE;
+        w->stack = mem_internal_allocate_n_zeroed_typed(w->size, PMC *);
+        pthread_mutex_init(&w->lock, NULL);
+    }
+
+#  ifndef _WIN32
+    /* Signals are for the interpreter thread. Helpers inherit this mask */
+    sigfillset(&all);
+    pthread_sigmask(SIG_SETMASK, &all, &old);
+#  endif
+
+    for (i = 1; i < pm->num_workers; i++)
+        if (pthread_create(&pm->workers[i].thread, NULL, mark_helper,
+                &pm->workers[i])) {
+            /* Make do with the helpers we have */
+            pm->num_workers = i;
+            break;
+        }
+
+#  ifndef _WIN32
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+#  endif
+
+    return pm;
+#else
+    UNUSED(helpers);
+    return NULL;
+#endif
+}
+
+/*
+
+=item C<void Parrot_gc_parallel_mark_destroy(PARROT_INTERP, Parallel_Mark *pm)>
+
+Stop the helper threads and free C<pm>.
+
+=cut
+
+*/
+
+void
+Parrot_gc_parallel_mark_destroy(SHIM_INTERP, ARGFREE_NOTNULL(Parallel_Mark *pm))
+{
+    ASSERT_ARGS(Parrot_gc_parallel_mark_destroy)
+#ifdef PARROT_GC_PARALLEL_MARK
+    const size_t allocated = pm->num_workers;
+    size_t       i;
+
+    pthread_mutex_lock(&pm->lock);
+    pm->shutdown = 1;
+    pthread_cond_broadcast(&pm->start);
+    pthread_mutex_unlock(&pm->lock);
+
+    for (i = 1; i < pm->num_workers; i++)
+        pthread_join(pm->workers[i].thread, NULL);
+
+    for (i = 0; i < allocated; i++) {
+        pthread_mutex_destroy(&pm->workers[i].lock);
+        mem_internal_free(pm->workers[i].stack);
+        if (pm->workers[i].shared)
+            mem_internal_free(pm->workers[i].shared);
+    }
+
+    pthread_cond_destroy(&pm->finish);
+    pthread_cond_destroy(&pm->work);
+    pthread_cond_destroy(&pm->start);
+    pthread_mutex_destroy(&pm->lock);
+    pthread_key_delete(pm->current);
+
+    mem_internal_free(pm->workers);
+    mem_internal_free(pm);
+#else
+    UNUSED(pm);
+#endif
+}
+
+/*
+
+=item C<void Parrot_gc_parallel_mark_run(PARROT_INTERP, Parallel_Mark *pm, PMC
+**grey, size_t count)>
+
+Mark the C<count> PMCs in C<grey> and everything they reach, with the calling
+thread and all helpers.  The PMCs in C<grey> must be claimed already.  Returns
+when marking is finished.
+
+=cut
+
+*/
+
+void
+Parrot_gc_parallel_mark_run(PARROT_INTERP, ARGMOD(Parallel_Mark *pm),
+        ARGIN(PMC **grey), size_t count)
+{
+    ASSERT_ARGS(Parrot_gc_parallel_mark_run)
+#ifdef PARROT_GC_PARALLEL_MARK
+    size_t i;
+
+    pm->interp = interp;
+    pthread_setspecific(pm->current, &pm->workers[0]);
+
+    /* Deal out grey PMCs. Helpers see them once they took the lock */
+    for (i = 0; i < count; i++) {
+        Mark_Worker * const w = &pm->workers[i % pm->num_workers];
+
+        mark_worker_reserve(w, 1);
+        w->stack[w->count++] = grey[i];
+    }
+
+    pthread_mutex_lock(&pm->lock);
+    pm->idle         = 0;
+    pm->done         = 0;
+    pm->busy_helpers = pm->num_workers - 1;
+    pm->run++;
+    pthread_cond_broadcast(&pm->start);
+    pthread_mutex_unlock(&pm->lock);
+
+    mark_worker_run(interp, &pm->workers[0]);
+
+    /* Helpers may still be looking at our deques */
+    pthread_mutex_lock(&pm->lock);
+    while (pm->busy_helpers)
+        pthread_cond_wait(&pm->finish, &pm->lock);
+    pthread_mutex_unlock(&pm->lock);
+#else
+    UNUSED(interp);
+    UNUSED(pm);
+    UNUSED(grey);
+    UNUSED(count);
+#endif
+}
+
+/*
+
+=item C<void Parrot_gc_parallel_mark_push(Parallel_Mark *pm, PMC *pmc)>
+
+Schedule the claimed C<pmc> for scanning by the current thread.  Only valid
+during C<Parrot_gc_parallel_mark_run>.
+
+=cut
+
+*/
+
+void
+Parrot_gc_parallel_mark_push(ARGIN(Parallel_Mark *pm), ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(Parrot_gc_parallel_mark_push)
+#ifdef PARROT_GC_PARALLEL_MARK
+    Mark_Worker * const w = (Mark_Worker *)pthread_getspecific(pm->current);
+
+    mark_worker_reserve(w, 1);
+    w->stack[w->count++] = pmc;
+#else
+    UNUSED(pm);
+    UNUSED(pmc);
+#endif
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/gc/gc_gms.c>, F<src/gc/gc_ms2.c>
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
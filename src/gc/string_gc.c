@@ -31,6 +31,9 @@ typedef void (*compact_f) (Interp *, GC_Statistics *stats, Variable_Size_Pool *)
 #define RECLAMATION_FACTOR 0.20
 #define WE_WANT_EVER_GROWING_ALLOCATIONS 0
 
+/* Bytes of a Memory_Block still in use */
+#define BLOCK_LIVE_SIZE(b) ((b)->size - (b)->freed - (b)->free)
+
 /* HEADERIZER HFILE: src/gc/gc_private.h */
 
 /* HEADERIZER BEGIN: static */
@@ -56,6 +59,11 @@ static void alloc_new_block(PARROT_INTERP,
         FUNC_MODIFIES(*stats)
         FUNC_MODIFIES(*pool);
 
+PARROT_WARN_UNUSED_RESULT
+static int block_live_size_cmp(ARGIN(const void *a), ARGIN(const void *b))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_CANNOT_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
 static const char * buffer_location(PARROT_INTERP,
@@ -63,6 +71,12 @@ static const char * buffer_location(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static UINTVAL choose_blocks(PARROT_INTERP,
+    ARGMOD(Variable_Size_Pool *pool))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pool);
+
 static void compact_pool(PARROT_INTERP,
     ARGMOD(GC_Statistics *stats),
     ARGMOD(Variable_Size_Pool *pool))
@@ -80,8 +94,7 @@ static void free_memory_pool(ARGFREE(Variable_Size_Pool *pool));
 static void free_old_mem_blocks(
      ARGMOD(GC_Statistics *stats),
     ARGMOD(Variable_Size_Pool *pool),
-    ARGMOD(Memory_Block *new_block),
-    UINTVAL total_size)
+    ARGMOD(Memory_Block *new_block))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         __attribute__nonnull__(3)
@@ -126,10 +139,6 @@ static Variable_Size_Pool * new_memory_pool(
     size_t min_block,
     NULLOK(compact_f compact));
 
-PARROT_CANNOT_RETURN_NULL
-static UINTVAL pad_pool_size(ARGIN(const Variable_Size_Pool *pool))
-        __attribute__nonnull__(1);
-
 #define ASSERT_ARGS_aligned_mem __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(buffer_unused) \
     , PARROT_ASSERT_ARG(mem))
@@ -138,9 +147,15 @@ static UINTVAL pad_pool_size(ARGIN(const Variable_Size_Pool *pool))
     , PARROT_ASSERT_ARG(stats) \
     , PARROT_ASSERT_ARG(pool) \
     , PARROT_ASSERT_ARG(why))
+#define ASSERT_ARGS_block_live_size_cmp __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
 #define ASSERT_ARGS_buffer_location __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_choose_blocks __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pool))
 #define ASSERT_ARGS_compact_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(stats) \
@@ -168,30 +183,33 @@ static UINTVAL pad_pool_size(ARGIN(const Variable_Size_Pool *pool))
     , PARROT_ASSERT_ARG(pool) \
     , PARROT_ASSERT_ARG(old_buf))
 #define ASSERT_ARGS_new_memory_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
-#define ASSERT_ARGS_pad_pool_size __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(pool))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
 /*
 
-=item C<void Parrot_gc_str_initialize(PARROT_INTERP, String_GC *gc)>
+=item C<void Parrot_gc_str_initialize(PARROT_INTERP, String_GC *gc, size_t
+compact_limit)>
 
 Initialize the managed memory pools. Parrot maintains two C<Variable_Size_Pool>
 structures, the general memory pool and the constant string pool. Create
 and initialize both pool structures, and allocate initial blocks of memory
 for both.
 
+A compaction of the general pool moves at most C<compact_limit> bytes, or
+all live strings if it is 0.
+
 =cut
 
 */
 
 void
-Parrot_gc_str_initialize(PARROT_INTERP, ARGMOD(String_GC *gc))
+Parrot_gc_str_initialize(PARROT_INTERP, ARGMOD(String_GC *gc), size_t compact_limit)
 {
     ASSERT_ARGS(Parrot_gc_str_initialize)
 
     gc->memory_pool   = new_memory_pool(POOL_SIZE, &compact_pool);
+    gc->memory_pool->compact_limit = compact_limit;
     alloc_new_block(interp, &interp->gc_sys->stats, POOL_SIZE, gc->memory_pool, "init");
 
     /* Constant strings - not compacted */
@@ -436,7 +454,8 @@ Parrot_gc_str_reallocate_string_storage(PARROT_INTERP,
 /*
 =item C<void Parrot_gc_str_compact_pool(PARROT_INTERP, String_GC *gc)>
 
-Compact string pool.
+Compact string pool. The time it takes is added to the collection being
+recorded.
 
 =cut
 */
@@ -444,7 +463,12 @@ void
 Parrot_gc_str_compact_pool(PARROT_INTERP, ARGIN(String_GC *gc))
 {
     ASSERT_ARGS(Parrot_gc_str_compact_pool)
+    const FLOATVAL start = Parrot_floatval_time();
+
     compact_pool(interp, &interp->gc_sys->stats, gc->memory_pool);
+
+    if (interp->gc_sys->event)
+        interp->gc_sys->event->compact_time += Parrot_floatval_time() - start;
 }
 
 /*
@@ -519,6 +543,7 @@ new_memory_pool(size_t min_block, NULLOK(compact_f compact))
     pool->guaranteed_reclaimable = 0;
     pool->possibly_reclaimable   = 0;
     pool->reclaim_factor         = RECLAMATION_FACTOR;
+    pool->compact_limit          = 0;
 
     return pool;
 }
@@ -746,6 +771,12 @@ Variable_Size_Pool *pool)>
 Compact the string buffer pool. Does not perform a GC scan, or mark items
 as being alive in any way.
 
+The live buffers of the blocks chosen by C<choose_blocks> are copied into one
+new block, which becomes the top block, and the chosen blocks are freed. With
+a C<compact_limit> on the pool only the most fragmented blocks are chosen, so
+a compaction copies a bounded amount of memory and the rest of the pool is
+left for later ones.
+
 =cut
 
 */
@@ -768,11 +799,11 @@ compact_pool(PARROT_INTERP,
     /* We're collecting */
     ++stats->gc_collect_runs;
 
-    /* Snag a block big enough for everything */
-    total_size = pad_pool_size(pool);
+    /* Snag a block big enough for everything we move */
+    total_size = choose_blocks(interp, pool);
 
     if (total_size == 0) {
-        free_old_mem_blocks(stats, pool, pool->top_block, total_size);
+        free_old_mem_blocks(stats, pool, pool->top_block);
         Parrot_unblock_GC_sweep(interp);
         return;
     }
@@ -793,7 +824,7 @@ compact_pool(PARROT_INTERP,
     stats->memory_collected += new_size;
     stats->memory_used      += new_size;
 
-    free_old_mem_blocks(stats, pool, new_block, total_size);
+    free_old_mem_blocks(stats, pool, new_block);
 
     Parrot_unblock_GC_sweep(interp);
 }
@@ -802,7 +833,8 @@ compact_pool(PARROT_INTERP,
 =item C<static void move_buffer_callback(PARROT_INTERP, Parrot_Buffer *b, void
 *data)>
 
-Callback for live STRING/Buffer for compating.
+Callback for live STRING/Buffer for compating. Moves buffers out of the
+blocks being evacuated.
 
 =cut
 */
@@ -815,7 +847,7 @@ move_buffer_callback(PARROT_INTERP, ARGIN(Parrot_Buffer *b), ARGIN(void *data))
     if (Buffer_buflen(b) && PObj_is_movable_TESTALL(b)) {
         Memory_Block * const old_block = Buffer_pool(b);
 
-        if (!is_block_almost_full(old_block))
+        if (old_block->evacuate)
             move_one_buffer(interp, new_block, b);
     }
 
@@ -823,61 +855,81 @@ move_buffer_callback(PARROT_INTERP, ARGIN(Parrot_Buffer *b), ARGIN(void *data))
 
 /*
 
-=item C<static UINTVAL pad_pool_size(const Variable_Size_Pool *pool)>
+=item C<static UINTVAL choose_blocks(PARROT_INTERP, Variable_Size_Pool *pool)>
+
+Choose the blocks to evacuate and return the size of the new block needed for
+their live buffers. Blocks which are almost full are never chosen.
 
-Calculate the size of the new pool. The currently used size equals the total
-size minus the reclaimable size. Add a minimum block to the current amount, so
-we can avoid having to allocate it in the future.
+Without a C<compact_limit> every other block is chosen. With one, the top
+block is taken first, since its free space would be lost under the new top
+block. Then the older blocks are taken in order of increasing live size,
+which frees the most memory per byte copied, for as long as their live sizes
+add up to no more than the limit. At least one older block is taken, so
+every compaction makes progress.
 
 Returns 0 if all blocks below the top block are almost full. In this case
 compacting is not needed.
 
 TODO - Big blocks
 
-Currently all available blocks are compacted into one new
-block with total_size. This is suboptimal, if the block has
-just one live item from a big allocation.
-
-But currently it's unknown if the buffer memory is alive
-as the live bits are in Buffer headers. We have to run the
-compaction loop to check liveness. OTOH if this compaction
-is running through all the buffer headers, there is no
-relation to the block.
-
-Moving the live bit into the buffer thus also solves this
-problem easily.
+A block with just one live item from a big allocation is still copied
+whole.  It's unknown if the buffer memory is alive as the live bits are in
+Buffer headers, so we have to run the compaction loop to check liveness.
+Moving the live bit into the buffer would solve this problem easily.
 
 =cut
 
 */
 
-PARROT_CANNOT_RETURN_NULL
 static UINTVAL
-pad_pool_size(ARGIN(const Variable_Size_Pool *pool))
+choose_blocks(PARROT_INTERP, ARGMOD(Variable_Size_Pool *pool))
 {
-    ASSERT_ARGS(pad_pool_size)
-    Memory_Block *cur_block = pool->top_block->prev;
-
-    UINTVAL total_size   = 0;
-#if RESOURCE_DEBUG
-    size_t  total_blocks = 1;
-#endif
-
-    while (cur_block) {
-        if (!is_block_almost_full(cur_block))
-            total_size += cur_block->size - cur_block->freed - cur_block->free;
-        cur_block   = cur_block->prev;
-#if RESOURCE_DEBUG
-        ++total_blocks;
-#endif
+    ASSERT_ARGS(choose_blocks)
+    Memory_Block  *cur_block;
+    Memory_Block **blocks;
+    size_t         num_blocks = 0, first_old, i;
+    UINTVAL        total_size = 0;
+
+    for (cur_block = pool->top_block; cur_block; cur_block = cur_block->prev) {
+        cur_block->evacuate = 0;
+        if (!is_block_almost_full(cur_block)) {
+            if (cur_block != pool->top_block)
+                total_size = 1;
+            ++num_blocks;
+        }
     }
 
     if (total_size == 0)
         return 0;
 
-    cur_block = pool->top_block;
-    if (!is_block_almost_full(cur_block))
-        total_size += cur_block->size - cur_block->freed - cur_block->free;
+    blocks = mem_internal_allocate_n_zeroed_typed(num_blocks, Memory_Block *);
+
+    for (cur_block = pool->top_block, i = 0; cur_block; cur_block = cur_block->prev)
+        if (!is_block_almost_full(cur_block))
+            blocks[i++] = cur_block;
+
+    /* The top block always goes, or its free space would be lost below the
+     * new one. The others are sorted if we can't take all of them */
+    first_old = blocks[0] == pool->top_block;
+
+    if (pool->compact_limit)
+        qsort(blocks + first_old, num_blocks - first_old,
+                sizeof (Memory_Block *), block_live_size_cmp);
+
+    total_size = 0;
+
+    for (i = 0; i < num_blocks; ++i) {
+        const UINTVAL live = BLOCK_LIVE_SIZE(blocks[i]);
+
+        if (pool->compact_limit && i > first_old
+        &&  total_size + live > pool->compact_limit)
+            break;
+
+        blocks[i]->evacuate = 1;
+        total_size         += live;
+    }
+
+    mem_internal_free(blocks);
 
     /* this makes for ever increasing allocations but fewer collect runs */
 #if WE_WANT_EVER_GROWING_ALLOCATIONS
@@ -885,7 +937,7 @@ pad_pool_size(ARGIN(const Variable_Size_Pool *pool))
 #endif
 
 #if RESOURCE_DEBUG
-    fprintf(stderr, "Total blocks: %d\n", total_blocks);
+    fprintf(stderr, "Evacuating %d of %d blocks\n", (int)i, (int)num_blocks);
 #endif
 
     return total_size;
@@ -893,6 +945,30 @@ pad_pool_size(ARGIN(const Variable_Size_Pool *pool))
 
 /*
 
+=item C<static int block_live_size_cmp(const void *a, const void *b)>
+
+Compare two C<Memory_Block> pointers by the size of the live data in the
+blocks, for C<qsort>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+block_live_size_cmp(ARGIN(const void *a), ARGIN(const void *b))
+{
+    ASSERT_ARGS(block_live_size_cmp)
+    const Memory_Block * const ba = *(const Memory_Block * const *)a;
+    const Memory_Block * const bb = *(const Memory_Block * const *)b;
+    const size_t               la = BLOCK_LIVE_SIZE(ba);
+    const size_t               lb = BLOCK_LIVE_SIZE(bb);
+
+    return la < lb ? -1 : la > lb ? 1 : 0;
+}
+
+/*
+
 =item C<static void move_one_buffer(PARROT_INTERP, Memory_Block *pool,
 Parrot_Buffer *old_buf)>
 
@@ -983,15 +1059,13 @@ move_one_buffer(PARROT_INTERP, ARGIN(Memory_Block *pool),
 /*
 
 =item C<static void free_old_mem_blocks( GC_Statistics *stats,
-Variable_Size_Pool *pool, Memory_Block *new_block, UINTVAL total_size)>
+Variable_Size_Pool *pool, Memory_Block *new_block)>
 
-The compact_pool operation collects disjointed blocks of memory allocated on a
-given pool's free list into one large block of memory, setting it as the new
-top block for the pool. Once that is done, and all items have been moved into
-the new block of memory, this function iterates through the old blocks and
-frees each one. It also performs the necessary housekeeping to record the
-freed memory blocks. At the end of this function, the pool will have only one
-block of memory on its free list.
+The compact_pool operation collects the live buffers of the evacuated blocks
+into one new block of memory, setting it as the new top block for the pool.
+Once that is done, this function iterates through the old blocks and frees
+the evacuated ones. It also performs the necessary housekeeping to record
+the freed memory blocks.
 
 =cut
 
@@ -1001,8 +1075,7 @@ static void
 free_old_mem_blocks(
         ARGMOD(GC_Statistics *stats),
         ARGMOD(Variable_Size_Pool *pool),
-        ARGMOD(Memory_Block *new_block),
-        UINTVAL total_size)
+        ARGMOD(Memory_Block *new_block))
 {
     ASSERT_ARGS(free_old_mem_blocks)
     Memory_Block *prev_block = new_block;
@@ -1013,15 +1086,17 @@ free_old_mem_blocks(
     while (cur_block) {
         Memory_Block * const next_block = cur_block->prev;
 
-        if (is_block_almost_full(cur_block)) {
+        if (!cur_block->evacuate) {
             /* Skip block */
-            prev_block = cur_block;
-            cur_block  = next_block;
+            cur_block->next = prev_block;
+            prev_block      = cur_block;
+            cur_block       = next_block;
         }
         else {
             /* Note that we don't have it any more */
             stats->memory_allocated -= cur_block->size;
             stats->memory_used      -= cur_block->size - cur_block->free;
+            pool->total_allocated   -= cur_block->size;
 
             /* We know the pool body and pool header are a single chunk, so
              * this is enough to get rid of 'em both */
@@ -1036,12 +1111,6 @@ free_old_mem_blocks(
     /* Terminate list */
     prev_block->prev = NULL;
 
-
-    /* ANR: I suspect this should be set to new_block->size, instead of passing
-     * in the raw value of total_size, because alloc_new_block pads the size of
-     * the new block under certain conditions. Leaving it unmodified for now,
-     * so this refactor has no functionality changes, only code cleanups.*/
-    pool->total_allocated        = total_size;
     pool->guaranteed_reclaimable = 0;
     pool->possibly_reclaimable   = 0;
 }
@@ -0,0 +1,247 @@
+/*
+Copyright (C) 2012, Parrot Foundation.
+
+=head1 NAME
+
+src/gc/telemetry.c - Recording collections
+
+=head1 DESCRIPTION
+
+Collectors call C<Parrot_gc_event_start> when a collection starts and
+C<Parrot_gc_event_finish> when it is done.  In between they count what they
+mark, sweep and promote in C<interp-E<gt>gc_sys-E<gt>event>.  Finished
+collections are kept in a ring of the last C<GC_EVENT_LOG_SIZE> ones, and
+their pause times go into a histogram with logarithmic buckets, so pause
+percentiles stay available for the whole run.
+
+With C<--gc-log=FILE> every collection is also written to FILE as a line of
+JSON:
+
+    {"gc":1,"start":1334567890.123456,"end":1334567890.124001,
+     "pause":0.000545,"generation":0,"marked":1204,"swept":20311,
+     "promoted":96320,"compact":0.000102}
+
+(on one line).  C<start> and C<end> are seconds since the epoch, the other
+times are seconds too.  C<generation> is the oldest generation collected,
+always 0 for collectors which have none, and -1 for a string compaction run
+on its own.
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+#include "gc_private.h"
+
+/* HEADERIZER HFILE: src/gc/gc_private.h */
+
+/* HEADERIZER BEGIN: static */
+/* HEADERIZER END: static */
+
+/*
+
+=head2 Functions
+
+=over 4
+
+=item C<void Parrot_gc_event_log_init(PARROT_INTERP, const char *log_file)>
+
+Set up recording of collections. Collections are written to C<log_file>
+unless it is NULL.
+
+=cut
+
+*/
+
+void
+Parrot_gc_event_log_init(PARROT_INTERP, ARGIN_NULLOK(const char *log_file))
+{
+    ASSERT_ARGS(Parrot_gc_event_log_init)
+    GC_Event_Log * const log = mem_internal_allocate_zeroed_typed(GC_Event_Log);
+
+    interp->gc_sys->event_log = log;
+    interp->gc_sys->event     = NULL;
+
+    if (log_file) {
+        log->log = fopen(log_file, "w");
+
+        /* Can't throw exception before GC is initialized */
+        if (!log->log) {
+            fprintf(stderr, "Cannot open GC log '%s'\n", log_file);
+            PANIC(interp, "Cannot activate GC");
+        }
+    }
+}
+
+/*
+
+=item C<void Parrot_gc_event_log_destroy(PARROT_INTERP)>
+
+Close the log file and free the recorded collections.
+
+=cut
+
+*/
+
+void
+Parrot_gc_event_log_destroy(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_event_log_destroy)
+    GC_Event_Log * const log = interp->gc_sys->event_log;
+
+    if (!log)
+        return;
+
+    if (log->log)
+        fclose(log->log);
+
+    mem_internal_free(log);
+    interp->gc_sys->event_log = NULL;
+    interp->gc_sys->event     = NULL;
+}
+
+/*
+
+=item C<GC_Event * Parrot_gc_event_start(PARROT_INTERP, INTVAL generation)>
+
+Start recording a collection of generations up to C<generation>. Returns the
+event to count in, which is also C<interp-E<gt>gc_sys-E<gt>event> until
+C<Parrot_gc_event_finish> is called.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+GC_Event *
+Parrot_gc_event_start(PARROT_INTERP, INTVAL generation)
+{
+    ASSERT_ARGS(Parrot_gc_event_start)
+    GC_Event * const event = &interp->gc_sys->event_log->current;
+
+    PARROT_ASSERT(!interp->gc_sys->event);
+
+    memset(event, 0, sizeof (GC_Event));
+    event->generation = generation;
+    event->start      = Parrot_floatval_time();
+
+    interp->gc_sys->event = event;
+    return event;
+}
+
+/*
+
+=item C<void Parrot_gc_event_finish(PARROT_INTERP)>
+
+Finish recording the current collection. Adds its pause to the histogram,
+keeps it in the ring and writes it to the log file.
+
+=cut
+
+*/
+
+void
+Parrot_gc_event_finish(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_gc_event_finish)
+    GC_Event_Log * const log   = interp->gc_sys->event_log;
+    GC_Event     * const event = &log->current;
+    FLOATVAL             pause;
+    FLOATVAL             bound = 1e-6;
+    size_t               bucket = 0;
+
+    PARROT_ASSERT(interp->gc_sys->event == event);
+
+    event->end = Parrot_floatval_time();
+    pause      = event->end - event->start;
+
+    while (pause > bound && bucket < GC_PAUSE_BUCKETS - 1) {
+        bound *= GC_PAUSE_BUCKET_GROWTH;
+        ++bucket;
+    }
+
+    ++log->pauses[bucket];
+
+    if (pause > log->max_pause)
+        log->max_pause = pause;
+
+    log->events[log->count % GC_EVENT_LOG_SIZE] = *event;
+    ++log->count;
+
+    if (log->log) {
+        fprintf(log->log, "{\"gc\":%lu,\"start\":%.6f,\"end\":%.6f,"
+                "\"pause\":%.6f,\"generation\":%ld,\"marked\":%lu,"
+                "\"swept\":%lu,\"promoted\":%lu,\"compact\":%.6f}\n",
+                (unsigned long)log->count, event->start, event->end, pause,
+                (long)event->generation, (unsigned long)event->marked,
+                (unsigned long)event->swept, (unsigned long)event->promoted,
+                event->compact_time);
+        fflush(log->log);
+    }
+
+    interp->gc_sys->event = NULL;
+}
+
+/*
+
+=item C<FLOATVAL Parrot_gc_event_pause_percentile(PARROT_INTERP, FLOATVAL
+percent)>
+
+Return the pause, in seconds, which C<percent> percent of all collections
+so far did not exceed. Accurate to the width of a histogram bucket, about
+19%. Returns 0 before the first collection.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+FLOATVAL
+Parrot_gc_event_pause_percentile(PARROT_INTERP, FLOATVAL percent)
+{
+    ASSERT_ARGS(Parrot_gc_event_pause_percentile)
+    const GC_Event_Log * const log = interp->gc_sys->event_log;
+    FLOATVAL                   bound = 1e-6;
+    FLOATVAL                   rank;
+    size_t                     wanted, seen = 0, bucket;
+
+    if (!log || !log->count)
+        return 0.0;
+
+    if (percent >= 100.0)
+        return log->max_pause;
+
+    /* nearest rank: the first pause with percent of all at or below it */
+    rank   = log->count * percent / 100.0;
+    wanted = rank > 1.0 ? (size_t)rank : 1;
+    if ((FLOATVAL)wanted < rank)
+        ++wanted;
+
+    for (bucket = 0; bucket < GC_PAUSE_BUCKETS; ++bucket) {
+        seen += log->pauses[bucket];
+        if (seen >= wanted)
+            break;
+        bound *= GC_PAUSE_BUCKET_GROWTH;
+    }
+
+    return bound < log->max_pause ? bound : log->max_pause;
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/gc/gc_private.h>, F<src/gc/api.c>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
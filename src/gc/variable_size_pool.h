@@ -27,6 +27,9 @@ typedef struct Memory_Block {
 
     /* Amount of freed memory. Used in compact_pool */
     size_t freed;
+
+    /* Chosen to be emptied by the running compact_pool */
+    int evacuate;
 } Memory_Block;
 
 typedef struct Variable_Size_Pool {
@@ -38,6 +41,8 @@ typedef struct Variable_Size_Pool {
     size_t possibly_reclaimable;     /* bytes that can possibly be reclaimed
                                       * (above plus COW-freed bytes) */
     FLOATVAL reclaim_factor; /* minimum percentage we will reclaim */
+    size_t compact_limit;    /* most bytes moved by one compaction, 0 for
+                              * no limit */
 } Variable_Size_Pool;
 
 /* HEADERIZER BEGIN: src/gc/variable_size_pool.c */
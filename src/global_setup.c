@@ -116,7 +116,10 @@ Parrot_gbl_set_config_hash_interpreter(PARROT_INTERP)
     PMC * const iglobals = interp->iglobals;
 
     PMC *config_hash = parrot_config_hash_global;
-    if (config_hash == NULL)
+
+    /* A thread can't share the hash of another interpreter; it gets a
+     * copy once it is running, see F<src/thread.c> */
+    if (config_hash == NULL || Interp_flags_TEST(interp, PARROT_IS_THREAD))
         config_hash = Parrot_pmc_new(interp, enum_class_Hash);
     else {
         /* On initialization, we probably set up an empty hash for our first
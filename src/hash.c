@@ -1,5 +1,5 @@
 /*
-Copyright (C) 2001-2011, Parrot Foundation.
+Copyright (C) 2001-2012, Parrot Foundation.
 
 =head1 NAME
 
@@ -7,13 +7,17 @@ src/hash.c - Hash table
 
 =head1 DESCRIPTION
 
-A hashtable contains an array of bucket indexes. Buckets are nodes in a
-linked list, each containing a C<void *> key and value. During hash
+A hashtable contains an array of buckets, each containing a C<void *> key and
+value, and an open addressed index into them. Buckets are handed out in order
+and reused after deletion, so they stay put until the hash grows. Each index
+slot holds a bucket number and the low bits of the key's hash; lookups probe
+the slots linearly and only compare keys whose cached bits match. During hash
 creation, the types of key and value as well as appropriate compare and
 hashing functions can be set.
 
 This hash implementation uses just one piece of malloced memory. The
-C<< hash->buckets >> bucket store points to this region.
+C<< hash->buckets >> bucket store points to this region, followed by the
+index.
 
 =head2 Functions
 
@@ -32,6 +36,36 @@ C<< hash->buckets >> bucket store points to this region.
  * else we use system allocator */
 #define SPLIT_POINT  16
 
+/* The cached hash bits of an index slot, which also pick its place.  Mixing
+ * spreads keys such as aligned pointers, whose low bits are all alike. */
+#define SLOT_HASHVAL(h) \
+    ((Parrot_UInt4)(((UHUGEINTVAL)(h) * 0x9e3779b97f4a7c15ULL) >> 32))
+
+/* SipHash-1-3 building blocks, see Parrot_hash_buffer */
+#define SIP_ROTL(x, b) (UHUGEINTVAL)(((x) << (b)) | ((x) >> (64 - (b))))
+
+#define SIP_ROUND(st) do { \
+    (st)->v0 += (st)->v1; (st)->v1 = SIP_ROTL((st)->v1, 13); (st)->v1 ^= (st)->v0; \
+    (st)->v0 = SIP_ROTL((st)->v0, 32); \
+    (st)->v2 += (st)->v3; (st)->v3 = SIP_ROTL((st)->v3, 16); (st)->v3 ^= (st)->v2; \
+    (st)->v0 += (st)->v3; (st)->v3 = SIP_ROTL((st)->v3, 21); (st)->v3 ^= (st)->v0; \
+    (st)->v2 += (st)->v1; (st)->v1 = SIP_ROTL((st)->v1, 17); (st)->v1 ^= (st)->v2; \
+    (st)->v2 = SIP_ROTL((st)->v2, 32); \
+} while (0)
+
+#define SIP_COMPRESS(st, m) do { \
+    (st)->v3 ^= (m); \
+    SIP_ROUND(st); \
+    (st)->v0 ^= (m); \
+} while (0)
+
+/* little endian load, so that buffers and codepoints pack alike everywhere */
+#define SIP_LOAD64(p) \
+    ((UHUGEINTVAL)(p)[0]         | ((UHUGEINTVAL)(p)[1] << 8)  | \
+    ((UHUGEINTVAL)(p)[2] << 16)  | ((UHUGEINTVAL)(p)[3] << 24) | \
+    ((UHUGEINTVAL)(p)[4] << 32)  | ((UHUGEINTVAL)(p)[5] << 40) | \
+    ((UHUGEINTVAL)(p)[6] << 48)  | ((UHUGEINTVAL)(p)[7] << 56))
+
 /* HEADERIZER HFILE: include/parrot/hash.h */
 
 /* HEADERIZER BEGIN: static */
@@ -44,11 +78,25 @@ static void allocate_buckets(PARROT_INTERP,
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*hash);
 
+static void compact_index(PARROT_INTERP, ARGMOD(Hash *hash))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*hash);
+
 static void expand_hash(PARROT_INTERP, ARGMOD(Hash *hash))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*hash);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static HashSlot * find_slot(PARROT_INTERP,
+    ARGIN(const Hash *hash),
+    ARGIN_NULLOK(void *key),
+    size_t hashval)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_PURE_FUNCTION
 PARROT_INLINE
@@ -84,6 +132,13 @@ static int hash_compare_string_enc(
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void insert_slot(
+    ARGMOD(Hash *hash),
+    Parrot_UInt4 hashval,
+    UINTVAL bucket)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*hash);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_PURE_FUNCTION
 PARROT_INLINE
@@ -136,9 +191,15 @@ static void parrot_mark_hash_values(PARROT_INTERP, ARGIN(Hash *hash))
 #define ASSERT_ARGS_allocate_buckets __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(hash))
+#define ASSERT_ARGS_compact_index __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(hash))
 #define ASSERT_ARGS_expand_hash __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(hash))
+#define ASSERT_ARGS_find_slot __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(hash))
 #define ASSERT_ARGS_hash_compare __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(hash))
@@ -153,6 +214,8 @@ static void parrot_mark_hash_values(PARROT_INTERP, ARGIN(Hash *hash))
 #define ASSERT_ARGS_hash_compare_string_enc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(search_key) \
     , PARROT_ASSERT_ARG(bucket_key))
+#define ASSERT_ARGS_insert_slot __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(hash))
 #define ASSERT_ARGS_key_hash __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(hash))
@@ -183,7 +246,39 @@ static void parrot_mark_hash_values(PARROT_INTERP, ARGIN(Hash *hash))
 =item C<size_t Parrot_hash_buffer(const unsigned char *buf, size_t len, size_t
 hashval)>
 
-Compute the hash of a buffer.
+Compute the hash of a buffer, keyed with the seed C<hashval>.
+
+This is SipHash-1-3, which eats eight bytes per round and makes it hard to
+come up with many keys sharing a hash without knowing the seed.  Strings are
+hashed by their codepoints, so that equal strings in different encodings hash
+the same: for fixed8 strings the buffer is hashed directly, the others feed
+their codepoints to a C<HashState> with the functions below, which gives the
+same result whenever all codepoints fit into a byte.
+
+=item C<void Parrot_hash_state_init(HashState *state, size_t seed)>
+
+Start hashing with the seed C<seed>.
+
+=item C<void Parrot_hash_state_add_bytes(HashState *state, const unsigned char
+*buf, size_t len)>
+
+Add C<len> codepoints, given as bytes in C<buf>, to the hash.
+
+=item C<void Parrot_hash_state_add_ucs4(HashState *state, const Parrot_Int4
+*buf, size_t len)>
+
+Add C<len> codepoints given as 32-bit units in C<buf> to the hash.  Runs of
+eight codepoints below 256 are packed and hashed as one word.
+
+=item C<void Parrot_hash_state_add_codepoint(HashState *state, UINTVAL c)>
+
+Add a single codepoint to the hash.  A codepoint beyond 255 ends the pending
+word, which is compressed with its length and a marker no byte-only input
+produces, and then goes in as a word of its own.
+
+=item C<size_t Parrot_hash_state_finish(HashState *state, size_t len)>
+
+Finish hashing a string of C<len> codepoints and return its hash.
 
 =cut
 
@@ -196,11 +291,117 @@ size_t
 Parrot_hash_buffer(ARGIN_NULLOK(const unsigned char *buf), size_t len, size_t hashval)
 {
     ASSERT_ARGS(Parrot_hash_buffer)
-    while (len--) {
-        hashval += hashval << 5;
-        hashval += *buf++;
+    HashState state;
+
+    Parrot_hash_state_init(&state, hashval);
+    Parrot_hash_state_add_bytes(&state, buf, len);
+    return Parrot_hash_state_finish(&state, len);
+}
+
+void
+Parrot_hash_state_init(ARGOUT(HashState *state), size_t seed)
+{
+    ASSERT_ARGS(Parrot_hash_state_init)
+    const UHUGEINTVAL k0 = (UHUGEINTVAL)seed;
+    const UHUGEINTVAL k1 = SIP_ROTL(k0, 32) ^ 0x9e3779b97f4a7c15ULL;
+
+    state->v0       = k0 ^ 0x736f6d6570736575ULL;
+    state->v1       = k1 ^ 0x646f72616e646f6dULL;
+    state->v2       = k0 ^ 0x6c7967656e657261ULL;
+    state->v3       = k1 ^ 0x7465646279746573ULL;
+    state->tail     = 0;
+    state->tail_len = 0;
+}
+
+PARROT_HOT
+void
+Parrot_hash_state_add_bytes(ARGMOD(HashState *state),
+        ARGIN_NULLOK(const unsigned char *buf), size_t len)
+{
+    ASSERT_ARGS(Parrot_hash_state_add_bytes)
+
+    /* top up a pending word first */
+    while (len && state->tail_len) {
+        Parrot_hash_state_add_codepoint(state, *buf++);
+        --len;
+    }
+
+    while (len >= 8) {
+        const UHUGEINTVAL m = SIP_LOAD64(buf);
+        SIP_COMPRESS(state, m);
+        buf += 8;
+        len -= 8;
+    }
+
+    while (len--)
+        Parrot_hash_state_add_codepoint(state, *buf++);
+}
+
+PARROT_HOT
+void
+Parrot_hash_state_add_ucs4(ARGMOD(HashState *state),
+        ARGIN_NULLOK(const Parrot_Int4 *buf), size_t len)
+{
+    ASSERT_ARGS(Parrot_hash_state_add_ucs4)
+
+    while (len) {
+        if (len >= 8 && !state->tail_len
+        &&  ((Parrot_UInt4)(buf[0] | buf[1] | buf[2] | buf[3]
+                          | buf[4] | buf[5] | buf[6] | buf[7]) < 256)) {
+            const UHUGEINTVAL m =
+                 (UHUGEINTVAL)buf[0]         | ((UHUGEINTVAL)buf[1] << 8)
+              | ((UHUGEINTVAL)buf[2] << 16)  | ((UHUGEINTVAL)buf[3] << 24)
+              | ((UHUGEINTVAL)buf[4] << 32)  | ((UHUGEINTVAL)buf[5] << 40)
+              | ((UHUGEINTVAL)buf[6] << 48)  | ((UHUGEINTVAL)buf[7] << 56);
+            SIP_COMPRESS(state, m);
+            buf += 8;
+            len -= 8;
+        }
+        else {
+            Parrot_hash_state_add_codepoint(state, (Parrot_UInt4)*buf++);
+            --len;
+        }
     }
-    return hashval;
+}
+
+PARROT_HOT
+void
+Parrot_hash_state_add_codepoint(ARGMOD(HashState *state), UINTVAL c)
+{
+    ASSERT_ARGS(Parrot_hash_state_add_codepoint)
+
+    if (c < 256) {
+        state->tail |= (UHUGEINTVAL)c << (8 * state->tail_len);
+        if (++state->tail_len == 8) {
+            SIP_COMPRESS(state, state->tail);
+            state->tail     = 0;
+            state->tail_len = 0;
+        }
+    }
+    else {
+        const UHUGEINTVAL m = state->tail | ((UHUGEINTVAL)state->tail_len << 56);
+        state->v2 ^= 0xee;
+        SIP_COMPRESS(state, m);
+        SIP_COMPRESS(state, (UHUGEINTVAL)c);
+        state->tail     = 0;
+        state->tail_len = 0;
+    }
+}
+
+PARROT_WARN_UNUSED_RESULT
+size_t
+Parrot_hash_state_finish(ARGMOD(HashState *state), size_t len)
+{
+    ASSERT_ARGS(Parrot_hash_state_finish)
+    const UHUGEINTVAL m = state->tail | ((UHUGEINTVAL)(len & 0xff) << 56);
+
+    SIP_COMPRESS(state, m);
+    state->v2 ^= 0xff;
+    SIP_ROUND(state);
+    SIP_ROUND(state);
+    SIP_ROUND(state);
+
+    return (size_t)(state->v0 ^ state->v1 ^ state->v2 ^ state->v3);
 }
 
 /*
@@ -778,7 +979,7 @@ allocate_buckets(PARROT_INTERP, ARGMOD(Hash *hash), UINTVAL size)
     ASSERT_ARGS(allocate_buckets)
 
     UINTVAL new_size = INITIAL_SIZE;
-    HashBucket *new_buckets, *bucket;
+    HashBucket *new_buckets;
     size_t i;
 
     while (size > new_size)
@@ -795,16 +996,15 @@ allocate_buckets(PARROT_INTERP, ARGMOD(Hash *hash), UINTVAL size)
 
     hash->mask      = new_size - 1;
     hash->buckets   = new_buckets;
-    hash->index     = (HashBucket **)(new_buckets + N_BUCKETS(new_size));
+    hash->index     = (HashSlot *)(new_buckets + N_BUCKETS(new_size));
+    hash->deleted   = 0;
 
     /* add new buckets to free_list
      * lowest bucket is top on free list and will be used first */
+    for (i = 0; i < N_BUCKETS(new_size) - 1; ++i)
+        new_buckets[i].value = new_buckets + i + 1;
 
-    bucket = hash->buckets + N_BUCKETS(new_size) - 1;
-    for (i = 0; i < N_BUCKETS(new_size); ++i, --bucket) {
-        bucket->next    = hash->free_list;
-        hash->free_list = bucket;
-    }
+    hash->free_list = new_buckets;
 }
 
 /*
@@ -813,26 +1013,14 @@ allocate_buckets(PARROT_INTERP, ARGMOD(Hash *hash), UINTVAL size)
 
 Expands a hash when necessary.
 
-For a hashtable of size N, we use C<MAXFULL_PERCENT> % of N as the
-number of buckets. This way, as soon as we run out of buckets on the
-free list, we know that it's time to resize the hashtable.
-
-Algorithm for expansion: We exactly double the size of the hashtable.
-Keys are assigned to buckets with the formula
-
-    bucket_index = hash(key) % Parrot_hash_size
+The index has twice as many slots as there are buckets, so as soon as we run
+out of buckets on the free list, we know that it's time to resize the
+hashtable.  At that point at most half of the index slots refer to buckets.
 
-When doubling the size of the hashtable, we know that every key is either
-already in the correct bucket, or belongs in the current bucket plus
-C<Parrot_hash_size> (the old C<Parrot_hash_size>). In fact, because the
-hashtable is always a power of two in size, it depends only on the next bit
-in the hash value, after the ones previously used.
-
-We scan through all the buckets in order, moving the buckets that need to be
-moved. No bucket will be scanned twice, and the cache should be reasonably
-happy because the hashtable accesses will be two parallel sequential scans.
-(Of course, this also mucks with the C<< ->next >> pointers, and they'll be
-all over memory.)
+Algorithm for expansion: We exactly double the size of the hashtable.  The
+buckets are copied as they are, so their order doesn't change, and the new
+index is filled from the old one.  The index slots cache enough of each
+key's hash to find their new places, so no key is hashed or compared again.
 
 =cut
 
@@ -842,26 +1030,21 @@ static void
 expand_hash(PARROT_INTERP, ARGMOD(Hash *hash))
 {
     ASSERT_ARGS(expand_hash)
-    HashBucket  **new_index,  **index;
-    HashBucket   *new_buckets, *bucket;
+    HashBucket   *new_buckets;
 
     void *        new_mem;
     void * const  old_mem    = hash->buckets;
+    HashSlot * const old_index = hash->index;
     const UINTVAL old_size   = hash->mask + 1;
     const UINTVAL new_size   = old_size  << 1; /* Double. Right-shift is 2x */
-    const UINTVAL new_mask   = new_size   - 1;
     size_t        i;
-    ptrdiff_t     offset;
 
     /*
-       allocate some less buckets
-       e.g. 3 buckets, 4 pointers:
-
-         +---+---+---+-+-+-+-+
-         | --> buckets |     |
-         +---+---+---+-+-+-+-+
-         ^             ^
-         | old_mem     | hash->index
+         +---+---+---+-+-+-+-+-+-+
+         |  buckets  |   index   |
+         +---+---+---+-+-+-+-+-+-+
+         ^           ^
+         | new_mem   | hash->index
     */
 
     /* resize mem */
@@ -872,15 +1055,23 @@ expand_hash(PARROT_INTERP, ARGMOD(Hash *hash))
         new_mem  = Parrot_gc_allocate_fixed_size_storage(
                         interp, HASH_ALLOC_SIZE(new_size));
 
-    offset = (char *)new_mem - (char *)old_mem;
-
-    new_buckets = (HashBucket *)  new_mem;
-    new_index   = (HashBucket **)(new_buckets + N_BUCKETS(new_size));
+    new_buckets = (HashBucket *)new_mem;
 
-    /* copy buckets and index */
+    /* copy buckets, clear the rest */
     memcpy(new_buckets, hash->buckets,
             N_BUCKETS(old_size) * sizeof (HashBucket));
-    memcpy(new_index, hash->index, old_size * sizeof (HashBucket *));
+    memset(new_buckets + N_BUCKETS(old_size), 0,
+            HASH_ALLOC_SIZE(new_size) - N_BUCKETS(old_size) * sizeof (HashBucket));
+
+    /* update hash data */
+    hash->index     = (HashSlot *)(new_buckets + N_BUCKETS(new_size));
+    hash->buckets   = new_buckets;
+    hash->mask      = new_size - 1;
+    hash->deleted   = 0;
+
+    for (i = 0; i < N_SLOTS(old_size); ++i)
+        if (HASH_SLOT_USED(old_index[i]))
+            insert_slot(hash, old_index[i].hashval, old_index[i].bucket);
 
     /* free */
     if (old_size > SPLIT_POINT)
@@ -888,72 +1079,107 @@ expand_hash(PARROT_INTERP, ARGMOD(Hash *hash))
     else
         Parrot_gc_free_fixed_size_storage(interp, HASH_ALLOC_SIZE(old_size), old_mem);
 
+    /* add new buckets to free_list
+     * lowest bucket is top on free list and will be used first */
+    for (i = N_BUCKETS(old_size); i < N_BUCKETS(new_size) - 1; ++i)
+        new_buckets[i].value = new_buckets + i + 1;
 
-    /* clear second half of the buckets, freed by old the index */
-    memset(new_buckets + N_BUCKETS(old_size), 0,
-            sizeof (HashBucket) * old_size);
+    hash->free_list = new_buckets + N_BUCKETS(old_size);
+}
 
-    /* clear second half of the index */
-    memset(new_index + (old_size), 0, sizeof (HashBucket *) * old_size);
+/*
 
+=item C<static void insert_slot(Hash *hash, Parrot_UInt4 hashval, UINTVAL
+bucket)>
 
+Enters bucket number C<bucket>, counting from 1, into the index of C<hash> at
+the first unused slot from where C<hashval>, the slot form of its key's hash,
+puts it.  The key must not be in the index yet.
 
-    /*
-         +---+---+---+---+---+---+-+-+-+-+-+-+-+-+
-         |  buckets  | old_index |  new_index    |
-         +---+---+---+---+---+---+-+-+-+-+-+-+-+-+
-         ^                       ^
-         | new_mem               | hash->index
-    */
+=cut
 
-    /* update hash data */
-    hash->index     = new_index;
-    hash->buckets   = new_buckets;
-    hash->mask      = new_mask;
+*/
 
-    /* reloc pointers and recalc bucket indices */
-    for (i = 0; i < old_size; ++i) {
-        index = new_index + i;
+static void
+insert_slot(ARGMOD(Hash *hash), Parrot_UInt4 hashval, UINTVAL bucket)
+{
+    ASSERT_ARGS(insert_slot)
+    const UINTVAL slot_mask = N_SLOTS(hash->mask + 1) - 1;
+    UINTVAL       i         = hashval & slot_mask;
 
-        while (*index != NULL) {
-            size_t new_loc;
-            size_t hashval;
+    while (HASH_SLOT_USED(hash->index[i]))
+        i = (i + 1) & slot_mask;
 
-            bucket = (HashBucket *)((char *)*index + offset);
+    if (hash->index[i].bucket == HASH_SLOT_DELETED)
+        --hash->deleted;
 
-            /* rehash the bucket */
-            if (hash->key_type == Hash_key_type_STRING
-            ||  hash->key_type == Hash_key_type_STRING_enc) {
-                STRING *s = (STRING *)bucket->key;
-                hashval   = s->hashval;
-            }
-            else {
-                hashval = key_hash(interp, hash, bucket->key);
-            }
+    hash->index[i].hashval = hashval;
+    hash->index[i].bucket  = (Parrot_UInt4)bucket;
+}
 
-            new_loc = hashval & new_mask;
+/*
 
-            if (i != new_loc) {
-                *index              = bucket->next;
-                bucket->next        = new_index[new_loc];
-                new_index[new_loc]  = bucket;
-            }
-            else {
-                *index = bucket;
-                index  = &bucket->next;
-            }
-        }
-    }
+=item C<static void compact_index(PARROT_INTERP, Hash *hash)>
 
-    /* add new buckets to free_list
-     * lowest bucket is top on free list and will be used first */
-    bucket = new_buckets + N_BUCKETS(old_size);
-    for (i = N_BUCKETS(old_size)-1 ; i > 0; --i, ++bucket) {
-        bucket->next = bucket + 1;
-    }
+Rebuilds the index of C<hash> without the slots left behind by deleted keys,
+which would otherwise make probing ever longer.
 
-    bucket->next = NULL;
-    hash->free_list = new_buckets + N_BUCKETS(old_size);
+=cut
+
+*/
+
+static void
+compact_index(PARROT_INTERP, ARGMOD(Hash *hash))
+{
+    ASSERT_ARGS(compact_index)
+    const UINTVAL    n_slots = N_SLOTS(hash->mask + 1);
+    HashSlot * const old     = mem_gc_allocate_n_typed(interp, n_slots, HashSlot);
+    UINTVAL          i;
+
+    memcpy(old, hash->index, n_slots * sizeof (HashSlot));
+    memset(hash->index, 0, n_slots * sizeof (HashSlot));
+    hash->deleted = 0;
+
+    for (i = 0; i < n_slots; ++i)
+        if (HASH_SLOT_USED(old[i]))
+            insert_slot(hash, old[i].hashval, old[i].bucket);
+
+    mem_gc_free(interp, old);
+}
+
+/*
+
+=item C<static HashSlot * find_slot(PARROT_INTERP, const Hash *hash, void *key,
+size_t hashval)>
+
+Returns the index slot of C<key>, whose hash is C<hashval>, or NULL if the
+key is not in C<hash>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static HashSlot *
+find_slot(PARROT_INTERP, ARGIN(const Hash *hash), ARGIN_NULLOK(void *key),
+        size_t hashval)
+{
+    ASSERT_ARGS(find_slot)
+    const Parrot_UInt4 slot_hashval = SLOT_HASHVAL(hashval);
+    const UINTVAL      slot_mask    = N_SLOTS(hash->mask + 1) - 1;
+    UINTVAL            i            = slot_hashval & slot_mask;
+
+    for (;; i = (i + 1) & slot_mask) {
+        HashSlot * const slot = hash->index + i;
+
+        if (slot->bucket == HASH_SLOT_EMPTY)
+            return NULL;
+
+        if (slot->hashval == slot_hashval && slot->bucket != HASH_SLOT_DELETED
+        &&  hash_compare(interp, hash, key, hash->buckets[slot->bucket - 1].key) == 0)
+            return slot;
+    }
 }
 
 
@@ -1074,6 +1300,7 @@ Parrot_hash_create(PARROT_INTERP, PARROT_DATA_TYPE val_type, Hash_key_type hkey_
     hash->seed       = interp->hash_seed;
     hash->mask       = 0;
     hash->entries    = 0;
+    hash->deleted    = 0;
     hash->index      = NULL;
     hash->buckets    = NULL;
     hash->free_list  = NULL;
@@ -1095,6 +1322,7 @@ Preallocates at least C<size> buckets.
 
 */
 
+PARROT_EXPORT
 PARROT_CANNOT_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
 Hash *
@@ -1209,6 +1437,36 @@ Parrot_hash_size(SHIM_INTERP, ARGIN(const Hash *hash))
 }
 
 
+/*
+
+=item C<HashBucket * Parrot_hash_null_key_bucket(PARROT_INTERP, const Hash
+*hash)>
+
+Returns the bucket holding the NULL key, if any, and NULL otherwise.  Integer
+and pointer keys may be 0, so for those key types a bucket without a key is
+not necessarily free; iterators use this to tell the two apart while walking
+the buckets in order.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+HashBucket *
+Parrot_hash_null_key_bucket(PARROT_INTERP, ARGIN(const Hash *hash))
+{
+    ASSERT_ARGS(Parrot_hash_null_key_bucket)
+
+    if (hash->key_type != Hash_key_type_int
+    &&  hash->key_type != Hash_key_type_ptr)
+        return NULL;
+
+    return Parrot_hash_get_bucket(interp, hash, NULL);
+}
+
+
 /*
 
 =item C<HashBucket * Parrot_hash_get_bucket(PARROT_INTERP, const Hash *hash,
@@ -1242,17 +1500,10 @@ Parrot_hash_get_bucket(PARROT_INTERP, ARGIN(const Hash *hash), ARGIN_NULLOK(cons
         /* The const casts are needed for PMC keys */
         const size_t hashval = key_hash(interp, hash,
                                     PARROT_const_cast(void *, key));
-        HashBucket  *bucket  = hash->index[hashval & hash->mask];
+        const HashSlot * const slot = find_slot(interp, hash,
+                                    PARROT_const_cast(void *, key), hashval);
 
-        while (bucket) {
-            if (hash_compare(interp, hash,
-                    PARROT_const_cast(void *, key),
-                    bucket->key) == 0)
-                break;
-            bucket = bucket->next;
-        }
-
-        return bucket;
+        return slot ? hash->buckets + slot->bucket - 1 : NULL;
     }
 }
 
@@ -1334,28 +1585,38 @@ parrot_hash_get_bucket_string(PARROT_INTERP, ARGIN(const Hash *hash),
         ARGIN(const STRING *s), UINTVAL hashval)
 {
     ASSERT_ARGS(parrot_hash_get_bucket_string)
-    HashBucket *bucket = hash->index[hashval & hash->mask];
+    const Parrot_UInt4 slot_hashval = SLOT_HASHVAL(hashval);
+    const UINTVAL      slot_mask    = N_SLOTS(hash->mask + 1) - 1;
+    UINTVAL            i            = slot_hashval & slot_mask;
+
+    for (;; i = (i + 1) & slot_mask) {
+        const HashSlot slot = hash->index[i];
+        HashBucket    *bucket;
+        const STRING  *s2;
+
+        if (slot.bucket == HASH_SLOT_EMPTY)
+            return NULL;
 
-    while (bucket) {
-        const STRING *s2 = (const STRING *)bucket->key;
+        if (slot.hashval != slot_hashval || slot.bucket == HASH_SLOT_DELETED)
+            continue;
+
+        bucket = hash->buckets + slot.bucket - 1;
+        s2     = (const STRING *)bucket->key;
         if (s == s2)
-            break;
+            return bucket;
 
         /* manually inline part of string_equal  */
         if (hashval == s2->hashval) {
             if (s->encoding == s2->encoding) {
                 if ((STRING_byte_length(s) == STRING_byte_length(s2))
                 && (memcmp(s->strstart, s2->strstart, STRING_byte_length(s)) == 0))
-                    break;
+                    return bucket;
             }
             else if (STRING_equal(interp, s, s2)) {
-                break;
+                return bucket;
             }
         }
-        bucket = bucket->next;
     }
-
-    return bucket;
 }
 
 
@@ -1387,19 +1648,21 @@ parrot_hash_store_value_in_bucket(PARROT_INTERP, ARGMOD(Hash *hash),
         bucket->value = value;
     else {
         /* Get a new bucket off the free list. If the free list is empty, we
-           expand the hash so we get more items on the free list */
+           expand the hash so we get more items on the free list. Keep a
+           quarter of the index unused, so that probing always ends. */
         if (!hash->free_list)
             expand_hash(interp, hash);
+        else if (hash->entries + hash->deleted >= N_SLOTS(hash->mask + 1) / 4 * 3)
+            compact_index(interp, hash);
 
         bucket = hash->free_list;
 
         /* Add the value to the new bucket, increasing the count of elements */
         ++hash->entries;
-        hash->free_list                   = bucket->next;
-        bucket->key                       = key;
-        bucket->value                     = value;
-        bucket->next                      = hash->index[hashval & hash->mask];
-        hash->index[hashval & hash->mask] = bucket;
+        hash->free_list = (HashBucket *)bucket->value;
+        bucket->key     = key;
+        bucket->value   = value;
+        insert_slot(hash, SLOT_HASHVAL(hashval), bucket - hash->buckets + 1);
     }
 }
 
@@ -1437,14 +1700,12 @@ Parrot_hash_put(PARROT_INTERP, ARGMOD(Hash *hash),
             bucket  = parrot_hash_get_bucket_string(interp, hash, s, hashval);
         }
         else {
-            hashval = key_hash(interp, hash, key);
-            bucket  = hash->index[hashval & hash->mask];
+            const HashSlot *slot;
 
-            while (bucket) {
-                if (hash_compare(interp, hash, key, bucket->key) == 0)
-                    break;
-                bucket = bucket->next;
-            }
+            hashval = key_hash(interp, hash, key);
+            slot    = find_slot(interp, hash, key, hashval);
+            if (slot)
+                bucket = hash->buckets + slot->bucket - 1;
         }
     }
 
@@ -1470,19 +1731,18 @@ void
 Parrot_hash_delete(PARROT_INTERP, ARGMOD(Hash *hash), ARGIN_NULLOK(void *key))
 {
     ASSERT_ARGS(Parrot_hash_delete)
-    const UINTVAL hashval = key_hash(interp, hash, key) & hash->mask;
-    if (hash->buckets){
-        HashBucket   **prev   = &hash->index[hashval];
-        for (; *prev; prev = &(*prev)->next) {
-            HashBucket * const current = *prev;
-            if (hash_compare(interp, hash, key, current->key) == 0) {
-                *prev = current->next;
-                --hash->entries;
-                current->next    = hash->free_list;
-                current->key     = NULL;
-                hash->free_list = current;
-                return;
-            }
+    if (hash->buckets) {
+        HashSlot * const slot = find_slot(interp, hash, key,
+                                    key_hash(interp, hash, key));
+        if (slot) {
+            HashBucket * const bucket = hash->buckets + slot->bucket - 1;
+
+            slot->bucket    = HASH_SLOT_DELETED;
+            ++hash->deleted;
+            --hash->entries;
+            bucket->key     = NULL;
+            bucket->value   = hash->free_list;
+            hash->free_list = bucket;
         }
     }
 }
@@ -1,5 +1,5 @@
 /*
-Copyright (C) 2001-2010, Parrot Foundation.
+Copyright (C) 2001-2012, Parrot Foundation.
 
 =head1 NAME
 
@@ -187,9 +187,12 @@ Parrot_interp_allocate_interpreter(ARGIN_NULLOK(Interp *parent), INTVAL flags)
     interp = mem_internal_allocate_zeroed_typed(Interp);
 
     /* the last interpreter (w/o) parent has to cleanup globals
-     * so remember parent if any */
+     * so remember parent if any; threads share the globals of the
+     * interpreter which started them */
     if (parent)
         interp->parent_interpreter = parent;
+    else if (flags & PARROT_IS_THREAD)
+        interp->parent_interpreter = NULL;
     else {
         interp->parent_interpreter = NULL;
         if (!emergency_interp)
@@ -252,8 +255,10 @@ Parrot_interp_initialize_interpreter(PARROT_INTERP, ARGIN(Parrot_GC_Init_Args *a
     interp->piodata = NULL;
     Parrot_io_init(interp);
 
-    /* use the system time as the prng seed */
-    Parrot_util_srand(Parrot_get_entropy(interp));
+    /* use the system time as the prng seed; the generator is shared by
+     * all threads and seeded once */
+    if (!Interp_flags_TEST(interp, PARROT_IS_THREAD))
+        Parrot_util_srand(Parrot_get_entropy(interp));
 
     /*
      * Set up the string subsystem
@@ -380,6 +385,9 @@ Parrot_interp_destroy(PARROT_INTERP)
 Waits for any threads to complete, then frees all allocated memory, and
 closes any open file handles, etc.
 
+A thread's interpreter (see F<src/thread.c>) is destroyed completely, but
+leaves alone what it shares with the other interpreters of the process.
+
 =cut
 
 */
@@ -388,9 +396,10 @@ void
 Parrot_interp_really_destroy(PARROT_INTERP, int exit_code, SHIM(void *arg))
 {
     ASSERT_ARGS(Parrot_interp_really_destroy)
+    const int is_thread = Interp_flags_TEST(interp, PARROT_IS_THREAD);
 
     /* wait for threads to complete if needed; terminate the event loop */
-    if (!interp->parent_interpreter) {
+    if (!interp->parent_interpreter && !is_thread) {
         Parrot_cx_runloop_end(interp);
 
         /* Don't bother trying to provide a pir backtrace on assertion failures
@@ -423,6 +432,13 @@ Parrot_interp_really_destroy(PARROT_INTERP, int exit_code, SHIM(void *arg))
      *      many constant PMCs we'll create
      */
 
+    /* A thread has all of its objects to itself. Destroy them while the
+     * I/O system their destroy functions use is still there */
+    if (is_thread) {
+        Parrot_io_flush(interp, Parrot_io_STDOUT(interp));
+        Parrot_gc_mark_and_sweep(interp, GC_finish_FLAG);
+    }
+
     /* Now the PIOData gets also cleared */
     Parrot_io_finish(interp);
 
@@ -443,7 +459,7 @@ Parrot_interp_really_destroy(PARROT_INTERP, int exit_code, SHIM(void *arg))
     /* we destroy all child interpreters and the last one too,
      * if the --leak-test commandline was given, and there is no
      * pending exception. */
-    if (! (interp->parent_interpreter)
+    if ((!interp->parent_interpreter && !is_thread)
         || (Interp_flags_TEST(interp, PARROT_DESTROY_FLAG)
             && !PMC_IS_NULL(interp->final_exception)))
         return;
@@ -451,7 +467,8 @@ Parrot_interp_really_destroy(PARROT_INTERP, int exit_code, SHIM(void *arg))
     if (interp->parent_interpreter)
         Parrot_gc_destroy_child_interp(interp->parent_interpreter, interp);
 
-    Parrot_gc_mark_and_sweep(interp, GC_finish_FLAG);
+    if (!is_thread)
+        Parrot_gc_mark_and_sweep(interp, GC_finish_FLAG);
 
     destroy_runloop_jump_points(interp);
 
@@ -467,7 +484,8 @@ Parrot_interp_really_destroy(PARROT_INTERP, int exit_code, SHIM(void *arg))
     /* strings, encodings - only once */
     Parrot_str_finish(interp);
 
-    PARROT_CORE_OPLIB_INIT(interp, 0);
+    if (!is_thread)
+        PARROT_CORE_OPLIB_INIT(interp, 0);
 
     if (!interp->parent_interpreter) {
         /* get rid of ops */
@@ -479,6 +497,7 @@ Parrot_interp_really_destroy(PARROT_INTERP, int exit_code, SHIM(void *arg))
 
         /* Finalize GC */
         Parrot_gc_finalize(interp);
+        Parrot_pf_unmap_retired_images(interp);
 
         mem_internal_free(interp);
     }
@@ -488,6 +507,7 @@ Parrot_interp_really_destroy(PARROT_INTERP, int exit_code, SHIM(void *arg))
 
         /* Finalize GC */
         Parrot_gc_finalize(interp);
+        Parrot_pf_unmap_retired_images(interp);
         mem_internal_free(interp);
     }
 }
@@ -818,6 +838,15 @@ Parrot_interp_info(PARROT_INTERP, INTVAL what)
       case CURRENT_RUNCORE:
         ret = interp->run_core->id;
         break;
+      case GC_PAUSE_P50:
+        ret = (INTVAL)(Parrot_gc_pause_percentile(interp, 50.0) * 1000000.0);
+        break;
+      case GC_PAUSE_P99:
+        ret = (INTVAL)(Parrot_gc_pause_percentile(interp, 99.0) * 1000000.0);
+        break;
+      case GC_PAUSE_MAX:
+        ret = (INTVAL)(Parrot_gc_pause_percentile(interp, 100.0) * 1000000.0);
+        break;
         /*
          * sysinfo attributes go here.
          * We may deprecate sysinfo dynop in favour of interpinfo in future,
@@ -1251,6 +1280,9 @@ Parrot_interp_set_run_core(PARROT_INTERP, Parrot_Run_core_t core)
       case PARROT_FAST_CORE:
         Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "fast"));
         break;
+      case PARROT_CGOTO_CORE:
+        Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "cgoto"));
+        break;
       case PARROT_EXEC_CORE:
         Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "exec"));
         break;
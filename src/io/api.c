@@ -35,6 +35,23 @@ PIOOFF_T piooffsetzero;
 
 /* HEADERIZER HFILE: include/parrot/io.h */
 /* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_CANNOT_RETURN_NULL
+static PMC * io_socket_connect_address(PARROT_INTERP,
+    ARGMOD(PMC *pmc),
+    ARGMOD(PMC *address))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*pmc)
+        FUNC_MODIFIES(*address);
+
+#define ASSERT_ARGS_io_socket_connect_address __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc) \
+    , PARROT_ASSERT_ARG(address))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
 /*
@@ -198,7 +215,10 @@ Parrot_io_finish(PARROT_INTERP)
     /*
      * TODO free IO of std-handles
      */
-    Parrot_io_flush(interp, _PIO_STDOUT(interp));
+
+    /* A thread flushed it before its objects were destroyed */
+    if (!Interp_flags_TEST(interp, PARROT_IS_THREAD))
+        Parrot_io_flush(interp, _PIO_STDOUT(interp));
     mem_gc_free(interp, interp->piodata->table);
     interp->piodata->table = NULL;
     mem_gc_free(interp, interp->piodata);
@@ -565,6 +585,11 @@ Parrot_io_close(PARROT_INTERP, ARGMOD(PMC *handle), INTVAL autoflush)
             autoflush == (vtable->flags & PIO_VF_FLUSH_ON_CLOSE) ? 1 : 0;
         if (autoflush == 1)
             vtable->flush(interp, handle);
+
+        /* Tasks waiting for the handle would wait for ever */
+        if (!(vtable->flags & PIO_VF_AWAYS_READABLE))
+            Parrot_cx_io_closed(interp, vtable->get_piohandle(interp, handle));
+
         return vtable->close(interp, handle);
     }
 }
@@ -1710,6 +1735,50 @@ Parrot_io_poll(PARROT_INTERP, ARGMOD(PMC *pmc), INTVAL which, INTVAL sec, INTVAL
 
 /*
 
+=item C<INTVAL Parrot_io_wait_readable(PARROT_INTERP, PMC *handle, STRING
+*method)>
+
+Called by the method C<method> of C<handle> before it reads. Unless input is
+buffered already, suspends the current task until C<handle> is readable if
+the scheduler has other work to do meanwhile, see C<Parrot_cx_wait_for_io>.
+Returns 1 if the task was suspended: the method must then return at once,
+without results, and will be called again. Returns 0 if the method should
+go ahead and read.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+INTVAL
+Parrot_io_wait_readable(PARROT_INTERP, ARGMOD(PMC *handle), ARGIN(STRING *method))
+{
+    ASSERT_ARGS(Parrot_io_wait_readable)
+    const IO_VTABLE *vtable;
+    const IO_BUFFER *read_buffer;
+    PIOHANDLE        os_handle;
+
+    if (Parrot_io_is_closed(interp, handle))
+        return 0;
+
+    /* Like StringHandles, which have no os handle */
+    vtable = IO_GET_VTABLE(interp, handle);
+    if (vtable->flags & PIO_VF_AWAYS_READABLE)
+        return 0;
+
+    read_buffer = IO_GET_READ_BUFFER(interp, handle);
+    if (read_buffer && BUFFER_USED_SIZE(read_buffer) > 0)
+        return 0;
+
+    os_handle = Parrot_io_get_os_handle(interp, handle);
+    if (os_handle == PIO_INVALID_HANDLE)
+        return 0;
+
+    return Parrot_cx_wait_for_io(interp, handle, os_handle, method, PIO_POLL_READ);
+}
+
+/*
+
 =item C<void Parrot_io_socket_connect(PARROT_INTERP, PMC *pmc, PMC *address)>
 
 Connects Socket C<pmc> to the given C<address>. Notice that this operation is
@@ -1726,6 +1795,83 @@ Parrot_io_socket_connect(PARROT_INTERP, ARGMOD(PMC *pmc), ARGMOD(PMC *address))
 {
     ASSERT_ARGS(Parrot_io_socket_connect)
     Parrot_Socket_attributes * const io = PARROT_SOCKET(pmc);
+    PMC * const sa = io_socket_connect_address(interp, pmc, address);
+
+    Parrot_io_internal_connect(interp, io->os_handle,
+            VTABLE_get_pointer(interp, sa), VTABLE_get_integer(interp, sa));
+}
+
+/*
+
+=item C<INTVAL Parrot_io_socket_connect_start(PARROT_INTERP, PMC *pmc, PMC
+*address)>
+
+Starts connecting Socket C<pmc> to the given C<address> like
+C<Parrot_io_socket_connect>, but does not wait for the connection. Returns 1
+if it is in progress, in which case C<Parrot_io_socket_connect_finish> must
+be called once the socket is writable, or 0 if it is connected already.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+INTVAL
+Parrot_io_socket_connect_start(PARROT_INTERP, ARGMOD(PMC *pmc), ARGMOD(PMC *address))
+{
+    ASSERT_ARGS(Parrot_io_socket_connect_start)
+    Parrot_Socket_attributes * const io = PARROT_SOCKET(pmc);
+    PMC * const sa = io_socket_connect_address(interp, pmc, address);
+
+    return Parrot_io_internal_connect_start(interp, io->os_handle,
+            VTABLE_get_pointer(interp, sa), VTABLE_get_integer(interp, sa));
+}
+
+/*
+
+=item C<void Parrot_io_socket_connect_finish(PARROT_INTERP, PMC *pmc)>
+
+Waits until the connection started by C<Parrot_io_socket_connect_start> is
+made. Throws an exception if it failed.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_io_socket_connect_finish(PARROT_INTERP, ARGMOD(PMC *pmc))
+{
+    ASSERT_ARGS(Parrot_io_socket_connect_finish)
+    Parrot_Socket_attributes * const io = PARROT_SOCKET(pmc);
+
+    if (Parrot_io_is_closed(interp, pmc))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+                "Can't connect closed socket");
+
+    Parrot_io_internal_connect_finish(interp, io->os_handle);
+}
+
+/*
+
+=item C<static PMC * io_socket_connect_address(PARROT_INTERP, PMC *pmc, PMC
+*address)>
+
+Checks that Socket C<pmc> can connect to C<address>, and returns the
+Sockaddr to connect to: C<address> itself, or the first one in the array
+C<address> which suits the socket. Remembers it as the remote address of
+C<pmc>.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+io_socket_connect_address(PARROT_INTERP, ARGMOD(PMC *pmc), ARGMOD(PMC *address))
+{
+    ASSERT_ARGS(io_socket_connect_address)
+    Parrot_Socket_attributes * const io = PARROT_SOCKET(pmc);
     int i;
 
     /* TODO: Move most of this logic to src/io/socket.c */
@@ -1743,18 +1889,15 @@ Parrot_io_socket_connect(PARROT_INTERP, ARGMOD(PMC *pmc), ARGMOD(PMC *address))
 
         for (i = 0; i < len; ++i) {
             PMC *sa = VTABLE_get_pmc_keyed_int(interp, address, i);
-            Parrot_Sockaddr_attributes * const sa_data = PARROT_SOCKADDR(sa);
 
             if (!Parrot_io_internal_addr_match(interp, sa, io->family, io->type,
                     io->protocol))
                 continue;
 
             io->remote = sa;
+            PARROT_GC_WRITE_BARRIER(interp, pmc);
 
-            Parrot_io_internal_connect(interp, io->os_handle, sa_data->pointer,
-                    sa_data->len);
-
-            return;
+            return sa;
         }
 
         Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
@@ -1763,10 +1906,9 @@ Parrot_io_socket_connect(PARROT_INTERP, ARGMOD(PMC *pmc), ARGMOD(PMC *address))
     }
 
     io->remote = address;
+    PARROT_GC_WRITE_BARRIER(interp, pmc);
 
-    Parrot_io_internal_connect(interp, io->os_handle,
-            VTABLE_get_pointer(interp, address),
-            VTABLE_get_integer(interp, address));
+    return address;
 }
 
 /*
@@ -243,6 +243,7 @@ io_socket_setup_vtable(PARROT_INTERP, ARGMOD_NULLOK(IO_VTABLE *vtable), INTVAL i
     vtable->set_flags = io_socket_set_flags;
     vtable->get_flags = io_socket_get_flags;
     vtable->total_size = io_socket_total_size;
+    vtable->get_piohandle = io_socket_get_piohandle;
 }
 
 /*
@@ -554,7 +555,7 @@ static PIOHANDLE
 io_socket_get_piohandle(PARROT_INTERP, ARGIN(PMC *handle))
 {
     ASSERT_ARGS(io_socket_get_piohandle)
-    PIOHANDLE os_handle;
+    PIOHANDLE os_handle = PIO_INVALID_HANDLE;
     GETATTR_Socket_os_handle(interp, handle, os_handle);
     return os_handle;
 }
@@ -48,6 +48,14 @@ static INTVAL fail_if_type_exists(PARROT_INTERP, ARGIN(PMC *name))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_CANNOT_RETURN_NULL
+static Meth_inline_cache * get_method_inline_cache(PARROT_INTERP,
+    ARGMOD(PackFile_ByteCode *code),
+    size_t offset)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*code);
+
 PARROT_INLINE
 PARROT_CANNOT_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
@@ -70,6 +78,9 @@ static void invalidate_type_caches(PARROT_INTERP, UINTVAL type)
 #define ASSERT_ARGS_fail_if_type_exists __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(name))
+#define ASSERT_ARGS_get_method_inline_cache __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(code))
 #define ASSERT_ARGS_get_pmc_proxy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_invalidate_all_caches __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -771,6 +782,47 @@ mark_object_cache(PARROT_INTERP)
 }
 
 
+/*
+
+=item C<void mark_method_inline_caches(PARROT_INTERP, const PackFile_ByteCode
+*code)>
+
+Marks the names, receiver classes and methods held by the inline caches of
+the callmethod ops in C<code>.  The classes have to stay alive, as a new class
+at the same address would otherwise hit the cache.
+
+=cut
+
+*/
+
+void
+mark_method_inline_caches(PARROT_INTERP, ARGIN(const PackFile_ByteCode *code))
+{
+    ASSERT_ARGS(mark_method_inline_caches)
+    size_t i;
+
+    if (!code->method_caches)
+        return;
+
+    for (i = 0; i < code->method_caches_size; ++i) {
+        const Meth_inline_cache * const ic = code->method_caches[i];
+        int way;
+
+        if (!ic)
+            continue;
+
+        Parrot_gc_mark_STRING_alive(interp, ic->name);
+
+        for (way = 0; way < METH_IC_WAYS; ++way) {
+            if (ic->_class[way])
+                Parrot_gc_mark_PMC_alive(interp, ic->_class[way]);
+            if (ic->pmc[way])
+                Parrot_gc_mark_PMC_alive(interp, ic->pmc[way]);
+        }
+    }
+}
+
+
 /*
 
 =item C<void init_object_cache(PARROT_INTERP)>
@@ -897,6 +949,8 @@ Parrot_invalidate_method_cache(PARROT_INTERP, ARGIN_NULLOK(STRING *_class))
     ASSERT_ARGS(Parrot_invalidate_method_cache)
     INTVAL type;
 
+    Parrot_invalidate_method_inline_caches(interp);
+
     /* during interp creation and NCI registration the class_hash
      * isn't yet up */
     if (!interp->class_hash)
@@ -918,6 +972,28 @@ Parrot_invalidate_method_cache(PARROT_INTERP, ARGIN_NULLOK(STRING *_class))
         invalidate_type_caches(interp, (UINTVAL)type);
 }
 
+
+/*
+
+=item C<void Parrot_invalidate_method_inline_caches(PARROT_INTERP)>
+
+Invalidates the inline caches of all callmethod ops.  Call this whenever
+the methods of a class or its MRO may have changed.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_invalidate_method_inline_caches(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_invalidate_method_inline_caches)
+
+    if (interp->caches)
+        ++interp->caches->epoch;
+}
+
 /*
 
 =item C<PMC * Parrot_find_method_direct(PARROT_INTERP, PMC *_class, STRING
@@ -1051,6 +1127,134 @@ Parrot_find_method_with_cache(PARROT_INTERP, ARGIN(PMC *_class), ARGIN(STRING *m
 }
 
 
+/*
+
+=item C<PMC * Parrot_find_method_inline_cached(PARROT_INTERP, PMC *object,
+STRING *method_name, const opcode_t *pc)>
+
+Finds the method C<method_name> of C<object> for the callmethod op at C<pc>
+in the current code segment.  Each such op remembers the methods it found
+for its last few receiver types, so a repeated call costs a compare of the
+receiver's vtable and class.  Receivers with a C<find_method> of their own,
+other than objects, always do a full lookup.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC *
+Parrot_find_method_inline_cached(PARROT_INTERP, ARGIN(PMC *object),
+        ARGIN(STRING *method_name), ARGIN(const opcode_t *pc))
+{
+    ASSERT_ARGS(Parrot_find_method_inline_cached)
+
+#if DISABLE_METH_CACHE
+    UNUSED(pc);
+    return VTABLE_find_method(interp, object, method_name);
+#else
+
+    PackFile_ByteCode * const code   = interp->code;
+    VTABLE            * const vtable = object->vtable;
+    const UINTVAL             epoch  = interp->caches->epoch;
+    PMC               *_class = NULL;
+    PMC               *method;
+    Meth_inline_cache *ic;
+    size_t             offset;
+    UINTVAL            way;
+
+    if (vtable->base_type == enum_class_Object
+    &&  vtable->find_method == interp->vtables[enum_class_Object]->find_method)
+        _class = PARROT_OBJECT(object)->_class;
+    else if (vtable->find_method != interp->vtables[enum_class_default]->find_method)
+        return VTABLE_find_method(interp, object, method_name);
+
+    if (!code || pc < code->base.data || pc >= code->base.data + code->base.size)
+        return VTABLE_find_method(interp, object, method_name);
+
+    offset = pc - code->base.data;
+
+    if (offset < code->method_caches_size
+    && (ic = code->method_caches[offset]) != NULL
+    &&  ic->name == method_name && ic->epoch == epoch) {
+        for (way = 0; way < METH_IC_WAYS; ++way)
+            if (ic->vtable[way] == vtable && ic->_class[way] == _class)
+                return ic->pmc[way];
+    }
+
+    method = VTABLE_find_method(interp, object, method_name);
+
+    if (PMC_IS_NULL(method))
+        return method;
+
+    ic = get_method_inline_cache(interp, code, offset);
+
+    /* a different name (from a register) or changed methods start over */
+    if (ic->name != method_name || ic->epoch != epoch) {
+        memset(ic, 0, sizeof (Meth_inline_cache));
+        ic->name  = method_name;
+        ic->epoch = epoch;
+    }
+
+    way              = ic->next;
+    ic->next         = (way + 1) % METH_IC_WAYS;
+    ic->vtable[way]  = vtable;
+    ic->_class[way]  = _class;
+    ic->pmc[way]     = method;
+
+    /* the code segment is marked through its packfile's view */
+    if (code->base.pf && code->base.pf->view)
+        PARROT_GC_WRITE_BARRIER(interp, code->base.pf->view);
+
+    return method;
+
+#endif
+}
+
+
+/*
+
+=item C<static Meth_inline_cache * get_method_inline_cache(PARROT_INTERP,
+PackFile_ByteCode *code, size_t offset)>
+
+Returns the inline cache of the callmethod op at C<offset> in C<code>,
+creating it if needed.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static Meth_inline_cache *
+get_method_inline_cache(PARROT_INTERP, ARGMOD(PackFile_ByteCode *code), size_t offset)
+{
+    ASSERT_ARGS(get_method_inline_cache)
+
+    /* the code may have grown since the table was made */
+    if (offset >= code->method_caches_size) {
+        const size_t size = code->base.size;
+
+        if (code->method_caches)
+            code->method_caches = mem_gc_realloc_n_typed_zeroed(interp,
+                    code->method_caches, size, code->method_caches_size,
+                    Meth_inline_cache *);
+        else
+            code->method_caches = mem_gc_allocate_n_zeroed_typed(interp,
+                    size, Meth_inline_cache *);
+
+        code->method_caches_size = size;
+    }
+
+    if (!code->method_caches[offset])
+        code->method_caches[offset] = mem_gc_allocate_zeroed_typed(interp,
+                Meth_inline_cache);
+
+    return code->method_caches[offset];
+}
+
+
 /*
 
 =item C<static PMC* C3_merge(PARROT_INTERP, PMC *merge_list)>
@@ -1263,6 +1467,8 @@ Parrot_ComposeRole(PARROT_INTERP, ARGIN(PMC *role),
     /* Check we have not already composed the role; if so, just ignore it. */
     INTVAL roles_count = VTABLE_elements(interp, roles_list);
 
+    Parrot_invalidate_method_inline_caches(interp);
+
     for (i = 0; i < roles_count; ++i)
         if (VTABLE_get_pmc_keyed_int(interp, roles_list, i) == role)
             return;
@@ -26,7 +26,7 @@
 #define NCONST(i) Parrot_pcc_get_num_constants(interp, interp->ctx)[cur_opcode[i]]
 #define SCONST(i) Parrot_pcc_get_str_constants(interp, interp->ctx)[cur_opcode[i]]
 #undef  PCONST
-#define PCONST(i) Parrot_pcc_get_pmc_constants(interp, interp->ctx)[cur_opcode[i]]
+#define PCONST(i) Parrot_pcc_get_pmc_constant(interp, interp->ctx, cur_opcode[i])
 
 static int get_op(PARROT_INTERP, const char * name, int full);
 
@@ -77,13 +77,13 @@ extern op_lib_t core_op_lib;
 
 
 
-INTVAL core_numops = 1126;
+INTVAL core_numops = 1132;
 
 /*
 ** Op Function Table:
 */
 
-static op_func_t core_op_func_table[1126] = {
+static op_func_t core_op_func_table[1132] = {
   Parrot_end,                                        /*      0 */
   Parrot_noop,                                       /*      1 */
   Parrot_check_events,                               /*      2 */
@@ -1209,6 +1209,12 @@ static op_func_t core_op_func_table[1126] = {
   Parrot_wait_p,                                     /*   1122 */
   Parrot_wait_pc,                                    /*   1123 */
   Parrot_pass,                                       /*   1124 */
+  Parrot_set_i_ic__lt_i_ic_ic,                       /*   1125 */
+  Parrot_inc_i__lt_i_ic_ic,                          /*   1126 */
+  Parrot_inc_i__lt_i_i_ic,                           /*   1127 */
+  Parrot_add_i_i_i__lt_i_ic_ic,                      /*   1128 */
+  Parrot_sub_i_i_i__if_i_ic,                         /*   1129 */
+  Parrot_dec_i__if_i_ic,                             /*   1130 */
 
   NULL /* NULL function pointer */
 };
@@ -1219,7 +1225,7 @@ static op_func_t core_op_func_table[1126] = {
 ** Op Info Table:
 */
 
-static op_info_t core_op_info_table[1126] = {
+static op_info_t core_op_info_table[1132] = {
   { /* 0 */
     "end",
     "end",
@@ -13595,6 +13601,72 @@ static op_info_t core_op_info_table[1126] = {
     { 0 },
     &core_op_lib
   },
+  { /* 1125 */
+    "set_i_ic__lt_i_ic_ic",
+    "set_i_ic__lt_i_ic_ic",
+    "Parrot_set_i_ic__lt_i_ic_ic",
+    0,
+    3,
+    { PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1126 */
+    "inc_i__lt_i_ic_ic",
+    "inc_i__lt_i_ic_ic",
+    "Parrot_inc_i__lt_i_ic_ic",
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1127 */
+    "inc_i__lt_i_i_ic",
+    "inc_i__lt_i_i_ic",
+    "Parrot_inc_i__lt_i_i_ic",
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1128 */
+    "add_i_i_i__lt_i_ic_ic",
+    "add_i_i_i__lt_i_ic_ic",
+    "Parrot_add_i_i_i__lt_i_ic_ic",
+    0,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1129 */
+    "sub_i_i_i__if_i_ic",
+    "sub_i_i_i__if_i_ic",
+    "Parrot_sub_i_i_i__if_i_ic",
+    0,
+    4,
+    { PARROT_ARG_I, PARROT_ARG_I, PARROT_ARG_I },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1130 */
+    "dec_i__if_i_ic",
+    "dec_i__if_i_ic",
+    "Parrot_dec_i__if_i_ic",
+    0,
+    2,
+    { PARROT_ARG_I },
+    { PARROT_ARGDIR_INOUT },
+    { 0 },
+    &core_op_lib
+  },
 
 };
 
@@ -13747,13 +13819,15 @@ Parrot_local_return_p(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_jump_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    opcode_t * const loc = INTVAL2PTR(opcode_t *, IREG(1));
+    opcode_t  * const  loc = INTVAL2PTR(opcode_t *, IREG(1));
+
     return (opcode_t *)loc;
 }
 
 opcode_t *
 Parrot_jump_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    opcode_t * const loc = INTVAL2PTR(opcode_t *, ICONST(1));
+    opcode_t  * const  loc = INTVAL2PTR(opcode_t *, ICONST(1));
+
     return (opcode_t *)loc;
 }
 
@@ -17113,7 +17187,7 @@ Parrot_getstderr_p(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_abs_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = abs(IREG(1));
+    IREG(1) = (IREG(1) < 0) ? (-IREG(1)) : IREG(1);
     return cur_opcode + 2;
 }
 
@@ -17125,7 +17199,7 @@ Parrot_abs_n(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_abs_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = abs(IREG(2));
+    IREG(1) = (IREG(2) < 0) ? (-IREG(2)) : IREG(2);
     return cur_opcode + 3;
 }
 
@@ -18202,7 +18276,7 @@ Parrot_callmethodcc_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC       * const  object = PREG(1);
     STRING    * const  meth = SREG(2);
     opcode_t  * const  next =  cur_opcode + 3;
-    PMC       * const  method_pmc = VTABLE_find_method(interp, object, meth);
+    PMC       * const  method_pmc = Parrot_find_method_inline_cached(interp, object, meth, CUR_OPCODE);
     opcode_t  * dest = NULL;
 
     Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), next);
@@ -18232,7 +18306,7 @@ Parrot_callmethodcc_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC       * const  object = PREG(1);
     STRING    * const  meth = SCONST(2);
     opcode_t  * const  next =  cur_opcode + 3;
-    PMC       * const  method_pmc = VTABLE_find_method(interp, object, meth);
+    PMC       * const  method_pmc = Parrot_find_method_inline_cached(interp, object, meth, CUR_OPCODE);
     opcode_t  * dest = NULL;
 
     Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), next);
@@ -18274,7 +18348,7 @@ Parrot_callmethod_p_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC       * const  object = PREG(1);
     STRING    * const  meth = SREG(2);
     opcode_t  * const  next =  cur_opcode + 4;
-    PMC       * const  method_pmc = VTABLE_find_method(interp, object, meth);
+    PMC       * const  method_pmc = Parrot_find_method_inline_cached(interp, object, meth, CUR_OPCODE);
     opcode_t  * dest;
     PMC       *        signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
 
@@ -18295,7 +18369,7 @@ Parrot_callmethod_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
     PMC       * const  object = PREG(1);
     STRING    * const  meth = SCONST(2);
     opcode_t  * const  next =  cur_opcode + 4;
-    PMC       * const  method_pmc = VTABLE_find_method(interp, object, meth);
+    PMC       * const  method_pmc = Parrot_find_method_inline_cached(interp, object, meth, CUR_OPCODE);
     opcode_t  * dest;
     PMC       *        signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
 
@@ -18330,7 +18404,7 @@ Parrot_tailcallmethod_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
     opcode_t  * const  next =  cur_opcode + 3;
     PMC       * const  object = PREG(1);
     STRING    * const  meth = SREG(2);
-    PMC       * const  method_pmc = VTABLE_find_method(interp, object, meth);
+    PMC       * const  method_pmc = Parrot_find_method_inline_cached(interp, object, meth, CUR_OPCODE);
     opcode_t  * dest;
     PMC       *        signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
 
@@ -18351,7 +18425,7 @@ Parrot_tailcallmethod_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
     opcode_t  * const  next =  cur_opcode + 3;
     PMC       * const  object = PREG(1);
     STRING    * const  meth = SCONST(2);
-    PMC       * const  method_pmc = VTABLE_find_method(interp, object, meth);
+    PMC       * const  method_pmc = Parrot_find_method_inline_cached(interp, object, meth, CUR_OPCODE);
     opcode_t  * dest;
     PMC       *        signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
 
@@ -24427,6 +24501,12278 @@ Parrot_pass(opcode_t *cur_opcode, PARROT_INTERP) {
     return cur_opcode + 1;
 }
 
+opcode_t *
+Parrot_set_i_ic__lt_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    /* set_i_ic */
+    {
+        IREG(1) = ICONST(2);
+        do { cur_opcode += 3; goto FUSED_1125_1; } while (0);
+    }
+  FUSED_1125_1:
+    /* lt_i_ic_ic */
+    {
+        if ((IREG(1) < ICONST(2))) {
+            return cur_opcode + ICONST(3);
+        }
+
+        return cur_opcode + 4;
+    }
+}
+
+opcode_t *
+Parrot_inc_i__lt_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    /* inc_i */
+    {
+        (IREG(1)++);
+        do { cur_opcode += 2; goto FUSED_1126_1; } while (0);
+    }
+  FUSED_1126_1:
+    /* lt_i_ic_ic */
+    {
+        if ((IREG(1) < ICONST(2))) {
+            return cur_opcode + ICONST(3);
+        }
+
+        return cur_opcode + 4;
+    }
+}
+
+opcode_t *
+Parrot_inc_i__lt_i_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    /* inc_i */
+    {
+        (IREG(1)++);
+        do { cur_opcode += 2; goto FUSED_1127_1; } while (0);
+    }
+  FUSED_1127_1:
+    /* lt_i_i_ic */
+    {
+        if ((IREG(1) < IREG(2))) {
+            return cur_opcode + ICONST(3);
+        }
+
+        return cur_opcode + 4;
+    }
+}
+
+opcode_t *
+Parrot_add_i_i_i__lt_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    /* add_i_i_i */
+    {
+        IREG(1) = (IREG(2) + IREG(3));
+        do { cur_opcode += 4; goto FUSED_1128_1; } while (0);
+    }
+  FUSED_1128_1:
+    /* lt_i_ic_ic */
+    {
+        if ((IREG(1) < ICONST(2))) {
+            return cur_opcode + ICONST(3);
+        }
+
+        return cur_opcode + 4;
+    }
+}
+
+opcode_t *
+Parrot_sub_i_i_i__if_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    /* sub_i_i_i */
+    {
+        IREG(1) = (IREG(2) - IREG(3));
+        do { cur_opcode += 4; goto FUSED_1129_1; } while (0);
+    }
+  FUSED_1129_1:
+    /* if_i_ic */
+    {
+        if ((IREG(1) != 0)) {
+            return cur_opcode + ICONST(2);
+        }
+
+        return cur_opcode + 3;
+    }
+}
+
+opcode_t *
+Parrot_dec_i__if_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    /* dec_i */
+    {
+        (IREG(1)--);
+        do { cur_opcode += 2; goto FUSED_1130_1; } while (0);
+    }
+  FUSED_1130_1:
+    /* if_i_ic */
+    {
+        if ((IREG(1) != 0)) {
+            return cur_opcode + ICONST(2);
+        }
+
+        return cur_opcode + 3;
+    }
+}
+
+
+
+/*
+** Computed goto core:
+*/
+
+#ifdef PARROT_HAS_COMPUTED_GOTO
+
+/* defines - Ops::Trans::CGoto */
+#define CG_NEXT() goto *cg_threaded[cur_opcode - cg_base]
+#define CG_BRANCH() do { \
+        if (cg_seg->save_func_table) \
+            return cur_opcode; \
+        CG_NEXT(); \
+    } while (0)
+#define CG_JUMP() do { \
+        if (!cur_opcode) \
+            return NULL; \
+        if (cg_seg != interp->code) \
+            return cur_opcode; \
+        CG_BRANCH(); \
+    } while (0)
+
+/*
+ * Runs ops from the current code segment until an op halts, leaves the
+ * segment or event checking takes over the op function table; returns the
+ * pc to continue at.  Called with a NULL pc, returns the label table
+ * instead: one entry per op, followed by the decode and dynop labels.
+ */
+
+PARROT_CAN_RETURN_NULL
+opcode_t *
+core_cg_core(opcode_t *cur_opcode, PARROT_INTERP)
+{
+    static void *cg_labels[] = {
+        &&PC_0,              /*      0 */
+        &&PC_1,              /*      1 */
+        &&PC_2,              /*      2 */
+        &&PC_3,              /*      3 */
+        &&PC_4,              /*      4 */
+        &&PC_5,              /*      5 */
+        &&PC_6,              /*      6 */
+        &&PC_7,              /*      7 */
+        &&PC_8,              /*      8 */
+        &&PC_9,              /*      9 */
+        &&PC_10,             /*     10 */
+        &&PC_11,             /*     11 */
+        &&PC_12,             /*     12 */
+        &&PC_13,             /*     13 */
+        &&PC_14,             /*     14 */
+        &&PC_15,             /*     15 */
+        &&PC_16,             /*     16 */
+        &&PC_17,             /*     17 */
+        &&PC_18,             /*     18 */
+        &&PC_19,             /*     19 */
+        &&PC_20,             /*     20 */
+        &&PC_21,             /*     21 */
+        &&PC_22,             /*     22 */
+        &&PC_23,             /*     23 */
+        &&PC_24,             /*     24 */
+        &&PC_25,             /*     25 */
+        &&PC_26,             /*     26 */
+        &&PC_27,             /*     27 */
+        &&PC_28,             /*     28 */
+        &&PC_29,             /*     29 */
+        &&PC_30,             /*     30 */
+        &&PC_31,             /*     31 */
+        &&PC_32,             /*     32 */
+        &&PC_33,             /*     33 */
+        &&PC_34,             /*     34 */
+        &&PC_35,             /*     35 */
+        &&PC_36,             /*     36 */
+        &&PC_37,             /*     37 */
+        &&PC_38,             /*     38 */
+        &&PC_39,             /*     39 */
+        &&PC_40,             /*     40 */
+        &&PC_41,             /*     41 */
+        &&PC_42,             /*     42 */
+        &&PC_43,             /*     43 */
+        &&PC_44,             /*     44 */
+        &&PC_45,             /*     45 */
+        &&PC_46,             /*     46 */
+        &&PC_47,             /*     47 */
+        &&PC_48,             /*     48 */
+        &&PC_49,             /*     49 */
+        &&PC_50,             /*     50 */
+        &&PC_51,             /*     51 */
+        &&PC_52,             /*     52 */
+        &&PC_53,             /*     53 */
+        &&PC_54,             /*     54 */
+        &&PC_55,             /*     55 */
+        &&PC_56,             /*     56 */
+        &&PC_57,             /*     57 */
+        &&PC_58,             /*     58 */
+        &&PC_59,             /*     59 */
+        &&PC_60,             /*     60 */
+        &&PC_61,             /*     61 */
+        &&PC_62,             /*     62 */
+        &&PC_63,             /*     63 */
+        &&PC_64,             /*     64 */
+        &&PC_65,             /*     65 */
+        &&PC_66,             /*     66 */
+        &&PC_67,             /*     67 */
+        &&PC_68,             /*     68 */
+        &&PC_69,             /*     69 */
+        &&PC_70,             /*     70 */
+        &&PC_71,             /*     71 */
+        &&PC_72,             /*     72 */
+        &&PC_73,             /*     73 */
+        &&PC_74,             /*     74 */
+        &&PC_75,             /*     75 */
+        &&PC_76,             /*     76 */
+        &&PC_77,             /*     77 */
+        &&PC_78,             /*     78 */
+        &&PC_79,             /*     79 */
+        &&PC_80,             /*     80 */
+        &&PC_81,             /*     81 */
+        &&PC_82,             /*     82 */
+        &&PC_83,             /*     83 */
+        &&PC_84,             /*     84 */
+        &&PC_85,             /*     85 */
+        &&PC_86,             /*     86 */
+        &&PC_87,             /*     87 */
+        &&PC_88,             /*     88 */
+        &&PC_89,             /*     89 */
+        &&PC_90,             /*     90 */
+        &&PC_91,             /*     91 */
+        &&PC_92,             /*     92 */
+        &&PC_93,             /*     93 */
+        &&PC_94,             /*     94 */
+        &&PC_95,             /*     95 */
+        &&PC_96,             /*     96 */
+        &&PC_97,             /*     97 */
+        &&PC_98,             /*     98 */
+        &&PC_99,             /*     99 */
+        &&PC_100,            /*    100 */
+        &&PC_101,            /*    101 */
+        &&PC_102,            /*    102 */
+        &&PC_103,            /*    103 */
+        &&PC_104,            /*    104 */
+        &&PC_105,            /*    105 */
+        &&PC_106,            /*    106 */
+        &&PC_107,            /*    107 */
+        &&PC_108,            /*    108 */
+        &&PC_109,            /*    109 */
+        &&PC_110,            /*    110 */
+        &&PC_111,            /*    111 */
+        &&PC_112,            /*    112 */
+        &&PC_113,            /*    113 */
+        &&PC_114,            /*    114 */
+        &&PC_115,            /*    115 */
+        &&PC_116,            /*    116 */
+        &&PC_117,            /*    117 */
+        &&PC_118,            /*    118 */
+        &&PC_119,            /*    119 */
+        &&PC_120,            /*    120 */
+        &&PC_121,            /*    121 */
+        &&PC_122,            /*    122 */
+        &&PC_123,            /*    123 */
+        &&PC_124,            /*    124 */
+        &&PC_125,            /*    125 */
+        &&PC_126,            /*    126 */
+        &&PC_127,            /*    127 */
+        &&PC_128,            /*    128 */
+        &&PC_129,            /*    129 */
+        &&PC_130,            /*    130 */
+        &&PC_131,            /*    131 */
+        &&PC_132,            /*    132 */
+        &&PC_133,            /*    133 */
+        &&PC_134,            /*    134 */
+        &&PC_135,            /*    135 */
+        &&PC_136,            /*    136 */
+        &&PC_137,            /*    137 */
+        &&PC_138,            /*    138 */
+        &&PC_139,            /*    139 */
+        &&PC_140,            /*    140 */
+        &&PC_141,            /*    141 */
+        &&PC_142,            /*    142 */
+        &&PC_143,            /*    143 */
+        &&PC_144,            /*    144 */
+        &&PC_145,            /*    145 */
+        &&PC_146,            /*    146 */
+        &&PC_147,            /*    147 */
+        &&PC_148,            /*    148 */
+        &&PC_149,            /*    149 */
+        &&PC_150,            /*    150 */
+        &&PC_151,            /*    151 */
+        &&PC_152,            /*    152 */
+        &&PC_153,            /*    153 */
+        &&PC_154,            /*    154 */
+        &&PC_155,            /*    155 */
+        &&PC_156,            /*    156 */
+        &&PC_157,            /*    157 */
+        &&PC_158,            /*    158 */
+        &&PC_159,            /*    159 */
+        &&PC_160,            /*    160 */
+        &&PC_161,            /*    161 */
+        &&PC_162,            /*    162 */
+        &&PC_163,            /*    163 */
+        &&PC_164,            /*    164 */
+        &&PC_165,            /*    165 */
+        &&PC_166,            /*    166 */
+        &&PC_167,            /*    167 */
+        &&PC_168,            /*    168 */
+        &&PC_169,            /*    169 */
+        &&PC_170,            /*    170 */
+        &&PC_171,            /*    171 */
+        &&PC_172,            /*    172 */
+        &&PC_173,            /*    173 */
+        &&PC_174,            /*    174 */
+        &&PC_175,            /*    175 */
+        &&PC_176,            /*    176 */
+        &&PC_177,            /*    177 */
+        &&PC_178,            /*    178 */
+        &&PC_179,            /*    179 */
+        &&PC_180,            /*    180 */
+        &&PC_181,            /*    181 */
+        &&PC_182,            /*    182 */
+        &&PC_183,            /*    183 */
+        &&PC_184,            /*    184 */
+        &&PC_185,            /*    185 */
+        &&PC_186,            /*    186 */
+        &&PC_187,            /*    187 */
+        &&PC_188,            /*    188 */
+        &&PC_189,            /*    189 */
+        &&PC_190,            /*    190 */
+        &&PC_191,            /*    191 */
+        &&PC_192,            /*    192 */
+        &&PC_193,            /*    193 */
+        &&PC_194,            /*    194 */
+        &&PC_195,            /*    195 */
+        &&PC_196,            /*    196 */
+        &&PC_197,            /*    197 */
+        &&PC_198,            /*    198 */
+        &&PC_199,            /*    199 */
+        &&PC_200,            /*    200 */
+        &&PC_201,            /*    201 */
+        &&PC_202,            /*    202 */
+        &&PC_203,            /*    203 */
+        &&PC_204,            /*    204 */
+        &&PC_205,            /*    205 */
+        &&PC_206,            /*    206 */
+        &&PC_207,            /*    207 */
+        &&PC_208,            /*    208 */
+        &&PC_209,            /*    209 */
+        &&PC_210,            /*    210 */
+        &&PC_211,            /*    211 */
+        &&PC_212,            /*    212 */
+        &&PC_213,            /*    213 */
+        &&PC_214,            /*    214 */
+        &&PC_215,            /*    215 */
+        &&PC_216,            /*    216 */
+        &&PC_217,            /*    217 */
+        &&PC_218,            /*    218 */
+        &&PC_219,            /*    219 */
+        &&PC_220,            /*    220 */
+        &&PC_221,            /*    221 */
+        &&PC_222,            /*    222 */
+        &&PC_223,            /*    223 */
+        &&PC_224,            /*    224 */
+        &&PC_225,            /*    225 */
+        &&PC_226,            /*    226 */
+        &&PC_227,            /*    227 */
+        &&PC_228,            /*    228 */
+        &&PC_229,            /*    229 */
+        &&PC_230,            /*    230 */
+        &&PC_231,            /*    231 */
+        &&PC_232,            /*    232 */
+        &&PC_233,            /*    233 */
+        &&PC_234,            /*    234 */
+        &&PC_235,            /*    235 */
+        &&PC_236,            /*    236 */
+        &&PC_237,            /*    237 */
+        &&PC_238,            /*    238 */
+        &&PC_239,            /*    239 */
+        &&PC_240,            /*    240 */
+        &&PC_241,            /*    241 */
+        &&PC_242,            /*    242 */
+        &&PC_243,            /*    243 */
+        &&PC_244,            /*    244 */
+        &&PC_245,            /*    245 */
+        &&PC_246,            /*    246 */
+        &&PC_247,            /*    247 */
+        &&PC_248,            /*    248 */
+        &&PC_249,            /*    249 */
+        &&PC_250,            /*    250 */
+        &&PC_251,            /*    251 */
+        &&PC_252,            /*    252 */
+        &&PC_253,            /*    253 */
+        &&PC_254,            /*    254 */
+        &&PC_255,            /*    255 */
+        &&PC_256,            /*    256 */
+        &&PC_257,            /*    257 */
+        &&PC_258,            /*    258 */
+        &&PC_259,            /*    259 */
+        &&PC_260,            /*    260 */
+        &&PC_261,            /*    261 */
+        &&PC_262,            /*    262 */
+        &&PC_263,            /*    263 */
+        &&PC_264,            /*    264 */
+        &&PC_265,            /*    265 */
+        &&PC_266,            /*    266 */
+        &&PC_267,            /*    267 */
+        &&PC_268,            /*    268 */
+        &&PC_269,            /*    269 */
+        &&PC_270,            /*    270 */
+        &&PC_271,            /*    271 */
+        &&PC_272,            /*    272 */
+        &&PC_273,            /*    273 */
+        &&PC_274,            /*    274 */
+        &&PC_275,            /*    275 */
+        &&PC_276,            /*    276 */
+        &&PC_277,            /*    277 */
+        &&PC_278,            /*    278 */
+        &&PC_279,            /*    279 */
+        &&PC_280,            /*    280 */
+        &&PC_281,            /*    281 */
+        &&PC_282,            /*    282 */
+        &&PC_283,            /*    283 */
+        &&PC_284,            /*    284 */
+        &&PC_285,            /*    285 */
+        &&PC_286,            /*    286 */
+        &&PC_287,            /*    287 */
+        &&PC_288,            /*    288 */
+        &&PC_289,            /*    289 */
+        &&PC_290,            /*    290 */
+        &&PC_291,            /*    291 */
+        &&PC_292,            /*    292 */
+        &&PC_293,            /*    293 */
+        &&PC_294,            /*    294 */
+        &&PC_295,            /*    295 */
+        &&PC_296,            /*    296 */
+        &&PC_297,            /*    297 */
+        &&PC_298,            /*    298 */
+        &&PC_299,            /*    299 */
+        &&PC_300,            /*    300 */
+        &&PC_301,            /*    301 */
+        &&PC_302,            /*    302 */
+        &&PC_303,            /*    303 */
+        &&PC_304,            /*    304 */
+        &&PC_305,            /*    305 */
+        &&PC_306,            /*    306 */
+        &&PC_307,            /*    307 */
+        &&PC_308,            /*    308 */
+        &&PC_309,            /*    309 */
+        &&PC_310,            /*    310 */
+        &&PC_311,            /*    311 */
+        &&PC_312,            /*    312 */
+        &&PC_313,            /*    313 */
+        &&PC_314,            /*    314 */
+        &&PC_315,            /*    315 */
+        &&PC_316,            /*    316 */
+        &&PC_317,            /*    317 */
+        &&PC_318,            /*    318 */
+        &&PC_319,            /*    319 */
+        &&PC_320,            /*    320 */
+        &&PC_321,            /*    321 */
+        &&PC_322,            /*    322 */
+        &&PC_323,            /*    323 */
+        &&PC_324,            /*    324 */
+        &&PC_325,            /*    325 */
+        &&PC_326,            /*    326 */
+        &&PC_327,            /*    327 */
+        &&PC_328,            /*    328 */
+        &&PC_329,            /*    329 */
+        &&PC_330,            /*    330 */
+        &&PC_331,            /*    331 */
+        &&PC_332,            /*    332 */
+        &&PC_333,            /*    333 */
+        &&PC_334,            /*    334 */
+        &&PC_335,            /*    335 */
+        &&PC_336,            /*    336 */
+        &&PC_337,            /*    337 */
+        &&PC_338,            /*    338 */
+        &&PC_339,            /*    339 */
+        &&PC_340,            /*    340 */
+        &&PC_341,            /*    341 */
+        &&PC_342,            /*    342 */
+        &&PC_343,            /*    343 */
+        &&PC_344,            /*    344 */
+        &&PC_345,            /*    345 */
+        &&PC_346,            /*    346 */
+        &&PC_347,            /*    347 */
+        &&PC_348,            /*    348 */
+        &&PC_349,            /*    349 */
+        &&PC_350,            /*    350 */
+        &&PC_351,            /*    351 */
+        &&PC_352,            /*    352 */
+        &&PC_353,            /*    353 */
+        &&PC_354,            /*    354 */
+        &&PC_355,            /*    355 */
+        &&PC_356,            /*    356 */
+        &&PC_357,            /*    357 */
+        &&PC_358,            /*    358 */
+        &&PC_359,            /*    359 */
+        &&PC_360,            /*    360 */
+        &&PC_361,            /*    361 */
+        &&PC_362,            /*    362 */
+        &&PC_363,            /*    363 */
+        &&PC_364,            /*    364 */
+        &&PC_365,            /*    365 */
+        &&PC_366,            /*    366 */
+        &&PC_367,            /*    367 */
+        &&PC_368,            /*    368 */
+        &&PC_369,            /*    369 */
+        &&PC_370,            /*    370 */
+        &&PC_371,            /*    371 */
+        &&PC_372,            /*    372 */
+        &&PC_373,            /*    373 */
+        &&PC_374,            /*    374 */
+        &&PC_375,            /*    375 */
+        &&PC_376,            /*    376 */
+        &&PC_377,            /*    377 */
+        &&PC_378,            /*    378 */
+        &&PC_379,            /*    379 */
+        &&PC_380,            /*    380 */
+        &&PC_381,            /*    381 */
+        &&PC_382,            /*    382 */
+        &&PC_383,            /*    383 */
+        &&PC_384,            /*    384 */
+        &&PC_385,            /*    385 */
+        &&PC_386,            /*    386 */
+        &&PC_387,            /*    387 */
+        &&PC_388,            /*    388 */
+        &&PC_389,            /*    389 */
+        &&PC_390,            /*    390 */
+        &&PC_391,            /*    391 */
+        &&PC_392,            /*    392 */
+        &&PC_393,            /*    393 */
+        &&PC_394,            /*    394 */
+        &&PC_395,            /*    395 */
+        &&PC_396,            /*    396 */
+        &&PC_397,            /*    397 */
+        &&PC_398,            /*    398 */
+        &&PC_399,            /*    399 */
+        &&PC_400,            /*    400 */
+        &&PC_401,            /*    401 */
+        &&PC_402,            /*    402 */
+        &&PC_403,            /*    403 */
+        &&PC_404,            /*    404 */
+        &&PC_405,            /*    405 */
+        &&PC_406,            /*    406 */
+        &&PC_407,            /*    407 */
+        &&PC_408,            /*    408 */
+        &&PC_409,            /*    409 */
+        &&PC_410,            /*    410 */
+        &&PC_411,            /*    411 */
+        &&PC_412,            /*    412 */
+        &&PC_413,            /*    413 */
+        &&PC_414,            /*    414 */
+        &&PC_415,            /*    415 */
+        &&PC_416,            /*    416 */
+        &&PC_417,            /*    417 */
+        &&PC_418,            /*    418 */
+        &&PC_419,            /*    419 */
+        &&PC_420,            /*    420 */
+        &&PC_421,            /*    421 */
+        &&PC_422,            /*    422 */
+        &&PC_423,            /*    423 */
+        &&PC_424,            /*    424 */
+        &&PC_425,            /*    425 */
+        &&PC_426,            /*    426 */
+        &&PC_427,            /*    427 */
+        &&PC_428,            /*    428 */
+        &&PC_429,            /*    429 */
+        &&PC_430,            /*    430 */
+        &&PC_431,            /*    431 */
+        &&PC_432,            /*    432 */
+        &&PC_433,            /*    433 */
+        &&PC_434,            /*    434 */
+        &&PC_435,            /*    435 */
+        &&PC_436,            /*    436 */
+        &&PC_437,            /*    437 */
+        &&PC_438,            /*    438 */
+        &&PC_439,            /*    439 */
+        &&PC_440,            /*    440 */
+        &&PC_441,            /*    441 */
+        &&PC_442,            /*    442 */
+        &&PC_443,            /*    443 */
+        &&PC_444,            /*    444 */
+        &&PC_445,            /*    445 */
+        &&PC_446,            /*    446 */
+        &&PC_447,            /*    447 */
+        &&PC_448,            /*    448 */
+        &&PC_449,            /*    449 */
+        &&PC_450,            /*    450 */
+        &&PC_451,            /*    451 */
+        &&PC_452,            /*    452 */
+        &&PC_453,            /*    453 */
+        &&PC_454,            /*    454 */
+        &&PC_455,            /*    455 */
+        &&PC_456,            /*    456 */
+        &&PC_457,            /*    457 */
+        &&PC_458,            /*    458 */
+        &&PC_459,            /*    459 */
+        &&PC_460,            /*    460 */
+        &&PC_461,            /*    461 */
+        &&PC_462,            /*    462 */
+        &&PC_463,            /*    463 */
+        &&PC_464,            /*    464 */
+        &&PC_465,            /*    465 */
+        &&PC_466,            /*    466 */
+        &&PC_467,            /*    467 */
+        &&PC_468,            /*    468 */
+        &&PC_469,            /*    469 */
+        &&PC_470,            /*    470 */
+        &&PC_471,            /*    471 */
+        &&PC_472,            /*    472 */
+        &&PC_473,            /*    473 */
+        &&PC_474,            /*    474 */
+        &&PC_475,            /*    475 */
+        &&PC_476,            /*    476 */
+        &&PC_477,            /*    477 */
+        &&PC_478,            /*    478 */
+        &&PC_479,            /*    479 */
+        &&PC_480,            /*    480 */
+        &&PC_481,            /*    481 */
+        &&PC_482,            /*    482 */
+        &&PC_483,            /*    483 */
+        &&PC_484,            /*    484 */
+        &&PC_485,            /*    485 */
+        &&PC_486,            /*    486 */
+        &&PC_487,            /*    487 */
+        &&PC_488,            /*    488 */
+        &&PC_489,            /*    489 */
+        &&PC_490,            /*    490 */
+        &&PC_491,            /*    491 */
+        &&PC_492,            /*    492 */
+        &&PC_493,            /*    493 */
+        &&PC_494,            /*    494 */
+        &&PC_495,            /*    495 */
+        &&PC_496,            /*    496 */
+        &&PC_497,            /*    497 */
+        &&PC_498,            /*    498 */
+        &&PC_499,            /*    499 */
+        &&PC_500,            /*    500 */
+        &&PC_501,            /*    501 */
+        &&PC_502,            /*    502 */
+        &&PC_503,            /*    503 */
+        &&PC_504,            /*    504 */
+        &&PC_505,            /*    505 */
+        &&PC_506,            /*    506 */
+        &&PC_507,            /*    507 */
+        &&PC_508,            /*    508 */
+        &&PC_509,            /*    509 */
+        &&PC_510,            /*    510 */
+        &&PC_511,            /*    511 */
+        &&PC_512,            /*    512 */
+        &&PC_513,            /*    513 */
+        &&PC_514,            /*    514 */
+        &&PC_515,            /*    515 */
+        &&PC_516,            /*    516 */
+        &&PC_517,            /*    517 */
+        &&PC_518,            /*    518 */
+        &&PC_519,            /*    519 */
+        &&PC_520,            /*    520 */
+        &&PC_521,            /*    521 */
+        &&PC_522,            /*    522 */
+        &&PC_523,            /*    523 */
+        &&PC_524,            /*    524 */
+        &&PC_525,            /*    525 */
+        &&PC_526,            /*    526 */
+        &&PC_527,            /*    527 */
+        &&PC_528,            /*    528 */
+        &&PC_529,            /*    529 */
+        &&PC_530,            /*    530 */
+        &&PC_531,            /*    531 */
+        &&PC_532,            /*    532 */
+        &&PC_533,            /*    533 */
+        &&PC_534,            /*    534 */
+        &&PC_535,            /*    535 */
+        &&PC_536,            /*    536 */
+        &&PC_537,            /*    537 */
+        &&PC_538,            /*    538 */
+        &&PC_539,            /*    539 */
+        &&PC_540,            /*    540 */
+        &&PC_541,            /*    541 */
+        &&PC_542,            /*    542 */
+        &&PC_543,            /*    543 */
+        &&PC_544,            /*    544 */
+        &&PC_545,            /*    545 */
+        &&PC_546,            /*    546 */
+        &&PC_547,            /*    547 */
+        &&PC_548,            /*    548 */
+        &&PC_549,            /*    549 */
+        &&PC_550,            /*    550 */
+        &&PC_551,            /*    551 */
+        &&PC_552,            /*    552 */
+        &&PC_553,            /*    553 */
+        &&PC_554,            /*    554 */
+        &&PC_555,            /*    555 */
+        &&PC_556,            /*    556 */
+        &&PC_557,            /*    557 */
+        &&PC_558,            /*    558 */
+        &&PC_559,            /*    559 */
+        &&PC_560,            /*    560 */
+        &&PC_561,            /*    561 */
+        &&PC_562,            /*    562 */
+        &&PC_563,            /*    563 */
+        &&PC_564,            /*    564 */
+        &&PC_565,            /*    565 */
+        &&PC_566,            /*    566 */
+        &&PC_567,            /*    567 */
+        &&PC_568,            /*    568 */
+        &&PC_569,            /*    569 */
+        &&PC_570,            /*    570 */
+        &&PC_571,            /*    571 */
+        &&PC_572,            /*    572 */
+        &&PC_573,            /*    573 */
+        &&PC_574,            /*    574 */
+        &&PC_575,            /*    575 */
+        &&PC_576,            /*    576 */
+        &&PC_577,            /*    577 */
+        &&PC_578,            /*    578 */
+        &&PC_579,            /*    579 */
+        &&PC_580,            /*    580 */
+        &&PC_581,            /*    581 */
+        &&PC_582,            /*    582 */
+        &&PC_583,            /*    583 */
+        &&PC_584,            /*    584 */
+        &&PC_585,            /*    585 */
+        &&PC_586,            /*    586 */
+        &&PC_587,            /*    587 */
+        &&PC_588,            /*    588 */
+        &&PC_589,            /*    589 */
+        &&PC_590,            /*    590 */
+        &&PC_591,            /*    591 */
+        &&PC_592,            /*    592 */
+        &&PC_593,            /*    593 */
+        &&PC_594,            /*    594 */
+        &&PC_595,            /*    595 */
+        &&PC_596,            /*    596 */
+        &&PC_597,            /*    597 */
+        &&PC_598,            /*    598 */
+        &&PC_599,            /*    599 */
+        &&PC_600,            /*    600 */
+        &&PC_601,            /*    601 */
+        &&PC_602,            /*    602 */
+        &&PC_603,            /*    603 */
+        &&PC_604,            /*    604 */
+        &&PC_605,            /*    605 */
+        &&PC_606,            /*    606 */
+        &&PC_607,            /*    607 */
+        &&PC_608,            /*    608 */
+        &&PC_609,            /*    609 */
+        &&PC_610,            /*    610 */
+        &&PC_611,            /*    611 */
+        &&PC_612,            /*    612 */
+        &&PC_613,            /*    613 */
+        &&PC_614,            /*    614 */
+        &&PC_615,            /*    615 */
+        &&PC_616,            /*    616 */
+        &&PC_617,            /*    617 */
+        &&PC_618,            /*    618 */
+        &&PC_619,            /*    619 */
+        &&PC_620,            /*    620 */
+        &&PC_621,            /*    621 */
+        &&PC_622,            /*    622 */
+        &&PC_623,            /*    623 */
+        &&PC_624,            /*    624 */
+        &&PC_625,            /*    625 */
+        &&PC_626,            /*    626 */
+        &&PC_627,            /*    627 */
+        &&PC_628,            /*    628 */
+        &&PC_629,            /*    629 */
+        &&PC_630,            /*    630 */
+        &&PC_631,            /*    631 */
+        &&PC_632,            /*    632 */
+        &&PC_633,            /*    633 */
+        &&PC_634,            /*    634 */
+        &&PC_635,            /*    635 */
+        &&PC_636,            /*    636 */
+        &&PC_637,            /*    637 */
+        &&PC_638,            /*    638 */
+        &&PC_639,            /*    639 */
+        &&PC_640,            /*    640 */
+        &&PC_641,            /*    641 */
+        &&PC_642,            /*    642 */
+        &&PC_643,            /*    643 */
+        &&PC_644,            /*    644 */
+        &&PC_645,            /*    645 */
+        &&PC_646,            /*    646 */
+        &&PC_647,            /*    647 */
+        &&PC_648,            /*    648 */
+        &&PC_649,            /*    649 */
+        &&PC_650,            /*    650 */
+        &&PC_651,            /*    651 */
+        &&PC_652,            /*    652 */
+        &&PC_653,            /*    653 */
+        &&PC_654,            /*    654 */
+        &&PC_655,            /*    655 */
+        &&PC_656,            /*    656 */
+        &&PC_657,            /*    657 */
+        &&PC_658,            /*    658 */
+        &&PC_659,            /*    659 */
+        &&PC_660,            /*    660 */
+        &&PC_661,            /*    661 */
+        &&PC_662,            /*    662 */
+        &&PC_663,            /*    663 */
+        &&PC_664,            /*    664 */
+        &&PC_665,            /*    665 */
+        &&PC_666,            /*    666 */
+        &&PC_667,            /*    667 */
+        &&PC_668,            /*    668 */
+        &&PC_669,            /*    669 */
+        &&PC_670,            /*    670 */
+        &&PC_671,            /*    671 */
+        &&PC_672,            /*    672 */
+        &&PC_673,            /*    673 */
+        &&PC_674,            /*    674 */
+        &&PC_675,            /*    675 */
+        &&PC_676,            /*    676 */
+        &&PC_677,            /*    677 */
+        &&PC_678,            /*    678 */
+        &&PC_679,            /*    679 */
+        &&PC_680,            /*    680 */
+        &&PC_681,            /*    681 */
+        &&PC_682,            /*    682 */
+        &&PC_683,            /*    683 */
+        &&PC_684,            /*    684 */
+        &&PC_685,            /*    685 */
+        &&PC_686,            /*    686 */
+        &&PC_687,            /*    687 */
+        &&PC_688,            /*    688 */
+        &&PC_689,            /*    689 */
+        &&PC_690,            /*    690 */
+        &&PC_691,            /*    691 */
+        &&PC_692,            /*    692 */
+        &&PC_693,            /*    693 */
+        &&PC_694,            /*    694 */
+        &&PC_695,            /*    695 */
+        &&PC_696,            /*    696 */
+        &&PC_697,            /*    697 */
+        &&PC_698,            /*    698 */
+        &&PC_699,            /*    699 */
+        &&PC_700,            /*    700 */
+        &&PC_701,            /*    701 */
+        &&PC_702,            /*    702 */
+        &&PC_703,            /*    703 */
+        &&PC_704,            /*    704 */
+        &&PC_705,            /*    705 */
+        &&PC_706,            /*    706 */
+        &&PC_707,            /*    707 */
+        &&PC_708,            /*    708 */
+        &&PC_709,            /*    709 */
+        &&PC_710,            /*    710 */
+        &&PC_711,            /*    711 */
+        &&PC_712,            /*    712 */
+        &&PC_713,            /*    713 */
+        &&PC_714,            /*    714 */
+        &&PC_715,            /*    715 */
+        &&PC_716,            /*    716 */
+        &&PC_717,            /*    717 */
+        &&PC_718,            /*    718 */
+        &&PC_719,            /*    719 */
+        &&PC_720,            /*    720 */
+        &&PC_721,            /*    721 */
+        &&PC_722,            /*    722 */
+        &&PC_723,            /*    723 */
+        &&PC_724,            /*    724 */
+        &&PC_725,            /*    725 */
+        &&PC_726,            /*    726 */
+        &&PC_727,            /*    727 */
+        &&PC_728,            /*    728 */
+        &&PC_729,            /*    729 */
+        &&PC_730,            /*    730 */
+        &&PC_731,            /*    731 */
+        &&PC_732,            /*    732 */
+        &&PC_733,            /*    733 */
+        &&PC_734,            /*    734 */
+        &&PC_735,            /*    735 */
+        &&PC_736,            /*    736 */
+        &&PC_737,            /*    737 */
+        &&PC_738,            /*    738 */
+        &&PC_739,            /*    739 */
+        &&PC_740,            /*    740 */
+        &&PC_741,            /*    741 */
+        &&PC_742,            /*    742 */
+        &&PC_743,            /*    743 */
+        &&PC_744,            /*    744 */
+        &&PC_745,            /*    745 */
+        &&PC_746,            /*    746 */
+        &&PC_747,            /*    747 */
+        &&PC_748,            /*    748 */
+        &&PC_749,            /*    749 */
+        &&PC_750,            /*    750 */
+        &&PC_751,            /*    751 */
+        &&PC_752,            /*    752 */
+        &&PC_753,            /*    753 */
+        &&PC_754,            /*    754 */
+        &&PC_755,            /*    755 */
+        &&PC_756,            /*    756 */
+        &&PC_757,            /*    757 */
+        &&PC_758,            /*    758 */
+        &&PC_759,            /*    759 */
+        &&PC_760,            /*    760 */
+        &&PC_761,            /*    761 */
+        &&PC_762,            /*    762 */
+        &&PC_763,            /*    763 */
+        &&PC_764,            /*    764 */
+        &&PC_765,            /*    765 */
+        &&PC_766,            /*    766 */
+        &&PC_767,            /*    767 */
+        &&PC_768,            /*    768 */
+        &&PC_769,            /*    769 */
+        &&PC_770,            /*    770 */
+        &&PC_771,            /*    771 */
+        &&PC_772,            /*    772 */
+        &&PC_773,            /*    773 */
+        &&PC_774,            /*    774 */
+        &&PC_775,            /*    775 */
+        &&PC_776,            /*    776 */
+        &&PC_777,            /*    777 */
+        &&PC_778,            /*    778 */
+        &&PC_779,            /*    779 */
+        &&PC_780,            /*    780 */
+        &&PC_781,            /*    781 */
+        &&PC_782,            /*    782 */
+        &&PC_783,            /*    783 */
+        &&PC_784,            /*    784 */
+        &&PC_785,            /*    785 */
+        &&PC_786,            /*    786 */
+        &&PC_787,            /*    787 */
+        &&PC_788,            /*    788 */
+        &&PC_789,            /*    789 */
+        &&PC_790,            /*    790 */
+        &&PC_791,            /*    791 */
+        &&PC_792,            /*    792 */
+        &&PC_793,            /*    793 */
+        &&PC_794,            /*    794 */
+        &&PC_795,            /*    795 */
+        &&PC_796,            /*    796 */
+        &&PC_797,            /*    797 */
+        &&PC_798,            /*    798 */
+        &&PC_799,            /*    799 */
+        &&PC_800,            /*    800 */
+        &&PC_801,            /*    801 */
+        &&PC_802,            /*    802 */
+        &&PC_803,            /*    803 */
+        &&PC_804,            /*    804 */
+        &&PC_805,            /*    805 */
+        &&PC_806,            /*    806 */
+        &&PC_807,            /*    807 */
+        &&PC_808,            /*    808 */
+        &&PC_809,            /*    809 */
+        &&PC_810,            /*    810 */
+        &&PC_811,            /*    811 */
+        &&PC_812,            /*    812 */
+        &&PC_813,            /*    813 */
+        &&PC_814,            /*    814 */
+        &&PC_815,            /*    815 */
+        &&PC_816,            /*    816 */
+        &&PC_817,            /*    817 */
+        &&PC_818,            /*    818 */
+        &&PC_819,            /*    819 */
+        &&PC_820,            /*    820 */
+        &&PC_821,            /*    821 */
+        &&PC_822,            /*    822 */
+        &&PC_823,            /*    823 */
+        &&PC_824,            /*    824 */
+        &&PC_825,            /*    825 */
+        &&PC_826,            /*    826 */
+        &&PC_827,            /*    827 */
+        &&PC_828,            /*    828 */
+        &&PC_829,            /*    829 */
+        &&PC_830,            /*    830 */
+        &&PC_831,            /*    831 */
+        &&PC_832,            /*    832 */
+        &&PC_833,            /*    833 */
+        &&PC_834,            /*    834 */
+        &&PC_835,            /*    835 */
+        &&PC_836,            /*    836 */
+        &&PC_837,            /*    837 */
+        &&PC_838,            /*    838 */
+        &&PC_839,            /*    839 */
+        &&PC_840,            /*    840 */
+        &&PC_841,            /*    841 */
+        &&PC_842,            /*    842 */
+        &&PC_843,            /*    843 */
+        &&PC_844,            /*    844 */
+        &&PC_845,            /*    845 */
+        &&PC_846,            /*    846 */
+        &&PC_847,            /*    847 */
+        &&PC_848,            /*    848 */
+        &&PC_849,            /*    849 */
+        &&PC_850,            /*    850 */
+        &&PC_851,            /*    851 */
+        &&PC_852,            /*    852 */
+        &&PC_853,            /*    853 */
+        &&PC_854,            /*    854 */
+        &&PC_855,            /*    855 */
+        &&PC_856,            /*    856 */
+        &&PC_857,            /*    857 */
+        &&PC_858,            /*    858 */
+        &&PC_859,            /*    859 */
+        &&PC_860,            /*    860 */
+        &&PC_861,            /*    861 */
+        &&PC_862,            /*    862 */
+        &&PC_863,            /*    863 */
+        &&PC_864,            /*    864 */
+        &&PC_865,            /*    865 */
+        &&PC_866,            /*    866 */
+        &&PC_867,            /*    867 */
+        &&PC_868,            /*    868 */
+        &&PC_869,            /*    869 */
+        &&PC_870,            /*    870 */
+        &&PC_871,            /*    871 */
+        &&PC_872,            /*    872 */
+        &&PC_873,            /*    873 */
+        &&PC_874,            /*    874 */
+        &&PC_875,            /*    875 */
+        &&PC_876,            /*    876 */
+        &&PC_877,            /*    877 */
+        &&PC_878,            /*    878 */
+        &&PC_879,            /*    879 */
+        &&PC_880,            /*    880 */
+        &&PC_881,            /*    881 */
+        &&PC_882,            /*    882 */
+        &&PC_883,            /*    883 */
+        &&PC_884,            /*    884 */
+        &&PC_885,            /*    885 */
+        &&PC_886,            /*    886 */
+        &&PC_887,            /*    887 */
+        &&PC_888,            /*    888 */
+        &&PC_889,            /*    889 */
+        &&PC_890,            /*    890 */
+        &&PC_891,            /*    891 */
+        &&PC_892,            /*    892 */
+        &&PC_893,            /*    893 */
+        &&PC_894,            /*    894 */
+        &&PC_895,            /*    895 */
+        &&PC_896,            /*    896 */
+        &&PC_897,            /*    897 */
+        &&PC_898,            /*    898 */
+        &&PC_899,            /*    899 */
+        &&PC_900,            /*    900 */
+        &&PC_901,            /*    901 */
+        &&PC_902,            /*    902 */
+        &&PC_903,            /*    903 */
+        &&PC_904,            /*    904 */
+        &&PC_905,            /*    905 */
+        &&PC_906,            /*    906 */
+        &&PC_907,            /*    907 */
+        &&PC_908,            /*    908 */
+        &&PC_909,            /*    909 */
+        &&PC_910,            /*    910 */
+        &&PC_911,            /*    911 */
+        &&PC_912,            /*    912 */
+        &&PC_913,            /*    913 */
+        &&PC_914,            /*    914 */
+        &&PC_915,            /*    915 */
+        &&PC_916,            /*    916 */
+        &&PC_917,            /*    917 */
+        &&PC_918,            /*    918 */
+        &&PC_919,            /*    919 */
+        &&PC_920,            /*    920 */
+        &&PC_921,            /*    921 */
+        &&PC_922,            /*    922 */
+        &&PC_923,            /*    923 */
+        &&PC_924,            /*    924 */
+        &&PC_925,            /*    925 */
+        &&PC_926,            /*    926 */
+        &&PC_927,            /*    927 */
+        &&PC_928,            /*    928 */
+        &&PC_929,            /*    929 */
+        &&PC_930,            /*    930 */
+        &&PC_931,            /*    931 */
+        &&PC_932,            /*    932 */
+        &&PC_933,            /*    933 */
+        &&PC_934,            /*    934 */
+        &&PC_935,            /*    935 */
+        &&PC_936,            /*    936 */
+        &&PC_937,            /*    937 */
+        &&PC_938,            /*    938 */
+        &&PC_939,            /*    939 */
+        &&PC_940,            /*    940 */
+        &&PC_941,            /*    941 */
+        &&PC_942,            /*    942 */
+        &&PC_943,            /*    943 */
+        &&PC_944,            /*    944 */
+        &&PC_945,            /*    945 */
+        &&PC_946,            /*    946 */
+        &&PC_947,            /*    947 */
+        &&PC_948,            /*    948 */
+        &&PC_949,            /*    949 */
+        &&PC_950,            /*    950 */
+        &&PC_951,            /*    951 */
+        &&PC_952,            /*    952 */
+        &&PC_953,            /*    953 */
+        &&PC_954,            /*    954 */
+        &&PC_955,            /*    955 */
+        &&PC_956,            /*    956 */
+        &&PC_957,            /*    957 */
+        &&PC_958,            /*    958 */
+        &&PC_959,            /*    959 */
+        &&PC_960,            /*    960 */
+        &&PC_961,            /*    961 */
+        &&PC_962,            /*    962 */
+        &&PC_963,            /*    963 */
+        &&PC_964,            /*    964 */
+        &&PC_965,            /*    965 */
+        &&PC_966,            /*    966 */
+        &&PC_967,            /*    967 */
+        &&PC_968,            /*    968 */
+        &&PC_969,            /*    969 */
+        &&PC_970,            /*    970 */
+        &&PC_971,            /*    971 */
+        &&PC_972,            /*    972 */
+        &&PC_973,            /*    973 */
+        &&PC_974,            /*    974 */
+        &&PC_975,            /*    975 */
+        &&PC_976,            /*    976 */
+        &&PC_977,            /*    977 */
+        &&PC_978,            /*    978 */
+        &&PC_979,            /*    979 */
+        &&PC_980,            /*    980 */
+        &&PC_981,            /*    981 */
+        &&PC_982,            /*    982 */
+        &&PC_983,            /*    983 */
+        &&PC_984,            /*    984 */
+        &&PC_985,            /*    985 */
+        &&PC_986,            /*    986 */
+        &&PC_987,            /*    987 */
+        &&PC_988,            /*    988 */
+        &&PC_989,            /*    989 */
+        &&PC_990,            /*    990 */
+        &&PC_991,            /*    991 */
+        &&PC_992,            /*    992 */
+        &&PC_993,            /*    993 */
+        &&PC_994,            /*    994 */
+        &&PC_995,            /*    995 */
+        &&PC_996,            /*    996 */
+        &&PC_997,            /*    997 */
+        &&PC_998,            /*    998 */
+        &&PC_999,            /*    999 */
+        &&PC_1000,           /*   1000 */
+        &&PC_1001,           /*   1001 */
+        &&PC_1002,           /*   1002 */
+        &&PC_1003,           /*   1003 */
+        &&PC_1004,           /*   1004 */
+        &&PC_1005,           /*   1005 */
+        &&PC_1006,           /*   1006 */
+        &&PC_1007,           /*   1007 */
+        &&PC_1008,           /*   1008 */
+        &&PC_1009,           /*   1009 */
+        &&PC_1010,           /*   1010 */
+        &&PC_1011,           /*   1011 */
+        &&PC_1012,           /*   1012 */
+        &&PC_1013,           /*   1013 */
+        &&PC_1014,           /*   1014 */
+        &&PC_1015,           /*   1015 */
+        &&PC_1016,           /*   1016 */
+        &&PC_1017,           /*   1017 */
+        &&PC_1018,           /*   1018 */
+        &&PC_1019,           /*   1019 */
+        &&PC_1020,           /*   1020 */
+        &&PC_1021,           /*   1021 */
+        &&PC_1022,           /*   1022 */
+        &&PC_1023,           /*   1023 */
+        &&PC_1024,           /*   1024 */
+        &&PC_1025,           /*   1025 */
+        &&PC_1026,           /*   1026 */
+        &&PC_1027,           /*   1027 */
+        &&PC_1028,           /*   1028 */
+        &&PC_1029,           /*   1029 */
+        &&PC_1030,           /*   1030 */
+        &&PC_1031,           /*   1031 */
+        &&PC_1032,           /*   1032 */
+        &&PC_1033,           /*   1033 */
+        &&PC_1034,           /*   1034 */
+        &&PC_1035,           /*   1035 */
+        &&PC_1036,           /*   1036 */
+        &&PC_1037,           /*   1037 */
+        &&PC_1038,           /*   1038 */
+        &&PC_1039,           /*   1039 */
+        &&PC_1040,           /*   1040 */
+        &&PC_1041,           /*   1041 */
+        &&PC_1042,           /*   1042 */
+        &&PC_1043,           /*   1043 */
+        &&PC_1044,           /*   1044 */
+        &&PC_1045,           /*   1045 */
+        &&PC_1046,           /*   1046 */
+        &&PC_1047,           /*   1047 */
+        &&PC_1048,           /*   1048 */
+        &&PC_1049,           /*   1049 */
+        &&PC_1050,           /*   1050 */
+        &&PC_1051,           /*   1051 */
+        &&PC_1052,           /*   1052 */
+        &&PC_1053,           /*   1053 */
+        &&PC_1054,           /*   1054 */
+        &&PC_1055,           /*   1055 */
+        &&PC_1056,           /*   1056 */
+        &&PC_1057,           /*   1057 */
+        &&PC_1058,           /*   1058 */
+        &&PC_1059,           /*   1059 */
+        &&PC_1060,           /*   1060 */
+        &&PC_1061,           /*   1061 */
+        &&PC_1062,           /*   1062 */
+        &&PC_1063,           /*   1063 */
+        &&PC_1064,           /*   1064 */
+        &&PC_1065,           /*   1065 */
+        &&PC_1066,           /*   1066 */
+        &&PC_1067,           /*   1067 */
+        &&PC_1068,           /*   1068 */
+        &&PC_1069,           /*   1069 */
+        &&PC_1070,           /*   1070 */
+        &&PC_1071,           /*   1071 */
+        &&PC_1072,           /*   1072 */
+        &&PC_1073,           /*   1073 */
+        &&PC_1074,           /*   1074 */
+        &&PC_1075,           /*   1075 */
+        &&PC_1076,           /*   1076 */
+        &&PC_1077,           /*   1077 */
+        &&PC_1078,           /*   1078 */
+        &&PC_1079,           /*   1079 */
+        &&PC_1080,           /*   1080 */
+        &&PC_1081,           /*   1081 */
+        &&PC_1082,           /*   1082 */
+        &&PC_1083,           /*   1083 */
+        &&PC_1084,           /*   1084 */
+        &&PC_1085,           /*   1085 */
+        &&PC_1086,           /*   1086 */
+        &&PC_1087,           /*   1087 */
+        &&PC_1088,           /*   1088 */
+        &&PC_1089,           /*   1089 */
+        &&PC_1090,           /*   1090 */
+        &&PC_1091,           /*   1091 */
+        &&PC_1092,           /*   1092 */
+        &&PC_1093,           /*   1093 */
+        &&PC_1094,           /*   1094 */
+        &&PC_1095,           /*   1095 */
+        &&PC_1096,           /*   1096 */
+        &&PC_1097,           /*   1097 */
+        &&PC_1098,           /*   1098 */
+        &&PC_1099,           /*   1099 */
+        &&PC_1100,           /*   1100 */
+        &&PC_1101,           /*   1101 */
+        &&PC_1102,           /*   1102 */
+        &&PC_1103,           /*   1103 */
+        &&PC_1104,           /*   1104 */
+        &&PC_1105,           /*   1105 */
+        &&PC_1106,           /*   1106 */
+        &&PC_1107,           /*   1107 */
+        &&PC_1108,           /*   1108 */
+        &&PC_1109,           /*   1109 */
+        &&PC_1110,           /*   1110 */
+        &&PC_1111,           /*   1111 */
+        &&PC_1112,           /*   1112 */
+        &&PC_1113,           /*   1113 */
+        &&PC_1114,           /*   1114 */
+        &&PC_1115,           /*   1115 */
+        &&PC_1116,           /*   1116 */
+        &&PC_1117,           /*   1117 */
+        &&PC_1118,           /*   1118 */
+        &&PC_1119,           /*   1119 */
+        &&PC_1120,           /*   1120 */
+        &&PC_1121,           /*   1121 */
+        &&PC_1122,           /*   1122 */
+        &&PC_1123,           /*   1123 */
+        &&PC_1124,           /*   1124 */
+        &&PC_1125,           /*   1125 */
+        &&PC_1126,           /*   1126 */
+        &&PC_1127,           /*   1127 */
+        &&PC_1128,           /*   1128 */
+        &&PC_1129,           /*   1129 */
+        &&PC_1130,           /*   1130 */
+        &&cg_decode,
+        &&cg_dynop
+    };
+
+    union {
+        void     **labels;
+        opcode_t  *pc;
+    } cg_table;
+    PackFile_ByteCode *cg_seg;
+    void             **cg_threaded;
+    opcode_t          *cg_base;
+
+    /* Handed out through a union, as a cast would pun the label table */
+    if (cur_opcode == NULL) {
+        cg_table.labels = cg_labels;
+        return cg_table.pc;
+    }
+
+    cg_seg      = interp->code;
+    cg_threaded = cg_seg->threaded_code;
+    cg_base     = cg_seg->base.data;
+    CG_NEXT();
+
+  cg_decode:
+    {
+        /* first visit of this op: replace the threaded code entry with the
+         * label of the op, or with the dynop trampoline */
+        const op_info_t * const info = cg_seg->op_info_table[*cur_opcode];
+        void           ** const slot = cg_threaded + (cur_opcode - cg_base);
+
+        *slot = info->lib == &core_op_lib
+              ? cg_labels[OP_INFO_OPNUM(info)]
+              : &&cg_dynop;
+        goto **slot;
+    }
+
+  cg_dynop:
+    cur_opcode = (cg_seg->op_func_table[*cur_opcode])(cur_opcode, interp);
+    CG_JUMP();
+
+PC_0: /* end */
+{
+    UNUSED(interp);
+    UNUSED(cur_opcode);
+    do { cur_opcode = (opcode_t *)(0); CG_JUMP(); } while (0);
+}
+
+PC_1: /* noop */
+{
+    UNUSED(interp);
+    do { cur_opcode += 1; CG_NEXT(); } while (0);
+}
+
+PC_2: /* check_events */
+{
+    opcode_t  * next =  cur_opcode + 1;
+
+    next = Parrot_cx_check_scheduler(interp, next);
+    do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+}
+
+PC_3: /* check_events__ */
+{
+    opcode_t  * const  _this = CUR_OPCODE;
+    opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, _this, EXCEPTION_INVALID_OPERATION, "check_events__ opcode doesn't do anything useful.");
+
+    do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    Parrot_runcore_disable_event_checking(interp);
+    do { cur_opcode = (opcode_t *)(_this); CG_JUMP(); } while (0);
+}
+
+PC_4: /* load_bytecode_s */
+{
+    Parrot_load_bytecode(interp, SREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_5: /* load_bytecode_sc */
+{
+    Parrot_load_bytecode(interp, SCONST(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_6: /* load_bytecode_p_s */
+{
+    PREG(1) = Parrot_pf_load_bytecode_search(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_7: /* load_bytecode_p_sc */
+{
+    PREG(1) = Parrot_pf_load_bytecode_search(interp, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_8: /* load_language_s */
+{
+    Parrot_load_language(interp, SREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_9: /* load_language_sc */
+{
+    Parrot_load_language(interp, SCONST(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_10: /* branch_i */
+{
+    if ((Parrot_cx_check_scheduler(interp, (cur_opcode + IREG(1))) == 0)) {
+        do { cur_opcode = (opcode_t *)(0); CG_JUMP(); } while (0);
+    }
+
+    do { cur_opcode += IREG(1); CG_BRANCH(); } while (0);
+}
+
+PC_11: /* branch_ic */
+{
+    if ((Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(1))) == 0)) {
+        do { cur_opcode = (opcode_t *)(0); CG_JUMP(); } while (0);
+    }
+
+    do { cur_opcode += ICONST(1); CG_BRANCH(); } while (0);
+}
+
+PC_12: /* local_branch_p_i */
+{
+    INTVAL   return_addr;
+    opcode_t  * const  dest =  cur_opcode + 3;
+
+    if ((PMC_IS_NULL(PREG(1)) || (PREG(1)->vtable->base_type != enum_class_ResizableIntegerArray))) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_INVALID_OPERATION, "Must pass a valid integer array to 'local_branch'");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    (return_addr) = PTR2INTVAL(dest);
+    VTABLE_push_integer(interp, PREG(1), (return_addr));
+    do { cur_opcode += IREG(2); CG_BRANCH(); } while (0);
+}
+
+PC_13: /* local_branch_p_ic */
+{
+    INTVAL   return_addr;
+    opcode_t  * const  dest =  cur_opcode + 3;
+
+    if ((PMC_IS_NULL(PREG(1)) || (PREG(1)->vtable->base_type != enum_class_ResizableIntegerArray))) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_INVALID_OPERATION, "Must pass a valid integer array to 'local_branch'");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    (return_addr) = PTR2INTVAL(dest);
+    VTABLE_push_integer(interp, PREG(1), (return_addr));
+    do { cur_opcode += ICONST(2); CG_BRANCH(); } while (0);
+}
+
+PC_14: /* local_return_p */
+{
+    INTVAL   return_addr;
+    opcode_t  * next;
+    opcode_t  * const  dest =  cur_opcode + 2;
+
+    if ((PMC_IS_NULL(PREG(1)) || (PREG(1)->vtable->base_type != enum_class_ResizableIntegerArray))) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_INVALID_OPERATION, "Must pass a valid integer array to 'local_return'");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    (return_addr) = VTABLE_pop_integer(interp, PREG(1));
+    next = INTVAL2PTR(opcode_t *, (return_addr));
+    if ((!(((next >= interp->code->base.data) && (next < ((interp->code->base.data + interp->code->base.size))))))) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_INVALID_OPERATION, "Address for 'local_return' must be within the current code segment");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+}
+
+PC_15: /* jump_i */
+{
+    opcode_t  * const  loc = INTVAL2PTR(opcode_t *, IREG(1));
+
+    do { cur_opcode = (opcode_t *)(loc); CG_JUMP(); } while (0);
+}
+
+PC_16: /* jump_ic */
+{
+    opcode_t  * const  loc = INTVAL2PTR(opcode_t *, ICONST(1));
+
+    do { cur_opcode = (opcode_t *)(loc); CG_JUMP(); } while (0);
+}
+
+PC_17: /* if_i_ic */
+{
+    if ((IREG(1) != 0)) {
+        do { cur_opcode += ICONST(2); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_18: /* if_n_ic */
+{
+    if ((!FLOAT_IS_ZERO(NREG(1)))) {
+        do { cur_opcode += ICONST(2); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_19: /* if_s_ic */
+{
+    if (Parrot_str_boolean(interp, SREG(1))) {
+        do { cur_opcode += ICONST(2); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_20: /* if_p_ic */
+{
+    if (VTABLE_get_bool(interp, PREG(1))) {
+        do { cur_opcode += ICONST(2); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_21: /* unless_i_ic */
+{
+    if ((IREG(1) == 0)) {
+        do { cur_opcode += ICONST(2); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_22: /* unless_n_ic */
+{
+    if (FLOAT_IS_ZERO(NREG(1))) {
+        do { cur_opcode += ICONST(2); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_23: /* unless_s_ic */
+{
+    if ((!Parrot_str_boolean(interp, SREG(1)))) {
+        do { cur_opcode += ICONST(2); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_24: /* unless_p_ic */
+{
+    if ((!VTABLE_get_bool(interp, PREG(1)))) {
+        do { cur_opcode += ICONST(2); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_25: /* invokecc_p */
+{
+    PMC       * const  p = PREG(1);
+    opcode_t  * dest =  cur_opcode + 2;
+    PMC       * const  signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), dest);
+    Parrot_pcc_reuse_continuation(interp, CURRENT_CONTEXT(interp), dest);
+    dest = VTABLE_invoke(interp, p, dest);
+    do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+}
+
+PC_26: /* invoke_p_p */
+{
+    opcode_t    * dest =  cur_opcode + 3;
+    PMC  * const  p = PREG(1);
+    PMC  * const  signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), dest);
+    interp->current_cont = PREG(2);
+    dest = VTABLE_invoke(interp, p, dest);
+    do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+}
+
+PC_27: /* yield */
+{
+    opcode_t    * dest =  cur_opcode + 1;
+    PMC  * const  p = Parrot_pcc_get_sub(interp, CURRENT_CONTEXT(interp));
+
+    VTABLE_increment(interp, p);
+    dest = VTABLE_invoke(interp, p, dest);
+    do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+}
+
+PC_28: /* tailcall_p */
+{
+    PMC  * const  p = PREG(1);
+    opcode_t    * dest =  cur_opcode + 2;
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+    PMC  * const  parent_ctx = Parrot_pcc_get_caller_ctx(interp, ctx);
+    PMC  * const  this_call_sig = Parrot_pcc_get_signature(interp, ctx);
+    PMC  * const  parent_call_sig = Parrot_pcc_get_signature(interp, parent_ctx);
+
+    interp->current_cont = Parrot_pcc_get_continuation(interp, ctx);
+    Parrot_pcc_merge_signature_for_tailcall(interp, parent_call_sig, this_call_sig);
+    SUB_FLAG_TAILCALL_SET(interp->current_cont);
+    dest = VTABLE_invoke(interp, p, dest);
+    do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+}
+
+PC_29: /* returncc */
+{
+    PMC  * const  p = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
+    opcode_t  * const  dest = VTABLE_invoke(interp, p,  cur_opcode + 1);
+
+    do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+}
+
+PC_30: /* capture_lex_p */
+{
+    Parrot_sub_capture_lex(interp, PREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_31: /* newclosure_p_p */
+{
+    PREG(1) = Parrot_sub_new_closure(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_32: /* set_args_pc */
+{
+    opcode_t  * const  raw_args = CUR_OPCODE;
+    PMC  * const  signature = PCONST(1);
+    PMC  * const  call_sig = Parrot_pcc_build_sig_object_from_op(interp, PMCNULL, signature, raw_args);
+    INTVAL   argc;
+
+    GETATTR_FixedIntegerArray_size(interp, signature, argc);
+    Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), call_sig);
+    do { cur_opcode += (argc + 2); CG_BRANCH(); } while (0);
+}
+
+PC_33: /* get_params_pc */
+{
+    opcode_t  * const  raw_params = CUR_OPCODE;
+    PMC       * const  signature = PCONST(1);
+    PMC       * const  ctx = CURRENT_CONTEXT(interp);
+    PMC       * const  ccont = Parrot_pcc_get_continuation(interp, ctx);
+    PMC       * const  caller_ctx = Parrot_pcc_get_caller_ctx(interp, ctx);
+    PMC       * const  call_object = Parrot_pcc_get_signature(interp, caller_ctx);
+    INTVAL   argc;
+
+    Parrot_pcc_fill_params_from_op(interp, call_object, signature, raw_params, PARROT_ERRORS_PARAM_COUNT_FLAG);
+    if ((PObj_get_FLAGS(ccont) & SUB_FLAG_TAILCALL)) {
+        (PObj_get_FLAGS(ccont) &= (~SUB_FLAG_TAILCALL));
+        Parrot_pcc_dec_recursion_depth(interp, ctx);
+        Parrot_pcc_set_caller_ctx(interp, ctx, Parrot_pcc_get_caller_ctx(interp, caller_ctx));
+    }
+
+    GETATTR_FixedIntegerArray_size(interp, signature, argc);
+    do { cur_opcode += (argc + 2); CG_BRANCH(); } while (0);
+}
+
+PC_34: /* set_returns_pc */
+{
+    opcode_t  * const  raw_args = CUR_OPCODE;
+    PMC       * const  signature = PCONST(1);
+    PMC       * const  call_sig = Parrot_pcc_build_sig_object_from_op(interp, Parrot_pcc_get_signature(interp, Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp))), signature, raw_args);
+    INTVAL   argc;
+
+    Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), call_sig);
+    GETATTR_FixedIntegerArray_size(interp, signature, argc);
+    do { cur_opcode += (argc + 2); CG_BRANCH(); } while (0);
+}
+
+PC_35: /* get_results_pc */
+{
+    opcode_t  * const  raw_params = CUR_OPCODE;
+    PMC       * const  signature = PCONST(1);
+    PMC       * const  ctx = CURRENT_CONTEXT(interp);
+    PMC       * const  call_object = Parrot_pcc_get_signature(interp, ctx);
+    INTVAL   argc;
+
+    Parrot_pcc_fill_params_from_op(interp, call_object, signature, raw_params, PARROT_ERRORS_RESULT_COUNT_FLAG);
+    GETATTR_FixedIntegerArray_size(interp, signature, argc);
+    Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), PMCNULL);
+    do { cur_opcode += (argc + 2); CG_BRANCH(); } while (0);
+}
+
+PC_36: /* set_result_info_p */
+{
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+
+    VTABLE_set_attr_str(interp, ctx, Parrot_str_new_constant(interp, "return_flags"), PREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_37: /* set_result_info_pc */
+{
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+
+    VTABLE_set_attr_str(interp, ctx, Parrot_str_new_constant(interp, "return_flags"), PCONST(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_38: /* result_info_p */
+{
+    PMC  * const  caller_ctx = Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
+    PMC  * const  sig = VTABLE_get_attr_str(interp, caller_ctx, Parrot_str_new_constant(interp, "return_flags"));
+
+    if ((!sig)) {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_FixedIntegerArray);
+    }
+    else {
+        PREG(1) = sig;
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_39: /* set_addr_i_ic */
+{
+    IREG(1) = PTR2INTVAL((CUR_OPCODE + ICONST(2)));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_40: /* set_addr_p_ic */
+{
+    VTABLE_set_pointer(interp, PREG(1), ((CUR_OPCODE + ICONST(2))));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_41: /* set_addr_p_i */
+{
+    VTABLE_set_pointer(interp, PREG(1), (void*)IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_42: /* get_addr_i_p */
+{
+    void  * const  ptr = VTABLE_get_pointer(interp, PREG(2));
+
+    IREG(1) = (INTVAL)ptr;
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_43: /* schedule_p */
+{
+    Parrot_cx_schedule_task(interp, PREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_44: /* addhandler_p */
+{
+    Parrot_cx_add_handler(interp, PREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_45: /* push_eh_ic */
+{
+    PMC  * const  eh = Parrot_pmc_new(interp, enum_class_ExceptionHandler);
+
+    VTABLE_set_pointer(interp, eh, (CUR_OPCODE + ICONST(1)));
+    Parrot_cx_add_handler_local(interp, eh);
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_46: /* push_eh_p */
+{
+    Parrot_cx_add_handler_local(interp, PREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_47: /* pop_eh */
+{
+    Parrot_cx_delete_handler_local(interp);
+    do { cur_opcode += 1; CG_NEXT(); } while (0);
+}
+
+PC_48: /* throw_p */
+{
+    PMC  *  except = PREG(1);
+    opcode_t  * dest;
+    opcode_t  * const  ret =  cur_opcode + 2;
+    PMC       * const  resume = Parrot_pmc_new(interp, enum_class_Continuation);
+    STRING  * const  exception_str = Parrot_str_new_constant(interp, "Exception");
+
+    VTABLE_set_pointer(interp, resume, ret);
+    if ((PMC_IS_NULL(except) || (!VTABLE_does(interp, except, exception_str)))) {
+        except = Parrot_ex_build_exception(interp, EXCEPT_fatal, EXCEPTION_UNIMPLEMENTED, Parrot_str_new_constant(interp, "Not a throwable object"));
+    }
+
+    VTABLE_set_attr_str(interp, except, Parrot_str_new_constant(interp, "resume"), resume);
+    dest = Parrot_ex_throw_from_op(interp, except, ret);
+    do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+}
+
+PC_49: /* throw_p_p */
+{
+    opcode_t  *  dest;
+    PMC  *  except = PREG(1);
+    STRING  * const  exception_str = Parrot_str_new_constant(interp, "Exception");
+
+    if ((PMC_IS_NULL(except) || (!VTABLE_does(interp, except, exception_str)))) {
+        except = Parrot_ex_build_exception(interp, EXCEPT_fatal, EXCEPTION_UNIMPLEMENTED, Parrot_str_new_constant(interp, "Not a throwable object"));
+    }
+
+    dest = Parrot_ex_throw_from_op(interp, PREG(1), VTABLE_get_pointer(interp, PREG(2)));
+    do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+}
+
+PC_50: /* rethrow_p */
+{
+    opcode_t  *  dest;
+    PMC  *  except = PREG(1);
+    STRING  * const  exception_str = Parrot_str_new_constant(interp, "Exception");
+
+    if ((PMC_IS_NULL(except) || (!VTABLE_does(interp, except, exception_str)))) {
+        opcode_t  * const  ret =  cur_opcode + 2;
+
+        except = Parrot_ex_build_exception(interp, EXCEPT_fatal, EXCEPTION_UNIMPLEMENTED, Parrot_str_new_constant(interp, "Not a throwable object"));
+        dest = Parrot_ex_throw_from_op(interp, except, ret);
+        do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+    }
+
+    dest = Parrot_ex_rethrow_from_op(interp, except);
+    do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+}
+
+PC_51: /* count_eh_i */
+{
+    IREG(1) = Parrot_cx_count_handlers_local(interp);
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_52: /* die_s */
+{
+    opcode_t         * dest;
+    opcode_t  * const  ret =  cur_opcode + 2;
+    PMC       * const  resume = Parrot_pmc_new(interp, enum_class_Continuation);
+    PMC       * const  exception = Parrot_ex_build_exception(interp, EXCEPT_error, EXCEPTION_DIE, SREG(1));
+
+    VTABLE_set_pointer(interp, resume, ret);
+    VTABLE_set_attr_str(interp, exception, Parrot_str_new_constant(interp, "resume"), resume);
+    dest = Parrot_ex_throw_from_op(interp, exception, ret);
+    do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+}
+
+PC_53: /* die_sc */
+{
+    opcode_t         * dest;
+    opcode_t  * const  ret =  cur_opcode + 2;
+    PMC       * const  resume = Parrot_pmc_new(interp, enum_class_Continuation);
+    PMC       * const  exception = Parrot_ex_build_exception(interp, EXCEPT_error, EXCEPTION_DIE, SCONST(1));
+
+    VTABLE_set_pointer(interp, resume, ret);
+    VTABLE_set_attr_str(interp, exception, Parrot_str_new_constant(interp, "resume"), resume);
+    dest = Parrot_ex_throw_from_op(interp, exception, ret);
+    do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+}
+
+PC_54: /* die_p */
+{
+    opcode_t         * dest;
+    opcode_t  * const  ret =  cur_opcode + 2;
+    PMC       * const  resume = Parrot_pmc_new(interp, enum_class_Continuation);
+    STRING    * const  msg = PMC_IS_NULL(PREG(1)) ? NULL : VTABLE_get_string(interp, PREG(1));
+    PMC       * const  exception = Parrot_ex_build_exception(interp, EXCEPT_error, EXCEPTION_DIE, msg);
+
+    VTABLE_set_pointer(interp, resume, ret);
+    VTABLE_set_attr_str(interp, exception, Parrot_str_new_constant(interp, "resume"), resume);
+    dest = Parrot_ex_throw_from_op(interp, exception, ret);
+    do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+}
+
+PC_55: /* die_pc */
+{
+    opcode_t         * dest;
+    opcode_t  * const  ret =  cur_opcode + 2;
+    PMC       * const  resume = Parrot_pmc_new(interp, enum_class_Continuation);
+    STRING    * const  msg = PMC_IS_NULL(PCONST(1)) ? NULL : VTABLE_get_string(interp, PCONST(1));
+    PMC       * const  exception = Parrot_ex_build_exception(interp, EXCEPT_error, EXCEPTION_DIE, msg);
+
+    VTABLE_set_pointer(interp, resume, ret);
+    VTABLE_set_attr_str(interp, exception, Parrot_str_new_constant(interp, "resume"), resume);
+    dest = Parrot_ex_throw_from_op(interp, exception, ret);
+    do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+}
+
+PC_56: /* die_i_i */
+{
+    if ((IREG(1) == EXCEPT_doomed)) {
+        Parrot_x_jump_out(interp, IREG(2));
+    }
+    else {
+        opcode_t         * dest;
+        opcode_t  * const  ret =  cur_opcode + 3;
+        PMC       * const  resume = Parrot_pmc_new(interp, enum_class_Continuation);
+        PMC       * const  exception = Parrot_ex_build_exception(interp, IREG(1), IREG(2), NULL);
+
+        VTABLE_set_pointer(interp, resume, ret);
+        VTABLE_set_attr_str(interp, exception, Parrot_str_new_constant(interp, "resume"), resume);
+        dest = Parrot_ex_throw_from_op(interp, exception, ret);
+        do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_57: /* die_ic_i */
+{
+    if ((ICONST(1) == EXCEPT_doomed)) {
+        Parrot_x_jump_out(interp, IREG(2));
+    }
+    else {
+        opcode_t         * dest;
+        opcode_t  * const  ret =  cur_opcode + 3;
+        PMC       * const  resume = Parrot_pmc_new(interp, enum_class_Continuation);
+        PMC       * const  exception = Parrot_ex_build_exception(interp, ICONST(1), IREG(2), NULL);
+
+        VTABLE_set_pointer(interp, resume, ret);
+        VTABLE_set_attr_str(interp, exception, Parrot_str_new_constant(interp, "resume"), resume);
+        dest = Parrot_ex_throw_from_op(interp, exception, ret);
+        do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_58: /* die_i_ic */
+{
+    if ((IREG(1) == EXCEPT_doomed)) {
+        Parrot_x_jump_out(interp, ICONST(2));
+    }
+    else {
+        opcode_t         * dest;
+        opcode_t  * const  ret =  cur_opcode + 3;
+        PMC       * const  resume = Parrot_pmc_new(interp, enum_class_Continuation);
+        PMC       * const  exception = Parrot_ex_build_exception(interp, IREG(1), ICONST(2), NULL);
+
+        VTABLE_set_pointer(interp, resume, ret);
+        VTABLE_set_attr_str(interp, exception, Parrot_str_new_constant(interp, "resume"), resume);
+        dest = Parrot_ex_throw_from_op(interp, exception, ret);
+        do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_59: /* die_ic_ic */
+{
+    if ((ICONST(1) == EXCEPT_doomed)) {
+        Parrot_x_jump_out(interp, ICONST(2));
+    }
+    else {
+        opcode_t         * dest;
+        opcode_t  * const  ret =  cur_opcode + 3;
+        PMC       * const  resume = Parrot_pmc_new(interp, enum_class_Continuation);
+        PMC       * const  exception = Parrot_ex_build_exception(interp, ICONST(1), ICONST(2), NULL);
+
+        VTABLE_set_pointer(interp, resume, ret);
+        VTABLE_set_attr_str(interp, exception, Parrot_str_new_constant(interp, "resume"), resume);
+        dest = Parrot_ex_throw_from_op(interp, exception, ret);
+        do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_60: /* exit_i */
+{
+    opcode_t         * dest;
+    opcode_t  * const  ret =  cur_opcode + 2;
+    PMC       * const  resume = Parrot_pmc_new(interp, enum_class_Continuation);
+    PMC       * const  exception = Parrot_ex_build_exception(interp, EXCEPT_exit, CONTROL_EXIT, NULL);
+
+    VTABLE_set_pointer(interp, resume, ret);
+    VTABLE_set_attr_str(interp, exception, Parrot_str_new_constant(interp, "resume"), resume);
+    VTABLE_set_integer_keyed_str(interp, exception, Parrot_str_new_constant(interp, "exit_code"), IREG(1));
+    dest = Parrot_ex_throw_from_op(interp, exception, ret);
+    do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+}
+
+PC_61: /* exit_ic */
+{
+    opcode_t         * dest;
+    opcode_t  * const  ret =  cur_opcode + 2;
+    PMC       * const  resume = Parrot_pmc_new(interp, enum_class_Continuation);
+    PMC       * const  exception = Parrot_ex_build_exception(interp, EXCEPT_exit, CONTROL_EXIT, NULL);
+
+    VTABLE_set_pointer(interp, resume, ret);
+    VTABLE_set_attr_str(interp, exception, Parrot_str_new_constant(interp, "resume"), resume);
+    VTABLE_set_integer_keyed_str(interp, exception, Parrot_str_new_constant(interp, "exit_code"), ICONST(1));
+    dest = Parrot_ex_throw_from_op(interp, exception, ret);
+    do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+}
+
+PC_62: /* finalize_p */
+{
+    opcode_t  * const  dest =  cur_opcode + 2;
+    PMC  * eh = Parrot_ex_get_current_handler(interp, PREG(1));
+
+    if ((!PMC_IS_NULL(eh))) {
+        Parrot_runloop  * rl = interp->current_runloop;
+        INTVAL   rid;
+
+        if ((eh->vtable->base_type == enum_class_ExceptionHandler)) {
+            GETATTR_ExceptionHandler_runloop_id(interp, eh, rid);
+        }
+        else {
+            Parrot_pcc_invoke_method_from_c_args(interp, eh, Parrot_str_new_constant(interp, "rid"), "->I", (&rid));
+        }
+
+        while ((rl && (rl->id != rid))) {
+            rl = rl->prev;
+        }
+
+        if (rl) {
+            if ((rl != interp->current_runloop)) {
+                rl->handler_start = dest;
+                longjmp(rl->resume, PARROT_JMP_EXCEPTION_FINALIZED);
+            }
+
+        }
+        else {
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "missing runloop");
+        }
+
+    }
+
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_63: /* finalize_pc */
+{
+    opcode_t  * const  dest =  cur_opcode + 2;
+    PMC  * eh = Parrot_ex_get_current_handler(interp, PCONST(1));
+
+    if ((!PMC_IS_NULL(eh))) {
+        Parrot_runloop  * rl = interp->current_runloop;
+        INTVAL   rid;
+
+        if ((eh->vtable->base_type == enum_class_ExceptionHandler)) {
+            GETATTR_ExceptionHandler_runloop_id(interp, eh, rid);
+        }
+        else {
+            Parrot_pcc_invoke_method_from_c_args(interp, eh, Parrot_str_new_constant(interp, "rid"), "->I", (&rid));
+        }
+
+        while ((rl && (rl->id != rid))) {
+            rl = rl->prev;
+        }
+
+        if (rl) {
+            if ((rl != interp->current_runloop)) {
+                rl->handler_start = dest;
+                longjmp(rl->resume, PARROT_JMP_EXCEPTION_FINALIZED);
+            }
+
+        }
+        else {
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "missing runloop");
+        }
+
+    }
+
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_64: /* pop_upto_eh_p */
+{
+    PMC  * eh = Parrot_ex_get_current_handler(interp, PREG(1));
+
+    if ((!PMC_IS_NULL(eh))) {
+        Parrot_cx_delete_upto_handler_local(interp, eh);
+    }
+
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_65: /* pop_upto_eh_pc */
+{
+    PMC  * eh = Parrot_ex_get_current_handler(interp, PCONST(1));
+
+    if ((!PMC_IS_NULL(eh))) {
+        Parrot_cx_delete_upto_handler_local(interp, eh);
+    }
+
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_66: /* peek_exception_p */
+{
+    PMC       * const  ctx = CURRENT_CONTEXT(interp);
+    PMC       * const  call_object = Parrot_pcc_get_signature(interp, ctx);
+
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, call_object, 0);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_67: /* debug_i */
+{
+    if ((IREG(1) != 0)) {
+        Interp_debug_SET(interp, IREG(1));
+    }
+    else {
+        Interp_debug_CLEAR(interp, PARROT_ALL_DEBUG_FLAGS);
+    }
+
+            interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;;
+        do { cur_opcode = (opcode_t *)(0); CG_JUMP(); } while (0);
+;
+}
+
+PC_68: /* debug_ic */
+{
+    if ((ICONST(1) != 0)) {
+        Interp_debug_SET(interp, ICONST(1));
+    }
+    else {
+        Interp_debug_CLEAR(interp, PARROT_ALL_DEBUG_FLAGS);
+    }
+
+            interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;;
+        do { cur_opcode = (opcode_t *)(0); CG_JUMP(); } while (0);
+;
+}
+
+PC_69: /* bounds_i */
+{
+    if ((IREG(1) != 0)) {
+        Parrot_interp_set_flag(interp, PARROT_BOUNDS_FLAG);
+    }
+    else {
+        Interp_flags_CLEAR(interp, PARROT_BOUNDS_FLAG);
+    }
+
+            interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;;
+        do { cur_opcode = (opcode_t *)(0); CG_JUMP(); } while (0);
+;
+}
+
+PC_70: /* bounds_ic */
+{
+    if ((ICONST(1) != 0)) {
+        Parrot_interp_set_flag(interp, PARROT_BOUNDS_FLAG);
+    }
+    else {
+        Interp_flags_CLEAR(interp, PARROT_BOUNDS_FLAG);
+    }
+
+            interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;;
+        do { cur_opcode = (opcode_t *)(0); CG_JUMP(); } while (0);
+;
+}
+
+PC_71: /* profile_i */
+{
+    if ((IREG(1) != 0)) {
+        Parrot_interp_set_flag(interp, PARROT_PROFILE_FLAG);
+    }
+    else {
+        Interp_flags_CLEAR(interp, PARROT_PROFILE_FLAG);
+    }
+
+            interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;;
+        do { cur_opcode = (opcode_t *)(0); CG_JUMP(); } while (0);
+;
+}
+
+PC_72: /* profile_ic */
+{
+    if ((ICONST(1) != 0)) {
+        Parrot_interp_set_flag(interp, PARROT_PROFILE_FLAG);
+    }
+    else {
+        Interp_flags_CLEAR(interp, PARROT_PROFILE_FLAG);
+    }
+
+            interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;;
+        do { cur_opcode = (opcode_t *)(0); CG_JUMP(); } while (0);
+;
+}
+
+PC_73: /* trace_i */
+{
+    if ((IREG(1) != 0)) {
+        Parrot_interp_set_trace(interp, IREG(1));
+    }
+    else {
+        Parrot_interp_clear_trace(interp, PARROT_ALL_TRACE_FLAGS);
+    }
+
+            interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;;
+        do { cur_opcode = (opcode_t *)(0); CG_JUMP(); } while (0);
+;
+}
+
+PC_74: /* trace_ic */
+{
+    if ((ICONST(1) != 0)) {
+        Parrot_interp_set_trace(interp, ICONST(1));
+    }
+    else {
+        Parrot_interp_clear_trace(interp, PARROT_ALL_TRACE_FLAGS);
+    }
+
+            interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;;
+        do { cur_opcode = (opcode_t *)(0); CG_JUMP(); } while (0);
+;
+}
+
+PC_75: /* gc_debug_i */
+{
+    if ((IREG(1) != 0)) {
+        Interp_flags_SET(interp, PARROT_GC_DEBUG_FLAG);
+    }
+    else {
+        Interp_flags_CLEAR(interp, PARROT_GC_DEBUG_FLAG);
+    }
+
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_76: /* gc_debug_ic */
+{
+    if ((ICONST(1) != 0)) {
+        Interp_flags_SET(interp, PARROT_GC_DEBUG_FLAG);
+    }
+    else {
+        Interp_flags_CLEAR(interp, PARROT_GC_DEBUG_FLAG);
+    }
+
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_77: /* interpinfo_i_i */
+{
+    IREG(1) = Parrot_interp_info(interp, IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_78: /* interpinfo_i_ic */
+{
+    IREG(1) = Parrot_interp_info(interp, ICONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_79: /* interpinfo_p_i */
+{
+    PREG(1) = Parrot_interp_info_p(interp, IREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_80: /* interpinfo_p_ic */
+{
+    PREG(1) = Parrot_interp_info_p(interp, ICONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_81: /* interpinfo_s_i */
+{
+    STRING  * const  s = Parrot_interp_info_s(interp, IREG(2));
+
+    SREG(1) = s;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_82: /* interpinfo_s_ic */
+{
+    STRING  * const  s = Parrot_interp_info_s(interp, ICONST(2));
+
+    SREG(1) = s;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_83: /* warningson_i */
+{
+    PARROT_WARNINGS_on(interp, IREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_84: /* warningson_ic */
+{
+    PARROT_WARNINGS_on(interp, ICONST(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_85: /* warningsoff_i */
+{
+    PARROT_WARNINGS_off(interp, IREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_86: /* warningsoff_ic */
+{
+    PARROT_WARNINGS_off(interp, ICONST(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_87: /* errorson_i */
+{
+    PARROT_ERRORS_on(interp, IREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_88: /* errorson_ic */
+{
+    PARROT_ERRORS_on(interp, ICONST(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_89: /* errorsoff_i */
+{
+    PARROT_ERRORS_off(interp, IREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_90: /* errorsoff_ic */
+{
+    PARROT_ERRORS_off(interp, ICONST(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_91: /* set_runcore_s */
+{
+    Parrot_runcore_switch(interp, SREG(1));
+            interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;;
+        do { cur_opcode = (opcode_t *)(0); CG_JUMP(); } while (0);
+;
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_92: /* set_runcore_sc */
+{
+    Parrot_runcore_switch(interp, SCONST(1));
+            interp->resume_offset = REL_PC + 2; interp->resume_flag = 1;;
+        do { cur_opcode = (opcode_t *)(0); CG_JUMP(); } while (0);
+;
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_93: /* runinterp_p_i */
+{
+    Interp  * const  new_interp = (Interp *)VTABLE_get_pointer(interp, PREG(1));
+
+    Interp_flags_SET(new_interp, PARROT_EXTERN_CODE_FLAG);
+    Parrot_switch_to_cs(new_interp, interp->code, 1);
+    runops(new_interp, (REL_PC + IREG(2)));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_94: /* runinterp_p_ic */
+{
+    Interp  * const  new_interp = (Interp *)VTABLE_get_pointer(interp, PREG(1));
+
+    Interp_flags_SET(new_interp, PARROT_EXTERN_CODE_FLAG);
+    Parrot_switch_to_cs(new_interp, interp->code, 1);
+    runops(new_interp, (REL_PC + ICONST(2)));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_95: /* getinterp_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, interp->iglobals, IGLOBALS_INTERPRETER);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_96: /* sweep_ic */
+{
+    if (ICONST(1)) {
+        Parrot_gc_mark_and_sweep(interp, GC_trace_normal_FLAG);
+    }
+    else {
+        if (Parrot_gc_impatient_pmcs(interp)) {
+            Parrot_gc_mark_and_sweep(interp, GC_lazy_FLAG);
+        }
+
+    }
+
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_97: /* collect */
+{
+    Parrot_gc_compact_memory_pool(interp);
+    do { cur_opcode += 1; CG_NEXT(); } while (0);
+}
+
+PC_98: /* sweepoff */
+{
+    Parrot_block_GC_mark(interp);
+    do { cur_opcode += 1; CG_NEXT(); } while (0);
+}
+
+PC_99: /* sweepon */
+{
+    Parrot_unblock_GC_mark(interp);
+    do { cur_opcode += 1; CG_NEXT(); } while (0);
+}
+
+PC_100: /* collectoff */
+{
+    Parrot_block_GC_sweep(interp);
+    do { cur_opcode += 1; CG_NEXT(); } while (0);
+}
+
+PC_101: /* collecton */
+{
+    Parrot_unblock_GC_sweep(interp);
+    do { cur_opcode += 1; CG_NEXT(); } while (0);
+}
+
+PC_102: /* needs_destroy_p */
+{
+    Parrot_gc_pmc_needs_early_collection(interp, PREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_103: /* loadlib_p_s */
+{
+    PREG(1) = Parrot_dyn_load_lib(interp, SREG(2), NULL);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_104: /* loadlib_p_sc */
+{
+    PREG(1) = Parrot_dyn_load_lib(interp, SCONST(2), NULL);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_105: /* loadlib_p_s_p */
+{
+    PREG(1) = Parrot_dyn_load_lib(interp, SREG(2), PREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_106: /* loadlib_p_sc_p */
+{
+    PREG(1) = Parrot_dyn_load_lib(interp, SCONST(2), PREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_107: /* loadlib_p_s_pc */
+{
+    PREG(1) = Parrot_dyn_load_lib(interp, SREG(2), PCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_108: /* loadlib_p_sc_pc */
+{
+    PREG(1) = Parrot_dyn_load_lib(interp, SCONST(2), PCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_109: /* dlfunc_p_p_s_s */
+{
+    void          * dl_handle = NULL;
+    void          * ptr;
+    funcptr_t       p;
+
+    if ((((!PMC_IS_NULL(PREG(2))) && (PREG(2)->vtable->base_type == enum_class_ParrotLibrary)) && VTABLE_defined(interp, PREG(2)))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    ptr = Parrot_dyn_dlsym_str(interp, dl_handle, SREG(3));
+    p = D2FPTR(ptr);
+    if ((p == NULLfunc)) {
+        const char  * const  err = Parrot_dlerror();
+
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG, "Symbol '%Ss' not found: %s\n", SREG(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_NCI);
+        VTABLE_set_pointer_keyed_str(interp, PREG(1), SREG(4), F2DPTR(p));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_110: /* dlfunc_p_p_sc_s */
+{
+    void          * dl_handle = NULL;
+    void          * ptr;
+    funcptr_t       p;
+
+    if ((((!PMC_IS_NULL(PREG(2))) && (PREG(2)->vtable->base_type == enum_class_ParrotLibrary)) && VTABLE_defined(interp, PREG(2)))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    ptr = Parrot_dyn_dlsym_str(interp, dl_handle, SCONST(3));
+    p = D2FPTR(ptr);
+    if ((p == NULLfunc)) {
+        const char  * const  err = Parrot_dlerror();
+
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG, "Symbol '%Ss' not found: %s\n", SCONST(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_NCI);
+        VTABLE_set_pointer_keyed_str(interp, PREG(1), SREG(4), F2DPTR(p));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_111: /* dlfunc_p_p_s_sc */
+{
+    void          * dl_handle = NULL;
+    void          * ptr;
+    funcptr_t       p;
+
+    if ((((!PMC_IS_NULL(PREG(2))) && (PREG(2)->vtable->base_type == enum_class_ParrotLibrary)) && VTABLE_defined(interp, PREG(2)))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    ptr = Parrot_dyn_dlsym_str(interp, dl_handle, SREG(3));
+    p = D2FPTR(ptr);
+    if ((p == NULLfunc)) {
+        const char  * const  err = Parrot_dlerror();
+
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG, "Symbol '%Ss' not found: %s\n", SREG(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_NCI);
+        VTABLE_set_pointer_keyed_str(interp, PREG(1), SCONST(4), F2DPTR(p));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_112: /* dlfunc_p_p_sc_sc */
+{
+    void          * dl_handle = NULL;
+    void          * ptr;
+    funcptr_t       p;
+
+    if ((((!PMC_IS_NULL(PREG(2))) && (PREG(2)->vtable->base_type == enum_class_ParrotLibrary)) && VTABLE_defined(interp, PREG(2)))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    ptr = Parrot_dyn_dlsym_str(interp, dl_handle, SCONST(3));
+    p = D2FPTR(ptr);
+    if ((p == NULLfunc)) {
+        const char  * const  err = Parrot_dlerror();
+
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG, "Symbol '%Ss' not found: %s\n", SCONST(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_NCI);
+        VTABLE_set_pointer_keyed_str(interp, PREG(1), SCONST(4), F2DPTR(p));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_113: /* dlfunc_p_p_s_p */
+{
+    void          * dl_handle = NULL;
+    void          * ptr;
+    funcptr_t       p;
+
+    if ((((!PMC_IS_NULL(PREG(2))) && (PREG(2)->vtable->base_type == enum_class_ParrotLibrary)) && VTABLE_defined(interp, PREG(2)))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    ptr = Parrot_dyn_dlsym_str(interp, dl_handle, SREG(3));
+    p = D2FPTR(ptr);
+    if ((p == NULLfunc)) {
+        const char  * const  err = Parrot_dlerror();
+
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG, "Symbol '%Ss' not found: %s\n", SREG(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_NCI);
+        VTABLE_set_pointer_keyed(interp, PREG(1), PREG(4), F2DPTR(p));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_114: /* dlfunc_p_p_sc_p */
+{
+    void          * dl_handle = NULL;
+    void          * ptr;
+    funcptr_t       p;
+
+    if ((((!PMC_IS_NULL(PREG(2))) && (PREG(2)->vtable->base_type == enum_class_ParrotLibrary)) && VTABLE_defined(interp, PREG(2)))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    ptr = Parrot_dyn_dlsym_str(interp, dl_handle, SCONST(3));
+    p = D2FPTR(ptr);
+    if ((p == NULLfunc)) {
+        const char  * const  err = Parrot_dlerror();
+
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG, "Symbol '%Ss' not found: %s\n", SCONST(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_NCI);
+        VTABLE_set_pointer_keyed(interp, PREG(1), PREG(4), F2DPTR(p));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_115: /* dlvar_p_p_s */
+{
+    void  *         dl_handle = NULL;
+    void  *         p;
+
+    if ((((!PMC_IS_NULL(PREG(2))) && (PREG(2)->vtable->base_type == enum_class_ParrotLibrary)) && VTABLE_defined(interp, PREG(2)))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    p = Parrot_dyn_dlsym_str(interp, dl_handle, SREG(3));
+    if ((p == NULL)) {
+        const char  * const  err = Parrot_dlerror();
+
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG, "Symbol '%Ss' not found: %s\n", SREG(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_UnManagedStruct);
+        VTABLE_set_pointer(interp, PREG(1), p);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_116: /* dlvar_p_p_sc */
+{
+    void  *         dl_handle = NULL;
+    void  *         p;
+
+    if ((((!PMC_IS_NULL(PREG(2))) && (PREG(2)->vtable->base_type == enum_class_ParrotLibrary)) && VTABLE_defined(interp, PREG(2)))) {
+        dl_handle = ((Parrot_ParrotLibrary_attributes*)PMC_data(PREG(2)))->dl_handle;
+    }
+
+    p = Parrot_dyn_dlsym_str(interp, dl_handle, SCONST(3));
+    if ((p == NULL)) {
+        const char  * const  err = Parrot_dlerror();
+
+        Parrot_warn(interp, PARROT_WARNINGS_UNDEF_FLAG, "Symbol '%Ss' not found: %s\n", SCONST(3), err ? err : "unknown reason");
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Undef);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_UnManagedStruct);
+        VTABLE_set_pointer(interp, PREG(1), p);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_117: /* compreg_s_p */
+{
+    Parrot_interp_set_compiler(interp, SREG(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_118: /* compreg_sc_p */
+{
+    Parrot_interp_set_compiler(interp, SCONST(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_119: /* compreg_p_s */
+{
+    PREG(1) = Parrot_interp_get_compiler(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_120: /* compreg_p_sc */
+{
+    PREG(1) = Parrot_interp_get_compiler(interp, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_121: /* new_callback_p_p_p_s */
+{
+    PREG(1) = Parrot_make_cb(interp, PREG(2), PREG(3), SREG(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_122: /* new_callback_p_p_p_sc */
+{
+    PREG(1) = Parrot_make_cb(interp, PREG(2), PREG(3), SCONST(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_123: /* annotations_p */
+{
+    if (interp->code->annotations) {
+        const opcode_t   cur_pos = (( cur_opcode + 2) - interp->code->base.data);
+
+        PREG(1) = PackFile_Annotations_lookup(interp, interp->code->annotations, cur_pos, NULL);
+    }
+    else {
+        PREG(1) = Parrot_pmc_new(interp, enum_class_Hash);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_124: /* annotations_p_s */
+{
+    if (interp->code->annotations) {
+        const opcode_t   cur_pos = (( cur_opcode + 3) - interp->code->base.data);
+
+        PREG(1) = PackFile_Annotations_lookup(interp, interp->code->annotations, cur_pos, SREG(2));
+    }
+    else {
+        PREG(1) = PMCNULL;
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_125: /* annotations_p_sc */
+{
+    if (interp->code->annotations) {
+        const opcode_t   cur_pos = (( cur_opcode + 3) - interp->code->base.data);
+
+        PREG(1) = PackFile_Annotations_lookup(interp, interp->code->annotations, cur_pos, SCONST(2));
+    }
+    else {
+        PREG(1) = PMCNULL;
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_126: /* band_i_i */
+{
+    (IREG(1) &= IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_127: /* band_i_ic */
+{
+    (IREG(1) &= ICONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_128: /* band_i_i_i */
+{
+    IREG(1) = (IREG(2) & IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_129: /* band_i_ic_i */
+{
+    IREG(1) = (ICONST(2) & IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_130: /* band_i_i_ic */
+{
+    IREG(1) = (IREG(2) & ICONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_131: /* bor_i_i */
+{
+    (IREG(1) |= IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_132: /* bor_i_ic */
+{
+    (IREG(1) |= ICONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_133: /* bor_i_i_i */
+{
+    IREG(1) = (IREG(2) | IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_134: /* bor_i_ic_i */
+{
+    IREG(1) = (ICONST(2) | IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_135: /* bor_i_i_ic */
+{
+    IREG(1) = (IREG(2) | ICONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_136: /* shl_i_i */
+{
+    IREG(1) = bit_shift_left(IREG(1), IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_137: /* shl_i_ic */
+{
+    IREG(1) = bit_shift_left(IREG(1), ICONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_138: /* shl_i_i_i */
+{
+    IREG(1) = bit_shift_left(IREG(2), IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_139: /* shl_i_ic_i */
+{
+    IREG(1) = bit_shift_left(ICONST(2), IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_140: /* shl_i_i_ic */
+{
+    IREG(1) = bit_shift_left(IREG(2), ICONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_141: /* shr_i_i */
+{
+    const INTVAL   signed_shift = (-IREG(2));
+
+    IREG(1) = bit_shift_left(IREG(1), signed_shift);
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_142: /* shr_i_ic */
+{
+    const INTVAL   signed_shift = (-ICONST(2));
+
+    IREG(1) = bit_shift_left(IREG(1), signed_shift);
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_143: /* shr_i_i_i */
+{
+    const INTVAL   signed_shift = (-IREG(3));
+
+    IREG(1) = bit_shift_left(IREG(2), signed_shift);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_144: /* shr_i_ic_i */
+{
+    const INTVAL   signed_shift = (-IREG(3));
+
+    IREG(1) = bit_shift_left(ICONST(2), signed_shift);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_145: /* shr_i_i_ic */
+{
+    const INTVAL   signed_shift = (-ICONST(3));
+
+    IREG(1) = bit_shift_left(IREG(2), signed_shift);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_146: /* lsr_i_i */
+{
+    const UINTVAL   a = (UINTVAL)IREG(1);
+    const UINTVAL   b = (a >> IREG(2));
+
+    IREG(1) = (INTVAL)b;
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_147: /* lsr_i_ic */
+{
+    const UINTVAL   a = (UINTVAL)IREG(1);
+    const UINTVAL   b = (a >> ICONST(2));
+
+    IREG(1) = (INTVAL)b;
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_148: /* lsr_i_i_i */
+{
+    IREG(1) = (INTVAL)(((UINTVAL)IREG(2) >> IREG(3)));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_149: /* lsr_i_ic_i */
+{
+    IREG(1) = (INTVAL)(((UINTVAL)ICONST(2) >> IREG(3)));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_150: /* lsr_i_i_ic */
+{
+    IREG(1) = (INTVAL)(((UINTVAL)IREG(2) >> ICONST(3)));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_151: /* bxor_i_i */
+{
+    (IREG(1) ^= IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_152: /* bxor_i_ic */
+{
+    (IREG(1) ^= ICONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_153: /* bxor_i_i_i */
+{
+    IREG(1) = (IREG(2) ^ IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_154: /* bxor_i_ic_i */
+{
+    IREG(1) = (ICONST(2) ^ IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_155: /* bxor_i_i_ic */
+{
+    IREG(1) = (IREG(2) ^ ICONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_156: /* eq_i_i_ic */
+{
+    if ((IREG(1) == IREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_157: /* eq_ic_i_ic */
+{
+    if ((ICONST(1) == IREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_158: /* eq_i_ic_ic */
+{
+    if ((IREG(1) == ICONST(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_159: /* eq_n_n_ic */
+{
+    if ((NREG(1) == NREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_160: /* eq_nc_n_ic */
+{
+    if ((NCONST(1) == NREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_161: /* eq_n_nc_ic */
+{
+    if ((NREG(1) == NCONST(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_162: /* eq_s_s_ic */
+{
+    if (STRING_equal(interp, SREG(1), SREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_163: /* eq_sc_s_ic */
+{
+    if (STRING_equal(interp, SCONST(1), SREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_164: /* eq_s_sc_ic */
+{
+    if (STRING_equal(interp, SREG(1), SCONST(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_165: /* eq_p_p_ic */
+{
+    if (VTABLE_is_equal(interp, PREG(1), PREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_166: /* eq_p_i_ic */
+{
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, IREG(2));
+    if (VTABLE_is_equal(interp, PREG(1), temp)) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_167: /* eq_p_ic_ic */
+{
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, ICONST(2));
+    if (VTABLE_is_equal(interp, PREG(1), temp)) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_168: /* eq_p_n_ic */
+{
+    if ((VTABLE_get_number(interp, PREG(1)) == NREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_169: /* eq_p_nc_ic */
+{
+    if ((VTABLE_get_number(interp, PREG(1)) == NCONST(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_170: /* eq_p_s_ic */
+{
+    if (STRING_equal(interp, VTABLE_get_string(interp, PREG(1)), SREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_171: /* eq_p_sc_ic */
+{
+    if (STRING_equal(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_172: /* eq_str_p_p_ic */
+{
+    if (VTABLE_is_equal_string(interp, PREG(1), PREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_173: /* eq_num_p_p_ic */
+{
+    if (VTABLE_is_equal_num(interp, PREG(1), PREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_174: /* eq_addr_s_s_ic */
+{
+    if ((SREG(1) == SREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_175: /* eq_addr_sc_s_ic */
+{
+    if ((SCONST(1) == SREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_176: /* eq_addr_s_sc_ic */
+{
+    if ((SREG(1) == SCONST(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_177: /* eq_addr_sc_sc_ic */
+{
+    if ((SCONST(1) == SCONST(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_178: /* eq_addr_p_p_ic */
+{
+    if ((PREG(1) == PREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_179: /* ne_i_i_ic */
+{
+    if ((IREG(1) != IREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_180: /* ne_ic_i_ic */
+{
+    if ((ICONST(1) != IREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_181: /* ne_i_ic_ic */
+{
+    if ((IREG(1) != ICONST(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_182: /* ne_n_n_ic */
+{
+    if ((NREG(1) != NREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_183: /* ne_nc_n_ic */
+{
+    if ((NCONST(1) != NREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_184: /* ne_n_nc_ic */
+{
+    if ((NREG(1) != NCONST(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_185: /* ne_s_s_ic */
+{
+    if ((!STRING_equal(interp, SREG(1), SREG(2)))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_186: /* ne_sc_s_ic */
+{
+    if ((!STRING_equal(interp, SCONST(1), SREG(2)))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_187: /* ne_s_sc_ic */
+{
+    if ((!STRING_equal(interp, SREG(1), SCONST(2)))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_188: /* ne_p_p_ic */
+{
+    if ((!VTABLE_is_equal(interp, PREG(1), PREG(2)))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_189: /* ne_p_i_ic */
+{
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, IREG(2));
+    if ((!VTABLE_is_equal(interp, PREG(1), temp))) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_190: /* ne_p_ic_ic */
+{
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, ICONST(2));
+    if ((!VTABLE_is_equal(interp, PREG(1), temp))) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_191: /* ne_p_n_ic */
+{
+    if ((VTABLE_get_number(interp, PREG(1)) != NREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_192: /* ne_p_nc_ic */
+{
+    if ((VTABLE_get_number(interp, PREG(1)) != NCONST(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_193: /* ne_p_s_ic */
+{
+    if ((!STRING_equal(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_194: /* ne_p_sc_ic */
+{
+    if ((!STRING_equal(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_195: /* ne_str_p_p_ic */
+{
+    if ((VTABLE_cmp_string(interp, PREG(1), PREG(2)) != 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_196: /* ne_num_p_p_ic */
+{
+    if ((VTABLE_cmp_num(interp, PREG(1), PREG(2)) != 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_197: /* ne_addr_s_s_ic */
+{
+    if ((SREG(1) != SREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_198: /* ne_addr_sc_s_ic */
+{
+    if ((SCONST(1) != SREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_199: /* ne_addr_s_sc_ic */
+{
+    if ((SREG(1) != SCONST(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_200: /* ne_addr_sc_sc_ic */
+{
+    if ((SCONST(1) != SCONST(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_201: /* ne_addr_p_p_ic */
+{
+    if ((PREG(1) != PREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_202: /* lt_i_i_ic */
+{
+    if ((IREG(1) < IREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_203: /* lt_ic_i_ic */
+{
+    if ((ICONST(1) < IREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_204: /* lt_i_ic_ic */
+{
+    if ((IREG(1) < ICONST(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_205: /* lt_n_n_ic */
+{
+    if ((NREG(1) < NREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_206: /* lt_nc_n_ic */
+{
+    if ((NCONST(1) < NREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_207: /* lt_n_nc_ic */
+{
+    if ((NREG(1) < NCONST(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_208: /* lt_s_s_ic */
+{
+    if ((STRING_compare(interp, SREG(1), SREG(2)) < 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_209: /* lt_sc_s_ic */
+{
+    if ((STRING_compare(interp, SCONST(1), SREG(2)) < 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_210: /* lt_s_sc_ic */
+{
+    if ((STRING_compare(interp, SREG(1), SCONST(2)) < 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_211: /* lt_p_p_ic */
+{
+    if ((VTABLE_cmp(interp, PREG(1), PREG(2)) < 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_212: /* lt_p_i_ic */
+{
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, IREG(2));
+    if ((VTABLE_cmp(interp, PREG(1), temp) < 0)) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_213: /* lt_p_ic_ic */
+{
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, ICONST(2));
+    if ((VTABLE_cmp(interp, PREG(1), temp) < 0)) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_214: /* lt_p_n_ic */
+{
+    if ((VTABLE_get_number(interp, PREG(1)) < NREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_215: /* lt_p_nc_ic */
+{
+    if ((VTABLE_get_number(interp, PREG(1)) < NCONST(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_216: /* lt_p_s_ic */
+{
+    if ((STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)) < 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_217: /* lt_p_sc_ic */
+{
+    if ((STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)) < 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_218: /* lt_str_p_p_ic */
+{
+    if ((VTABLE_cmp_string(interp, PREG(1), PREG(2)) < 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_219: /* lt_num_p_p_ic */
+{
+    if ((VTABLE_cmp_num(interp, PREG(1), PREG(2)) < 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_220: /* le_i_i_ic */
+{
+    if ((IREG(1) <= IREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_221: /* le_ic_i_ic */
+{
+    if ((ICONST(1) <= IREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_222: /* le_i_ic_ic */
+{
+    if ((IREG(1) <= ICONST(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_223: /* le_n_n_ic */
+{
+    if ((NREG(1) <= NREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_224: /* le_nc_n_ic */
+{
+    if ((NCONST(1) <= NREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_225: /* le_n_nc_ic */
+{
+    if ((NREG(1) <= NCONST(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_226: /* le_s_s_ic */
+{
+    if ((STRING_compare(interp, SREG(1), SREG(2)) <= 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_227: /* le_sc_s_ic */
+{
+    if ((STRING_compare(interp, SCONST(1), SREG(2)) <= 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_228: /* le_s_sc_ic */
+{
+    if ((STRING_compare(interp, SREG(1), SCONST(2)) <= 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_229: /* le_p_p_ic */
+{
+    if ((VTABLE_cmp(interp, PREG(1), PREG(2)) <= 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_230: /* le_p_i_ic */
+{
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, IREG(2));
+    if ((VTABLE_cmp(interp, PREG(1), temp) <= 0)) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_231: /* le_p_ic_ic */
+{
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, ICONST(2));
+    if ((VTABLE_cmp(interp, PREG(1), temp) <= 0)) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_232: /* le_p_n_ic */
+{
+    if ((VTABLE_get_number(interp, PREG(1)) <= NREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_233: /* le_p_nc_ic */
+{
+    if ((VTABLE_get_number(interp, PREG(1)) <= NCONST(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_234: /* le_p_s_ic */
+{
+    if ((STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)) <= 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_235: /* le_p_sc_ic */
+{
+    if ((STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)) <= 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_236: /* le_str_p_p_ic */
+{
+    if ((VTABLE_cmp_string(interp, PREG(1), PREG(2)) <= 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_237: /* le_num_p_p_ic */
+{
+    if ((VTABLE_cmp_num(interp, PREG(1), PREG(2)) <= 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_238: /* gt_p_p_ic */
+{
+    if ((VTABLE_cmp(interp, PREG(1), PREG(2)) > 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_239: /* gt_p_i_ic */
+{
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, IREG(2));
+    if ((VTABLE_cmp(interp, PREG(1), temp) > 0)) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_240: /* gt_p_ic_ic */
+{
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, ICONST(2));
+    if ((VTABLE_cmp(interp, PREG(1), temp) > 0)) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_241: /* gt_p_n_ic */
+{
+    if ((VTABLE_get_number(interp, PREG(1)) > NREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_242: /* gt_p_nc_ic */
+{
+    if ((VTABLE_get_number(interp, PREG(1)) > NCONST(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_243: /* gt_p_s_ic */
+{
+    if ((STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)) > 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_244: /* gt_p_sc_ic */
+{
+    if ((STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)) > 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_245: /* gt_str_p_p_ic */
+{
+    if ((VTABLE_cmp_string(interp, PREG(1), PREG(2)) > 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_246: /* gt_num_p_p_ic */
+{
+    if ((VTABLE_cmp_num(interp, PREG(1), PREG(2)) > 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_247: /* ge_p_p_ic */
+{
+    if ((VTABLE_cmp(interp, PREG(1), PREG(2)) >= 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_248: /* ge_p_i_ic */
+{
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, IREG(2));
+    if ((VTABLE_cmp(interp, PREG(1), temp) >= 0)) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_249: /* ge_p_ic_ic */
+{
+    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+
+    VTABLE_set_integer_native(interp, temp, ICONST(2));
+    if ((VTABLE_cmp(interp, PREG(1), temp) >= 0)) {
+        Parrot_pmc_free_temporary(interp, temp);
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    Parrot_pmc_free_temporary(interp, temp);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_250: /* ge_p_n_ic */
+{
+    if ((VTABLE_get_number(interp, PREG(1)) >= NREG(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_251: /* ge_p_nc_ic */
+{
+    if ((VTABLE_get_number(interp, PREG(1)) >= NCONST(2))) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_252: /* ge_p_s_ic */
+{
+    if ((STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SREG(2)) >= 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_253: /* ge_p_sc_ic */
+{
+    if ((STRING_compare(interp, VTABLE_get_string(interp, PREG(1)), SCONST(2)) >= 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_254: /* ge_str_p_p_ic */
+{
+    if ((VTABLE_cmp_string(interp, PREG(1), PREG(2)) >= 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_255: /* ge_num_p_p_ic */
+{
+    if ((VTABLE_cmp_num(interp, PREG(1), PREG(2)) >= 0)) {
+        do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_256: /* if_null_p_ic */
+{
+    if (PMC_IS_NULL(PREG(1))) {
+        do { cur_opcode += ICONST(2); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_257: /* if_null_s_ic */
+{
+    if (STRING_IS_NULL(SREG(1))) {
+        do { cur_opcode += ICONST(2); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_258: /* unless_null_p_ic */
+{
+    if ((!PMC_IS_NULL(PREG(1)))) {
+        do { cur_opcode += ICONST(2); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_259: /* unless_null_s_ic */
+{
+    if ((!STRING_IS_NULL(SREG(1)))) {
+        do { cur_opcode += ICONST(2); CG_BRANCH(); } while (0);
+    }
+
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_260: /* cmp_i_i_i */
+{
+    IREG(1) = (IREG(2) < IREG(3)) ? (-1) : (IREG(2) > IREG(3)) ? (+1) : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_261: /* cmp_i_ic_i */
+{
+    IREG(1) = (ICONST(2) < IREG(3)) ? (-1) : (ICONST(2) > IREG(3)) ? (+1) : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_262: /* cmp_i_i_ic */
+{
+    IREG(1) = (IREG(2) < ICONST(3)) ? (-1) : (IREG(2) > ICONST(3)) ? (+1) : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_263: /* cmp_i_n_n */
+{
+    IREG(1) = (NREG(2) < NREG(3)) ? (-1) : (NREG(2) > NREG(3)) ? (+1) : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_264: /* cmp_i_nc_n */
+{
+    IREG(1) = (NCONST(2) < NREG(3)) ? (-1) : (NCONST(2) > NREG(3)) ? (+1) : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_265: /* cmp_i_n_nc */
+{
+    IREG(1) = (NREG(2) < NCONST(3)) ? (-1) : (NREG(2) > NCONST(3)) ? (+1) : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_266: /* cmp_i_s_s */
+{
+    IREG(1) = STRING_compare(interp, SREG(2), SREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_267: /* cmp_i_sc_s */
+{
+    IREG(1) = STRING_compare(interp, SCONST(2), SREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_268: /* cmp_i_s_sc */
+{
+    IREG(1) = STRING_compare(interp, SREG(2), SCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_269: /* cmp_i_p_p */
+{
+    IREG(1) = VTABLE_cmp(interp, PREG(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_270: /* cmp_i_p_i */
+{
+    const INTVAL   l = VTABLE_get_integer(interp, PREG(2));
+
+    IREG(1) = (l < IREG(3)) ? (-1) : (l > IREG(3)) ? (+1) : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_271: /* cmp_i_p_ic */
+{
+    const INTVAL   l = VTABLE_get_integer(interp, PREG(2));
+
+    IREG(1) = (l < ICONST(3)) ? (-1) : (l > ICONST(3)) ? (+1) : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_272: /* cmp_i_p_n */
+{
+    const FLOATVAL   l = VTABLE_get_number(interp, PREG(2));
+
+    IREG(1) = (l < NREG(3)) ? (-1) : (l > NREG(3)) ? (+1) : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_273: /* cmp_i_p_nc */
+{
+    const FLOATVAL   l = VTABLE_get_number(interp, PREG(2));
+
+    IREG(1) = (l < NCONST(3)) ? (-1) : (l > NCONST(3)) ? (+1) : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_274: /* cmp_i_p_s */
+{
+    STRING * const  l = VTABLE_get_string(interp, PREG(2));
+
+    IREG(1) = STRING_compare(interp, l, SREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_275: /* cmp_i_p_sc */
+{
+    STRING * const  l = VTABLE_get_string(interp, PREG(2));
+
+    IREG(1) = STRING_compare(interp, l, SCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_276: /* cmp_str_i_p_p */
+{
+    IREG(1) = VTABLE_cmp_string(interp, PREG(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_277: /* cmp_num_i_p_p */
+{
+    IREG(1) = VTABLE_cmp_num(interp, PREG(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_278: /* cmp_pmc_p_p_p */
+{
+    PREG(1) = VTABLE_cmp_pmc(interp, PREG(2), PREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_279: /* issame_i_p_p */
+{
+    if ((PREG(2) == PREG(3))) {
+        IREG(1) = 1;
+    }
+    else {
+        IREG(1) = VTABLE_is_same(interp, PREG(2), PREG(3));
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_280: /* issame_i_s_s */
+{
+    IREG(1) = (SREG(2) == SREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_281: /* issame_i_sc_s */
+{
+    IREG(1) = (SCONST(2) == SREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_282: /* issame_i_s_sc */
+{
+    IREG(1) = (SREG(2) == SCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_283: /* issame_i_sc_sc */
+{
+    IREG(1) = (SCONST(2) == SCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_284: /* isntsame_i_p_p */
+{
+    if ((PREG(2) == PREG(3))) {
+        IREG(1) = 0;
+    }
+    else {
+        IREG(1) = (!VTABLE_is_same(interp, PREG(2), PREG(3)));
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_285: /* isntsame_i_s_s */
+{
+    IREG(1) = (SREG(2) != SREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_286: /* isntsame_i_sc_s */
+{
+    IREG(1) = (SCONST(2) != SREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_287: /* isntsame_i_s_sc */
+{
+    IREG(1) = (SREG(2) != SCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_288: /* isntsame_i_sc_sc */
+{
+    IREG(1) = (SCONST(2) != SCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_289: /* istrue_i_p */
+{
+    IREG(1) = VTABLE_get_bool(interp, PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_290: /* isfalse_i_p */
+{
+    IREG(1) = (!VTABLE_get_bool(interp, PREG(2)));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_291: /* isnull_i_p */
+{
+    IREG(1) = PMC_IS_NULL(PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_292: /* isnull_i_pc */
+{
+    IREG(1) = PMC_IS_NULL(PCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_293: /* isnull_i_s */
+{
+    IREG(1) = STRING_IS_NULL(SREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_294: /* isnull_i_sc */
+{
+    IREG(1) = STRING_IS_NULL(SCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_295: /* isgt_i_p_p */
+{
+    IREG(1) = ((VTABLE_cmp(interp, PREG(2), PREG(3)) > 0));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_296: /* isge_i_p_p */
+{
+    IREG(1) = ((VTABLE_cmp(interp, PREG(2), PREG(3)) >= 0));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_297: /* isle_i_i_i */
+{
+    IREG(1) = (IREG(2) <= IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_298: /* isle_i_ic_i */
+{
+    IREG(1) = (ICONST(2) <= IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_299: /* isle_i_i_ic */
+{
+    IREG(1) = (IREG(2) <= ICONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_300: /* isle_i_n_n */
+{
+    IREG(1) = (NREG(2) <= NREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_301: /* isle_i_nc_n */
+{
+    IREG(1) = (NCONST(2) <= NREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_302: /* isle_i_n_nc */
+{
+    IREG(1) = (NREG(2) <= NCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_303: /* isle_i_s_s */
+{
+    IREG(1) = (STRING_compare(interp, SREG(2), SREG(3)) <= 0);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_304: /* isle_i_sc_s */
+{
+    IREG(1) = (STRING_compare(interp, SCONST(2), SREG(3)) <= 0);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_305: /* isle_i_s_sc */
+{
+    IREG(1) = (STRING_compare(interp, SREG(2), SCONST(3)) <= 0);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_306: /* isle_i_p_p */
+{
+    IREG(1) = ((VTABLE_cmp(interp, PREG(2), PREG(3)) <= 0));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_307: /* islt_i_i_i */
+{
+    IREG(1) = ((IREG(2) < IREG(3))) ? 1 : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_308: /* islt_i_ic_i */
+{
+    IREG(1) = ((ICONST(2) < IREG(3))) ? 1 : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_309: /* islt_i_i_ic */
+{
+    IREG(1) = ((IREG(2) < ICONST(3))) ? 1 : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_310: /* islt_i_n_n */
+{
+    IREG(1) = (NREG(2) < NREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_311: /* islt_i_nc_n */
+{
+    IREG(1) = (NCONST(2) < NREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_312: /* islt_i_n_nc */
+{
+    IREG(1) = (NREG(2) < NCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_313: /* islt_i_s_s */
+{
+    IREG(1) = (STRING_compare(interp, SREG(2), SREG(3)) < 0);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_314: /* islt_i_sc_s */
+{
+    IREG(1) = (STRING_compare(interp, SCONST(2), SREG(3)) < 0);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_315: /* islt_i_s_sc */
+{
+    IREG(1) = (STRING_compare(interp, SREG(2), SCONST(3)) < 0);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_316: /* islt_i_p_p */
+{
+    IREG(1) = ((VTABLE_cmp(interp, PREG(2), PREG(3)) < 0));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_317: /* iseq_i_i_i */
+{
+    IREG(1) = ((IREG(2) == IREG(3))) ? 1 : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_318: /* iseq_i_ic_i */
+{
+    IREG(1) = ((ICONST(2) == IREG(3))) ? 1 : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_319: /* iseq_i_i_ic */
+{
+    IREG(1) = ((IREG(2) == ICONST(3))) ? 1 : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_320: /* iseq_i_n_n */
+{
+    IREG(1) = (NREG(2) == NREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_321: /* iseq_i_nc_n */
+{
+    IREG(1) = (NCONST(2) == NREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_322: /* iseq_i_n_nc */
+{
+    IREG(1) = (NREG(2) == NCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_323: /* iseq_i_s_s */
+{
+    IREG(1) = STRING_equal(interp, SREG(2), SREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_324: /* iseq_i_sc_s */
+{
+    IREG(1) = STRING_equal(interp, SCONST(2), SREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_325: /* iseq_i_s_sc */
+{
+    IREG(1) = STRING_equal(interp, SREG(2), SCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_326: /* iseq_i_p_p */
+{
+    if (((&PREG(2)) == (&PREG(3)))) {
+        IREG(1) = 1;
+    }
+    else {
+        IREG(1) = VTABLE_is_equal(interp, PREG(2), PREG(3));
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_327: /* isne_i_i_i */
+{
+    IREG(1) = ((IREG(2) == IREG(3))) ? 0 : 1;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_328: /* isne_i_ic_i */
+{
+    IREG(1) = ((ICONST(2) == IREG(3))) ? 0 : 1;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_329: /* isne_i_i_ic */
+{
+    IREG(1) = ((IREG(2) == ICONST(3))) ? 0 : 1;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_330: /* isne_i_n_n */
+{
+    IREG(1) = (NREG(2) != NREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_331: /* isne_i_nc_n */
+{
+    IREG(1) = (NCONST(2) != NREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_332: /* isne_i_n_nc */
+{
+    IREG(1) = (NREG(2) != NCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_333: /* isne_i_s_s */
+{
+    IREG(1) = (!STRING_equal(interp, SREG(2), SREG(3)));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_334: /* isne_i_sc_s */
+{
+    IREG(1) = (!STRING_equal(interp, SCONST(2), SREG(3)));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_335: /* isne_i_s_sc */
+{
+    IREG(1) = (!STRING_equal(interp, SREG(2), SCONST(3)));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_336: /* isne_i_p_p */
+{
+    if (((&PREG(2)) == (&PREG(3)))) {
+        IREG(1) = 0;
+    }
+    else {
+        IREG(1) = (!VTABLE_is_equal(interp, PREG(2), PREG(3)));
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_337: /* and_i_i_i */
+{
+    IREG(1) = IREG(2) ? IREG(3) : IREG(2);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_338: /* and_i_ic_i */
+{
+    IREG(1) = ICONST(2) ? IREG(3) : ICONST(2);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_339: /* and_i_i_ic */
+{
+    IREG(1) = IREG(2) ? ICONST(3) : IREG(2);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_340: /* and_p_p_p */
+{
+    PREG(1) = VTABLE_get_bool(interp, PREG(2)) ? PREG(3) : PREG(2);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_341: /* not_i */
+{
+    IREG(1) = (!IREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_342: /* not_i_i */
+{
+    IREG(1) = (!IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_343: /* not_p */
+{
+    VTABLE_set_bool(interp, PREG(1), (!VTABLE_get_bool(interp, PREG(1))));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_344: /* not_p_p */
+{
+    const INTVAL   a = (!VTABLE_get_bool(interp, PREG(2)));
+
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Boolean));
+    }
+
+    VTABLE_set_bool(interp, PREG(1), a);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_345: /* or_i_i_i */
+{
+    IREG(1) = IREG(2) ? IREG(2) : IREG(3);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_346: /* or_i_ic_i */
+{
+    IREG(1) = ICONST(2) ? ICONST(2) : IREG(3);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_347: /* or_i_i_ic */
+{
+    IREG(1) = IREG(2) ? IREG(2) : ICONST(3);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_348: /* or_p_p_p */
+{
+    PREG(1) = VTABLE_get_bool(interp, PREG(2)) ? PREG(2) : PREG(3);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_349: /* xor_i_i_i */
+{
+    IREG(1) = ((IREG(2) && (!IREG(3)))) ? IREG(2) : ((IREG(3) && (!IREG(2)))) ? IREG(3) : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_350: /* xor_i_ic_i */
+{
+    IREG(1) = ((ICONST(2) && (!IREG(3)))) ? ICONST(2) : ((IREG(3) && (!ICONST(2)))) ? IREG(3) : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_351: /* xor_i_i_ic */
+{
+    IREG(1) = ((IREG(2) && (!ICONST(3)))) ? IREG(2) : ((ICONST(3) && (!IREG(2)))) ? ICONST(3) : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_352: /* xor_p_p_p */
+{
+    const INTVAL   a = VTABLE_get_bool(interp, PREG(2));
+    const INTVAL   b = VTABLE_get_bool(interp, PREG(3));
+
+    if ((a && (!b))) {
+        PREG(1) = PREG(2);
+    }
+    else {
+        if ((b && (!a))) {
+            PREG(1) = PREG(3);
+        }
+        else {
+            PREG(1) = Parrot_pmc_new(interp, VTABLE_type(interp, PREG(2)));
+            VTABLE_set_bool(interp, PREG(1), 0);
+        }
+
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_353: /* print_i */
+{
+    Parrot_io_printf(interp, INTVAL_FMT, (INTVAL)IREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_354: /* print_ic */
+{
+    Parrot_io_printf(interp, INTVAL_FMT, (INTVAL)ICONST(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_355: /* print_n */
+{
+    #if defined(PARROT_HAS_NEGATIVE_ZERO)
+        Parrot_io_printf(interp, FLOATVAL_FMT, NREG(1));
+
+#else
+        if (Parrot_is_nzero(NREG(1))) {
+            Parrot_io_printf(interp, "-0");
+        }
+        else {
+            Parrot_io_printf(interp, FLOATVAL_FMT, NREG(1));
+        }
+
+#endif
+;
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_356: /* print_nc */
+{
+    #if defined(PARROT_HAS_NEGATIVE_ZERO)
+        Parrot_io_printf(interp, FLOATVAL_FMT, NCONST(1));
+
+#else
+        if (Parrot_is_nzero(NCONST(1))) {
+            Parrot_io_printf(interp, "-0");
+        }
+        else {
+            Parrot_io_printf(interp, FLOATVAL_FMT, NCONST(1));
+        }
+
+#endif
+;
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_357: /* print_s */
+{
+    STRING  * const  s = SREG(1);
+
+    if ((s && Parrot_str_byte_length(interp, s))) {
+        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+    }
+
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_358: /* print_sc */
+{
+    STRING  * const  s = SCONST(1);
+
+    if ((s && Parrot_str_byte_length(interp, s))) {
+        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+    }
+
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_359: /* print_p */
+{
+    PMC  * const  p = PREG(1);
+    STRING  * const  s = (VTABLE_get_string(interp, p));
+
+    if (s) {
+        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+    }
+
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_360: /* say_i */
+{
+    Parrot_io_printf(interp, INTVAL_FMT "\n", (INTVAL)IREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_361: /* say_ic */
+{
+    Parrot_io_printf(interp, INTVAL_FMT "\n", (INTVAL)ICONST(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_362: /* say_n */
+{
+    #if defined(PARROT_HAS_NEGATIVE_ZERO)
+        Parrot_io_printf(interp, FLOATVAL_FMT "\n", NREG(1));
+
+#else
+        if (Parrot_is_nzero(NREG(1))) {
+            Parrot_io_printf(interp, "-0\n");
+        }
+        else {
+            Parrot_io_printf(interp, FLOATVAL_FMT "\n", NREG(1));
+        }
+
+#endif
+;
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_363: /* say_nc */
+{
+    #if defined(PARROT_HAS_NEGATIVE_ZERO)
+        Parrot_io_printf(interp, FLOATVAL_FMT "\n", NCONST(1));
+
+#else
+        if (Parrot_is_nzero(NCONST(1))) {
+            Parrot_io_printf(interp, "-0\n");
+        }
+        else {
+            Parrot_io_printf(interp, FLOATVAL_FMT "\n", NCONST(1));
+        }
+
+#endif
+;
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_364: /* say_s */
+{
+    STRING  * const  s = SREG(1);
+
+    if ((s && Parrot_str_byte_length(interp, s))) {
+        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+    }
+
+    Parrot_io_putps(interp, _PIO_STDOUT(interp), Parrot_str_new_constant(interp, "\n"));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_365: /* say_sc */
+{
+    STRING  * const  s = SCONST(1);
+
+    if ((s && Parrot_str_byte_length(interp, s))) {
+        Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+    }
+
+    Parrot_io_putps(interp, _PIO_STDOUT(interp), Parrot_str_new_constant(interp, "\n"));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_366: /* say_p */
+{
+    PMC  * const  p = PREG(1);
+
+    if (PMC_IS_NULL(p)) {
+        opcode_t  * handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 2, EXCEPTION_UNEXPECTED_NULL, "Null PMC in say");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+    else {
+        STRING  * const  s = VTABLE_get_string(interp, p);
+
+        if (s) {
+            Parrot_io_putps(interp, _PIO_STDOUT(interp), s);
+        }
+
+        Parrot_io_putps(interp, _PIO_STDOUT(interp), Parrot_str_new_constant(interp, "\n"));
+    }
+
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_367: /* print_p_i */
+{
+    if (PREG(1)) {
+        STRING  * const  s = Parrot_str_from_int(interp, IREG(2));
+
+        Parrot_io_putps(interp, PREG(1), s);
+    }
+
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_368: /* print_p_ic */
+{
+    if (PREG(1)) {
+        STRING  * const  s = Parrot_str_from_int(interp, ICONST(2));
+
+        Parrot_io_putps(interp, PREG(1), s);
+    }
+
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_369: /* print_p_n */
+{
+    if (PREG(1)) {
+        STRING  * const  s = Parrot_sprintf_c(interp, FLOATVAL_FMT, NREG(2));
+
+        Parrot_io_putps(interp, PREG(1), s);
+    }
+
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_370: /* print_p_nc */
+{
+    if (PREG(1)) {
+        STRING  * const  s = Parrot_sprintf_c(interp, FLOATVAL_FMT, NCONST(2));
+
+        Parrot_io_putps(interp, PREG(1), s);
+    }
+
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_371: /* print_p_s */
+{
+    if ((SREG(2) && PREG(1))) {
+        Parrot_io_putps(interp, PREG(1), SREG(2));
+    }
+
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_372: /* print_p_sc */
+{
+    if ((SCONST(2) && PREG(1))) {
+        Parrot_io_putps(interp, PREG(1), SCONST(2));
+    }
+
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_373: /* print_p_p */
+{
+    if ((PREG(2) && PREG(1))) {
+        STRING  * const  s = VTABLE_get_string(interp, PREG(2));
+
+        Parrot_io_putps(interp, PREG(1), s);
+    }
+
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_374: /* getstdin_p */
+{
+    PREG(1) = _PIO_STDIN(interp);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_375: /* getstdout_p */
+{
+    PREG(1) = _PIO_STDOUT(interp);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_376: /* getstderr_p */
+{
+    PREG(1) = _PIO_STDERR(interp);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_377: /* abs_i */
+{
+    IREG(1) = (IREG(1) < 0) ? (-IREG(1)) : IREG(1);
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_378: /* abs_n */
+{
+    NREG(1) = fabs(NREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_379: /* abs_i_i */
+{
+    IREG(1) = (IREG(2) < 0) ? (-IREG(2)) : IREG(2);
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_380: /* abs_n_n */
+{
+    NREG(1) = fabs(NREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_381: /* abs_p */
+{
+    VTABLE_i_absolute(interp, PREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_382: /* abs_p_p */
+{
+    PREG(1) = VTABLE_absolute(interp, PREG(2), PREG(1));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_383: /* add_i_i */
+{
+    (IREG(1) += IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_384: /* add_i_ic */
+{
+    (IREG(1) += ICONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_385: /* add_n_n */
+{
+    (NREG(1) += NREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_386: /* add_n_nc */
+{
+    (NREG(1) += NCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_387: /* add_p_p */
+{
+    VTABLE_i_add(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_388: /* add_p_i */
+{
+    VTABLE_i_add_int(interp, PREG(1), IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_389: /* add_p_ic */
+{
+    VTABLE_i_add_int(interp, PREG(1), ICONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_390: /* add_p_n */
+{
+    VTABLE_i_add_float(interp, PREG(1), NREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_391: /* add_p_nc */
+{
+    VTABLE_i_add_float(interp, PREG(1), NCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_392: /* add_i_i_i */
+{
+    IREG(1) = (IREG(2) + IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_393: /* add_i_ic_i */
+{
+    IREG(1) = (ICONST(2) + IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_394: /* add_i_i_ic */
+{
+    IREG(1) = (IREG(2) + ICONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_395: /* add_n_n_n */
+{
+    NREG(1) = (NREG(2) + NREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_396: /* add_n_nc_n */
+{
+    NREG(1) = (NCONST(2) + NREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_397: /* add_n_n_nc */
+{
+    NREG(1) = (NREG(2) + NCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_398: /* add_p_p_p */
+{
+    PREG(1) = VTABLE_add(interp, PREG(2), PREG(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_399: /* add_p_p_i */
+{
+    PREG(1) = VTABLE_add_int(interp, PREG(2), IREG(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_400: /* add_p_p_ic */
+{
+    PREG(1) = VTABLE_add_int(interp, PREG(2), ICONST(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_401: /* add_p_p_n */
+{
+    PREG(1) = VTABLE_add_float(interp, PREG(2), NREG(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_402: /* add_p_p_nc */
+{
+    PREG(1) = VTABLE_add_float(interp, PREG(2), NCONST(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_403: /* dec_i */
+{
+    (IREG(1)--);
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_404: /* dec_n */
+{
+    (NREG(1)--);
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_405: /* dec_p */
+{
+    VTABLE_decrement(interp, PREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_406: /* div_i_i */
+{
+    const INTVAL   den = IREG(2);
+
+    if ((den == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    (IREG(1) /= den);
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_407: /* div_i_ic */
+{
+    const INTVAL   den = ICONST(2);
+
+    if ((den == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    (IREG(1) /= den);
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_408: /* div_n_n */
+{
+    const FLOATVAL   den = NREG(2);
+
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    (NREG(1) /= den);
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_409: /* div_n_nc */
+{
+    const FLOATVAL   den = NCONST(2);
+
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    (NREG(1) /= den);
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_410: /* div_p_p */
+{
+    VTABLE_i_divide(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_411: /* div_p_i */
+{
+    VTABLE_i_divide_int(interp, PREG(1), IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_412: /* div_p_ic */
+{
+    VTABLE_i_divide_int(interp, PREG(1), ICONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_413: /* div_p_n */
+{
+    VTABLE_i_divide_float(interp, PREG(1), NREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_414: /* div_p_nc */
+{
+    VTABLE_i_divide_float(interp, PREG(1), NCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_415: /* div_i_i_i */
+{
+    const INTVAL   den = IREG(3);
+
+    if ((den == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    IREG(1) = (IREG(2) / den);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_416: /* div_i_ic_i */
+{
+    const INTVAL   den = IREG(3);
+
+    if ((den == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    IREG(1) = (ICONST(2) / den);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_417: /* div_i_i_ic */
+{
+    const INTVAL   den = ICONST(3);
+
+    if ((den == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    IREG(1) = (IREG(2) / den);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_418: /* div_i_ic_ic */
+{
+    const INTVAL   den = ICONST(3);
+
+    if ((den == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    IREG(1) = (ICONST(2) / den);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_419: /* div_n_n_n */
+{
+    const FLOATVAL   den = NREG(3);
+
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    NREG(1) = (NREG(2) / den);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_420: /* div_n_nc_n */
+{
+    const FLOATVAL   den = NREG(3);
+
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    NREG(1) = (NCONST(2) / den);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_421: /* div_n_n_nc */
+{
+    const FLOATVAL   den = NCONST(3);
+
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    NREG(1) = (NREG(2) / den);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_422: /* div_n_nc_nc */
+{
+    const FLOATVAL   den = NCONST(3);
+
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    NREG(1) = (NCONST(2) / den);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_423: /* div_p_p_p */
+{
+    PREG(1) = VTABLE_divide(interp, PREG(2), PREG(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_424: /* div_p_p_i */
+{
+    PREG(1) = VTABLE_divide_int(interp, PREG(2), IREG(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_425: /* div_p_p_ic */
+{
+    PREG(1) = VTABLE_divide_int(interp, PREG(2), ICONST(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_426: /* div_p_p_n */
+{
+    PREG(1) = VTABLE_divide_float(interp, PREG(2), NREG(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_427: /* div_p_p_nc */
+{
+    PREG(1) = VTABLE_divide_float(interp, PREG(2), NCONST(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_428: /* fdiv_i_i */
+{
+    const INTVAL   den = IREG(2);
+    FLOATVAL   f;
+
+    if ((den == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    f = floor((((FLOATVAL)IREG(1)) / den));
+    IREG(1) = (INTVAL)f;
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_429: /* fdiv_i_ic */
+{
+    const INTVAL   den = ICONST(2);
+    FLOATVAL   f;
+
+    if ((den == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    f = floor((((FLOATVAL)IREG(1)) / den));
+    IREG(1) = (INTVAL)f;
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_430: /* fdiv_n_n */
+{
+    const FLOATVAL   den = NREG(2);
+
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    NREG(1) = floor((NREG(1) / den));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_431: /* fdiv_n_nc */
+{
+    const FLOATVAL   den = NCONST(2);
+
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    NREG(1) = floor((NREG(1) / den));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_432: /* fdiv_p_p */
+{
+    VTABLE_i_floor_divide(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_433: /* fdiv_p_i */
+{
+    VTABLE_i_floor_divide_int(interp, PREG(1), IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_434: /* fdiv_p_ic */
+{
+    VTABLE_i_floor_divide_int(interp, PREG(1), ICONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_435: /* fdiv_p_n */
+{
+    VTABLE_i_floor_divide_float(interp, PREG(1), NREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_436: /* fdiv_p_nc */
+{
+    VTABLE_i_floor_divide_float(interp, PREG(1), NCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_437: /* fdiv_i_i_i */
+{
+    const INTVAL   den = IREG(3);
+    FLOATVAL   f;
+
+    if ((den == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    f = floor(((FLOATVAL)IREG(2) / den));
+    IREG(1) = (INTVAL)f;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_438: /* fdiv_i_ic_i */
+{
+    const INTVAL   den = IREG(3);
+    FLOATVAL   f;
+
+    if ((den == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    f = floor(((FLOATVAL)ICONST(2) / den));
+    IREG(1) = (INTVAL)f;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_439: /* fdiv_i_i_ic */
+{
+    const INTVAL   den = ICONST(3);
+    FLOATVAL   f;
+
+    if ((den == 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    f = floor(((FLOATVAL)IREG(2) / den));
+    IREG(1) = (INTVAL)f;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_440: /* fdiv_n_n_n */
+{
+    const FLOATVAL   den = NREG(3);
+
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    NREG(1) = floor((NREG(2) / den));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_441: /* fdiv_n_nc_n */
+{
+    const FLOATVAL   den = NREG(3);
+
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    NREG(1) = floor((NCONST(2) / den));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_442: /* fdiv_n_n_nc */
+{
+    const FLOATVAL   den = NCONST(3);
+
+    if (FLOAT_IS_ZERO(den)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_DIV_BY_ZERO, "Divide by zero");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    NREG(1) = floor((NREG(2) / den));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_443: /* fdiv_p_p_p */
+{
+    PREG(1) = VTABLE_floor_divide(interp, PREG(2), PREG(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_444: /* fdiv_p_p_i */
+{
+    PREG(1) = VTABLE_floor_divide_int(interp, PREG(2), IREG(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_445: /* fdiv_p_p_ic */
+{
+    PREG(1) = VTABLE_floor_divide_int(interp, PREG(2), ICONST(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_446: /* fdiv_p_p_n */
+{
+    PREG(1) = VTABLE_floor_divide_float(interp, PREG(2), NREG(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_447: /* fdiv_p_p_nc */
+{
+    PREG(1) = VTABLE_floor_divide_float(interp, PREG(2), NCONST(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_448: /* ceil_n */
+{
+    NREG(1) = ceil(NREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_449: /* ceil_i_n */
+{
+    const FLOATVAL   f = ceil(NREG(2));
+
+    IREG(1) = (INTVAL)f;
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_450: /* ceil_n_n */
+{
+    NREG(1) = ceil(NREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_451: /* floor_n */
+{
+    NREG(1) = floor(NREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_452: /* floor_i_n */
+{
+    const FLOATVAL   f = floor(NREG(2));
+
+    IREG(1) = (INTVAL)f;
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_453: /* floor_n_n */
+{
+    NREG(1) = floor(NREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_454: /* inc_i */
+{
+    (IREG(1)++);
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_455: /* inc_n */
+{
+    (NREG(1)++);
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_456: /* inc_p */
+{
+    VTABLE_increment(interp, PREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_457: /* mod_i_i */
+{
+    IREG(1) = Parrot_util_intval_mod(IREG(1), IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_458: /* mod_i_ic */
+{
+    IREG(1) = Parrot_util_intval_mod(IREG(1), ICONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_459: /* mod_n_n */
+{
+    NREG(1) = Parrot_util_floatval_mod(NREG(1), NREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_460: /* mod_n_nc */
+{
+    NREG(1) = Parrot_util_floatval_mod(NREG(1), NCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_461: /* mod_p_p */
+{
+    VTABLE_i_modulus(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_462: /* mod_p_i */
+{
+    VTABLE_i_modulus_int(interp, PREG(1), IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_463: /* mod_p_ic */
+{
+    VTABLE_i_modulus_int(interp, PREG(1), ICONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_464: /* mod_p_n */
+{
+    VTABLE_i_modulus_float(interp, PREG(1), NREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_465: /* mod_p_nc */
+{
+    VTABLE_i_modulus_float(interp, PREG(1), NCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_466: /* mod_i_i_i */
+{
+    IREG(1) = Parrot_util_intval_mod(IREG(2), IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_467: /* mod_i_ic_i */
+{
+    IREG(1) = Parrot_util_intval_mod(ICONST(2), IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_468: /* mod_i_i_ic */
+{
+    IREG(1) = Parrot_util_intval_mod(IREG(2), ICONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_469: /* mod_n_n_n */
+{
+    NREG(1) = Parrot_util_floatval_mod(NREG(2), NREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_470: /* mod_n_nc_n */
+{
+    NREG(1) = Parrot_util_floatval_mod(NCONST(2), NREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_471: /* mod_n_n_nc */
+{
+    NREG(1) = Parrot_util_floatval_mod(NREG(2), NCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_472: /* mod_p_p_p */
+{
+    PREG(1) = VTABLE_modulus(interp, PREG(2), PREG(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_473: /* mod_p_p_i */
+{
+    PREG(1) = VTABLE_modulus_int(interp, PREG(2), IREG(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_474: /* mod_p_p_ic */
+{
+    PREG(1) = VTABLE_modulus_int(interp, PREG(2), ICONST(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_475: /* mod_p_p_n */
+{
+    PREG(1) = VTABLE_modulus_float(interp, PREG(2), NREG(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_476: /* mod_p_p_nc */
+{
+    PREG(1) = VTABLE_modulus_float(interp, PREG(2), NCONST(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_477: /* mul_i_i */
+{
+    (IREG(1) *= IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_478: /* mul_i_ic */
+{
+    (IREG(1) *= ICONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_479: /* mul_n_n */
+{
+    (NREG(1) *= NREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_480: /* mul_n_nc */
+{
+    (NREG(1) *= NCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_481: /* mul_p_p */
+{
+    VTABLE_i_multiply(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_482: /* mul_p_i */
+{
+    VTABLE_i_multiply_int(interp, PREG(1), IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_483: /* mul_p_ic */
+{
+    VTABLE_i_multiply_int(interp, PREG(1), ICONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_484: /* mul_p_n */
+{
+    VTABLE_i_multiply_float(interp, PREG(1), NREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_485: /* mul_p_nc */
+{
+    VTABLE_i_multiply_float(interp, PREG(1), NCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_486: /* mul_i_i_i */
+{
+    IREG(1) = (IREG(2) * IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_487: /* mul_i_ic_i */
+{
+    IREG(1) = (ICONST(2) * IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_488: /* mul_i_i_ic */
+{
+    IREG(1) = (IREG(2) * ICONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_489: /* mul_n_n_n */
+{
+    NREG(1) = (NREG(2) * NREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_490: /* mul_n_nc_n */
+{
+    NREG(1) = (NCONST(2) * NREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_491: /* mul_n_n_nc */
+{
+    NREG(1) = (NREG(2) * NCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_492: /* mul_p_p_p */
+{
+    PREG(1) = VTABLE_multiply(interp, PREG(2), PREG(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_493: /* mul_p_p_i */
+{
+    PREG(1) = VTABLE_multiply_int(interp, PREG(2), IREG(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_494: /* mul_p_p_ic */
+{
+    PREG(1) = VTABLE_multiply_int(interp, PREG(2), ICONST(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_495: /* mul_p_p_n */
+{
+    PREG(1) = VTABLE_multiply_float(interp, PREG(2), NREG(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_496: /* mul_p_p_nc */
+{
+    PREG(1) = VTABLE_multiply_float(interp, PREG(2), NCONST(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_497: /* neg_i */
+{
+    IREG(1) = (-IREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_498: /* neg_n */
+{
+    NREG(1) = (-NREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_499: /* neg_p */
+{
+    VTABLE_i_neg(interp, PREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_500: /* neg_i_i */
+{
+    IREG(1) = (-IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_501: /* neg_n_n */
+{
+    NREG(1) = (-NREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_502: /* neg_p_p */
+{
+    PREG(1) = VTABLE_neg(interp, PREG(2), PREG(1));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_503: /* sub_i_i */
+{
+    (IREG(1) -= IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_504: /* sub_i_ic */
+{
+    (IREG(1) -= ICONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_505: /* sub_n_n */
+{
+    (NREG(1) -= NREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_506: /* sub_n_nc */
+{
+    (NREG(1) -= NCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_507: /* sub_p_p */
+{
+    VTABLE_i_subtract(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_508: /* sub_p_i */
+{
+    VTABLE_i_subtract_int(interp, PREG(1), IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_509: /* sub_p_ic */
+{
+    VTABLE_i_subtract_int(interp, PREG(1), ICONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_510: /* sub_p_n */
+{
+    VTABLE_i_subtract_float(interp, PREG(1), NREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_511: /* sub_p_nc */
+{
+    VTABLE_i_subtract_float(interp, PREG(1), NCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_512: /* sub_i_i_i */
+{
+    IREG(1) = (IREG(2) - IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_513: /* sub_i_ic_i */
+{
+    IREG(1) = (ICONST(2) - IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_514: /* sub_i_i_ic */
+{
+    IREG(1) = (IREG(2) - ICONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_515: /* sub_n_n_n */
+{
+    NREG(1) = (NREG(2) - NREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_516: /* sub_n_nc_n */
+{
+    NREG(1) = (NCONST(2) - NREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_517: /* sub_n_n_nc */
+{
+    NREG(1) = (NREG(2) - NCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_518: /* sub_p_p_p */
+{
+    PREG(1) = VTABLE_subtract(interp, PREG(2), PREG(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_519: /* sub_p_p_i */
+{
+    PREG(1) = VTABLE_subtract_int(interp, PREG(2), IREG(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_520: /* sub_p_p_ic */
+{
+    PREG(1) = VTABLE_subtract_int(interp, PREG(2), ICONST(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_521: /* sub_p_p_n */
+{
+    PREG(1) = VTABLE_subtract_float(interp, PREG(2), NREG(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_522: /* sub_p_p_nc */
+{
+    PREG(1) = VTABLE_subtract_float(interp, PREG(2), NCONST(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_523: /* sqrt_n_n */
+{
+    NREG(1) = sqrt((FLOATVAL)NREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_524: /* is_inf_or_nan_i_n */
+{
+    IREG(1) = PARROT_FLOATVAL_IS_INF_OR_NAN(NREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_525: /* is_inf_or_nan_i_nc */
+{
+    IREG(1) = PARROT_FLOATVAL_IS_INF_OR_NAN(NCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_526: /* callmethodcc_p_s */
+{
+    PMC       * const  object = PREG(1);
+    STRING    * const  meth = SREG(2);
+    opcode_t  * const  next =  cur_opcode + 3;
+    PMC       * const  method_pmc = Parrot_find_method_inline_cached(interp, object, meth, CUR_OPCODE);
+    opcode_t  * dest = NULL;
+
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), next);
+    if ((!PMC_IS_NULL(method_pmc))) {
+        PMC  * const  signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+        Parrot_pcc_reuse_continuation(interp, CURRENT_CONTEXT(interp), next);
+        dest = VTABLE_invoke(interp, method_pmc, next);
+    }
+    else {
+        PMC  * const  _class = VTABLE_get_class(interp, object);
+
+        if (PMC_IS_NULL(_class)) {
+            dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for non-object", meth);
+        }
+        else {
+            dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for invocant of class '%Ss'", meth, VTABLE_get_string(interp, _class));
+        }
+
+    }
+
+    do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+}
+
+PC_527: /* callmethodcc_p_sc */
+{
+    PMC       * const  object = PREG(1);
+    STRING    * const  meth = SCONST(2);
+    opcode_t  * const  next =  cur_opcode + 3;
+    PMC       * const  method_pmc = Parrot_find_method_inline_cached(interp, object, meth, CUR_OPCODE);
+    opcode_t  * dest = NULL;
+
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), next);
+    if ((!PMC_IS_NULL(method_pmc))) {
+        PMC  * const  signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+        Parrot_pcc_reuse_continuation(interp, CURRENT_CONTEXT(interp), next);
+        dest = VTABLE_invoke(interp, method_pmc, next);
+    }
+    else {
+        PMC  * const  _class = VTABLE_get_class(interp, object);
+
+        if (PMC_IS_NULL(_class)) {
+            dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for non-object", meth);
+        }
+        else {
+            dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for invocant of class '%Ss'", meth, VTABLE_get_string(interp, _class));
+        }
+
+    }
+
+    do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+}
+
+PC_528: /* callmethodcc_p_p */
+{
+    opcode_t         * dest;
+    opcode_t  * const  next =  cur_opcode + 3;
+    PMC       *        signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), next);
+    Parrot_pcc_reuse_continuation(interp, CURRENT_CONTEXT(interp), next);
+    dest = VTABLE_invoke(interp, PREG(2), next);
+    do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+}
+
+PC_529: /* callmethod_p_s_p */
+{
+    PMC       * const  object = PREG(1);
+    STRING    * const  meth = SREG(2);
+    opcode_t  * const  next =  cur_opcode + 4;
+    PMC       * const  method_pmc = Parrot_find_method_inline_cached(interp, object, meth, CUR_OPCODE);
+    opcode_t  * dest;
+    PMC       *        signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), next);
+    if (PMC_IS_NULL(method_pmc)) {
+        dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for invocant of class '%Ss'", meth, VTABLE_get_string(interp, VTABLE_get_class(interp, object)));
+    }
+    else {
+        interp->current_cont = PREG(3);
+        dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);
+    }
+
+    do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+}
+
+PC_530: /* callmethod_p_sc_p */
+{
+    PMC       * const  object = PREG(1);
+    STRING    * const  meth = SCONST(2);
+    opcode_t  * const  next =  cur_opcode + 4;
+    PMC       * const  method_pmc = Parrot_find_method_inline_cached(interp, object, meth, CUR_OPCODE);
+    opcode_t  * dest;
+    PMC       *        signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), next);
+    if (PMC_IS_NULL(method_pmc)) {
+        dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for invocant of class '%Ss'", meth, VTABLE_get_string(interp, VTABLE_get_class(interp, object)));
+    }
+    else {
+        interp->current_cont = PREG(3);
+        dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);
+    }
+
+    do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+}
+
+PC_531: /* callmethod_p_p_p */
+{
+    PMC       * const  object = PREG(1);
+    PMC       * const  method_pmc = PREG(2);
+    opcode_t  * const  next =  cur_opcode + 4;
+    opcode_t  * dest;
+    PMC       *        signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), next);
+    interp->current_cont = PREG(3);
+    dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);
+    do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+}
+
+PC_532: /* tailcallmethod_p_s */
+{
+    opcode_t  * const  next =  cur_opcode + 3;
+    PMC       * const  object = PREG(1);
+    STRING    * const  meth = SREG(2);
+    PMC       * const  method_pmc = Parrot_find_method_inline_cached(interp, object, meth, CUR_OPCODE);
+    opcode_t  * dest;
+    PMC       *        signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+    if (PMC_IS_NULL(method_pmc)) {
+        dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for invocant of class '%Ss'", meth, VTABLE_get_string(interp, VTABLE_get_class(interp, object)));
+    }
+    else {
+        interp->current_cont = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
+        (PObj_get_FLAGS(interp->current_cont) |= SUB_FLAG_TAILCALL);
+        dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);
+    }
+
+    do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+}
+
+PC_533: /* tailcallmethod_p_sc */
+{
+    opcode_t  * const  next =  cur_opcode + 3;
+    PMC       * const  object = PREG(1);
+    STRING    * const  meth = SCONST(2);
+    PMC       * const  method_pmc = Parrot_find_method_inline_cached(interp, object, meth, CUR_OPCODE);
+    opcode_t  * dest;
+    PMC       *        signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+    if (PMC_IS_NULL(method_pmc)) {
+        dest = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for invocant of class '%Ss'", meth, VTABLE_get_string(interp, VTABLE_get_class(interp, object)));
+    }
+    else {
+        interp->current_cont = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
+        (PObj_get_FLAGS(interp->current_cont) |= SUB_FLAG_TAILCALL);
+        dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);
+    }
+
+    do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+}
+
+PC_534: /* tailcallmethod_p_p */
+{
+    opcode_t  * const  next =  cur_opcode + 3;
+    PMC       * const  object = PREG(1);
+    PMC       * const  method_pmc = PREG(2);
+    opcode_t  * dest;
+    PMC       *        signature = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+
+    interp->current_cont = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
+    (PObj_get_FLAGS(interp->current_cont) |= SUB_FLAG_TAILCALL);
+    dest = (opcode_t *)VTABLE_invoke(interp, method_pmc, next);
+    do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+}
+
+PC_535: /* addmethod_p_s_p */
+{
+    VTABLE_add_method(interp, PREG(1), SREG(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_536: /* addmethod_p_sc_p */
+{
+    VTABLE_add_method(interp, PREG(1), SCONST(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_537: /* can_i_p_s */
+{
+    PMC  * const  meth = VTABLE_find_method(interp, PREG(2), SREG(3));
+
+    IREG(1) = (!PMC_IS_NULL(meth));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_538: /* can_i_p_sc */
+{
+    PMC  * const  meth = VTABLE_find_method(interp, PREG(2), SCONST(3));
+
+    IREG(1) = (!PMC_IS_NULL(meth));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_539: /* does_i_p_s */
+{
+    IREG(1) = SREG(3) ? VTABLE_does(interp, PREG(2), SREG(3)) : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_540: /* does_i_p_sc */
+{
+    IREG(1) = SCONST(3) ? VTABLE_does(interp, PREG(2), SCONST(3)) : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_541: /* does_i_p_p */
+{
+    IREG(1) = PREG(3) ? VTABLE_does_pmc(interp, PREG(2), PREG(3)) : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_542: /* does_i_p_pc */
+{
+    IREG(1) = PCONST(3) ? VTABLE_does_pmc(interp, PREG(2), PCONST(3)) : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_543: /* isa_i_p_s */
+{
+    IREG(1) = SREG(3) ? VTABLE_isa(interp, PREG(2), SREG(3)) : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_544: /* isa_i_p_sc */
+{
+    IREG(1) = SCONST(3) ? VTABLE_isa(interp, PREG(2), SCONST(3)) : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_545: /* isa_i_p_p */
+{
+    IREG(1) = PREG(3) ? VTABLE_isa_pmc(interp, PREG(2), PREG(3)) : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_546: /* isa_i_p_pc */
+{
+    IREG(1) = PCONST(3) ? VTABLE_isa_pmc(interp, PREG(2), PCONST(3)) : 0;
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_547: /* newclass_p_s */
+{
+    PMC  * const  name = Parrot_pmc_new(interp, enum_class_String);
+
+    VTABLE_set_string_native(interp, name, SREG(2));
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, name);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_548: /* newclass_p_sc */
+{
+    PMC  * const  name = Parrot_pmc_new(interp, enum_class_String);
+
+    VTABLE_set_string_native(interp, name, SCONST(2));
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, name);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_549: /* newclass_p_p */
+{
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_550: /* newclass_p_pc */
+{
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_551: /* subclass_p_p */
+{
+    PMC       * const  parent_class = Parrot_oo_get_class(interp, PREG(2));
+    opcode_t  * const  next =  cur_opcode + 3;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = Parrot_pmc_new(interp, enum_class_Class);
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_552: /* subclass_p_pc */
+{
+    PMC       * const  parent_class = Parrot_oo_get_class(interp, PCONST(2));
+    opcode_t  * const  next =  cur_opcode + 3;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = Parrot_pmc_new(interp, enum_class_Class);
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_553: /* subclass_p_p_s */
+{
+    PMC       * const  parent_class = Parrot_oo_get_class(interp, PREG(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = Parrot_oo_newclass_from_str(interp, SREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_554: /* subclass_p_pc_s */
+{
+    PMC       * const  parent_class = Parrot_oo_get_class(interp, PCONST(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = Parrot_oo_newclass_from_str(interp, SREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_555: /* subclass_p_p_sc */
+{
+    PMC       * const  parent_class = Parrot_oo_get_class(interp, PREG(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = Parrot_oo_newclass_from_str(interp, SCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_556: /* subclass_p_pc_sc */
+{
+    PMC       * const  parent_class = Parrot_oo_get_class(interp, PCONST(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = Parrot_oo_newclass_from_str(interp, SCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_557: /* subclass_p_p_p */
+{
+    PMC       * const  parent_class = Parrot_oo_get_class(interp, PREG(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_558: /* subclass_p_pc_p */
+{
+    PMC       * const  parent_class = Parrot_oo_get_class(interp, PCONST(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_559: /* subclass_p_p_pc */
+{
+    PMC       * const  parent_class = Parrot_oo_get_class(interp, PREG(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PREG(2)));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_560: /* subclass_p_pc_pc */
+{
+    PMC       * const  parent_class = Parrot_oo_get_class(interp, PCONST(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", VTABLE_get_string(interp, PCONST(2)));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_561: /* subclass_p_s */
+{
+    PMC       * const  parent_class = Parrot_oo_get_class_str(interp, SREG(2));
+    opcode_t  * const  next =  cur_opcode + 3;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", SREG(2));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = Parrot_pmc_new(interp, enum_class_Class);
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_562: /* subclass_p_sc */
+{
+    PMC       * const  parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
+    opcode_t  * const  next =  cur_opcode + 3;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", SCONST(2));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = Parrot_pmc_new(interp, enum_class_Class);
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_563: /* subclass_p_s_s */
+{
+    PMC       * const  parent_class = Parrot_oo_get_class_str(interp, SREG(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", SREG(2));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = Parrot_oo_newclass_from_str(interp, SREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_564: /* subclass_p_sc_s */
+{
+    PMC       * const  parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", SCONST(2));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = Parrot_oo_newclass_from_str(interp, SREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_565: /* subclass_p_s_sc */
+{
+    PMC       * const  parent_class = Parrot_oo_get_class_str(interp, SREG(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", SREG(2));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = Parrot_oo_newclass_from_str(interp, SCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_566: /* subclass_p_sc_sc */
+{
+    PMC       * const  parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", SCONST(2));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = Parrot_oo_newclass_from_str(interp, SCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_567: /* subclass_p_s_p */
+{
+    PMC       * const  parent_class = Parrot_oo_get_class_str(interp, SREG(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", SREG(2));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_568: /* subclass_p_sc_p */
+{
+    PMC       * const  parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", SCONST(2));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PREG(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_569: /* subclass_p_s_pc */
+{
+    PMC       * const  parent_class = Parrot_oo_get_class_str(interp, SREG(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", SREG(2));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_570: /* subclass_p_sc_pc */
+{
+    PMC       * const  parent_class = Parrot_oo_get_class_str(interp, SCONST(2));
+    opcode_t  * const  next =  cur_opcode + 4;
+
+    if (PMC_IS_NULL(parent_class)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NO_CLASS, "Class '%Ss' doesn't exist", SCONST(2));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = Parrot_pmc_new_init(interp, enum_class_Class, PCONST(3));
+    VTABLE_add_parent(interp, PREG(1), parent_class);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_571: /* get_class_p_s */
+{
+    PREG(1) = Parrot_oo_get_class_str(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_572: /* get_class_p_sc */
+{
+    PREG(1) = Parrot_oo_get_class_str(interp, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_573: /* get_class_p_p */
+{
+    PREG(1) = Parrot_oo_get_class(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_574: /* get_class_p_pc */
+{
+    PREG(1) = Parrot_oo_get_class(interp, PCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_575: /* class_p_p */
+{
+    PREG(1) = VTABLE_get_class(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_576: /* addparent_p_p */
+{
+    VTABLE_add_parent(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_577: /* removeparent_p_p */
+{
+    VTABLE_remove_parent(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_578: /* addrole_p_p */
+{
+    VTABLE_add_role(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_579: /* addattribute_p_s */
+{
+    VTABLE_add_attribute(interp, PREG(1), SREG(2), PMCNULL);
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_580: /* addattribute_p_sc */
+{
+    VTABLE_add_attribute(interp, PREG(1), SCONST(2), PMCNULL);
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_581: /* removeattribute_p_s */
+{
+    VTABLE_remove_attribute(interp, PREG(1), SREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_582: /* removeattribute_p_sc */
+{
+    VTABLE_remove_attribute(interp, PREG(1), SCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_583: /* getattribute_p_p_s */
+{
+    PREG(1) = VTABLE_get_attr_str(interp, PREG(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_584: /* getattribute_p_p_sc */
+{
+    PREG(1) = VTABLE_get_attr_str(interp, PREG(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_585: /* getattribute_p_p_p_s */
+{
+    PREG(1) = VTABLE_get_attr_keyed(interp, PREG(2), PREG(3), SREG(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_586: /* getattribute_p_p_pc_s */
+{
+    PREG(1) = VTABLE_get_attr_keyed(interp, PREG(2), PCONST(3), SREG(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_587: /* getattribute_p_p_p_sc */
+{
+    PREG(1) = VTABLE_get_attr_keyed(interp, PREG(2), PREG(3), SCONST(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_588: /* getattribute_p_p_pc_sc */
+{
+    PREG(1) = VTABLE_get_attr_keyed(interp, PREG(2), PCONST(3), SCONST(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_589: /* setattribute_p_s_p */
+{
+    VTABLE_set_attr_str(interp, PREG(1), SREG(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_590: /* setattribute_p_sc_p */
+{
+    VTABLE_set_attr_str(interp, PREG(1), SCONST(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_591: /* setattribute_p_p_s_p */
+{
+    VTABLE_set_attr_keyed(interp, PREG(1), PREG(2), SREG(3), PREG(4));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_592: /* setattribute_p_pc_s_p */
+{
+    VTABLE_set_attr_keyed(interp, PREG(1), PCONST(2), SREG(3), PREG(4));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_593: /* setattribute_p_p_sc_p */
+{
+    VTABLE_set_attr_keyed(interp, PREG(1), PREG(2), SCONST(3), PREG(4));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_594: /* setattribute_p_pc_sc_p */
+{
+    VTABLE_set_attr_keyed(interp, PREG(1), PCONST(2), SCONST(3), PREG(4));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_595: /* inspect_p_p */
+{
+    PREG(1) = VTABLE_inspect(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_596: /* inspect_p_pc */
+{
+    PREG(1) = VTABLE_inspect(interp, PCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_597: /* inspect_p_p_s */
+{
+    PREG(1) = VTABLE_inspect_str(interp, PREG(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_598: /* inspect_p_pc_s */
+{
+    PREG(1) = VTABLE_inspect_str(interp, PCONST(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_599: /* inspect_p_p_sc */
+{
+    PREG(1) = VTABLE_inspect_str(interp, PREG(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_600: /* inspect_p_pc_sc */
+{
+    PREG(1) = VTABLE_inspect_str(interp, PCONST(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_601: /* new_p_s */
+{
+    STRING  * const  name = SREG(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if ((!PMC_IS_NULL(_class))) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if ((type <= 0)) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new(interp, type);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_602: /* new_p_sc */
+{
+    STRING  * const  name = SCONST(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if ((!PMC_IS_NULL(_class))) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if ((type <= 0)) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new(interp, type);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_603: /* new_p_s_p */
+{
+    STRING  * const  name = SREG(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if ((!PMC_IS_NULL(_class))) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if ((type <= 0)) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new_init(interp, type, PREG(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_604: /* new_p_sc_p */
+{
+    STRING  * const  name = SCONST(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if ((!PMC_IS_NULL(_class))) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if ((type <= 0)) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new_init(interp, type, PREG(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_605: /* new_p_s_pc */
+{
+    STRING  * const  name = SREG(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if ((!PMC_IS_NULL(_class))) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if ((type <= 0)) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new_init(interp, type, PCONST(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_606: /* new_p_sc_pc */
+{
+    STRING  * const  name = SCONST(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if ((!PMC_IS_NULL(_class))) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if ((type <= 0)) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new_init(interp, type, PCONST(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_607: /* new_p_p */
+{
+    PMC  * const  name_key = PREG(2);
+    PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+
+    if ((!PMC_IS_NULL(_class))) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+        if ((type <= 0)) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new(interp, type);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_608: /* new_p_pc */
+{
+    PMC  * const  name_key = PCONST(2);
+    PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+
+    if ((!PMC_IS_NULL(_class))) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+        if ((type <= 0)) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new(interp, type);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_609: /* new_p_p_p */
+{
+    PMC  * const  name_key = PREG(2);
+    PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+
+    if ((!PMC_IS_NULL(_class))) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+        if ((type <= 0)) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new_init(interp, type, PREG(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_610: /* new_p_pc_p */
+{
+    PMC  * const  name_key = PCONST(2);
+    PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+
+    if ((!PMC_IS_NULL(_class))) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+        if ((type <= 0)) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new_init(interp, type, PREG(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_611: /* new_p_p_pc */
+{
+    PMC  * const  name_key = PREG(2);
+    PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+
+    if ((!PMC_IS_NULL(_class))) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+        if ((type <= 0)) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new_init(interp, type, PCONST(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_612: /* new_p_pc_pc */
+{
+    PMC  * const  name_key = PCONST(2);
+    PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+
+    if ((!PMC_IS_NULL(_class))) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+        if ((type <= 0)) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new_init(interp, type, PCONST(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_613: /* root_new_p_p */
+{
+    PMC  * const  key = PREG(2);
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC  *  classobj = PMCNULL;
+
+    if ((!PMC_IS_NULL(ns))) {
+        classobj = Parrot_oo_get_class(interp, ns);
+    }
+
+    if ((!PMC_IS_NULL(classobj))) {
+        PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+    }
+    else {
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, key));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_614: /* root_new_p_pc */
+{
+    PMC  * const  key = PCONST(2);
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC  *  classobj = PMCNULL;
+
+    if ((!PMC_IS_NULL(ns))) {
+        classobj = Parrot_oo_get_class(interp, ns);
+    }
+
+    if ((!PMC_IS_NULL(classobj))) {
+        PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+    }
+    else {
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, key));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_615: /* root_new_p_p_p */
+{
+    PMC  * const  key = PREG(2);
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC  *  classobj = PMCNULL;
+
+    if ((!PMC_IS_NULL(ns))) {
+        classobj = Parrot_oo_get_class(interp, ns);
+    }
+
+    if ((!PMC_IS_NULL(classobj))) {
+        PREG(1) = VTABLE_instantiate(interp, classobj, PREG(3));
+    }
+    else {
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, key));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_616: /* root_new_p_pc_p */
+{
+    PMC  * const  key = PCONST(2);
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC  *  classobj = PMCNULL;
+
+    if ((!PMC_IS_NULL(ns))) {
+        classobj = Parrot_oo_get_class(interp, ns);
+    }
+
+    if ((!PMC_IS_NULL(classobj))) {
+        PREG(1) = VTABLE_instantiate(interp, classobj, PREG(3));
+    }
+    else {
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, key));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_617: /* root_new_p_p_pc */
+{
+    PMC  * const  key = PREG(2);
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC  *  classobj = PMCNULL;
+
+    if ((!PMC_IS_NULL(ns))) {
+        classobj = Parrot_oo_get_class(interp, ns);
+    }
+
+    if ((!PMC_IS_NULL(classobj))) {
+        PREG(1) = VTABLE_instantiate(interp, classobj, PCONST(3));
+    }
+    else {
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, key));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_618: /* root_new_p_pc_pc */
+{
+    PMC  * const  key = PCONST(2);
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC  *  classobj = PMCNULL;
+
+    if ((!PMC_IS_NULL(ns))) {
+        classobj = Parrot_oo_get_class(interp, ns);
+    }
+
+    if ((!PMC_IS_NULL(classobj))) {
+        PREG(1) = VTABLE_instantiate(interp, classobj, PCONST(3));
+    }
+    else {
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, key));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_619: /* typeof_s_p */
+{
+    SREG(1) = VTABLE_name(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_620: /* typeof_p_p */
+{
+    PREG(1) = VTABLE_get_class(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_621: /* get_repr_s_p */
+{
+    SREG(1) = VTABLE_get_repr(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_622: /* find_method_p_p_s */
+{
+    opcode_t  * const  resume =  cur_opcode + 4;
+
+    PREG(1) = VTABLE_find_method(interp, PREG(2), SREG(3));
+    if ((PMC_IS_NULL(PREG(1)) || (!VTABLE_defined(interp, PREG(1))))) {
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp, resume, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for invocant of class '%Ss'", SREG(3), VTABLE_get_string(interp, VTABLE_get_class(interp, PREG(2))));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+    }
+
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(resume); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_623: /* find_method_p_p_sc */
+{
+    opcode_t  * const  resume =  cur_opcode + 4;
+
+    PREG(1) = VTABLE_find_method(interp, PREG(2), SCONST(3));
+    if ((PMC_IS_NULL(PREG(1)) || (!VTABLE_defined(interp, PREG(1))))) {
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp, resume, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for invocant of class '%Ss'", SCONST(3), VTABLE_get_string(interp, VTABLE_get_class(interp, PREG(2))));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+    }
+
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(resume); CG_JUMP(); } while (0);
+    }
+
+}
+
+PC_624: /* defined_i_p */
+{
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined(interp, PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_625: /* defined_i_p_ki */
+{
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed_int(interp, PREG(2), IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_626: /* defined_i_p_kic */
+{
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed_int(interp, PREG(2), ICONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_627: /* defined_i_p_k */
+{
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed(interp, PREG(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_628: /* defined_i_p_kc */
+{
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed(interp, PREG(2), PCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_629: /* exists_i_p_ki */
+{
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_exists_keyed_int(interp, PREG(2), IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_630: /* exists_i_p_kic */
+{
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_exists_keyed_int(interp, PREG(2), ICONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_631: /* exists_i_p_k */
+{
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_exists_keyed(interp, PREG(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_632: /* exists_i_p_kc */
+{
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_exists_keyed(interp, PREG(2), PCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_633: /* delete_p_k */
+{
+    VTABLE_delete_keyed(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_634: /* delete_p_kc */
+{
+    VTABLE_delete_keyed(interp, PREG(1), PCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_635: /* delete_p_ki */
+{
+    VTABLE_delete_keyed_int(interp, PREG(1), IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_636: /* delete_p_kic */
+{
+    VTABLE_delete_keyed_int(interp, PREG(1), ICONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_637: /* elements_i_p */
+{
+    IREG(1) = VTABLE_elements(interp, PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_638: /* push_p_i */
+{
+    VTABLE_push_integer(interp, PREG(1), IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_639: /* push_p_ic */
+{
+    VTABLE_push_integer(interp, PREG(1), ICONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_640: /* push_p_n */
+{
+    VTABLE_push_float(interp, PREG(1), NREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_641: /* push_p_nc */
+{
+    VTABLE_push_float(interp, PREG(1), NCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_642: /* push_p_s */
+{
+    VTABLE_push_string(interp, PREG(1), SREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_643: /* push_p_sc */
+{
+    VTABLE_push_string(interp, PREG(1), SCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_644: /* push_p_p */
+{
+    VTABLE_push_pmc(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_645: /* pop_i_p */
+{
+    IREG(1) = VTABLE_pop_integer(interp, PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_646: /* pop_n_p */
+{
+    NREG(1) = VTABLE_pop_float(interp, PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_647: /* pop_s_p */
+{
+    SREG(1) = VTABLE_pop_string(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_648: /* pop_p_p */
+{
+    PREG(1) = VTABLE_pop_pmc(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_649: /* unshift_p_i */
+{
+    VTABLE_unshift_integer(interp, PREG(1), IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_650: /* unshift_p_ic */
+{
+    VTABLE_unshift_integer(interp, PREG(1), ICONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_651: /* unshift_p_n */
+{
+    VTABLE_unshift_float(interp, PREG(1), NREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_652: /* unshift_p_nc */
+{
+    VTABLE_unshift_float(interp, PREG(1), NCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_653: /* unshift_p_s */
+{
+    VTABLE_unshift_string(interp, PREG(1), SREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_654: /* unshift_p_sc */
+{
+    VTABLE_unshift_string(interp, PREG(1), SCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_655: /* unshift_p_p */
+{
+    VTABLE_unshift_pmc(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_656: /* shift_i_p */
+{
+    IREG(1) = VTABLE_shift_integer(interp, PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_657: /* shift_n_p */
+{
+    NREG(1) = VTABLE_shift_float(interp, PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_658: /* shift_s_p */
+{
+    SREG(1) = VTABLE_shift_string(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_659: /* shift_p_p */
+{
+    PREG(1) = VTABLE_shift_pmc(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_660: /* splice_p_p_i_i */
+{
+    VTABLE_splice(interp, PREG(1), PREG(2), IREG(3), IREG(4));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_661: /* splice_p_p_ic_i */
+{
+    VTABLE_splice(interp, PREG(1), PREG(2), ICONST(3), IREG(4));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_662: /* splice_p_p_i_ic */
+{
+    VTABLE_splice(interp, PREG(1), PREG(2), IREG(3), ICONST(4));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_663: /* splice_p_p_ic_ic */
+{
+    VTABLE_splice(interp, PREG(1), PREG(2), ICONST(3), ICONST(4));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_664: /* setprop_p_s_p */
+{
+    Parrot_pmc_setprop(interp, PREG(1), SREG(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_665: /* setprop_p_sc_p */
+{
+    Parrot_pmc_setprop(interp, PREG(1), SCONST(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_666: /* getprop_p_s_p */
+{
+    Parrot_warn_deprecated(interp, "getprop_p_s_p is deprecated. Use getprop_p_p_s instead");
+    PREG(1) = Parrot_pmc_getprop(interp, PREG(3), SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_667: /* getprop_p_sc_p */
+{
+    Parrot_warn_deprecated(interp, "getprop_p_s_p is deprecated. Use getprop_p_p_s instead");
+    PREG(1) = Parrot_pmc_getprop(interp, PREG(3), SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_668: /* getprop_p_p_s */
+{
+    PREG(1) = Parrot_pmc_getprop(interp, PREG(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_669: /* getprop_p_p_sc */
+{
+    PREG(1) = Parrot_pmc_getprop(interp, PREG(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_670: /* delprop_p_s */
+{
+    Parrot_pmc_delprop(interp, PREG(1), SREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_671: /* delprop_p_sc */
+{
+    Parrot_pmc_delprop(interp, PREG(1), SCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_672: /* prophash_p_p */
+{
+    PREG(1) = Parrot_pmc_getprops(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_673: /* freeze_s_p */
+{
+    SREG(1) = Parrot_freeze(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_674: /* thaw_p_s */
+{
+    PREG(1) = Parrot_thaw(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_675: /* thaw_p_sc */
+{
+    PREG(1) = Parrot_thaw(interp, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_676: /* add_multi_s_s_p */
+{
+    Parrot_mmd_add_multi_from_long_sig(interp, SREG(1), SREG(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_677: /* add_multi_sc_s_p */
+{
+    Parrot_mmd_add_multi_from_long_sig(interp, SCONST(1), SREG(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_678: /* add_multi_s_sc_p */
+{
+    Parrot_mmd_add_multi_from_long_sig(interp, SREG(1), SCONST(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_679: /* add_multi_sc_sc_p */
+{
+    Parrot_mmd_add_multi_from_long_sig(interp, SCONST(1), SCONST(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_680: /* find_multi_p_s_s */
+{
+    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SREG(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_681: /* find_multi_p_sc_s */
+{
+    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SCONST(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_682: /* find_multi_p_s_sc */
+{
+    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SREG(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_683: /* find_multi_p_sc_sc */
+{
+    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SCONST(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_684: /* register_p */
+{
+    Parrot_pmc_gc_register(interp, PREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_685: /* unregister_p */
+{
+    Parrot_pmc_gc_unregister(interp, PREG(1));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_686: /* box_p_i */
+{
+    PREG(1) = Parrot_pmc_box_integer(interp, IREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_687: /* box_p_ic */
+{
+    PREG(1) = Parrot_pmc_box_integer(interp, ICONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_688: /* box_p_n */
+{
+    PREG(1) = Parrot_pmc_box_number(interp, NREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_689: /* box_p_nc */
+{
+    PREG(1) = Parrot_pmc_box_number(interp, NCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_690: /* box_p_s */
+{
+    PREG(1) = Parrot_pmc_box_string(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_691: /* box_p_sc */
+{
+    PREG(1) = Parrot_pmc_box_string(interp, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_692: /* iter_p_p */
+{
+    PREG(1) = VTABLE_get_iter(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_693: /* morph_p_p */
+{
+    VTABLE_morph(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_694: /* morph_p_pc */
+{
+    VTABLE_morph(interp, PREG(1), PCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_695: /* clone_s_s */
+{
+    SREG(1) = STRING_IS_NULL(SREG(2)) ? Parrot_str_new(interp, NULL, 0) : SREG(2);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_696: /* clone_s_sc */
+{
+    SREG(1) = STRING_IS_NULL(SCONST(2)) ? Parrot_str_new(interp, NULL, 0) : SCONST(2);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_697: /* set_i_i */
+{
+    IREG(1) = IREG(2);
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_698: /* set_i_ic */
+{
+    IREG(1) = ICONST(2);
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_699: /* set_i_n */
+{
+    IREG(1) = (INTVAL)NREG(2);
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_700: /* set_i_nc */
+{
+    IREG(1) = (INTVAL)NCONST(2);
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_701: /* set_i_s */
+{
+    IREG(1) = Parrot_str_to_int(interp, SREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_702: /* set_i_sc */
+{
+    IREG(1) = Parrot_str_to_int(interp, SCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_703: /* set_n_n */
+{
+    NREG(1) = NREG(2);
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_704: /* set_n_nc */
+{
+    NREG(1) = NCONST(2);
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_705: /* set_n_i */
+{
+    NREG(1) = (FLOATVAL)IREG(2);
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_706: /* set_n_ic */
+{
+    NREG(1) = (FLOATVAL)ICONST(2);
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_707: /* set_n_s */
+{
+    NREG(1) = Parrot_str_to_num(interp, SREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_708: /* set_n_sc */
+{
+    NREG(1) = Parrot_str_to_num(interp, SCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_709: /* set_n_p */
+{
+    NREG(1) = VTABLE_get_number(interp, PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_710: /* set_s_p */
+{
+    SREG(1) = VTABLE_get_string(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_711: /* set_s_s */
+{
+    SREG(1) = SREG(2);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_712: /* set_s_sc */
+{
+    SREG(1) = SCONST(2);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_713: /* set_s_i */
+{
+    SREG(1) = Parrot_str_from_int(interp, IREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_714: /* set_s_ic */
+{
+    SREG(1) = Parrot_str_from_int(interp, ICONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_715: /* set_s_n */
+{
+    SREG(1) = Parrot_str_from_num(interp, NREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_716: /* set_s_nc */
+{
+    SREG(1) = Parrot_str_from_num(interp, NCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_717: /* set_p_pc */
+{
+    PREG(1) = PCONST(2);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_718: /* set_p_p */
+{
+    PREG(1) = PREG(2);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_719: /* set_p_i */
+{
+    VTABLE_set_integer_native(interp, PREG(1), IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_720: /* set_p_ic */
+{
+    VTABLE_set_integer_native(interp, PREG(1), ICONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_721: /* set_p_n */
+{
+    VTABLE_set_number_native(interp, PREG(1), NREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_722: /* set_p_nc */
+{
+    VTABLE_set_number_native(interp, PREG(1), NCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_723: /* set_p_s */
+{
+    VTABLE_set_string_native(interp, PREG(1), SREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_724: /* set_p_sc */
+{
+    VTABLE_set_string_native(interp, PREG(1), SCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_725: /* set_i_p */
+{
+    IREG(1) = VTABLE_get_integer(interp, PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_726: /* assign_p_p */
+{
+    VTABLE_assign_pmc(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_727: /* assign_p_i */
+{
+    VTABLE_set_integer_native(interp, PREG(1), IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_728: /* assign_p_ic */
+{
+    VTABLE_set_integer_native(interp, PREG(1), ICONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_729: /* assign_p_n */
+{
+    VTABLE_set_number_native(interp, PREG(1), NREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_730: /* assign_p_nc */
+{
+    VTABLE_set_number_native(interp, PREG(1), NCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_731: /* assign_p_s */
+{
+    VTABLE_assign_string_native(interp, PREG(1), SREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_732: /* assign_p_sc */
+{
+    VTABLE_assign_string_native(interp, PREG(1), SCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_733: /* assign_s_s */
+{
+    SREG(1) = SREG(2);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_734: /* assign_s_sc */
+{
+    SREG(1) = SCONST(2);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_735: /* setref_p_p */
+{
+    VTABLE_set_pmc(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_736: /* deref_p_p */
+{
+    PREG(1) = VTABLE_get_pmc(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_737: /* set_p_ki_i */
+{
+    VTABLE_set_integer_keyed_int(interp, PREG(1), IREG(2), IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_738: /* set_p_kic_i */
+{
+    VTABLE_set_integer_keyed_int(interp, PREG(1), ICONST(2), IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_739: /* set_p_ki_ic */
+{
+    VTABLE_set_integer_keyed_int(interp, PREG(1), IREG(2), ICONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_740: /* set_p_kic_ic */
+{
+    VTABLE_set_integer_keyed_int(interp, PREG(1), ICONST(2), ICONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_741: /* set_p_ki_n */
+{
+    VTABLE_set_number_keyed_int(interp, PREG(1), IREG(2), NREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_742: /* set_p_kic_n */
+{
+    VTABLE_set_number_keyed_int(interp, PREG(1), ICONST(2), NREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_743: /* set_p_ki_nc */
+{
+    VTABLE_set_number_keyed_int(interp, PREG(1), IREG(2), NCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_744: /* set_p_kic_nc */
+{
+    VTABLE_set_number_keyed_int(interp, PREG(1), ICONST(2), NCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_745: /* set_p_ki_s */
+{
+    VTABLE_set_string_keyed_int(interp, PREG(1), IREG(2), SREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_746: /* set_p_kic_s */
+{
+    VTABLE_set_string_keyed_int(interp, PREG(1), ICONST(2), SREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_747: /* set_p_ki_sc */
+{
+    VTABLE_set_string_keyed_int(interp, PREG(1), IREG(2), SCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_748: /* set_p_kic_sc */
+{
+    VTABLE_set_string_keyed_int(interp, PREG(1), ICONST(2), SCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_749: /* set_p_ki_p */
+{
+    VTABLE_set_pmc_keyed_int(interp, PREG(1), IREG(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_750: /* set_p_kic_p */
+{
+    VTABLE_set_pmc_keyed_int(interp, PREG(1), ICONST(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_751: /* set_i_p_ki */
+{
+    IREG(1) = VTABLE_get_integer_keyed_int(interp, PREG(2), IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_752: /* set_i_p_kic */
+{
+    IREG(1) = VTABLE_get_integer_keyed_int(interp, PREG(2), ICONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_753: /* set_n_p_ki */
+{
+    NREG(1) = VTABLE_get_number_keyed_int(interp, PREG(2), IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_754: /* set_n_p_kic */
+{
+    NREG(1) = VTABLE_get_number_keyed_int(interp, PREG(2), ICONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_755: /* set_s_p_ki */
+{
+    SREG(1) = VTABLE_get_string_keyed_int(interp, PREG(2), IREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_756: /* set_s_p_kic */
+{
+    SREG(1) = VTABLE_get_string_keyed_int(interp, PREG(2), ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_757: /* set_p_p_ki */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_758: /* set_p_p_kic */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_759: /* set_p_k_i */
+{
+    VTABLE_set_integer_keyed(interp, PREG(1), PREG(2), IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_760: /* set_p_kc_i */
+{
+    VTABLE_set_integer_keyed(interp, PREG(1), PCONST(2), IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_761: /* set_p_k_ic */
+{
+    VTABLE_set_integer_keyed(interp, PREG(1), PREG(2), ICONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_762: /* set_p_kc_ic */
+{
+    VTABLE_set_integer_keyed(interp, PREG(1), PCONST(2), ICONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_763: /* set_p_k_n */
+{
+    VTABLE_set_number_keyed(interp, PREG(1), PREG(2), NREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_764: /* set_p_kc_n */
+{
+    VTABLE_set_number_keyed(interp, PREG(1), PCONST(2), NREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_765: /* set_p_k_nc */
+{
+    VTABLE_set_number_keyed(interp, PREG(1), PREG(2), NCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_766: /* set_p_kc_nc */
+{
+    VTABLE_set_number_keyed(interp, PREG(1), PCONST(2), NCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_767: /* set_p_k_s */
+{
+    VTABLE_set_string_keyed(interp, PREG(1), PREG(2), SREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_768: /* set_p_kc_s */
+{
+    VTABLE_set_string_keyed(interp, PREG(1), PCONST(2), SREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_769: /* set_p_k_sc */
+{
+    VTABLE_set_string_keyed(interp, PREG(1), PREG(2), SCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_770: /* set_p_kc_sc */
+{
+    VTABLE_set_string_keyed(interp, PREG(1), PCONST(2), SCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_771: /* set_p_k_p */
+{
+    VTABLE_set_pmc_keyed(interp, PREG(1), PREG(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_772: /* set_p_kc_p */
+{
+    VTABLE_set_pmc_keyed(interp, PREG(1), PCONST(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_773: /* set_i_p_k */
+{
+    IREG(1) = VTABLE_get_integer_keyed(interp, PREG(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_774: /* set_i_p_kc */
+{
+    IREG(1) = VTABLE_get_integer_keyed(interp, PREG(2), PCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_775: /* set_n_p_k */
+{
+    NREG(1) = VTABLE_get_number_keyed(interp, PREG(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_776: /* set_n_p_kc */
+{
+    NREG(1) = VTABLE_get_number_keyed(interp, PREG(2), PCONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_777: /* set_s_p_k */
+{
+    SREG(1) = VTABLE_get_string_keyed(interp, PREG(2), PREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_778: /* set_s_p_kc */
+{
+    SREG(1) = VTABLE_get_string_keyed(interp, PREG(2), PCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_779: /* set_p_p_k */
+{
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_780: /* set_p_p_kc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_781: /* clone_p_p */
+{
+    PREG(1) = VTABLE_clone(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_782: /* clone_p_p_p */
+{
+    PREG(1) = VTABLE_clone_pmc(interp, PREG(2), PREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_783: /* clone_p_p_pc */
+{
+    PREG(1) = VTABLE_clone_pmc(interp, PREG(2), PCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_784: /* copy_p_p */
+{
+    if (PMC_IS_NULL(PREG(1))) {
+        opcode_t  * const  dest =  cur_opcode + 3;
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_NULL_REG_ACCESS, "Null PMC in copy");
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+    else {
+        PMC    * const  clone = VTABLE_clone(interp, PREG(2));
+        PMC    * const  meta = Parrot_pmc_getprops(interp, PREG(1));
+        const Parrot_UInt   gc_flags = (PREG(1)->flags & PObj_GC_all_FLAGS);
+
+        Parrot_pmc_destroy(interp, PREG(1));
+        memmove(PREG(1), clone, sizeof(PMC));
+        (PREG(1)->flags |= gc_flags);
+        PARROT_GC_WRITE_BARRIER(interp, PREG(1));
+        PObj_custom_destroy_CLEAR(clone);
+        PMC_data(clone) = NULL;
+        PMC_metadata(clone) = NULL;
+        if ((!PMC_IS_NULL(meta))) {
+            PMC  * const  iter = VTABLE_get_iter(interp, meta);
+
+            while (VTABLE_get_bool(interp, iter)) {
+                STRING  * const  key = VTABLE_shift_string(interp, iter);
+                PMC  * const  value = VTABLE_get_pmc_keyed_str(interp, meta, key);
+
+                Parrot_pmc_setprop(interp, PREG(1), key, value);
+            }
+
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_785: /* null_s */
+{
+    SREG(1) = STRINGNULL;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_786: /* null_i */
+{
+    IREG(1) = 0;
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_787: /* null_p */
+{
+    PREG(1) = PMCNULL;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_788: /* null_n */
+{
+    NREG(1) = 0;
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_789: /* ord_i_s */
+{
+    IREG(1) = STRING_ord(interp, SREG(2), 0);
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_790: /* ord_i_sc */
+{
+    IREG(1) = STRING_ord(interp, SCONST(2), 0);
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_791: /* ord_i_s_i */
+{
+    IREG(1) = STRING_ord(interp, SREG(2), IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_792: /* ord_i_sc_i */
+{
+    IREG(1) = STRING_ord(interp, SCONST(2), IREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_793: /* ord_i_s_ic */
+{
+    IREG(1) = STRING_ord(interp, SREG(2), ICONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_794: /* ord_i_sc_ic */
+{
+    IREG(1) = STRING_ord(interp, SCONST(2), ICONST(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_795: /* chr_s_i */
+{
+    STRING  * const  s = Parrot_str_chr(interp, (UINTVAL)IREG(2));
+
+    SREG(1) = s;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_796: /* chr_s_ic */
+{
+    STRING  * const  s = Parrot_str_chr(interp, (UINTVAL)ICONST(2));
+
+    SREG(1) = s;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_797: /* chopn_s_s_i */
+{
+    SREG(1) = Parrot_str_chopn(interp, SREG(2), IREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_798: /* chopn_s_sc_i */
+{
+    SREG(1) = Parrot_str_chopn(interp, SCONST(2), IREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_799: /* chopn_s_s_ic */
+{
+    SREG(1) = Parrot_str_chopn(interp, SREG(2), ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_800: /* chopn_s_sc_ic */
+{
+    SREG(1) = Parrot_str_chopn(interp, SCONST(2), ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_801: /* concat_p_p */
+{
+    VTABLE_i_concatenate(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_802: /* concat_p_s */
+{
+    VTABLE_i_concatenate_str(interp, PREG(1), SREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_803: /* concat_p_sc */
+{
+    VTABLE_i_concatenate_str(interp, PREG(1), SCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_804: /* concat_s_s_s */
+{
+    SREG(1) = Parrot_str_concat(interp, SREG(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_805: /* concat_s_sc_s */
+{
+    SREG(1) = Parrot_str_concat(interp, SCONST(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_806: /* concat_s_s_sc */
+{
+    SREG(1) = Parrot_str_concat(interp, SREG(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_807: /* concat_p_p_s */
+{
+    PREG(1) = VTABLE_concatenate_str(interp, PREG(2), SREG(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_808: /* concat_p_p_sc */
+{
+    PREG(1) = VTABLE_concatenate_str(interp, PREG(2), SCONST(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_809: /* concat_p_p_p */
+{
+    PREG(1) = VTABLE_concatenate(interp, PREG(2), PREG(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_810: /* repeat_s_s_i */
+{
+    if ((IREG(3) < 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    SREG(1) = Parrot_str_repeat(interp, SREG(2), (UINTVAL)IREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_811: /* repeat_s_sc_i */
+{
+    if ((IREG(3) < 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    SREG(1) = Parrot_str_repeat(interp, SCONST(2), (UINTVAL)IREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_812: /* repeat_s_s_ic */
+{
+    if ((ICONST(3) < 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    SREG(1) = Parrot_str_repeat(interp, SREG(2), (UINTVAL)ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_813: /* repeat_s_sc_ic */
+{
+    if ((ICONST(3) < 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    SREG(1) = Parrot_str_repeat(interp, SCONST(2), (UINTVAL)ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_814: /* repeat_p_p_i */
+{
+    if ((IREG(3) < 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = VTABLE_repeat_int(interp, PREG(2), IREG(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_815: /* repeat_p_p_ic */
+{
+    if ((ICONST(3) < 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = VTABLE_repeat_int(interp, PREG(2), ICONST(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_816: /* repeat_p_p_p */
+{
+    if ((VTABLE_get_integer(interp, PREG(3)) < 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = VTABLE_repeat(interp, PREG(2), PREG(3), PREG(1));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_817: /* repeat_p_i */
+{
+    VTABLE_i_repeat_int(interp, PREG(1), IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_818: /* repeat_p_ic */
+{
+    VTABLE_i_repeat_int(interp, PREG(1), ICONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_819: /* repeat_p_p */
+{
+    VTABLE_i_repeat(interp, PREG(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_820: /* length_i_s */
+{
+    IREG(1) = Parrot_str_length(interp, SREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_821: /* length_i_sc */
+{
+    IREG(1) = Parrot_str_length(interp, SCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_822: /* bytelength_i_s */
+{
+    IREG(1) = Parrot_str_byte_length(interp, SREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_823: /* bytelength_i_sc */
+{
+    IREG(1) = Parrot_str_byte_length(interp, SCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_824: /* pin_s */
+{
+    Parrot_str_pin(interp, SREG(1));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_825: /* unpin_s */
+{
+    Parrot_str_unpin(interp, SREG(1));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_826: /* substr_s_s_i */
+{
+    const INTVAL   len = Parrot_str_byte_length(interp, SREG(2));
+
+    SREG(1) = STRING_substr(interp, SREG(2), IREG(3), len);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_827: /* substr_s_sc_i */
+{
+    const INTVAL   len = Parrot_str_byte_length(interp, SCONST(2));
+
+    SREG(1) = STRING_substr(interp, SCONST(2), IREG(3), len);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_828: /* substr_s_s_ic */
+{
+    const INTVAL   len = Parrot_str_byte_length(interp, SREG(2));
+
+    SREG(1) = STRING_substr(interp, SREG(2), ICONST(3), len);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_829: /* substr_s_sc_ic */
+{
+    const INTVAL   len = Parrot_str_byte_length(interp, SCONST(2));
+
+    SREG(1) = STRING_substr(interp, SCONST(2), ICONST(3), len);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_830: /* substr_s_s_i_i */
+{
+    SREG(1) = STRING_substr(interp, SREG(2), IREG(3), IREG(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_831: /* substr_s_sc_i_i */
+{
+    SREG(1) = STRING_substr(interp, SCONST(2), IREG(3), IREG(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_832: /* substr_s_s_ic_i */
+{
+    SREG(1) = STRING_substr(interp, SREG(2), ICONST(3), IREG(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_833: /* substr_s_sc_ic_i */
+{
+    SREG(1) = STRING_substr(interp, SCONST(2), ICONST(3), IREG(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_834: /* substr_s_s_i_ic */
+{
+    SREG(1) = STRING_substr(interp, SREG(2), IREG(3), ICONST(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_835: /* substr_s_sc_i_ic */
+{
+    SREG(1) = STRING_substr(interp, SCONST(2), IREG(3), ICONST(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_836: /* substr_s_s_ic_ic */
+{
+    SREG(1) = STRING_substr(interp, SREG(2), ICONST(3), ICONST(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_837: /* substr_s_sc_ic_ic */
+{
+    SREG(1) = STRING_substr(interp, SCONST(2), ICONST(3), ICONST(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_838: /* substr_s_p_i_i */
+{
+    SREG(1) = VTABLE_substr(interp, PREG(2), IREG(3), IREG(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_839: /* substr_s_p_ic_i */
+{
+    SREG(1) = VTABLE_substr(interp, PREG(2), ICONST(3), IREG(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_840: /* substr_s_p_i_ic */
+{
+    SREG(1) = VTABLE_substr(interp, PREG(2), IREG(3), ICONST(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_841: /* substr_s_p_ic_ic */
+{
+    SREG(1) = VTABLE_substr(interp, PREG(2), ICONST(3), ICONST(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_842: /* replace_s_s_i_i_s */
+{
+    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), IREG(4), SREG(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_843: /* replace_s_sc_i_i_s */
+{
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), IREG(4), SREG(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_844: /* replace_s_s_ic_i_s */
+{
+    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), IREG(4), SREG(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_845: /* replace_s_sc_ic_i_s */
+{
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), IREG(4), SREG(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_846: /* replace_s_s_i_ic_s */
+{
+    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), ICONST(4), SREG(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_847: /* replace_s_sc_i_ic_s */
+{
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), ICONST(4), SREG(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_848: /* replace_s_s_ic_ic_s */
+{
+    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), ICONST(4), SREG(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_849: /* replace_s_sc_ic_ic_s */
+{
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), ICONST(4), SREG(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_850: /* replace_s_s_i_i_sc */
+{
+    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), IREG(4), SCONST(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_851: /* replace_s_sc_i_i_sc */
+{
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), IREG(4), SCONST(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_852: /* replace_s_s_ic_i_sc */
+{
+    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), IREG(4), SCONST(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_853: /* replace_s_sc_ic_i_sc */
+{
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), IREG(4), SCONST(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_854: /* replace_s_s_i_ic_sc */
+{
+    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), ICONST(4), SCONST(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_855: /* replace_s_sc_i_ic_sc */
+{
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), ICONST(4), SCONST(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_856: /* replace_s_s_ic_ic_sc */
+{
+    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), ICONST(4), SCONST(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_857: /* replace_s_sc_ic_ic_sc */
+{
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), ICONST(4), SCONST(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_858: /* index_i_s_s */
+{
+    IREG(1) = ((SREG(2) && SREG(3))) ? STRING_index(interp, SREG(2), SREG(3), 0) : (-1);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_859: /* index_i_sc_s */
+{
+    IREG(1) = ((SCONST(2) && SREG(3))) ? STRING_index(interp, SCONST(2), SREG(3), 0) : (-1);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_860: /* index_i_s_sc */
+{
+    IREG(1) = ((SREG(2) && SCONST(3))) ? STRING_index(interp, SREG(2), SCONST(3), 0) : (-1);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_861: /* index_i_sc_sc */
+{
+    IREG(1) = ((SCONST(2) && SCONST(3))) ? STRING_index(interp, SCONST(2), SCONST(3), 0) : (-1);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_862: /* index_i_s_s_i */
+{
+    IREG(1) = ((SREG(2) && SREG(3))) ? STRING_index(interp, SREG(2), SREG(3), IREG(4)) : (-1);
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_863: /* index_i_sc_s_i */
+{
+    IREG(1) = ((SCONST(2) && SREG(3))) ? STRING_index(interp, SCONST(2), SREG(3), IREG(4)) : (-1);
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_864: /* index_i_s_sc_i */
+{
+    IREG(1) = ((SREG(2) && SCONST(3))) ? STRING_index(interp, SREG(2), SCONST(3), IREG(4)) : (-1);
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_865: /* index_i_sc_sc_i */
+{
+    IREG(1) = ((SCONST(2) && SCONST(3))) ? STRING_index(interp, SCONST(2), SCONST(3), IREG(4)) : (-1);
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_866: /* index_i_s_s_ic */
+{
+    IREG(1) = ((SREG(2) && SREG(3))) ? STRING_index(interp, SREG(2), SREG(3), ICONST(4)) : (-1);
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_867: /* index_i_sc_s_ic */
+{
+    IREG(1) = ((SCONST(2) && SREG(3))) ? STRING_index(interp, SCONST(2), SREG(3), ICONST(4)) : (-1);
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_868: /* index_i_s_sc_ic */
+{
+    IREG(1) = ((SREG(2) && SCONST(3))) ? STRING_index(interp, SREG(2), SCONST(3), ICONST(4)) : (-1);
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_869: /* index_i_sc_sc_ic */
+{
+    IREG(1) = ((SCONST(2) && SCONST(3))) ? STRING_index(interp, SCONST(2), SCONST(3), ICONST(4)) : (-1);
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_870: /* rindex_i_s_s */
+{
+    STRING  * const  str = SREG(2);
+
+    IREG(1) = Parrot_str_find_reverse_index(interp, str, SREG(3), STRING_length(str));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_871: /* rindex_i_sc_s */
+{
+    STRING  * const  str = SCONST(2);
+
+    IREG(1) = Parrot_str_find_reverse_index(interp, str, SREG(3), STRING_length(str));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_872: /* rindex_i_s_sc */
+{
+    STRING  * const  str = SREG(2);
+
+    IREG(1) = Parrot_str_find_reverse_index(interp, str, SCONST(3), STRING_length(str));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_873: /* rindex_i_sc_sc */
+{
+    STRING  * const  str = SCONST(2);
+
+    IREG(1) = Parrot_str_find_reverse_index(interp, str, SCONST(3), STRING_length(str));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_874: /* rindex_i_s_s_i */
+{
+    STRING  * const  str = SREG(2);
+
+    IREG(1) = Parrot_str_find_reverse_index(interp, str, SREG(3), IREG(4));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_875: /* rindex_i_sc_s_i */
+{
+    STRING  * const  str = SCONST(2);
+
+    IREG(1) = Parrot_str_find_reverse_index(interp, str, SREG(3), IREG(4));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_876: /* rindex_i_s_sc_i */
+{
+    STRING  * const  str = SREG(2);
+
+    IREG(1) = Parrot_str_find_reverse_index(interp, str, SCONST(3), IREG(4));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_877: /* rindex_i_sc_sc_i */
+{
+    STRING  * const  str = SCONST(2);
+
+    IREG(1) = Parrot_str_find_reverse_index(interp, str, SCONST(3), IREG(4));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_878: /* rindex_i_s_s_ic */
+{
+    STRING  * const  str = SREG(2);
+
+    IREG(1) = Parrot_str_find_reverse_index(interp, str, SREG(3), ICONST(4));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_879: /* rindex_i_sc_s_ic */
+{
+    STRING  * const  str = SCONST(2);
+
+    IREG(1) = Parrot_str_find_reverse_index(interp, str, SREG(3), ICONST(4));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_880: /* rindex_i_s_sc_ic */
+{
+    STRING  * const  str = SREG(2);
+
+    IREG(1) = Parrot_str_find_reverse_index(interp, str, SCONST(3), ICONST(4));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_881: /* rindex_i_sc_sc_ic */
+{
+    STRING  * const  str = SCONST(2);
+
+    IREG(1) = Parrot_str_find_reverse_index(interp, str, SCONST(3), ICONST(4));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_882: /* sprintf_s_s_p */
+{
+    SREG(1) = Parrot_psprintf(interp, SREG(2), PREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_883: /* sprintf_s_sc_p */
+{
+    SREG(1) = Parrot_psprintf(interp, SCONST(2), PREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_884: /* sprintf_p_p_p */
+{
+    VTABLE_set_string_native(interp, PREG(1), Parrot_psprintf(interp, VTABLE_get_string(interp, PREG(2)), PREG(3)));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_885: /* new_s */
+{
+    SREG(1) = Parrot_str_new_noinit(interp, 0);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_886: /* stringinfo_i_s_i */
+{
+    if ((SREG(2) == NULL)) {
+        IREG(1) = 0;
+    }
+    else {
+        switch (IREG(3)) {
+          case STRINGINFO_HEADER:
+            IREG(1) = PTR2UINTVAL(SREG(2));
+            break;
+          case STRINGINFO_STRSTART:
+            IREG(1) = PTR2UINTVAL(SREG(2)->strstart);
+            break;
+          case STRINGINFO_BUFLEN:
+            IREG(1) = Buffer_buflen(SREG(2));
+            break;
+          case STRINGINFO_FLAGS:
+            IREG(1) = PObj_get_FLAGS(SREG(2));
+            break;
+          case STRINGINFO_BUFUSED:
+            IREG(1) = SREG(2)->bufused;
+            break;
+          case STRINGINFO_STRLEN:
+            IREG(1) = SREG(2)->strlen;
+            break;
+          default:
+            {
+                opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "stringinfo: unknown info type: %d", IREG(3));
+
+                do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+            }
+
+        }
+
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_887: /* stringinfo_i_sc_i */
+{
+    if ((SCONST(2) == NULL)) {
+        IREG(1) = 0;
+    }
+    else {
+        switch (IREG(3)) {
+          case STRINGINFO_HEADER:
+            IREG(1) = PTR2UINTVAL(SCONST(2));
+            break;
+          case STRINGINFO_STRSTART:
+            IREG(1) = PTR2UINTVAL(SCONST(2)->strstart);
+            break;
+          case STRINGINFO_BUFLEN:
+            IREG(1) = Buffer_buflen(SCONST(2));
+            break;
+          case STRINGINFO_FLAGS:
+            IREG(1) = PObj_get_FLAGS(SCONST(2));
+            break;
+          case STRINGINFO_BUFUSED:
+            IREG(1) = SCONST(2)->bufused;
+            break;
+          case STRINGINFO_STRLEN:
+            IREG(1) = SCONST(2)->strlen;
+            break;
+          default:
+            {
+                opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "stringinfo: unknown info type: %d", IREG(3));
+
+                do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+            }
+
+        }
+
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_888: /* stringinfo_i_s_ic */
+{
+    if ((SREG(2) == NULL)) {
+        IREG(1) = 0;
+    }
+    else {
+        switch (ICONST(3)) {
+          case STRINGINFO_HEADER:
+            IREG(1) = PTR2UINTVAL(SREG(2));
+            break;
+          case STRINGINFO_STRSTART:
+            IREG(1) = PTR2UINTVAL(SREG(2)->strstart);
+            break;
+          case STRINGINFO_BUFLEN:
+            IREG(1) = Buffer_buflen(SREG(2));
+            break;
+          case STRINGINFO_FLAGS:
+            IREG(1) = PObj_get_FLAGS(SREG(2));
+            break;
+          case STRINGINFO_BUFUSED:
+            IREG(1) = SREG(2)->bufused;
+            break;
+          case STRINGINFO_STRLEN:
+            IREG(1) = SREG(2)->strlen;
+            break;
+          default:
+            {
+                opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "stringinfo: unknown info type: %d", ICONST(3));
+
+                do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+            }
+
+        }
+
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_889: /* stringinfo_i_sc_ic */
+{
+    if ((SCONST(2) == NULL)) {
+        IREG(1) = 0;
+    }
+    else {
+        switch (ICONST(3)) {
+          case STRINGINFO_HEADER:
+            IREG(1) = PTR2UINTVAL(SCONST(2));
+            break;
+          case STRINGINFO_STRSTART:
+            IREG(1) = PTR2UINTVAL(SCONST(2)->strstart);
+            break;
+          case STRINGINFO_BUFLEN:
+            IREG(1) = Buffer_buflen(SCONST(2));
+            break;
+          case STRINGINFO_FLAGS:
+            IREG(1) = PObj_get_FLAGS(SCONST(2));
+            break;
+          case STRINGINFO_BUFUSED:
+            IREG(1) = SCONST(2)->bufused;
+            break;
+          case STRINGINFO_STRLEN:
+            IREG(1) = SCONST(2)->strlen;
+            break;
+          default:
+            {
+                opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "stringinfo: unknown info type: %d", ICONST(3));
+
+                do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+            }
+
+        }
+
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_890: /* upcase_s_s */
+{
+    SREG(1) = Parrot_str_upcase(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_891: /* upcase_s_sc */
+{
+    SREG(1) = Parrot_str_upcase(interp, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_892: /* downcase_s_s */
+{
+    SREG(1) = Parrot_str_downcase(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_893: /* downcase_s_sc */
+{
+    SREG(1) = Parrot_str_downcase(interp, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_894: /* titlecase_s_s */
+{
+    SREG(1) = Parrot_str_titlecase(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_895: /* titlecase_s_sc */
+{
+    SREG(1) = Parrot_str_titlecase(interp, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_896: /* join_s_s_p */
+{
+    SREG(1) = Parrot_str_join(interp, SREG(2), PREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_897: /* join_s_sc_p */
+{
+    SREG(1) = Parrot_str_join(interp, SCONST(2), PREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_898: /* split_p_s_s */
+{
+    PREG(1) = Parrot_str_split(interp, SREG(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_899: /* split_p_sc_s */
+{
+    PREG(1) = Parrot_str_split(interp, SCONST(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_900: /* split_p_s_sc */
+{
+    PREG(1) = Parrot_str_split(interp, SREG(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_901: /* split_p_sc_sc */
+{
+    PREG(1) = Parrot_str_split(interp, SCONST(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_902: /* encoding_i_s */
+{
+    IREG(1) = Parrot_encoding_number_of_str(interp, SREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_903: /* encoding_i_sc */
+{
+    IREG(1) = Parrot_encoding_number_of_str(interp, SCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_904: /* encodingname_s_i */
+{
+    SREG(1) = Parrot_encoding_name(interp, IREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_905: /* encodingname_s_ic */
+{
+    SREG(1) = Parrot_encoding_name(interp, ICONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_906: /* find_encoding_i_s */
+{
+    const INTVAL   n = Parrot_encoding_number(interp, SREG(2));
+
+    if ((n < 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_ENCODING, "encoding '%Ss' not found", SREG(2));
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    IREG(1) = n;
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_907: /* find_encoding_i_sc */
+{
+    const INTVAL   n = Parrot_encoding_number(interp, SCONST(2));
+
+    if ((n < 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_ENCODING, "encoding '%Ss' not found", SCONST(2));
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    IREG(1) = n;
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_908: /* trans_encoding_s_s_i */
+{
+    SREG(1) = Parrot_str_change_encoding(interp, SREG(2), IREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_909: /* trans_encoding_s_sc_i */
+{
+    SREG(1) = Parrot_str_change_encoding(interp, SCONST(2), IREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_910: /* trans_encoding_s_s_ic */
+{
+    SREG(1) = Parrot_str_change_encoding(interp, SREG(2), ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_911: /* trans_encoding_s_sc_ic */
+{
+    SREG(1) = Parrot_str_change_encoding(interp, SCONST(2), ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_912: /* is_cclass_i_i_s_i */
+{
+    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SREG(3), IREG(4));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_913: /* is_cclass_i_ic_s_i */
+{
+    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SREG(3), IREG(4));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_914: /* is_cclass_i_i_sc_i */
+{
+    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SCONST(3), IREG(4));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_915: /* is_cclass_i_ic_sc_i */
+{
+    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SCONST(3), IREG(4));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_916: /* is_cclass_i_i_s_ic */
+{
+    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SREG(3), ICONST(4));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_917: /* is_cclass_i_ic_s_ic */
+{
+    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SREG(3), ICONST(4));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_918: /* is_cclass_i_i_sc_ic */
+{
+    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SCONST(3), ICONST(4));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_919: /* is_cclass_i_ic_sc_ic */
+{
+    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SCONST(3), ICONST(4));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_920: /* find_cclass_i_i_s_i_i */
+{
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), IREG(4), IREG(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_921: /* find_cclass_i_ic_s_i_i */
+{
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), IREG(4), IREG(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_922: /* find_cclass_i_i_sc_i_i */
+{
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), IREG(4), IREG(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_923: /* find_cclass_i_ic_sc_i_i */
+{
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), IREG(4), IREG(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_924: /* find_cclass_i_i_s_ic_i */
+{
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), ICONST(4), IREG(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_925: /* find_cclass_i_ic_s_ic_i */
+{
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), ICONST(4), IREG(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_926: /* find_cclass_i_i_sc_ic_i */
+{
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), ICONST(4), IREG(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_927: /* find_cclass_i_ic_sc_ic_i */
+{
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), ICONST(4), IREG(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_928: /* find_cclass_i_i_s_i_ic */
+{
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), IREG(4), ICONST(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_929: /* find_cclass_i_ic_s_i_ic */
+{
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), IREG(4), ICONST(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_930: /* find_cclass_i_i_sc_i_ic */
+{
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), IREG(4), ICONST(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_931: /* find_cclass_i_ic_sc_i_ic */
+{
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), IREG(4), ICONST(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_932: /* find_cclass_i_i_s_ic_ic */
+{
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), ICONST(4), ICONST(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_933: /* find_cclass_i_ic_s_ic_ic */
+{
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), ICONST(4), ICONST(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_934: /* find_cclass_i_i_sc_ic_ic */
+{
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), ICONST(4), ICONST(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_935: /* find_cclass_i_ic_sc_ic_ic */
+{
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), ICONST(4), ICONST(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_936: /* find_not_cclass_i_i_s_i_i */
+{
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), IREG(4), IREG(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_937: /* find_not_cclass_i_ic_s_i_i */
+{
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), IREG(4), IREG(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_938: /* find_not_cclass_i_i_sc_i_i */
+{
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), IREG(4), IREG(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_939: /* find_not_cclass_i_ic_sc_i_i */
+{
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), IREG(4), IREG(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_940: /* find_not_cclass_i_i_s_ic_i */
+{
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), ICONST(4), IREG(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_941: /* find_not_cclass_i_ic_s_ic_i */
+{
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), ICONST(4), IREG(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_942: /* find_not_cclass_i_i_sc_ic_i */
+{
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), ICONST(4), IREG(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_943: /* find_not_cclass_i_ic_sc_ic_i */
+{
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), ICONST(4), IREG(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_944: /* find_not_cclass_i_i_s_i_ic */
+{
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), IREG(4), ICONST(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_945: /* find_not_cclass_i_ic_s_i_ic */
+{
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), IREG(4), ICONST(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_946: /* find_not_cclass_i_i_sc_i_ic */
+{
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), IREG(4), ICONST(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_947: /* find_not_cclass_i_ic_sc_i_ic */
+{
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), IREG(4), ICONST(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_948: /* find_not_cclass_i_i_s_ic_ic */
+{
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), ICONST(4), ICONST(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_949: /* find_not_cclass_i_ic_s_ic_ic */
+{
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), ICONST(4), ICONST(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_950: /* find_not_cclass_i_i_sc_ic_ic */
+{
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), ICONST(4), ICONST(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_951: /* find_not_cclass_i_ic_sc_ic_ic */
+{
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), ICONST(4), ICONST(5));
+    do { cur_opcode += 6; CG_NEXT(); } while (0);
+}
+
+PC_952: /* escape_s_s */
+{
+    SREG(1) = Parrot_str_escape(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_953: /* compose_s_s */
+{
+    SREG(1) = Parrot_str_compose(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_954: /* compose_s_sc */
+{
+    SREG(1) = Parrot_str_compose(interp, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_955: /* find_codepoint_i_s */
+{
+    #if PARROT_HAS_ICU
+        UErrorCode     err = U_ZERO_ERROR;
+        char  * const  cstr = Parrot_str_to_cstring(interp, SREG(2));
+        UChar32        codepoint = u_charFromName(U_EXTENDED_CHAR_NAME, cstr, (&err));
+        Parrot_str_free_cstring(cstr);
+        IREG(1) = U_SUCCESS(err) ? (INTVAL)codepoint : (-1);
+
+#else
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_LIBRARY_ERROR, "no ICU lib loaded");
+        do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+
+#endif
+;
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_956: /* find_codepoint_i_sc */
+{
+    #if PARROT_HAS_ICU
+        UErrorCode     err = U_ZERO_ERROR;
+        char  * const  cstr = Parrot_str_to_cstring(interp, SCONST(2));
+        UChar32        codepoint = u_charFromName(U_EXTENDED_CHAR_NAME, cstr, (&err));
+        Parrot_str_free_cstring(cstr);
+        IREG(1) = U_SUCCESS(err) ? (INTVAL)codepoint : (-1);
+
+#else
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_LIBRARY_ERROR, "no ICU lib loaded");
+        do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+
+#endif
+;
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_957: /* spawnw_i_s */
+{
+    IREG(1) = Parrot_Run_OS_Command(interp, SREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_958: /* spawnw_i_sc */
+{
+    IREG(1) = Parrot_Run_OS_Command(interp, SCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_959: /* spawnw_i_p */
+{
+    IREG(1) = Parrot_Run_OS_Command_Argv(interp, PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_960: /* err_i */
+{
+    IREG(1) = errno;
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_961: /* err_s */
+{
+    const char  * const  tmp = strerror(errno);
+
+    SREG(1) = Parrot_str_new_init(interp, tmp, strlen(tmp), Parrot_ascii_encoding_ptr, 0);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_962: /* err_s_i */
+{
+    const char  * const  tmp = strerror(IREG(2));
+
+    SREG(1) = Parrot_str_new_init(interp, tmp, strlen(tmp), Parrot_ascii_encoding_ptr, 0);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_963: /* err_s_ic */
+{
+    const char  * const  tmp = strerror(ICONST(2));
+
+    SREG(1) = Parrot_str_new_init(interp, tmp, strlen(tmp), Parrot_ascii_encoding_ptr, 0);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_964: /* time_i */
+{
+    IREG(1) = Parrot_intval_time();
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_965: /* time_n */
+{
+    NREG(1) = Parrot_floatval_time();
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_966: /* sleep_i */
+{
+    opcode_t  * next =  cur_opcode + 2;
+
+    if ((IREG(1) < 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NEG_SLEEP, "Cannot go back in time");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, (FLOATVAL)IREG(1), next);
+    do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+}
+
+PC_967: /* sleep_ic */
+{
+    opcode_t  * next =  cur_opcode + 2;
+
+    if ((ICONST(1) < 0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NEG_SLEEP, "Cannot go back in time");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, (FLOATVAL)ICONST(1), next);
+    do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+}
+
+PC_968: /* sleep_n */
+{
+    opcode_t  * next =  cur_opcode + 2;
+
+    if ((NREG(1) < 0.0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NEG_SLEEP, "Cannot go back in time");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, NREG(1), next);
+    do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+}
+
+PC_969: /* sleep_nc */
+{
+    opcode_t  * next =  cur_opcode + 2;
+
+    if ((NCONST(1) < 0.0)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NEG_SLEEP, "Cannot go back in time");
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, NCONST(1), next);
+    do { cur_opcode = (opcode_t *)(next); CG_JUMP(); } while (0);
+}
+
+PC_970: /* store_lex_s_p */
+{
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_971: /* store_lex_sc_p */
+{
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_972: /* store_lex_s_s */
+{
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_973: /* store_lex_sc_s */
+{
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_974: /* store_lex_s_sc */
+{
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_975: /* store_lex_sc_sc */
+{
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_976: /* store_lex_s_i */
+{
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_977: /* store_lex_sc_i */
+{
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, IREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_978: /* store_lex_s_ic */
+{
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, ICONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_979: /* store_lex_sc_ic */
+{
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, ICONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_980: /* store_lex_s_n */
+{
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_981: /* store_lex_sc_n */
+{
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_982: /* store_lex_s_nc */
+{
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_983: /* store_lex_sc_nc */
+{
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NCONST(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_984: /* store_dynamic_lex_s_p */
+{
+    STRING   * const  lex_name = SREG(1);
+    PMC      * const  ctx = Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
+    PMC      * const  lex_pad = PMC_IS_NULL(ctx) ? PMCNULL : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found in dynamic scope", lex_name);
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_985: /* store_dynamic_lex_sc_p */
+{
+    STRING   * const  lex_name = SCONST(1);
+    PMC      * const  ctx = Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
+    PMC      * const  lex_pad = PMC_IS_NULL(ctx) ? PMCNULL : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found in dynamic scope", lex_name);
+
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_986: /* find_lex_p_s */
+{
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(2);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    PMC  * const  result = PMC_IS_NULL(lex_pad) ? PMCNULL : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+
+    PREG(1) = result;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_987: /* find_lex_p_sc */
+{
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(2);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    PMC  * const  result = PMC_IS_NULL(lex_pad) ? PMCNULL : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+
+    PREG(1) = result;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_988: /* find_lex_s_s */
+{
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(2);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    STRING  * const  result = PMC_IS_NULL(lex_pad) ? STRINGNULL : VTABLE_get_string_keyed_str(interp, lex_pad, lex_name);
+
+    SREG(1) = result;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_989: /* find_lex_s_sc */
+{
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(2);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    STRING  * const  result = PMC_IS_NULL(lex_pad) ? STRINGNULL : VTABLE_get_string_keyed_str(interp, lex_pad, lex_name);
+
+    SREG(1) = result;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_990: /* find_lex_i_s */
+{
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(2);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    INTVAL   result = PMC_IS_NULL(lex_pad) ? 0 : VTABLE_get_integer_keyed_str(interp, lex_pad, lex_name);
+
+    IREG(1) = result;
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_991: /* find_lex_i_sc */
+{
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(2);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    INTVAL   result = PMC_IS_NULL(lex_pad) ? 0 : VTABLE_get_integer_keyed_str(interp, lex_pad, lex_name);
+
+    IREG(1) = result;
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_992: /* find_lex_n_s */
+{
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(2);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    FLOATVAL   result = PMC_IS_NULL(lex_pad) ? 0.0 : VTABLE_get_number_keyed_str(interp, lex_pad, lex_name);
+
+    NREG(1) = result;
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_993: /* find_lex_n_sc */
+{
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(2);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    FLOATVAL   result = PMC_IS_NULL(lex_pad) ? 0.0 : VTABLE_get_number_keyed_str(interp, lex_pad, lex_name);
+
+    NREG(1) = result;
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_994: /* find_dynamic_lex_p_s */
+{
+    STRING   * const  lex_name = SREG(2);
+    PMC      * const  ctx = Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
+    PMC      * const  lex_pad = PMC_IS_NULL(ctx) ? PMCNULL : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
+    PMC      * const  result = PMC_IS_NULL(lex_pad) ? PMCNULL : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+
+    PREG(1) = result;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_995: /* find_dynamic_lex_p_sc */
+{
+    STRING   * const  lex_name = SCONST(2);
+    PMC      * const  ctx = Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
+    PMC      * const  lex_pad = PMC_IS_NULL(ctx) ? PMCNULL : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
+    PMC      * const  result = PMC_IS_NULL(lex_pad) ? PMCNULL : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+
+    PREG(1) = result;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_996: /* find_caller_lex_p_s */
+{
+    STRING   * const  lex_name = SREG(2);
+    PMC      *  ctx = CURRENT_CONTEXT(interp);
+    PMC      *  result = PMCNULL;
+
+    for (ctx = Parrot_pcc_get_caller_ctx(interp, ctx); ((!PMC_IS_NULL(ctx)) && PMC_IS_NULL(result)); ctx = Parrot_pcc_get_caller_ctx(interp, ctx)) {
+        PMC  * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        if ((!PMC_IS_NULL(lex_pad))) {
+            result = VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+        }
+
+        if ((!result)) {
+            result = PMCNULL;
+        }
+
+    }
+
+    PREG(1) = result;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_997: /* find_caller_lex_p_sc */
+{
+    STRING   * const  lex_name = SCONST(2);
+    PMC      *  ctx = CURRENT_CONTEXT(interp);
+    PMC      *  result = PMCNULL;
+
+    for (ctx = Parrot_pcc_get_caller_ctx(interp, ctx); ((!PMC_IS_NULL(ctx)) && PMC_IS_NULL(result)); ctx = Parrot_pcc_get_caller_ctx(interp, ctx)) {
+        PMC  * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        if ((!PMC_IS_NULL(lex_pad))) {
+            result = VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+        }
+
+        if ((!result)) {
+            result = PMCNULL;
+        }
+
+    }
+
+    PREG(1) = result;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_998: /* get_namespace_p */
+{
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+
+    PREG(1) = cur_ns;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_999: /* get_namespace_p_p */
+{
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PREG(2));
+
+    PREG(1) = PMC_IS_NULL(ns) ? PMCNULL : ns;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1000: /* get_namespace_p_pc */
+{
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PCONST(2));
+
+    PREG(1) = PMC_IS_NULL(ns) ? PMCNULL : ns;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1001: /* get_hll_namespace_p */
+{
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    PREG(1) = hll_ns;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_1002: /* get_hll_namespace_p_p */
+{
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PREG(2));
+
+        PREG(1) = ns;
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1003: /* get_hll_namespace_p_pc */
+{
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PCONST(2));
+
+        PREG(1) = ns;
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1004: /* get_root_namespace_p */
+{
+    PMC  * const  root_ns = interp->root_namespace;
+
+    PREG(1) = root_ns;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_1005: /* get_root_namespace_p_p */
+{
+    PMC  * const  root_ns = interp->root_namespace;
+
+    if (PMC_IS_NULL(root_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PREG(2));
+
+        PREG(1) = ns;
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1006: /* get_root_namespace_p_pc */
+{
+    PMC  * const  root_ns = interp->root_namespace;
+
+    if (PMC_IS_NULL(root_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PCONST(2));
+
+        PREG(1) = ns;
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1007: /* get_global_p_s */
+{
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+
+    PREG(1) = Parrot_ns_find_global_from_op(interp, cur_ns, SREG(2),  cur_opcode + 3);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1008: /* get_global_p_sc */
+{
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+
+    PREG(1) = Parrot_ns_find_global_from_op(interp, cur_ns, SCONST(2),  cur_opcode + 3);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1009: /* get_global_p_p_s */
+{
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+
+    if (PMC_IS_NULL(cur_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PREG(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3),  cur_opcode + 4);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1010: /* get_global_p_pc_s */
+{
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+
+    if (PMC_IS_NULL(cur_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PCONST(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3),  cur_opcode + 4);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1011: /* get_global_p_p_sc */
+{
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+
+    if (PMC_IS_NULL(cur_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PREG(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3),  cur_opcode + 4);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1012: /* get_global_p_pc_sc */
+{
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+
+    if (PMC_IS_NULL(cur_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PCONST(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3),  cur_opcode + 4);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1013: /* get_hll_global_p_s */
+{
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    PREG(1) = Parrot_ns_find_global_from_op(interp, hll_ns, SREG(2),  cur_opcode + 3);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1014: /* get_hll_global_p_sc */
+{
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    PREG(1) = Parrot_ns_find_global_from_op(interp, hll_ns, SCONST(2),  cur_opcode + 3);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1015: /* get_hll_global_p_p_s */
+{
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = hll_ns;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PREG(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3),  cur_opcode + 4);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1016: /* get_hll_global_p_pc_s */
+{
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = hll_ns;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PCONST(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3),  cur_opcode + 4);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1017: /* get_hll_global_p_p_sc */
+{
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = hll_ns;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PREG(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3),  cur_opcode + 4);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1018: /* get_hll_global_p_pc_sc */
+{
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = hll_ns;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PCONST(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3),  cur_opcode + 4);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1019: /* get_root_global_p_s */
+{
+    PMC  * const  root_ns = interp->root_namespace;
+
+    PREG(1) = Parrot_ns_find_global_from_op(interp, root_ns, SREG(2),  cur_opcode + 3);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1020: /* get_root_global_p_sc */
+{
+    PMC  * const  root_ns = interp->root_namespace;
+
+    PREG(1) = Parrot_ns_find_global_from_op(interp, root_ns, SCONST(2),  cur_opcode + 3);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1021: /* get_root_global_p_p_s */
+{
+    PMC  * const  root_ns = interp->root_namespace;
+
+    if (PMC_IS_NULL(root_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PREG(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3),  cur_opcode + 4);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1022: /* get_root_global_p_pc_s */
+{
+    PMC  * const  root_ns = interp->root_namespace;
+
+    if (PMC_IS_NULL(root_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PCONST(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3),  cur_opcode + 4);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1023: /* get_root_global_p_p_sc */
+{
+    PMC  * const  root_ns = interp->root_namespace;
+
+    if (PMC_IS_NULL(root_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PREG(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3),  cur_opcode + 4);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1024: /* get_root_global_p_pc_sc */
+{
+    PMC  * const  root_ns = interp->root_namespace;
+
+    if (PMC_IS_NULL(root_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PCONST(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3),  cur_opcode + 4);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1025: /* set_global_s_p */
+{
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+
+    Parrot_ns_set_global(interp, cur_ns, SREG(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1026: /* set_global_sc_p */
+{
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+
+    Parrot_ns_set_global(interp, cur_ns, SCONST(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1027: /* set_global_p_s_p */
+{
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, cur_ns, PREG(1));
+
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1028: /* set_global_pc_s_p */
+{
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, cur_ns, PCONST(1));
+
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1029: /* set_global_p_sc_p */
+{
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, cur_ns, PREG(1));
+
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1030: /* set_global_pc_sc_p */
+{
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, cur_ns, PCONST(1));
+
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1031: /* set_hll_global_s_p */
+{
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    Parrot_ns_set_global(interp, hll_ns, SREG(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1032: /* set_hll_global_sc_p */
+{
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    Parrot_ns_set_global(interp, hll_ns, SCONST(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1033: /* set_hll_global_p_s_p */
+{
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, hll_ns, PREG(1));
+
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1034: /* set_hll_global_pc_s_p */
+{
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, hll_ns, PCONST(1));
+
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1035: /* set_hll_global_p_sc_p */
+{
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, hll_ns, PREG(1));
+
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1036: /* set_hll_global_pc_sc_p */
+{
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, hll_ns, PCONST(1));
+
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1037: /* set_root_global_s_p */
+{
+    PMC  * const  root_ns = interp->root_namespace;
+
+    Parrot_ns_set_global(interp, root_ns, SREG(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1038: /* set_root_global_sc_p */
+{
+    PMC  * const  root_ns = interp->root_namespace;
+
+    Parrot_ns_set_global(interp, root_ns, SCONST(1), PREG(2));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1039: /* set_root_global_p_s_p */
+{
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, root_ns, PREG(1));
+
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1040: /* set_root_global_pc_s_p */
+{
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, root_ns, PCONST(1));
+
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1041: /* set_root_global_p_sc_p */
+{
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, root_ns, PREG(1));
+
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1042: /* set_root_global_pc_sc_p */
+{
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, root_ns, PCONST(1));
+
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1043: /* find_name_p_s */
+{
+    if ((!SREG(2))) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "Tried to find null name");
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = Parrot_ns_find_named_item(interp, SREG(2),  cur_opcode + 3);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1044: /* find_name_p_sc */
+{
+    if ((!SCONST(2))) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "Tried to find null name");
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+    }
+
+    PREG(1) = Parrot_ns_find_named_item(interp, SCONST(2),  cur_opcode + 3);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1045: /* find_sub_not_null_p_s */
+{
+    opcode_t  * const  dest =  cur_opcode + 3;
+    PMC       * const  sub = Parrot_ns_find_named_item(interp, SREG(2), dest);
+
+    if (PMC_IS_NULL(sub)) {
+        opcode_t  * handler;
+
+        Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), dest);
+        handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_GLOBAL_NOT_FOUND, "Could not find sub %Ss", SREG(2));
+        {
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+        }
+
+    }
+
+    PREG(1) = sub;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1046: /* find_sub_not_null_p_sc */
+{
+    opcode_t  * const  dest =  cur_opcode + 3;
+    PMC       * const  sub = Parrot_ns_find_named_item(interp, SCONST(2), dest);
+
+    if (PMC_IS_NULL(sub)) {
+        opcode_t  * handler;
+
+        Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), dest);
+        handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_GLOBAL_NOT_FOUND, "Could not find sub %Ss", SCONST(2));
+        {
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(handler); CG_JUMP(); } while (0);
+        }
+
+    }
+
+    PREG(1) = sub;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1047: /* trap */
+{
+    UNUSED(interp);
+    #if defined(__GNUC__) && defined(i386) && !defined(sun)
+        __asm__("int3");
+
+#endif
+;
+    #if defined(__GNUC__) && defined(PPC)
+        __asm__("trap");
+
+#endif
+;
+    do { cur_opcode += 1; CG_NEXT(); } while (0);
+}
+
+PC_1048: /* set_label_p_ic */
+{
+    VTABLE_set_pointer(interp, PREG(1), ((CUR_OPCODE + ICONST(2))));
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1049: /* get_label_i_p */
+{
+    void  * const  ptr = VTABLE_get_pointer(interp, PREG(2));
+
+    IREG(1) = PTR2INTVAL(ptr);
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1050: /* get_id_i_p */
+{
+    IREG(1) = Parrot_hash_pointer((void *)PREG(2), interp->hash_seed);
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1051: /* get_id_i_pc */
+{
+    IREG(1) = Parrot_hash_pointer((void *)PCONST(2), interp->hash_seed);
+    do { cur_opcode += 3; CG_NEXT(); } while (0);
+}
+
+PC_1052: /* fetch_p_p_p_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1053: /* fetch_p_pc_p_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1054: /* fetch_p_p_pc_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1055: /* fetch_p_pc_pc_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1056: /* fetch_p_p_p_pc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1057: /* fetch_p_pc_p_pc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1058: /* fetch_p_p_pc_pc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1059: /* fetch_p_pc_pc_pc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1060: /* fetch_p_p_i_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1061: /* fetch_p_pc_i_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1062: /* fetch_p_p_ic_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1063: /* fetch_p_pc_ic_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1064: /* fetch_p_p_i_pc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1065: /* fetch_p_pc_i_pc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1066: /* fetch_p_p_ic_pc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1067: /* fetch_p_pc_ic_pc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1068: /* fetch_p_p_s_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1069: /* fetch_p_pc_s_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1070: /* fetch_p_p_sc_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1071: /* fetch_p_pc_sc_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1072: /* fetch_p_p_s_pc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1073: /* fetch_p_pc_s_pc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1074: /* fetch_p_p_sc_pc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1075: /* fetch_p_pc_sc_pc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1076: /* vivify_p_p_p_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed(interp, PREG(2), PREG(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1077: /* vivify_p_pc_p_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed(interp, PCONST(2), PREG(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1078: /* vivify_p_p_pc_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed(interp, PREG(2), PCONST(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1079: /* vivify_p_pc_pc_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed(interp, PCONST(2), PCONST(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1080: /* vivify_p_p_p_pc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed(interp, PREG(2), PREG(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1081: /* vivify_p_pc_p_pc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed(interp, PCONST(2), PREG(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1082: /* vivify_p_p_pc_pc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed(interp, PREG(2), PCONST(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1083: /* vivify_p_pc_pc_pc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed(interp, PCONST(2), PCONST(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1084: /* vivify_p_p_i_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed_int(interp, PREG(2), IREG(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1085: /* vivify_p_pc_i_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed_int(interp, PCONST(2), IREG(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1086: /* vivify_p_p_ic_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed_int(interp, PREG(2), ICONST(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1087: /* vivify_p_pc_ic_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed_int(interp, PCONST(2), ICONST(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1088: /* vivify_p_p_i_pc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_int(interp, PREG(2), IREG(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1089: /* vivify_p_pc_i_pc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_int(interp, PCONST(2), IREG(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1090: /* vivify_p_p_ic_pc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_int(interp, PREG(2), ICONST(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1091: /* vivify_p_pc_ic_pc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_int(interp, PCONST(2), ICONST(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1092: /* vivify_p_p_s_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed_str(interp, PREG(2), SREG(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1093: /* vivify_p_pc_s_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SREG(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1094: /* vivify_p_p_sc_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed_str(interp, PREG(2), SCONST(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1095: /* vivify_p_pc_sc_p */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SCONST(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1096: /* vivify_p_p_s_pc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_str(interp, PREG(2), SREG(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1097: /* vivify_p_pc_s_pc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SREG(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1098: /* vivify_p_p_sc_pc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_str(interp, PREG(2), SCONST(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1099: /* vivify_p_pc_sc_pc */
+{
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SCONST(3), PREG(1));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 5; CG_NEXT(); } while (0);
+}
+
+PC_1100: /* new_p_s_i */
+{
+    STRING  * const  name = SREG(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if ((!PMC_IS_NULL(_class))) {
+        PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+        VTABLE_set_integer_native(interp, initial, IREG(3));
+        PREG(1) = VTABLE_instantiate(interp, _class, initial);
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if ((type <= 0)) {
+            opcode_t  * dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1101: /* new_p_sc_i */
+{
+    STRING  * const  name = SCONST(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if ((!PMC_IS_NULL(_class))) {
+        PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+        VTABLE_set_integer_native(interp, initial, IREG(3));
+        PREG(1) = VTABLE_instantiate(interp, _class, initial);
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if ((type <= 0)) {
+            opcode_t  * dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1102: /* new_p_s_ic */
+{
+    STRING  * const  name = SREG(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if ((!PMC_IS_NULL(_class))) {
+        PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+        VTABLE_set_integer_native(interp, initial, ICONST(3));
+        PREG(1) = VTABLE_instantiate(interp, _class, initial);
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if ((type <= 0)) {
+            opcode_t  * dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1103: /* new_p_sc_ic */
+{
+    STRING  * const  name = SCONST(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if ((!PMC_IS_NULL(_class))) {
+        PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+        VTABLE_set_integer_native(interp, initial, ICONST(3));
+        PREG(1) = VTABLE_instantiate(interp, _class, initial);
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if ((type <= 0)) {
+            opcode_t  * dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1104: /* new_p_p_i */
+{
+    PMC  * const   name_key = PREG(2);
+    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+    if ((type > enum_class_core_max)) {
+        PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+
+        if ((!PMC_IS_NULL(_class))) {
+            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+            VTABLE_set_integer_native(interp, initial, IREG(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+
+    }
+    else {
+        if ((type > enum_class_default)) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+        }
+        else {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1105: /* new_p_pc_i */
+{
+    PMC  * const   name_key = PCONST(2);
+    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+    if ((type > enum_class_core_max)) {
+        PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+
+        if ((!PMC_IS_NULL(_class))) {
+            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+            VTABLE_set_integer_native(interp, initial, IREG(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+
+    }
+    else {
+        if ((type > enum_class_default)) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+        }
+        else {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1106: /* new_p_p_ic */
+{
+    PMC  * const   name_key = PREG(2);
+    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+    if ((type > enum_class_core_max)) {
+        PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+
+        if ((!PMC_IS_NULL(_class))) {
+            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+            VTABLE_set_integer_native(interp, initial, ICONST(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+
+    }
+    else {
+        if ((type > enum_class_default)) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+        }
+        else {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1107: /* new_p_pc_ic */
+{
+    PMC  * const   name_key = PCONST(2);
+    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+    if ((type > enum_class_core_max)) {
+        PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+
+        if ((!PMC_IS_NULL(_class))) {
+            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+            VTABLE_set_integer_native(interp, initial, ICONST(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+
+    }
+    else {
+        if ((type > enum_class_default)) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+        }
+        else {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1108: /* root_new_p_p_i */
+{
+    PMC  * const   name_key = PREG(2);
+    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+    if ((type > enum_class_core_max)) {
+        PMC  * const  root_ns = interp->root_namespace;
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
+        PMC  * const  _class = Parrot_oo_get_class(interp, ns);
+
+        if ((!PMC_IS_NULL(_class))) {
+            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+            VTABLE_set_integer_native(interp, initial, IREG(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+
+    }
+    else {
+        if ((type > enum_class_default)) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+        }
+        else {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1109: /* root_new_p_pc_i */
+{
+    PMC  * const   name_key = PCONST(2);
+    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+    if ((type > enum_class_core_max)) {
+        PMC  * const  root_ns = interp->root_namespace;
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
+        PMC  * const  _class = Parrot_oo_get_class(interp, ns);
+
+        if ((!PMC_IS_NULL(_class))) {
+            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+            VTABLE_set_integer_native(interp, initial, IREG(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+
+    }
+    else {
+        if ((type > enum_class_default)) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+        }
+        else {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1110: /* root_new_p_p_ic */
+{
+    PMC  * const   name_key = PREG(2);
+    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+    if ((type > enum_class_core_max)) {
+        PMC  * const  root_ns = interp->root_namespace;
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
+        PMC  * const  _class = Parrot_oo_get_class(interp, ns);
+
+        if ((!PMC_IS_NULL(_class))) {
+            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+            VTABLE_set_integer_native(interp, initial, ICONST(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+
+    }
+    else {
+        if ((type > enum_class_default)) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+        }
+        else {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1111: /* root_new_p_pc_ic */
+{
+    PMC  * const   name_key = PCONST(2);
+    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+    if ((type > enum_class_core_max)) {
+        PMC  * const  root_ns = interp->root_namespace;
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
+        PMC  * const  _class = Parrot_oo_get_class(interp, ns);
+
+        if ((!PMC_IS_NULL(_class))) {
+            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+            VTABLE_set_integer_native(interp, initial, ICONST(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+
+    }
+    else {
+        if ((type > enum_class_default)) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+        }
+        else {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1112: /* get_context_p */
+{
+    PREG(1) = CURRENT_CONTEXT(interp);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_1113: /* new_call_context_p */
+{
+    PREG(1) = Parrot_pcc_new_call_object(interp);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_1114: /* invokecc_p_p */
+{
+    PMC       * const  p = PREG(1);
+    opcode_t  * dest =  cur_opcode + 3;
+    PMC       * const  signature = PREG(2);
+
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), dest);
+    Parrot_pcc_reuse_continuation(interp, CURRENT_CONTEXT(interp), dest);
+    dest = VTABLE_invoke(interp, p, dest);
+    do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+}
+
+PC_1115: /* flatten_array_into_p_p_i */
+{
+    PMC  * const  dest = PREG(1);
+    PMC  * const  src = PREG(2);
+    const INTVAL   overwrite = IREG(3);
+    INTVAL   i;
+    INTVAL   start_idx = overwrite ? 0 : VTABLE_elements(interp, dest);
+    INTVAL   src_elems = VTABLE_elements(interp, src);
+
+    for (i = 0; (i < src_elems); (i++)) {
+        PMC  * const  val = VTABLE_get_pmc_keyed_int(interp, dest, i);
+
+        VTABLE_set_pmc_keyed_int(interp, dest, (i + start_idx), val);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1116: /* flatten_array_into_p_p_ic */
+{
+    PMC  * const  dest = PREG(1);
+    PMC  * const  src = PREG(2);
+    const INTVAL   overwrite = ICONST(3);
+    INTVAL   i;
+    INTVAL   start_idx = overwrite ? 0 : VTABLE_elements(interp, dest);
+    INTVAL   src_elems = VTABLE_elements(interp, src);
+
+    for (i = 0; (i < src_elems); (i++)) {
+        PMC  * const  val = VTABLE_get_pmc_keyed_int(interp, dest, i);
+
+        VTABLE_set_pmc_keyed_int(interp, dest, (i + start_idx), val);
+    }
+
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1117: /* flatten_hash_into_p_p_i */
+{
+    PMC  * const  dest = PREG(1);
+    PMC  * const  src = PREG(2);
+    const INTVAL   overwrite = IREG(3);
+
+    Parrot_hash_flatten_hash_into(interp, dest, src, overwrite);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1118: /* flatten_hash_into_p_p_ic */
+{
+    PMC  * const  dest = PREG(1);
+    PMC  * const  src = PREG(2);
+    const INTVAL   overwrite = ICONST(3);
+
+    Parrot_hash_flatten_hash_into(interp, dest, src, overwrite);
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1119: /* slurp_array_from_p_p_i */
+{
+    PMC  * const  dest = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    PMC  * const  src = PREG(2);
+    const INTVAL   src_elems = VTABLE_elements(interp, src);
+    INTVAL   i;
+
+    for (i = IREG(3); (i < src_elems); (i++)) {
+        PMC  * const  value = VTABLE_get_pmc_keyed_int(interp, src, i);
+
+        VTABLE_push_pmc(interp, src, value);
+    }
+
+    PREG(1) = dest;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1120: /* slurp_array_from_p_p_ic */
+{
+    PMC  * const  dest = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    PMC  * const  src = PREG(2);
+    const INTVAL   src_elems = VTABLE_elements(interp, src);
+    INTVAL   i;
+
+    for (i = ICONST(3); (i < src_elems); (i++)) {
+        PMC  * const  value = VTABLE_get_pmc_keyed_int(interp, src, i);
+
+        VTABLE_push_pmc(interp, src, value);
+    }
+
+    PREG(1) = dest;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 4; CG_NEXT(); } while (0);
+}
+
+PC_1121: /* receive_p */
+{
+    opcode_t  *const  dest =  cur_opcode + 2;
+    PMC  * cur_task = Parrot_cx_current_task(interp);
+    Parrot_Task_attributes  * tdata = PARROT_TASK(cur_task);
+    int   msg_count;
+
+    if (PMC_IS_NULL(tdata->mailbox)) {
+        tdata->mailbox = Parrot_pmc_new(interp, enum_class_PMCList);
+        PARROT_GC_WRITE_BARRIER(interp, cur_task);
+        msg_count = 0;
+    }
+    else {
+        msg_count = VTABLE_elements(interp, tdata->mailbox);
+    }
+
+    if ((msg_count > 0)) {
+        PREG(1) = VTABLE_shift_pmc(interp, tdata->mailbox);
+        {
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(dest); CG_JUMP(); } while (0);
+        }
+
+    }
+    else {
+        TASK_recv_block_SET(cur_task);
+        (void)Parrot_cx_stop_task(interp, cur_opcode);
+        {
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            do { cur_opcode = (opcode_t *)(0); CG_JUMP(); } while (0);
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_1122: /* wait_p */
+{
+    opcode_t  *const  next =  cur_opcode + 2;
+    PMC  * task = PREG(1);
+    PMC  * cur_task;
+    Parrot_Task_attributes  * tdata;
+
+    if ((!VTABLE_isa(interp, task, Parrot_str_new_constant(interp, "Task")))) {
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "Argument to wait op must be a Task.\n");
+    }
+
+    cur_task = Parrot_cx_stop_task(interp, next);
+    tdata = PARROT_TASK(task);
+    if (PMC_IS_NULL(tdata->waiters)) {
+        tdata->waiters = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+        PARROT_GC_WRITE_BARRIER(interp, task);
+    }
+
+    VTABLE_push_pmc(interp, tdata->waiters, cur_task);
+    do { cur_opcode = (opcode_t *)(0); CG_JUMP(); } while (0);
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_1123: /* wait_pc */
+{
+    opcode_t  *const  next =  cur_opcode + 2;
+    PMC  * task = PCONST(1);
+    PMC  * cur_task;
+    Parrot_Task_attributes  * tdata;
+
+    if ((!VTABLE_isa(interp, task, Parrot_str_new_constant(interp, "Task")))) {
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "Argument to wait op must be a Task.\n");
+    }
+
+    cur_task = Parrot_cx_stop_task(interp, next);
+    tdata = PARROT_TASK(task);
+    if (PMC_IS_NULL(tdata->waiters)) {
+        tdata->waiters = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+        PARROT_GC_WRITE_BARRIER(interp, task);
+    }
+
+    VTABLE_push_pmc(interp, tdata->waiters, cur_task);
+    do { cur_opcode = (opcode_t *)(0); CG_JUMP(); } while (0);
+    do { cur_opcode += 2; CG_NEXT(); } while (0);
+}
+
+PC_1124: /* pass */
+{
+    opcode_t  *const  next =  cur_opcode + 1;
+    opcode_t  *const  addr = Parrot_cx_preempt_task(interp, interp->scheduler, next);
+
+    do { cur_opcode = (opcode_t *)(addr); CG_JUMP(); } while (0);
+    do { cur_opcode += 1; CG_NEXT(); } while (0);
+}
+
+PC_1125: /* set_i_ic__lt_i_ic_ic */
+{
+    /* set_i_ic */
+    {
+        IREG(1) = ICONST(2);
+        do { cur_opcode += 3; goto FUSED_1125_1; } while (0);
+    }
+  FUSED_1125_1:
+    /* lt_i_ic_ic */
+    {
+        if ((IREG(1) < ICONST(2))) {
+            do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+        }
+
+        do { cur_opcode += 4; CG_NEXT(); } while (0);
+    }
+}
+
+PC_1126: /* inc_i__lt_i_ic_ic */
+{
+    /* inc_i */
+    {
+        (IREG(1)++);
+        do { cur_opcode += 2; goto FUSED_1126_1; } while (0);
+    }
+  FUSED_1126_1:
+    /* lt_i_ic_ic */
+    {
+        if ((IREG(1) < ICONST(2))) {
+            do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+        }
+
+        do { cur_opcode += 4; CG_NEXT(); } while (0);
+    }
+}
+
+PC_1127: /* inc_i__lt_i_i_ic */
+{
+    /* inc_i */
+    {
+        (IREG(1)++);
+        do { cur_opcode += 2; goto FUSED_1127_1; } while (0);
+    }
+  FUSED_1127_1:
+    /* lt_i_i_ic */
+    {
+        if ((IREG(1) < IREG(2))) {
+            do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+        }
+
+        do { cur_opcode += 4; CG_NEXT(); } while (0);
+    }
+}
+
+PC_1128: /* add_i_i_i__lt_i_ic_ic */
+{
+    /* add_i_i_i */
+    {
+        IREG(1) = (IREG(2) + IREG(3));
+        do { cur_opcode += 4; goto FUSED_1128_1; } while (0);
+    }
+  FUSED_1128_1:
+    /* lt_i_ic_ic */
+    {
+        if ((IREG(1) < ICONST(2))) {
+            do { cur_opcode += ICONST(3); CG_BRANCH(); } while (0);
+        }
+
+        do { cur_opcode += 4; CG_NEXT(); } while (0);
+    }
+}
+
+PC_1129: /* sub_i_i_i__if_i_ic */
+{
+    /* sub_i_i_i */
+    {
+        IREG(1) = (IREG(2) - IREG(3));
+        do { cur_opcode += 4; goto FUSED_1129_1; } while (0);
+    }
+  FUSED_1129_1:
+    /* if_i_ic */
+    {
+        if ((IREG(1) != 0)) {
+            do { cur_opcode += ICONST(2); CG_BRANCH(); } while (0);
+        }
+
+        do { cur_opcode += 3; CG_NEXT(); } while (0);
+    }
+}
+
+PC_1130: /* dec_i__if_i_ic */
+{
+    /* dec_i */
+    {
+        (IREG(1)--);
+        do { cur_opcode += 2; goto FUSED_1130_1; } while (0);
+    }
+  FUSED_1130_1:
+    /* if_i_ic */
+    {
+        if ((IREG(1) != 0)) {
+            do { cur_opcode += ICONST(2); CG_BRANCH(); } while (0);
+        }
+
+        do { cur_opcode += 3; CG_NEXT(); } while (0);
+    }
+}
+
+}
+
+#undef CG_NEXT
+#undef CG_BRANCH
+#undef CG_JUMP
+
+#endif /* PARROT_HAS_COMPUTED_GOTO */
+
+
+
+/*
+** Superinstructions (see src/ops/ops.fuse):
+*/
+
+const op_fuse_t core_op_fuse_table[] = {
+  { 1125, 2, {  698,  204,    0 } }, /* set_i_ic__lt_i_ic_ic */
+  { 1126, 2, {  454,  204,    0 } }, /* inc_i__lt_i_ic_ic */
+  { 1127, 2, {  454,  202,    0 } }, /* inc_i__lt_i_i_ic */
+  { 1128, 2, {  392,  204,    0 } }, /* add_i_i_i__lt_i_ic_ic */
+  { 1129, 2, {  512,   17,    0 } }, /* sub_i_i_i__if_i_ic */
+  { 1130, 2, {  403,   17,    0 } }, /* dec_i__if_i_ic */
+  {    0, 0, {    0,    0,    0 } }
+};
+
 
 /*
 ** op lib descriptor:
@@ -24441,7 +36787,7 @@ op_lib_t core_op_lib = {
   4,    /* major_version */
   8,    /* minor_version */
   0,    /* patch_version */
-  1125,             /* op_count */
+  1131,             /* op_count */
   core_op_info_table,       /* op_info_table */
   core_op_func_table,       /* op_func_table */
   get_op          /* op_code() */ 
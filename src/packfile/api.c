@@ -1,5 +1,5 @@
 /*
-Copyright (C) 2001-2011, Parrot Foundation.
+Copyright (C) 2001-2012, Parrot Foundation.
 This program is free software. It is subject to the same license as
 Parrot itself.
 
@@ -27,6 +27,7 @@ format of bytecode.
 */
 
 #include "pf_private.h"
+#include "parrot/events.h"
 #include "api.str"
 #include "pmc/pmc_sub.h"
 #include "pmc/pmc_packfileview.h"
@@ -79,9 +80,12 @@ static INTVAL find_pf_ann_idx(
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
-static void load_file(PARROT_INTERP, ARGIN(STRING *path))
+static void load_file(PARROT_INTERP,
+    ARGIN(PackFile *pf),
+    ARGIN(STRING *name))
         __attribute__nonnull__(1)
-        __attribute__nonnull__(2);
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
 
 static void mark_1_bc_seg(PARROT_INTERP, ARGMOD(PackFile_ByteCode *bc))
         __attribute__nonnull__(1)
@@ -127,9 +131,26 @@ static void PackFile_set_header(ARGOUT(PackFile_Header *header))
         __attribute__nonnull__(1)
         FUNC_MODIFIES(*header);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static STRING * pbc_cache_path(PARROT_INTERP,
+    ARGIN(STRING *path),
+    INTVAL is_pasm)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static void push_context(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static PackFile * read_cached_pbc(PARROT_INTERP,
+    ARGIN(STRING *cache_path),
+    ARGIN(STRING *path))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 PARROT_CAN_RETURN_NULL
 static char * read_pbc_file_bytes_handle(PARROT_INTERP,
     PIOHANDLE io,
@@ -161,6 +182,16 @@ static int sub_pragma(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(3);
 
+static void write_cached_pbc(PARROT_INTERP,
+    ARGMOD(PackFile *pf),
+    ARGIN(STRING *cache_path),
+    ARGIN(STRING *path))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*pf);
+
 #define ASSERT_ARGS_compile_file __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(path))
@@ -180,7 +211,8 @@ static int sub_pragma(PARROT_INTERP,
     , PARROT_ASSERT_ARG(key))
 #define ASSERT_ARGS_load_file __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
-    , PARROT_ASSERT_ARG(path))
+    , PARROT_ASSERT_ARG(pf) \
+    , PARROT_ASSERT_ARG(name))
 #define ASSERT_ARGS_mark_1_bc_seg __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(bc))
@@ -202,8 +234,15 @@ static int sub_pragma(PARROT_INTERP,
        PARROT_ASSERT_ARG(bc))
 #define ASSERT_ARGS_PackFile_set_header __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(header))
+#define ASSERT_ARGS_pbc_cache_path __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(path))
 #define ASSERT_ARGS_push_context __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_read_cached_pbc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cache_path) \
+    , PARROT_ASSERT_ARG(path))
 #define ASSERT_ARGS_read_pbc_file_bytes_handle __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_read_pbc_file_packfile __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -217,6 +256,11 @@ static int sub_pragma(PARROT_INTERP,
 #define ASSERT_ARGS_sub_pragma __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sub_pmc))
+#define ASSERT_ARGS_write_cached_pbc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pf) \
+    , PARROT_ASSERT_ARG(cache_path) \
+    , PARROT_ASSERT_ARG(path))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -232,6 +276,11 @@ Notice that this can cause problems, if a Packfile is destroyed, but some of
 its contents are not destroyed, but those contents contain indirect references
 to other things in the packfile which are destroyed. Use with caution.
 
+A file image read in for the packfile is freed with it. A mapped image is
+unmapped, unless constant STRINGs were made from it in place; those may still
+be alive, so the image is then handed to the root interpreter and only
+unmapped by C<Parrot_pf_unmap_retired_images> once its GC is gone.
+
 =item C<void PackFile_destroy(PARROT_INTERP, PackFile *pf)>
 
 Deprecated. Same as C<Parrot_pf_destroy>. Use Parrot_pf_destroy instead.
@@ -245,22 +294,43 @@ void
 Parrot_pf_destroy(PARROT_INTERP, ARGMOD(PackFile *pf))
 {
     ASSERT_ARGS(Parrot_pf_destroy)
-
-#ifdef PARROT_HAS_HEADER_SYSMMAN
-    if (pf->is_mmap_ped) {
-        DECL_CONST_CAST;
-        /* Cast the result to void to avoid a warning with
-         * some not-so-standard mmap headers
-         */
-        munmap((void *)PARROT_const_cast(opcode_t *, pf->src), pf->size);
-    }
-#endif
+    DECL_CONST_CAST;
 
     mem_gc_free(interp, pf->header);
     pf->header = NULL;
     mem_gc_free(interp, pf->dirp);
     pf->dirp   = NULL;
     PackFile_Segment_destroy(interp, &pf->directory.base);
+
+    /* segments may reference the image, so release it last */
+    if (pf->owns_src)
+        mem_gc_free(interp, PARROT_const_cast(opcode_t *, pf->src));
+
+#ifdef PARROT_HAS_HEADER_SYSMMAN
+    if (pf->is_mmap_ped) {
+        /* Constant STRINGs made from the image use it in place and can
+         * outlive the packfile, so keep it until the GC owning them is gone */
+        if (pf->n_mapped_strings) {
+            Interp *owner = interp;
+            PackFile_RetiredImage * const image =
+                mem_internal_allocate_typed(PackFile_RetiredImage);
+
+            while (owner->parent_interpreter)
+                owner = owner->parent_interpreter;
+
+            image->src             = PARROT_const_cast(opcode_t *, pf->src);
+            image->size            = pf->size;
+            image->next            = owner->retired_images;
+            owner->retired_images  = image;
+        }
+        else
+            /* Cast the result to void to avoid a warning with
+             * some not-so-standard mmap headers
+             */
+            munmap((void *)PARROT_const_cast(opcode_t *, pf->src), pf->size);
+    }
+#endif
+
     return;
 }
 
@@ -274,6 +344,36 @@ PackFile_destroy(PARROT_INTERP, ARGMOD(PackFile *pf))
 
 /*
 
+=item C<void Parrot_pf_unmap_retired_images(PARROT_INTERP)>
+
+Unmaps the images C<Parrot_pf_destroy> kept mapped for the constant STRINGs
+using them. Only call this when no such STRING can be alive any more, that
+is after the GC of C<interp> has been finalized.
+
+=cut
+
+*/
+
+void
+Parrot_pf_unmap_retired_images(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_pf_unmap_retired_images)
+    PackFile_RetiredImage *image = interp->retired_images;
+
+    while (image) {
+        PackFile_RetiredImage * const next = image->next;
+#ifdef PARROT_HAS_HEADER_SYSMMAN
+        munmap(image->src, image->size);
+#endif
+        mem_internal_free(image);
+        image = next;
+    }
+
+    interp->retired_images = NULL;
+}
+
+/*
+
 =item C<INTVAL Parrot_pf_serialized_size(PARROT_INTERP, PackFile *pf)>
 
 Returns the size, in bytes, that a packfile will be if serialized
@@ -475,7 +575,8 @@ Parrot_pf_subs_by_tag(PARROT_INTERP, ARGIN(PMC * pfpmc), ARGIN(STRING * flag))
 
       done_find_bounds:
         for (i = bottom_lo; i < top_hi; i++)
-            VTABLE_push_pmc(interp, subs, ct->pmc.constants[ct->tag_map[i].const_idx]);
+            VTABLE_push_pmc(interp, subs,
+                    PF_PMC_CONSTANT(interp, ct, ct->tag_map[i].const_idx));
     }
 
     /* Backwards compatibility. :load is equivalent to "load" tag. :init is
@@ -491,7 +592,7 @@ Parrot_pf_subs_by_tag(PARROT_INTERP, ARGIN(PMC * pfpmc), ARGIN(STRING * flag))
             Parrot_Sub_attributes *sub;
             int pragmas;
 
-            if (!VTABLE_isa(interp, sub_pmc, SUB))
+            if (!sub_pmc || !VTABLE_isa(interp, sub_pmc, SUB))
                 continue;
             PMC_get_sub(interp, sub_pmc, sub);
             pragmas = PObj_get_FLAGS(sub_pmc) & SUB_FLAG_PF_MASK & ~SUB_FLAG_IS_OUTER;
@@ -581,7 +682,8 @@ Parrot_pf_all_tagged_pmcs(PARROT_INTERP, ARGIN(PMC * pfpmc))
                 VTABLE_set_pmc_keyed_str(interp, taghash, cur_tag_str, cur_tag_list);
                 last_seen = cur_tag;
             }
-            VTABLE_push_pmc(interp, cur_tag_list, ct->pmc.constants[ct->tag_map[i].const_idx]);
+            VTABLE_push_pmc(interp, cur_tag_list,
+                    PF_PMC_CONSTANT(interp, ct, ct->tag_map[i].const_idx));
         }
     }
     return taghash;
@@ -615,7 +717,7 @@ Parrot_pf_all_subs(PARROT_INTERP, ARGIN(PMC *pfpmc))
         STRING * const SUB = CONST_STRING(interp, "Sub");
         for (i = 0; i < ct->pmc.const_count; ++i) {
             PMC * const x = ct->pmc.constants[i];
-            if (VTABLE_isa(interp, x, SUB))
+            if (x && VTABLE_isa(interp, x, SUB))
                 VTABLE_push_pmc(interp, array, x);
         }
         return array;
@@ -806,6 +908,8 @@ mark_1_bc_seg(PARROT_INTERP, ARGMOD(PackFile_ByteCode *bc))
     size_t i;
     for (i = 0; i < bc->n_libdeps; i++)
         Parrot_gc_mark_STRING_alive(interp, bc->libdeps[i]);
+
+    mark_method_inline_caches(interp, bc);
 }
 
 /*
@@ -950,7 +1054,8 @@ do_sub_pragmas(PARROT_INTERP, ARGIN(PMC *pfpmc),
         STRING * const SUB = CONST_STRING(interp, "Sub");
         PMC * const sub_pmc = ct->pmc.constants[i];
 
-        if (VTABLE_isa(interp, sub_pmc, SUB)) {
+        /* constants still frozen are never Subs */
+        if (sub_pmc && VTABLE_isa(interp, sub_pmc, SUB)) {
             Parrot_Sub_attributes *sub;
 
             PMC_get_sub(interp, sub_pmc, sub);
@@ -2078,7 +2183,7 @@ PackFile_Annotations_lookup(PARROT_INTERP, ARGIN(PackFile_Annotations *self),
           case PF_ANNOTATION_KEY_TYPE_STR:
             return Parrot_pmc_box_string(interp, self->code->const_table->str.constants[val]);
           case PF_ANNOTATION_KEY_TYPE_PMC:
-            return self->code->const_table->pmc.constants[val];
+            return PF_PMC_CONSTANT(interp, self->code->const_table, val);
           default:
             Parrot_warn(interp, PARROT_WARNINGS_ALL_FLAG, "unexpected annotation type found");
             return PMCNULL;
@@ -2163,7 +2268,19 @@ compile_file(PARROT_INTERP, ARGIN(STRING *path), INTVAL is_pasm)
 {
     ASSERT_ARGS(compile_file)
     PackFile_ByteCode * const cur_code = interp->code;
+    STRING * const cache_path = pbc_cache_path(interp, path, is_pasm);
     PMC * compiler;
+
+    if (!STRING_IS_NULL(cache_path)
+    &&  Parrot_file_stat_intval(interp, cache_path, STAT_EXISTS)) {
+        PackFile * const cached = read_cached_pbc(interp, cache_path, path);
+
+        if (cached) {
+            load_file(interp, cached, path);
+            return;
+        }
+    }
+
     if (is_pasm)
         compiler = Parrot_interp_get_compiler(interp, CONST_STRING(interp, "PASM"));
     else
@@ -2178,6 +2295,11 @@ compile_file(PARROT_INTERP, ARGIN(STRING *path), INTVAL is_pasm)
         if (cs) {
             interp->code = cur_code;
             VTABLE_set_pmc_keyed_str(interp, pbc_cache, path, pf_pmc);
+
+            /* store it before any :load sub gets to change the constants */
+            if (!STRING_IS_NULL(cache_path))
+                write_cached_pbc(interp, pf, cache_path, path);
+
             do_sub_pragmas(interp, pf_pmc, PBC_LOADED, NULL);
         }
         else {
@@ -2188,34 +2310,225 @@ compile_file(PARROT_INTERP, ARGIN(STRING *path), INTVAL is_pasm)
     }
 }
 
+/*
+
+=item C<static STRING * pbc_cache_path(PARROT_INTERP, STRING *path, INTVAL
+is_pasm)>
+
+Return the name under which the compiled form of the PIR or PASM source file
+C<path> is kept in the directory named by the C<PARROT_PBC_CACHE> environment
+variable, or C<STRINGNULL> if that variable is not set to a writable directory
+or the source can't be read.
+
+The name is a hash of the source text and path together with everything that
+makes bytecode from another Parrot unusable: the version and build, the
+bytecode format, the name, version and size of every loaded oplib and the
+word size and byte order.  An edited source file thus gets a new entry instead
+of reusing the stale one.  Files pulled in with C<.include> are not part of
+the hash.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static STRING *
+pbc_cache_path(PARROT_INTERP, ARGIN(STRING *path), INTVAL is_pasm)
+{
+    ASSERT_ARGS(pbc_cache_path)
+    STRING * const dir = Parrot_getenv(interp, CONST_STRING(interp, "PARROT_PBC_CACHE"));
+    PMC    * const config = VTABLE_get_pmc_keyed_int(interp, interp->iglobals,
+                                (INTVAL)IGLOBALS_CONFIG_HASH);
+    STRING     *fingerprint;
+    char        name[40];
+    char       *buf;
+    UHUGEINTVAL hash = 14695981039346656037ULL;
+    PIOHANDLE   file;
+    size_t      i, len;
+    int         lib;
+    Parrot_runloop jmp;
+
+    if (STRING_IS_NULL(dir) || STRING_length(dir) == 0
+    ||  !Parrot_file_stat_intval(interp, dir, STAT_ISDIR)
+    ||  !Parrot_file_can_write(interp, dir))
+        return STRINGNULL;
+
+    fingerprint = Parrot_sprintf_c(interp, "%s %d.%d %d %d %d %Ss",
+            PARROT_VERSION, PARROT_PBC_MAJOR, PARROT_PBC_MINOR,
+            (int)sizeof (opcode_t), (int)PARROT_BIGENDIAN, (int)is_pasm, path);
+
+    if (!PMC_IS_NULL(config) && VTABLE_elements(interp, config)) {
+        STRING * const sha1_key = CONST_STRING(interp, "sha1");
+        STRING * const date_key = CONST_STRING(interp, "configdate");
+        fingerprint = Parrot_sprintf_c(interp, "%Ss %Ss %Ss", fingerprint,
+            VTABLE_get_string_keyed_str(interp, config, sha1_key),
+            VTABLE_get_string_keyed_str(interp, config, date_key));
+    }
+
+    for (lib = 0; lib < interp->n_libs; ++lib) {
+        const op_lib_t * const ops = interp->all_op_libs[lib];
+        fingerprint = Parrot_sprintf_c(interp, "%Ss %s %d.%d.%d %d", fingerprint,
+            ops->name, ops->major_version, ops->minor_version,
+            ops->patch_version, (int)ops->op_count);
+    }
+
+    /* FNV-1a; unlike Parrot_hash_buffer it doesn't depend on the hash seed */
+    for (i = 0; i < fingerprint->bufused; ++i)
+        hash = (hash ^ (unsigned char)fingerprint->strstart[i]) * 1099511628211ULL;
+
+    file = Parrot_io_internal_open(interp, path, PIO_F_READ);
+    if (file == PIO_INVALID_HANDLE)
+        return STRINGNULL;
+
+    buf = mem_gc_allocate_n_typed(interp, 4096, char);
+
+    if (setjmp(jmp.resume)) {
+        /* a read error: just compile the file, which reports it */
+        Parrot_cx_delete_handler_local(interp);
+        mem_gc_free(interp, buf);
+        Parrot_io_internal_close(interp, file);
+        return STRINGNULL;
+    }
+
+    Parrot_ex_add_c_handler(interp, &jmp);
+    while ((len = Parrot_io_internal_read(interp, file, buf, 4096)) > 0)
+        for (i = 0; i < len; ++i)
+            hash = (hash ^ (unsigned char)buf[i]) * 1099511628211ULL;
+    Parrot_cx_delete_handler_local(interp);
+
+    mem_gc_free(interp, buf);
+    Parrot_io_internal_close(interp, file);
+
+    snprintf(name, sizeof (name), "/%08lx%08lx.pbc",
+            (unsigned long)(hash >> 32), (unsigned long)(hash & 0xffffffffUL));
+
+    return Parrot_str_concat(interp, dir, Parrot_str_new(interp, name, 0));
+}
+
+/*
+
+=item C<static void write_cached_pbc(PARROT_INTERP, PackFile *pf, STRING
+*cache_path, STRING *path)>
+
+Write the packfile C<pf> freshly compiled from C<path> to C<cache_path>.  The
+source path goes along in a raw C<PBC_CACHE_SOURCE> segment, which is only
+added for the write.  The file goes to a temporary file first and is renamed
+into place, so concurrent processes never load a partly written file.  If the
+file can't be created the source is just compiled again next time.
+
+=cut
+
+*/
+
+static void
+write_cached_pbc(PARROT_INTERP, ARGMOD(PackFile *pf), ARGIN(STRING *cache_path),
+        ARGIN(STRING *path))
+{
+    ASSERT_ARGS(write_cached_pbc)
+    STRING * const tmp_path = Parrot_sprintf_c(interp, "%Ss.%d.tmp",
+            cache_path, (int)Parrot_getpid());
+    PIOHANDLE fp;
+
+    Parrot_block_GC_mark(interp);
+    fp = Parrot_io_internal_open(interp, tmp_path, PIO_F_WRITE);
+    if (fp != PIO_INVALID_HANDLE) {
+        STRING * const seg_name = CONST_STRING(interp, "PBC_CACHE_SOURCE");
+        PackFile_Segment * const source = PackFile_Segment_new_seg(interp,
+                &pf->directory, PF_UNKNOWN_SEG, seg_name, 1);
+        const size_t bytes = path->bufused;
+        size_t size, written;
+        opcode_t *packed;
+
+        /* the byte count, then the bytes of the path */
+        source->size     = 1 + (bytes + sizeof (opcode_t) - 1) / sizeof (opcode_t);
+        source->op_count = source->size;
+        source->data     = mem_gc_allocate_n_zeroed_typed(interp, source->size, opcode_t);
+        source->data[0]  = (opcode_t)bytes;
+        memcpy(source->data + 1, path->strstart, bytes);
+
+        size   = PackFile_pack_size(interp, pf) * sizeof (opcode_t);
+        packed = (opcode_t *)mem_sys_allocate(size);
+        PackFile_pack(interp, pf, packed);
+
+        /* it was added last */
+        --pf->directory.num_segments;
+        PackFile_Segment_destroy(interp, source);
+
+        written = Parrot_io_internal_write(interp, fp, (char *)packed, size);
+        Parrot_io_internal_close(interp, fp);
+        mem_sys_free(packed);
+
+        if (written == size)
+            Parrot_file_rename(interp, tmp_path, cache_path);
+        else
+            Parrot_file_unlink(interp, tmp_path);
+    }
+    Parrot_unblock_GC_mark(interp);
+}
 
 /*
 
-=item C<static void load_file(PARROT_INTERP, STRING *path)>
+=item C<static PackFile * read_cached_pbc(PARROT_INTERP, STRING *cache_path,
+STRING *path)>
 
-Load a bytecode file and append it to the current packfile directory.
+Read the cached compiled form of C<path> from C<cache_path>.  Returns NULL if
+the file was compiled from another source, as recorded by
+C<write_cached_pbc>; the caller then compiles C<path> and replaces the entry.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static PackFile *
+read_cached_pbc(PARROT_INTERP, ARGIN(STRING *cache_path), ARGIN(STRING *path))
+{
+    ASSERT_ARGS(read_cached_pbc)
+    PackFile * const pf = Parrot_pf_read_pbc_file(interp, cache_path);
+    STRING   * const seg_name = CONST_STRING(interp, "PBC_CACHE_SOURCE");
+    const PackFile_Segment * const source = PackFile_find_segment(interp,
+            &pf->directory, seg_name, 0);
+
+    if (source && source->size >= 1
+    &&  source->data[0] == (opcode_t)path->bufused
+    &&  (size_t)(source->size - 1) * sizeof (opcode_t) >= path->bufused
+    &&  memcmp(source->data + 1, path->strstart, path->bufused) == 0)
+        return pf;
+
+    Parrot_pf_destroy(interp, pf);
+    return NULL;
+}
+
+/*
+
+=item C<static void load_file(PARROT_INTERP, PackFile *pf, STRING *name)>
+
+Append the packfile C<pf>, read from a bytecode file, to the current packfile
+directory.  The packfile is registered as C<name>, which is the path of the
+source file when C<pf> is its cached compiled form.
 
 =cut
 
 */
 
 static void
-load_file(PARROT_INTERP, ARGIN(STRING *path))
+load_file(PARROT_INTERP, ARGIN(PackFile *pf), ARGIN(STRING *name))
 {
     ASSERT_ARGS(load_file)
 
-    PackFile * const pf = Parrot_pf_read_pbc_file(interp, path);
-    PMC * const pf_pmc = Parrot_pf_get_packfile_pmc(interp, pf, path);
+    PMC * const pf_pmc = Parrot_pf_get_packfile_pmc(interp, pf, name);
 
     if (!pf_pmc)
         Parrot_ex_throw_from_c_args(interp, NULL, 1,
-                "Unable to load PBC file %Ss", path);
+                "Unable to load PBC file %Ss", name);
     else {
         PMC * const pbc_cache = VTABLE_get_pmc_keyed_int(interp,
             interp->iglobals, IGLOBALS_LOADED_PBCS);
         STRING * const method = CONST_STRING(interp, "mark_initialized");
         STRING * const load_str = CONST_STRING(interp, "load");
-        VTABLE_set_pmc_keyed_str(interp, pbc_cache, path, pf_pmc);
+        VTABLE_set_pmc_keyed_str(interp, pbc_cache, name, pf_pmc);
         Parrot_pcc_invoke_method_from_c_args(interp, pf_pmc, method, "S->",
                 load_str);
         do_sub_pragmas(interp, pf_pmc, PBC_LOADED, pf_pmc);
@@ -2299,7 +2612,7 @@ Parrot_load_language(PARROT_INTERP, ARGIN_NULLOK(STRING *lang_name))
     push_context(interp);
 
     if (STRING_equal(interp, found_ext, pbc))
-        load_file(interp, path);
+        load_file(interp, Parrot_pf_read_pbc_file(interp, path), path);
     else {
         const STRING * pasm_s = CONST_STRING(interp, "pasm");
         const INTVAL is_pasm = STRING_equal(interp, found_ext, pasm_s);
@@ -2374,7 +2687,7 @@ Parrot_load_bytecode(PARROT_INTERP, ARGIN_NULLOK(Parrot_String file_str))
     push_context(interp);
 
     if (STRING_equal(interp, found_ext, pbc))
-        load_file(interp, path);
+        load_file(interp, Parrot_pf_read_pbc_file(interp, path), path);
     else {
         const STRING * pasm_s = CONST_STRING(interp, "pasm");
         const INTVAL is_pasm = STRING_equal(interp, ext, pasm_s);
@@ -2606,11 +2919,14 @@ read_pbc_file_packfile_handle(PARROT_INTERP, ARGIN(STRING * const fullname),
     ASSERT_ARGS(read_pbc_file_packfile_handle)
     char * const program_code = read_pbc_file_bytes_handle(interp, io, program_size);
     PackFile * const pf = PackFile_new(interp, 0);
-    pf->options = 0;
+    pf->owns_src = 1;
+    pf->options  = PFOPT_LAZY_CONSTANTS;
 
-    if (!PackFile_unpack(interp, pf, (opcode_t *)program_code, (size_t)program_size))
+    if (!PackFile_unpack(interp, pf, (opcode_t *)program_code, (size_t)program_size)) {
+        Parrot_pf_destroy(interp, pf);
         Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
                 "Can't unpack packfile %Ss.\n", fullname);
+    }
     return pf;
 }
 
@@ -2668,6 +2984,13 @@ fullname, INTVAL program_size)>
 Read a pbc file into a PackFile*. May use mmap if available or direct reads
 from the file.
 
+The file is mapped privately and writable: pages stay shared with every other
+process mapping the same file until they are written.  The bytecode used in
+place is never rewritten (ops are not fused into it), so its pages stay
+shared.  If the file is in host format, the bytecode and the number
+and string constants are used in place, otherwise C<PackFile_unpack> copies
+them and unmaps the file again.
+
 =cut
 
 */
@@ -2687,41 +3010,43 @@ read_pbc_file_packfile(PARROT_INTERP, ARGIN(STRING * const fullname),
         Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
                 "Can't open %Ss, code %i.\n", fullname, errno);
 
-    /* TODO: Who frees program_code? We don't do it here (And don't need to
-             if we've mmapped it. Figure out where this is handled and
-             document it here.
-    */
-
-#ifndef PARROT_HAS_HEADER_SYSMAN
-
-    program_code = read_pbc_file_bytes_handle(interp, io, program_size);
-
-#else
-
-    program_code = (char *)mmap(NULL, (size_t)program_size,
-                    PROT_READ, MAP_SHARED, io, (off_t)0);
+#ifdef PARROT_HAS_HEADER_SYSMMAN
 
-    /* If mmap fails, fall back and try to read the file from the handle
-       directly.
-    */
-    if (program_code == (void *)MAP_FAILED) {
-        Parrot_warn(interp, PARROT_WARNINGS_IO_FLAG,
-                "Can't mmap file %s, code %i.\n", fullname, errno);
-        program_code = read_pbc_file_bytes_handle(interp, fullname, io, program_size);
+    if (program_size > 0) {
+        program_code = (char *)mmap(NULL, (size_t)program_size,
+                        PROT_READ | PROT_WRITE, MAP_PRIVATE, io, (off_t)0);
+
+        /* If mmap fails, fall back and try to read the file from the handle
+           directly.
+        */
+        if (program_code == (char *)MAP_FAILED) {
+            Parrot_warn(interp, PARROT_WARNINGS_IO_FLAG,
+                    "Can't mmap file %Ss, code %i.\n", fullname, errno);
+            program_code = NULL;
+        }
+        else
+            is_mapped = 1;
     }
-    else
-        is_mapped = 1;
 
 #endif
 
+    if (!program_code)
+        program_code = read_pbc_file_bytes_handle(interp, io, program_size);
+
+    Parrot_io_internal_close(interp, io);
+
+    /* Lazily thawed constants point into the image, so the packfile owns it
+     * either way: Parrot_pf_destroy frees or unmaps it */
     pf = PackFile_new(interp, is_mapped);
-    pf->options = 0;
+    pf->owns_src = !is_mapped;
+    pf->options  = PFOPT_LAZY_CONSTANTS;
 
-    if (!PackFile_unpack(interp, pf, (opcode_t *)program_code, (size_t)program_size))
+    if (!PackFile_unpack(interp, pf, (opcode_t *)program_code, (size_t)program_size)) {
+        Parrot_pf_destroy(interp, pf);
         Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
                 "Can't unpack packfile %Ss.\n", fullname);
+    }
 
-    Parrot_io_internal_close(interp, io);
     return pf;
 }
 
@@ -2761,7 +3086,7 @@ set_current_sub(PARROT_INTERP)
 
     for (i = 0; i < ct->pmc.const_count; i++) {
         PMC * const sub_pmc = ct->pmc.constants[i];
-        if (VTABLE_isa(interp, sub_pmc, SUB)) {
+        if (sub_pmc && VTABLE_isa(interp, sub_pmc, SUB)) {
             Parrot_Sub_attributes *sub;
 
             PMC_get_sub(interp, sub_pmc, sub);
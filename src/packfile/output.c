@@ -1,5 +1,5 @@
 /*
-Copyright (C) 2001-2011, Parrot Foundation.
+Copyright (C) 2001-2012, Parrot Foundation.
 This program is free software. It is subject to the same license as
 Parrot itself.
 
@@ -114,7 +114,9 @@ PackFile_pack(PARROT_INTERP, ARGMOD(PackFile *self), ARGOUT(opcode_t *cursor))
     PackFile_Segment *seg;
     int padding_size;
     char *byte_cursor = (char*)cursor;
+    const opcode_t * const src = self->src;
 
+    /* offsets are taken relative to the output while packing */
     self->src = cursor;
 
     /* Pack the fixed part of the header */
@@ -153,6 +155,10 @@ PackFile_pack(PARROT_INTERP, ARGMOD(PackFile *self), ARGOUT(opcode_t *cursor))
     /* dir size */
     size = seg->op_count;
     ret = PackFile_Segment_pack(interp, seg, cursor);
+
+    /* the packfile still owns and uses the image it was read from */
+    self->src = src;
+
     if ((size_t)(ret - cursor) != size) {
         Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_MALFORMED_PACKFILE,
                 "PackFile_pack segment '%Ss' used size %d but reported %d\n",
@@ -219,7 +225,7 @@ PackFile_ConstTable_pack_size(PARROT_INTERP, ARGMOD(PackFile_Segment *seg))
     self->pmc_hash = Parrot_hash_create(interp, enum_type_PMC, Hash_key_type_PMC_ptr);
     for (i = 0; i < self->pmc.const_count; i++) {
         Hash *seen;
-        PMC * const c = self->pmc.constants[i];
+        PMC * const c = PF_PMC_CONSTANT(interp, self, i);
         size += PF_size_strlen(Parrot_freeze_pbc_size(interp, c, self, &seen)) - 1;
         update_backref_hash(interp, self, seen, i);
     }
@@ -271,7 +277,7 @@ PackFile_ConstTable_pack(PARROT_INTERP,
     self->pmc_hash = Parrot_hash_create(interp, enum_type_PMC, Hash_key_type_PMC_ptr);
     for (i = 0; i < self->pmc.const_count; i++) {
         Hash *seen;
-        PMC * const c = self->pmc.constants[i];
+        PMC * const c = PF_PMC_CONSTANT(interp, self, i);
         cursor  = Parrot_freeze_pbc(interp, c, self, cursor, &seen);
         update_backref_hash(interp, self, seen, i);
     }
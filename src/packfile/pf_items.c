@@ -1067,6 +1067,9 @@ Fetches an C<opcode_t> from the stream, converting byteorder if needed.
 
 When used for freeze/thaw the C<pf> argument might be NULL.
 
+If the data lies in the mmap()ed image of C<pf> and needs no transforms, the
+new C<STRING> references it in place.
+
 =cut
 
 */
@@ -1443,6 +1446,12 @@ PF_fetch_string(PARROT_INTERP, ARGIN_NULLOK(PackFile *pf), ARGIN(const opcode_t
 
     size = (size_t)PF_fetch_opcode(pf, cursor);
 
+    /* counted, so Parrot_pf_destroy knows to keep the image mapped */
+    if (PF_IN_MAPPED_IMAGE(pf, *cursor)) {
+        flags |= PObj_external_FLAG;
+        ++pf->n_mapped_strings;
+    }
+
     encoding = Parrot_get_encoding(interp, encoding_nr);
     if (!encoding)
             Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_UNIMPLEMENTED,
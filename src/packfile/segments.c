@@ -17,6 +17,9 @@ Functions in this file represent behaviors for different PackFile segments.
 
 #include "parrot/parrot.h"
 #include "pf_private.h"
+#include "parrot/oplib/ops.h"
+#include "parrot/oplib/core_ops.h"
+#include "parrot/imageio.h"
 #include "pmc/pmc_parrotlibrary.h"
 #include "segments.str"
 
@@ -146,6 +149,15 @@ static const opcode_t * directory_unpack(PARROT_INTERP,
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*segp);
 
+static opcode_t fuse_map_op(PARROT_INTERP,
+    ARGMOD(PackFile_ByteCode *bc),
+    ARGIN(op_lib_t *lib),
+    opcode_t op)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*bc);
+
 static void make_code_pointers(ARGMOD(PackFile_Segment *seg))
         __attribute__nonnull__(1)
         FUNC_MODIFIES(*seg);
@@ -200,6 +212,10 @@ static const opcode_t * pf_debug_unpack(PARROT_INTERP,
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*self);
 
+PARROT_WARN_UNUSED_RESULT
+static int pmc_constant_can_wait(ARGIN(const opcode_t *cursor))
+        __attribute__nonnull__(1);
+
 static void segment_init(
     ARGOUT(PackFile_Segment *self),
     ARGIN(PackFile *pf),
@@ -266,6 +282,10 @@ static void sort_segs(ARGMOD(PackFile_Directory *dir))
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(segp) \
     , PARROT_ASSERT_ARG(cursor))
+#define ASSERT_ARGS_fuse_map_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(bc) \
+    , PARROT_ASSERT_ARG(lib))
 #define ASSERT_ARGS_make_code_pointers __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(seg))
 #define ASSERT_ARGS_PackFile_Constant_unpack_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -290,6 +310,8 @@ static void sort_segs(ARGMOD(PackFile_Directory *dir))
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(self) \
     , PARROT_ASSERT_ARG(cursor))
+#define ASSERT_ARGS_pmc_constant_can_wait __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(cursor))
 #define ASSERT_ARGS_segment_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(self) \
     , PARROT_ASSERT_ARG(pf) \
@@ -322,7 +344,8 @@ PackFile_ConstTable_clear(PARROT_INTERP, ARGMOD(PackFile_ConstTable *self))
     ASSERT_ARGS(PackFile_ConstTable_clear)
 
     if (self->num.constants) {
-        mem_gc_free(interp, self->num.constants);
+        if (!PF_IN_MAPPED_IMAGE(self->base.pf, self->num.constants))
+            mem_gc_free(interp, self->num.constants);
         self->num.constants = NULL;
     }
 
@@ -336,6 +359,11 @@ PackFile_ConstTable_clear(PARROT_INTERP, ARGMOD(PackFile_ConstTable *self))
         self->pmc.constants = NULL;
     }
 
+    if (self->pmc.frozen) {
+        mem_gc_free(interp, self->pmc.frozen);
+        self->pmc.frozen = NULL;
+    }
+
     if (self->string_hash) {
         Parrot_hash_destroy(interp, self->string_hash);
         self->string_hash = NULL;
@@ -360,6 +388,18 @@ Unpacks a PackFile ConstTable from a block of memory. The format is:
   opcode_t const_count
   *  constants
 
+Number constants and the payloads of string constants in the mmap()ed image
+of a packfile in host format are referenced in place rather than copied.
+
+If the packfile was read with C<PFOPT_LAZY_CONSTANTS> and is in host format,
+PMC constants which have no side effects when thawed (keys and call
+signatures) are left frozen in the image and thawed by
+C<PackFile_ConstTable_thaw_pmc> on first use.  Subs are still thawed here, as
+they have to be stored in their namespaces.  Leaving them frozen too would
+take an index of their names, namespaces and multi signatures written by the
+compiler, and so a new PBC version: later constants may also refer to any
+object inside a Sub's image, which only a full thaw can resolve.
+
 Returns cursor if everything is OK, else zero (0).
 
 =cut
@@ -377,6 +417,8 @@ PackFile_ConstTable_unpack(PARROT_INTERP, ARGMOD(PackFile_Segment *seg),
     STRING              * const sub_str = CONST_STRING(interp, "Sub");
     PackFile_ConstTable * const self    = (PackFile_ConstTable *)seg;
     PackFile            * const pf      = seg->pf;
+    const int                   lazy    = (pf->options & PFOPT_LAZY_CONSTANTS)
+                                       && !pf->need_endianize && !pf->need_wordsize;
     opcode_t                    i;
 
     PackFile_ConstTable_clear(interp, self);
@@ -385,11 +427,24 @@ PackFile_ConstTable_unpack(PARROT_INTERP, ARGMOD(PackFile_Segment *seg),
     self->str.const_count = PF_fetch_opcode(pf, &cursor);
     self->pmc.const_count = PF_fetch_opcode(pf, &cursor);
 
-    if (self->num.const_count) {
+    /* a mapped FLOATVAL array in host format is used in place */
+    if (self->num.const_count
+    &&  PF_IN_MAPPED_IMAGE(pf, cursor)
+    &&  !pf->fetch_nv
+    &&  sizeof (FLOATVAL) % sizeof (opcode_t) == 0
+    &&  (UINTVAL)cursor % sizeof (FLOATVAL) == 0) {
+        DECL_CONST_CAST;
+        self->num.constants = (FLOATVAL *)PARROT_const_cast(opcode_t *, cursor);
+        cursor += self->num.const_count * sizeof (FLOATVAL) / sizeof (opcode_t);
+    }
+    else if (self->num.const_count) {
         self->num.constants = mem_gc_allocate_n_zeroed_typed(interp,
                                     self->num.const_count, FLOATVAL);
         if (!self->num.constants)
             goto err;
+
+        for (i = 0; i < self->num.const_count; i++)
+            self->num.constants[i] = PF_fetch_number(pf, &cursor);
     }
 
     if (self->str.const_count) {
@@ -404,22 +459,37 @@ PackFile_ConstTable_unpack(PARROT_INTERP, ARGMOD(PackFile_Segment *seg),
                                     self->pmc.const_count, PMC *);
         if (!self->pmc.constants)
             goto err;
-    }
 
-    for (i = 0; i < self->num.const_count; i++)
-        self->num.constants[i] = PF_fetch_number(pf, &cursor);
+        if (lazy)
+            self->pmc.frozen = mem_gc_allocate_n_zeroed_typed(interp,
+                                    self->pmc.const_count, const opcode_t *);
+    }
 
     for (i = 0; i < self->str.const_count; i++)
         self->str.constants[i] = PF_fetch_string(interp, pf, &cursor);
 
-    for (i = 0; i < self->pmc.const_count; i++)
-        self->pmc.constants[i] = PackFile_Constant_unpack_pmc(interp, self, &cursor);
+    for (i = 0; i < self->pmc.const_count; i++) {
+        if (self->pmc.frozen && pmc_constant_can_wait(cursor)) {
+            /* skip the image, as PF_fetch_buf would */
+            const size_t size = PF_fetch_opcode(pf, &cursor);
+            self->pmc.frozen[i] = cursor - 1;
+            cursor += (size + sizeof (opcode_t) - 1) / sizeof (opcode_t);
+        }
+        else
+            self->pmc.constants[i] = PackFile_Constant_unpack_pmc(interp, self, &cursor);
+    }
 
     for (i = 0; i < self->pmc.const_count; i++) {
+        PMC *pmc;
+
+        /* left frozen, or thawed for a backreference from another constant */
+        if (self->pmc.frozen && self->pmc.frozen[i])
+            continue;
+
         /* XXX unpack returned the lists of all objects in the object graph
          * must dereference the first object into the constant slot */
-        PMC      * const pmc  = self->pmc.constants[i]
-                              = VTABLE_get_pmc_keyed_int(interp, self->pmc.constants[i], 0);
+        pmc = self->pmc.constants[i]
+            = VTABLE_get_pmc_keyed_int(interp, self->pmc.constants[i], 0);
 
         /* magically place subs into namespace stashes
          * XXX make this explicit with :load subs in PBC */
@@ -442,6 +512,132 @@ PackFile_ConstTable_unpack(PARROT_INTERP, ARGMOD(PackFile_Segment *seg),
 }
 
 
+/*
+
+=item C<PMC * PackFile_ConstTable_thaw_pmc(PARROT_INTERP, PackFile_ConstTable
+*ct, INTVAL idx)>
+
+Thaws the PMC constant C<idx>, which C<PackFile_ConstTable_unpack> left
+frozen, and stores it in the constant table.  Use the C<PF_PMC_CONSTANT>
+macro rather than calling this directly.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PMC *
+PackFile_ConstTable_thaw_pmc(PARROT_INTERP, ARGMOD(PackFile_ConstTable *ct), INTVAL idx)
+{
+    ASSERT_ARGS(PackFile_ConstTable_thaw_pmc)
+    const opcode_t *cursor;
+    PMC            *olist;
+
+    if (ct->pmc.constants[idx] || !ct->pmc.frozen || !ct->pmc.frozen[idx])
+        return ct->pmc.constants[idx];
+
+    cursor = ct->pmc.frozen[idx];
+
+    Parrot_block_GC_mark(interp);
+    olist                  = PackFile_Constant_unpack_pmc(interp, ct, &cursor);
+    ct->pmc.constants[idx] = VTABLE_get_pmc_keyed_int(interp, olist, 0);
+    Parrot_unblock_GC_mark(interp);
+
+    /* the packfile is marked through its view */
+    if (ct->base.pf->view)
+        PARROT_GC_WRITE_BARRIER(interp, ct->base.pf->view);
+
+    return ct->pmc.constants[idx];
+}
+
+
+/*
+
+=item C<INTVAL PackFile_ConstTable_signature_elements(PARROT_INTERP,
+PackFile_ConstTable *ct, INTVAL idx)>
+
+Returns the number of elements of the call signature constant C<idx>, reading
+it from the image if the constant is still frozen.  Walking the ops of a
+segment needs this for every variable-argument op, and should not thaw the
+signatures of code that never runs.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+INTVAL
+PackFile_ConstTable_signature_elements(PARROT_INTERP,
+        ARGMOD(PackFile_ConstTable *ct), INTVAL idx)
+{
+    ASSERT_ARGS(PackFile_ConstTable_signature_elements)
+
+    /* the image holds its byte count, PackID, type and then the size */
+    if (!ct->pmc.constants[idx] && ct->pmc.frozen && ct->pmc.frozen[idx]
+    &&  ct->pmc.frozen[idx][2] == enum_class_FixedIntegerArray)
+        return ct->pmc.frozen[idx][3];
+
+    return VTABLE_elements(interp, PF_PMC_CONSTANT(interp, ct, idx));
+}
+
+
+/*
+
+=item C<static int pmc_constant_can_wait(const opcode_t *cursor)>
+
+Checks if the PMC constant frozen at C<cursor> can be left frozen until it is
+used: it has to be a key or a call signature without properties, as these
+are thawed without side effects and do not refer to other constants.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+pmc_constant_can_wait(ARGIN(const opcode_t *cursor))
+{
+    ASSERT_ARGS(pmc_constant_can_wait)
+    const opcode_t * const image = cursor + 1;
+    const size_t           words = (size_t)cursor[0] / sizeof (opcode_t);
+    size_t                 i     = 3;
+    opcode_t               n;
+
+    if (words < 4 || PackID_get_FLAGS(image[0]) != enum_PackID_normal)
+        return 0;
+
+    n = image[2];
+
+    switch (image[1]) {
+      case enum_class_FixedIntegerArray:
+        if (n < 0)
+            return 0;
+        i += n;
+        break;
+
+      case enum_class_Key:
+        /* each key part is its flags and an integer, a register number or
+         * the index of a string constant; -1 is followed by an inline
+         * string */
+        for (; n > 0; n--, i += 2) {
+            if (i + 1 >= words
+            || ((image[i] & KEY_string_FLAG) && !(image[i] & KEY_register_FLAG)
+                && image[i + 1] < 0))
+                return 0;
+        }
+        break;
+
+      default:
+        return 0;
+    }
+
+    /* the last item is the PackID of the properties, which must be null */
+    return i < words && image[i] == (opcode_t)PackID_new(0, enum_PackID_seen);
+}
+
+
 /*
 
 =item C<static PackFile_Segment * const_new(PARROT_INTERP)>
@@ -1715,6 +1911,22 @@ byte_code_destroy(PARROT_INTERP, ARGMOD(PackFile_Segment *self))
     if (byte_code->libdeps)
         mem_gc_free(interp, byte_code->libdeps);
 
+    if (byte_code->threaded_code)
+        mem_gc_free(interp, byte_code->threaded_code);
+
+    if (byte_code->unfused_ops)
+        mem_gc_free(interp, byte_code->unfused_ops);
+
+    if (byte_code->method_caches) {
+        size_t i;
+
+        for (i = 0; i < byte_code->method_caches_size; i++)
+            if (byte_code->method_caches[i])
+                mem_gc_free(interp, byte_code->method_caches[i]);
+
+        mem_gc_free(interp, byte_code->method_caches);
+    }
+
     if (byte_code->annotations)
         PackFile_Annotations_destroy(interp, (PackFile_Segment *)byte_code->annotations);
 
@@ -1725,6 +1937,9 @@ byte_code_destroy(PARROT_INTERP, ARGMOD(PackFile_Segment *self))
     byte_code->op_info_table   = NULL;
     byte_code->op_mapping.libs = NULL;
     byte_code->libdeps         = NULL;
+    byte_code->threaded_code   = NULL;
+    byte_code->unfused_ops     = NULL;
+    byte_code->method_caches   = NULL;
 }
 
 
@@ -1798,7 +2013,9 @@ byte_code_packed_size(SHIM_INTERP, ARGMOD(PackFile_Segment *self))
 =item C<static opcode_t * byte_code_pack(PARROT_INTERP, PackFile_Segment *self,
 opcode_t *cursor)>
 
-Stores the passed C<PackFile_ByteCode> segment in bytecode.
+Stores the passed C<PackFile_ByteCode> segment in bytecode.  The code itself
+is already stored just before C<cursor>; ops replaced by fused ops are put
+back there, and the fused ops are left out of the op table.
 
 =cut
 
@@ -1811,13 +2028,17 @@ byte_code_pack(SHIM_INTERP, ARGMOD(PackFile_Segment *self), ARGOUT(opcode_t *cur
 {
     ASSERT_ARGS(byte_code_pack)
     const PackFile_ByteCode * const byte_code = (PackFile_ByteCode *)self;
+    opcode_t * const code = cursor - self->size;
     int i;
     unsigned int u;
 
+    for (u = 0; u < byte_code->n_fused; u++)
+        code[byte_code->unfused_ops[2 * u]] = byte_code->unfused_ops[2 * u + 1];
+
     *cursor++ = byte_code->main_sub;
 
     *cursor++ = byte_code->n_libdeps;
-    *cursor++ = byte_code->op_count;
+    *cursor++ = byte_code->op_count - byte_code->fused_table_ops;
     *cursor++ = byte_code->op_mapping.n_libs;
 
     for (u = 0; u < byte_code->n_libdeps; u++)
@@ -1984,6 +2205,176 @@ byte_code_unpack(PARROT_INTERP, ARGMOD(PackFile_Segment *self), ARGIN(const opco
 
 /*
 
+=item C<void Parrot_pf_fuse_ops(PARROT_INTERP, PackFile_ByteCode *bc)>
+
+Rewrites the sequences of core ops in C<bc> that have a fused op (see
+F<src/ops/ops.fuse>) to use it.  Only the opcode of the first op of a
+sequence changes: its arguments and the following ops stay where they are,
+so branch targets, sub offsets and debug information remain valid, and code
+that branches into the middle of a sequence simply runs the remaining ops
+one by one.  Threaded code the C<cgoto> core already decoded keeps running
+the unfused ops, which is equally correct.
+
+Code used in place from a mapped PBC file is left alone: rewriting it would
+give the process private copies of the pages it shares with every other
+process running the same file.
+
+The fused ops are build specific, so they never reach the op mapping.  Their
+entries are appended to the op table past the mapped ops, and the original
+opcodes are kept, so packing the segment writes the code as it was.
+
+The C<fast> and C<cgoto> runcores call this when they prepare to run a
+segment whose code grew since the last call.
+
+=item C<void Parrot_pf_unfuse_ops(PARROT_INTERP, PackFile_ByteCode *bc)>
+
+Undoes C<Parrot_pf_fuse_ops>: puts the original opcodes back and drops the
+fused ops from the op table, so that ops can be mapped after the existing
+ones again.  The next run fuses the code anew.
+
+=item C<static opcode_t fuse_map_op(PARROT_INTERP, PackFile_ByteCode *bc,
+op_lib_t *lib, opcode_t op)>
+
+Returns the number of the op C<op> of C<lib> in the op table of C<bc>,
+appending it to the table if it is not there yet.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_pf_fuse_ops(PARROT_INTERP, ARGMOD(PackFile_ByteCode *bc))
+{
+    ASSERT_ARGS(Parrot_pf_fuse_ops)
+    op_lib_t * const core_ops = PARROT_GET_CORE_OPLIB(interp);
+    opcode_t * const code     = bc->base.data;
+    const size_t     size     = bc->base.size;
+    size_t          *offs;
+    opcode_t        *ops;
+    size_t           n = 0;
+    size_t           n_alloced = 0;
+    size_t           i;
+
+    /* the op function table is swapped out while event checking is on */
+    if (!code || !bc->const_table || bc->save_func_table)
+        return;
+
+    Parrot_pf_unfuse_ops(interp, bc);
+    bc->fused_size = size;
+
+    if (PF_IN_MAPPED_IMAGE(bc->base.pf, code))
+        return;
+
+    /* find the core op number of every op; -1 for ops of other libraries */
+    offs = mem_gc_allocate_n_typed(interp, size, size_t);
+    ops  = mem_gc_allocate_n_typed(interp, size, opcode_t);
+
+    for (i = 0; i < size; n++) {
+        const op_info_t *info;
+        size_t           op_size;
+
+        if (code[i] < 0 || code[i] >= (opcode_t)bc->op_count)
+            break;
+
+        info    = bc->op_info_table[code[i]];
+        op_size = info->op_count;
+        ADD_OP_VAR_PART(interp, bc, code + i, op_size);
+
+        offs[n] = i;
+        ops[n]  = info->lib == core_ops ? OP_INFO_OPNUM(info) : -1;
+        i      += op_size;
+    }
+
+    for (i = 0; i < n; i++) {
+        const op_fuse_t *best = NULL;
+        const op_fuse_t *f;
+
+        if (ops[i] < 0)
+            continue;
+
+        for (f = core_op_fuse_table; f->n_ops; f++) {
+            opcode_t j;
+
+            if (f->ops[0] != ops[i]
+            ||  i + f->n_ops > n
+            || (best && best->n_ops >= f->n_ops))
+                continue;
+
+            for (j = 1; j < f->n_ops; j++)
+                if (f->ops[j] != ops[i + j])
+                    break;
+
+            if (j == f->n_ops)
+                best = f;
+        }
+
+        if (best) {
+            if (bc->n_fused == n_alloced) {
+                n_alloced       = n_alloced ? 2 * n_alloced : 16;
+                bc->unfused_ops = mem_gc_realloc_n_typed(interp, bc->unfused_ops,
+                                        2 * n_alloced, opcode_t);
+            }
+
+            bc->unfused_ops[2 * bc->n_fused]     = (opcode_t)offs[i];
+            bc->unfused_ops[2 * bc->n_fused + 1] = code[offs[i]];
+            bc->n_fused++;
+
+            code[offs[i]] = fuse_map_op(interp, bc, core_ops, best->fused);
+            i += best->n_ops - 1;
+        }
+    }
+
+    mem_gc_free(interp, offs);
+    mem_gc_free(interp, ops);
+}
+
+PARROT_EXPORT
+void
+Parrot_pf_unfuse_ops(PARROT_INTERP, ARGMOD(PackFile_ByteCode *bc))
+{
+    ASSERT_ARGS(Parrot_pf_unfuse_ops)
+    size_t i;
+
+    for (i = 0; i < bc->n_fused; i++)
+        bc->base.data[bc->unfused_ops[2 * i]] = bc->unfused_ops[2 * i + 1];
+
+    if (bc->unfused_ops) {
+        mem_gc_free(interp, bc->unfused_ops);
+        bc->unfused_ops = NULL;
+    }
+
+    bc->op_count       -= bc->fused_table_ops;
+    bc->n_fused         = 0;
+    bc->fused_table_ops = 0;
+    bc->fused_size      = 0;
+}
+
+static opcode_t
+fuse_map_op(PARROT_INTERP, ARGMOD(PackFile_ByteCode *bc), ARGIN(op_lib_t *lib), opcode_t op)
+{
+    ASSERT_ARGS(fuse_map_op)
+    op_info_t * const info = &lib->op_info_table[op];
+    opcode_t          i;
+
+    for (i = 0; i < (opcode_t)bc->op_count; i++)
+        if (bc->op_info_table[i] == info)
+            return i;
+
+    bc->op_count++;
+    bc->fused_table_ops++;
+    bc->op_func_table = mem_gc_realloc_n_typed_zeroed(interp, bc->op_func_table,
+                            bc->op_count, bc->op_count - 1, op_func_t);
+    bc->op_info_table = mem_gc_realloc_n_typed_zeroed(interp, bc->op_info_table,
+                            bc->op_count, bc->op_count - 1, op_info_t *);
+    bc->op_func_table[bc->op_count - 1] = lib->op_func_table[op];
+    bc->op_info_table[bc->op_count - 1] = info;
+
+    return bc->op_count - 1;
+}
+
+/*
+
 =back
 
 =head2 Debug Info
@@ -62,6 +62,23 @@ Parrot_floatval_time(void)
 }
 
 
+/*
+
+=item C<FLOATVAL Parrot_floatval_monotonic_time(void)>
+
+ANSI-C has no monotonic clock, so this is just C<Parrot_floatval_time>.
+
+=cut
+
+*/
+
+FLOATVAL
+Parrot_floatval_monotonic_time(void)
+{
+    return Parrot_floatval_time();
+}
+
+
 /*
 
 =item C<void Parrot_sleep(unsigned int seconds)>
@@ -0,0 +1,257 @@
+/*
+ * Copyright (C) 2012, Parrot Foundation.
+ */
+
+/*
+
+=head1 NAME
+
+src/platform/generic/poller.c
+
+=head1 DESCRIPTION
+
+Waiting for many handles at once with poll(2). The poller keeps an array of
+the handles added since they were last reported; each wait polls all of them.
+Platforms which have something better than that, like epoll on Linux, bring
+their own version of this file.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+
+#ifdef PARROT_HAS_HEADER_POLL
+#  include <poll.h>
+#endif
+
+/* HEADERIZER HFILE: none */
+
+/* Longer timeouts, in seconds, are cut down to this one */
+#define POLLER_MAX_TIMEOUT 86400.0
+
+#ifdef PARROT_HAS_HEADER_POLL
+struct Parrot_io_poller {
+    struct pollfd *fds;       /* The handles waited for */
+    size_t         used;      /* How many of fds are in use */
+    size_t         allocated; /* How many fds there is room for */
+};
+#else
+struct Parrot_io_poller {
+    int unused;
+};
+#endif
+
+/*
+
+=item C<Parrot_io_poller * Parrot_io_internal_poller_new(PARROT_INTERP)>
+
+Creates a poller, or returns NULL if that is not possible.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+Parrot_io_poller *
+Parrot_io_internal_poller_new(PARROT_INTERP)
+{
+    UNUSED(interp);
+#ifdef PARROT_HAS_HEADER_POLL
+    return mem_internal_allocate_zeroed_typed(Parrot_io_poller);
+#else
+    return NULL;
+#endif
+}
+
+/*
+
+=item C<void Parrot_io_internal_poller_free(PARROT_INTERP, Parrot_io_poller
+*poller)>
+
+Destroys C<poller>.
+
+=cut
+
+*/
+
+void
+Parrot_io_internal_poller_free(PARROT_INTERP, ARGFREE_NOTNULL(Parrot_io_poller *poller))
+{
+    UNUSED(interp);
+#ifdef PARROT_HAS_HEADER_POLL
+    if (poller->fds)
+        mem_internal_free(poller->fds);
+#endif
+    mem_internal_free(poller);
+}
+
+/*
+
+=item C<INTVAL Parrot_io_internal_poller_add(PARROT_INTERP, Parrot_io_poller
+*poller, PIOHANDLE handle, INTVAL which)>
+
+Makes the next C<Parrot_io_internal_poller_wait> report C<handle> once it
+is ready for any of C<which>, a combination of C<PIO_POLL_READ>,
+C<PIO_POLL_WRITE> and C<PIO_POLL_ERROR>. Returns 0, or -1 if C<handle> can't
+be waited for.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_internal_poller_add(PARROT_INTERP, ARGMOD(Parrot_io_poller *poller),
+        PIOHANDLE handle, INTVAL which)
+{
+#ifdef PARROT_HAS_HEADER_POLL
+    short  events = 0;
+    size_t i;
+
+    UNUSED(interp);
+
+    if (which & PIO_POLL_READ)
+        events |= POLLIN;
+    if (which & PIO_POLL_WRITE)
+        events |= POLLOUT;
+    if (which & PIO_POLL_ERROR)
+        events |= POLLPRI;
+
+    for (i = 0; i < poller->used; ++i) {
+        if (poller->fds[i].fd == handle) {
+            poller->fds[i].events = events;
+            return 0;
+        }
+    }
+
+    if (poller->used == poller->allocated) {
+        poller->allocated = poller->allocated ? poller->allocated * 2 : 16;
+        mem_internal_realloc_n_typed(poller->fds, poller->allocated, struct pollfd);
+    }
+
+    poller->fds[poller->used].fd      = handle;
+    poller->fds[poller->used].events  = events;
+    poller->fds[poller->used].revents = 0;
+    ++poller->used;
+
+    return 0;
+#else
+    UNUSED(interp);
+    UNUSED(poller);
+    UNUSED(handle);
+    UNUSED(which);
+    return -1;
+#endif
+}
+
+/*
+
+=item C<void Parrot_io_internal_poller_remove(PARROT_INTERP, Parrot_io_poller
+*poller, PIOHANDLE handle)>
+
+Forgets about C<handle>, which is about to be closed. Its number may be
+reused by the next handle opened.
+
+=cut
+
+*/
+
+void
+Parrot_io_internal_poller_remove(PARROT_INTERP, ARGMOD(Parrot_io_poller *poller),
+        PIOHANDLE handle)
+{
+#ifdef PARROT_HAS_HEADER_POLL
+    size_t i;
+
+    UNUSED(interp);
+
+    for (i = 0; i < poller->used; ++i) {
+        if (poller->fds[i].fd == handle) {
+            poller->fds[i] = poller->fds[--poller->used];
+            return;
+        }
+    }
+#else
+    UNUSED(interp);
+    UNUSED(poller);
+    UNUSED(handle);
+#endif
+}
+
+/*
+
+=item C<INTVAL Parrot_io_internal_poller_wait(PARROT_INTERP, Parrot_io_poller
+*poller, FLOATVAL timeout, PIOHANDLE *ready, INTVAL size)>
+
+Waits up to C<timeout> seconds, or for ever if it is negative, until one of
+the handles added to C<poller> is ready. Stores up to C<size> of the ready
+handles in C<ready> and returns how many it stored. A handle is reported
+only once for each time it was added. Returns 0 if the wait was interrupted
+by a signal.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_internal_poller_wait(PARROT_INTERP, ARGMOD(Parrot_io_poller *poller),
+        FLOATVAL timeout, ARGOUT(PIOHANDLE *ready), INTVAL size)
+{
+#ifdef PARROT_HAS_HEADER_POLL
+    int    ms    = -1;
+    INTVAL count = 0;
+    size_t i     = 0;
+
+    UNUSED(interp);
+
+    /* Round up, so the wait is not over before the timeout */
+    if (timeout >= 0.0)
+        ms = timeout < POLLER_MAX_TIMEOUT ? (int)ceil(timeout * 1000.0)
+                                          : (int)(POLLER_MAX_TIMEOUT * 1000.0);
+
+    if (poll(poller->fds, poller->used, ms) <= 0)
+        return 0;
+
+    /* Report the ready handles and forget about them */
+    while (i < poller->used && count < size) {
+        if (poller->fds[i].revents) {
+            ready[count++] = poller->fds[i].fd;
+            poller->fds[i] = poller->fds[--poller->used];
+        }
+        else
+            ++i;
+    }
+
+    return count;
+#else
+    UNUSED(interp);
+    UNUSED(poller);
+    UNUSED(timeout);
+    UNUSED(ready);
+    UNUSED(size);
+    return 0;
+#endif
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/platform/linux/poller.c>, F<src/scheduler.c>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -63,6 +63,10 @@ This code implements UNIX socket functions for Parrot.
 #    include <netdb.h>
 #  endif /* PARROT_HAS_HEADER_NETDB */
 
+#  ifdef PARROT_HAS_HEADER_FCNTL
+#    include <fcntl.h>
+#  endif /* PARROT_HAS_HEADER_FCNTL */
+
 #endif /* _WIN32 */
 
 #include "parrot/parrot.h"
@@ -524,6 +528,86 @@ AGAIN:
 
 /*
 
+=item C<INTVAL Parrot_io_internal_connect_start(PARROT_INTERP, PIOHANDLE
+os_handle, void *addr, INTVAL addr_len)>
+
+Starts connecting C<os_handle> to C<addr> without waiting for the connection
+to be made. Returns 1 if it is in progress: once the socket becomes writable
+it is done, and C<Parrot_io_internal_connect_finish> tells whether it worked.
+Returns 0 if the socket is connected already, calling this again for a
+connection in progress tells that too.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_internal_connect_start(PARROT_INTERP, PIOHANDLE os_handle, ARGIN(void *addr),
+        INTVAL addr_len)
+{
+#ifdef _WIN32
+    /* TODO: Implement on Windows */
+    Parrot_io_internal_connect(interp, os_handle, addr, addr_len);
+    return 0;
+#else
+    const PIOSOCKET sock  = (PIOSOCKET)os_handle;
+    const int       flags = fcntl(sock, F_GETFL, 0);
+    int             error = 0;
+
+    fcntl(sock, F_SETFL, flags | O_NONBLOCK);
+    if (connect(sock, (struct sockaddr *)addr, addr_len) != 0)
+        error = PIO_SOCK_ERRNO;
+    fcntl(sock, F_SETFL, flags);
+
+    if (error == 0 || error == PIO_SOCK_EISCONN)
+        return 0;
+
+    if (error != PIO_SOCK_EINPROGRESS
+    &&  error != PIO_SOCK_EINTR
+    &&  error != EALREADY)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+                "connect failed: %Ss",
+                Parrot_platform_strerror(interp, error));
+
+    /* Still connecting */
+    return 1;
+#endif
+}
+
+/*
+
+=item C<void Parrot_io_internal_connect_finish(PARROT_INTERP, PIOHANDLE
+os_handle)>
+
+Waits until the connection started by C<Parrot_io_internal_connect_start> is
+made. Throws an exception if it failed.
+
+=cut
+
+*/
+
+void
+Parrot_io_internal_connect_finish(PARROT_INTERP, PIOHANDLE os_handle)
+{
+    int       error = 0;
+    socklen_t len   = sizeof (error);
+
+    while (!(Parrot_io_internal_poll(interp, os_handle, PIO_POLL_WRITE, 60, 0)
+             & PIO_POLL_WRITE))
+        ;
+
+    if (getsockopt((PIOSOCKET)os_handle, SOL_SOCKET, SO_ERROR,
+            (char *)&error, &len) != 0)
+        error = PIO_SOCK_ERRNO;
+
+    if (error)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+                "connect failed: %Ss",
+                Parrot_platform_strerror(interp, error));
+}
+
+/*
+
 =item C<void Parrot_io_internal_bind(PARROT_INTERP, PIOHANDLE os_handle, void
 *addr, INTVAL addr_len)>
 
@@ -65,6 +65,29 @@ Parrot_floatval_time(void)
 
 /*
 
+=item C<FLOATVAL Parrot_floatval_monotonic_time(void)>
+
+Returns the seconds since some unspecified starting point, from a clock which
+is not affected by changes to the system time. Only differences between two
+values are meaningful.
+
+=cut
+
+*/
+
+FLOATVAL
+Parrot_floatval_monotonic_time(void)
+{
+#ifdef CLOCK_MONOTONIC
+    struct timespec t;
+    if (clock_gettime(CLOCK_MONOTONIC, &t) == 0)
+        return (FLOATVAL)t.tv_sec + ((FLOATVAL)t.tv_nsec / 1000000000.0);
+#endif
+    return Parrot_floatval_time();
+}
+
+/*
+
 =item C<void Parrot_sleep(unsigned int seconds)>
 
 Parrot wrapper around standard library C<sleep()> function.
@@ -0,0 +1,218 @@
+/*
+ * Copyright (C) 2012, Parrot Foundation.
+ */
+
+/*
+
+=head1 NAME
+
+src/platform/linux/poller.c
+
+=head1 DESCRIPTION
+
+Waiting for many handles at once with epoll. Each handle is added with
+C<EPOLLONESHOT>, so it stays in the epoll set after it was reported but is
+not reported again until it is added once more; closing the handle removes
+it.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+
+#include <sys/epoll.h>
+#include <errno.h>
+
+/* HEADERIZER HFILE: none */
+
+/* How many ready handles one epoll_wait call returns at most */
+#define POLLER_BATCH 32
+
+/* Longer timeouts, in seconds, are cut down to this one */
+#define POLLER_MAX_TIMEOUT 86400.0
+
+struct Parrot_io_poller {
+    int epoll_fd;
+};
+
+/*
+
+=item C<Parrot_io_poller * Parrot_io_internal_poller_new(PARROT_INTERP)>
+
+Creates a poller, or returns NULL if that is not possible.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+Parrot_io_poller *
+Parrot_io_internal_poller_new(PARROT_INTERP)
+{
+    const int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    Parrot_io_poller *poller;
+
+    UNUSED(interp);
+
+    if (epoll_fd < 0)
+        return NULL;
+
+    poller           = mem_internal_allocate_typed(Parrot_io_poller);
+    poller->epoll_fd = epoll_fd;
+
+    return poller;
+}
+
+/*
+
+=item C<void Parrot_io_internal_poller_free(PARROT_INTERP, Parrot_io_poller
+*poller)>
+
+Destroys C<poller>.
+
+=cut
+
+*/
+
+void
+Parrot_io_internal_poller_free(PARROT_INTERP, ARGFREE_NOTNULL(Parrot_io_poller *poller))
+{
+    UNUSED(interp);
+    close(poller->epoll_fd);
+    mem_internal_free(poller);
+}
+
+/*
+
+=item C<INTVAL Parrot_io_internal_poller_add(PARROT_INTERP, Parrot_io_poller
+*poller, PIOHANDLE handle, INTVAL which)>
+
+Makes the next C<Parrot_io_internal_poller_wait> report C<handle> once it
+is ready for any of C<which>, a combination of C<PIO_POLL_READ>,
+C<PIO_POLL_WRITE> and C<PIO_POLL_ERROR>. Returns 0, or -1 if C<handle> can't
+be waited for. Regular files can't, they are always ready.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_internal_poller_add(PARROT_INTERP, ARGMOD(Parrot_io_poller *poller),
+        PIOHANDLE handle, INTVAL which)
+{
+    struct epoll_event event;
+
+    UNUSED(interp);
+
+    event.events  = EPOLLONESHOT;
+    event.data.fd = handle;
+
+    if (which & PIO_POLL_READ)
+        event.events |= EPOLLIN | EPOLLRDHUP;
+    if (which & PIO_POLL_WRITE)
+        event.events |= EPOLLOUT;
+    if (which & PIO_POLL_ERROR)
+        event.events |= EPOLLPRI;
+
+    /* Usually the handle was waited for before */
+    if (epoll_ctl(poller->epoll_fd, EPOLL_CTL_MOD, handle, &event) == 0)
+        return 0;
+
+    if (errno == ENOENT
+    &&  epoll_ctl(poller->epoll_fd, EPOLL_CTL_ADD, handle, &event) == 0)
+        return 0;
+
+    return -1;
+}
+
+/*
+
+=item C<void Parrot_io_internal_poller_remove(PARROT_INTERP, Parrot_io_poller
+*poller, PIOHANDLE handle)>
+
+Forgets about C<handle>, which is about to be closed. Its number may be
+reused by the next handle opened.
+
+=cut
+
+*/
+
+void
+Parrot_io_internal_poller_remove(PARROT_INTERP, ARGMOD(Parrot_io_poller *poller),
+        PIOHANDLE handle)
+{
+    /* Kernels before 2.6.9 want an event, even if it is ignored */
+    struct epoll_event event;
+
+    UNUSED(interp);
+
+    event.events  = 0;
+    event.data.fd = handle;
+
+    (void)epoll_ctl(poller->epoll_fd, EPOLL_CTL_DEL, handle, &event);
+}
+
+/*
+
+=item C<INTVAL Parrot_io_internal_poller_wait(PARROT_INTERP, Parrot_io_poller
+*poller, FLOATVAL timeout, PIOHANDLE *ready, INTVAL size)>
+
+Waits up to C<timeout> seconds, or for ever if it is negative, until one of
+the handles added to C<poller> is ready. Stores up to C<size> of the ready
+handles in C<ready> and returns how many it stored. A handle is reported
+only once for each time it was added. Returns 0 if the wait was interrupted
+by a signal.
+
+=cut
+
+*/
+
+INTVAL
+Parrot_io_internal_poller_wait(PARROT_INTERP, ARGMOD(Parrot_io_poller *poller),
+        FLOATVAL timeout, ARGOUT(PIOHANDLE *ready), INTVAL size)
+{
+    struct epoll_event events[POLLER_BATCH];
+    int                ms = -1;
+    int                count, i;
+
+    UNUSED(interp);
+
+    if (size > POLLER_BATCH)
+        size = POLLER_BATCH;
+
+    /* Round up, so the wait is not over before the timeout */
+    if (timeout >= 0.0)
+        ms = timeout < POLLER_MAX_TIMEOUT ? (int)ceil(timeout * 1000.0)
+                                          : (int)(POLLER_MAX_TIMEOUT * 1000.0);
+
+    count = epoll_wait(poller->epoll_fd, events, size, ms);
+
+    for (i = 0; i < count; ++i)
+        ready[i] = events[i].data.fd;
+
+    return count > 0 ? count : 0;
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/platform/generic/poller.c>, F<src/scheduler.c>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
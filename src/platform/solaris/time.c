@@ -65,6 +65,23 @@ Parrot_floatval_time(void)
 
 /*
 
+=item C<FLOATVAL Parrot_floatval_monotonic_time(void)>
+
+Returns the seconds since some unspecified starting point, from a clock which
+is not affected by changes to the system time.
+
+=cut
+
+*/
+
+FLOATVAL
+Parrot_floatval_monotonic_time(void)
+{
+    return (FLOATVAL)gethrtime() / 1000000000.0;
+}
+
+/*
+
 =item C<void Parrot_sleep(unsigned int seconds)>
 
 Parrot wrapper around standard library C<sleep()> function.
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2012, Parrot Foundation.
+ */
+
+/*
+
+=head1 NAME
+
+src/platform/win32/poller.c
+
+=head1 DESCRIPTION
+
+Waiting for many handles at once is not implemented on Windows yet, so tasks
+block in their I/O operations there.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+
+/* HEADERIZER HFILE: none */
+
+/*
+
+=item C<Parrot_io_poller * Parrot_io_internal_poller_new(PARROT_INTERP)>
+
+Returns NULL, there are no pollers.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+Parrot_io_poller *
+Parrot_io_internal_poller_new(PARROT_INTERP)
+{
+    UNUSED(interp);
+    return NULL;
+}
+
+/*
+
+=item C<void Parrot_io_internal_poller_free(PARROT_INTERP, Parrot_io_poller
+*poller)>
+
+=item C<INTVAL Parrot_io_internal_poller_add(PARROT_INTERP, Parrot_io_poller
+*poller, PIOHANDLE handle, INTVAL which)>
+
+=item C<void Parrot_io_internal_poller_remove(PARROT_INTERP, Parrot_io_poller
+*poller, PIOHANDLE handle)>
+
+=item C<INTVAL Parrot_io_internal_poller_wait(PARROT_INTERP, Parrot_io_poller
+*poller, FLOATVAL timeout, PIOHANDLE *ready, INTVAL size)>
+
+Never called.
+
+=cut
+
+*/
+
+void
+Parrot_io_internal_poller_free(PARROT_INTERP, ARGFREE_NOTNULL(Parrot_io_poller *poller))
+{
+    UNUSED(interp);
+    UNUSED(poller);
+}
+
+INTVAL
+Parrot_io_internal_poller_add(PARROT_INTERP, ARGMOD(Parrot_io_poller *poller),
+        PIOHANDLE handle, INTVAL which)
+{
+    UNUSED(interp);
+    UNUSED(poller);
+    UNUSED(handle);
+    UNUSED(which);
+    return -1;
+}
+
+void
+Parrot_io_internal_poller_remove(PARROT_INTERP, ARGMOD(Parrot_io_poller *poller),
+        PIOHANDLE handle)
+{
+    UNUSED(interp);
+    UNUSED(poller);
+    UNUSED(handle);
+}
+
+INTVAL
+Parrot_io_internal_poller_wait(PARROT_INTERP, ARGMOD(Parrot_io_poller *poller),
+        FLOATVAL timeout, ARGOUT(PIOHANDLE *ready), INTVAL size)
+{
+    UNUSED(interp);
+    UNUSED(poller);
+    UNUSED(timeout);
+    UNUSED(ready);
+    UNUSED(size);
+    return 0;
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/platform/generic/poller.c>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -82,6 +82,29 @@ Parrot_floatval_time(void)
     return (FLOATVAL)i.QuadPart / 10000000.0 - 11644473600.0;
 }
 
+/*
+
+=item C<FLOATVAL Parrot_floatval_monotonic_time(void)>
+
+Returns the seconds since some unspecified starting point, from the
+performance counter, which is not affected by changes to the system time.
+
+=cut
+
+*/
+
+FLOATVAL
+Parrot_floatval_monotonic_time(void)
+{
+    LARGE_INTEGER count, frequency;
+
+    if (QueryPerformanceFrequency(&frequency)
+    &&  QueryPerformanceCounter(&count))
+        return (FLOATVAL)count.QuadPart / (FLOATVAL)frequency.QuadPart;
+
+    return Parrot_floatval_time();
+}
+
 
 /*
 
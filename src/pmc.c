@@ -743,6 +743,9 @@ Parrot_pmc_get_new_vtable_index(PARROT_INTERP)
     if (type_id >= interp->n_vtable_alloced)
         Parrot_vtbl_realloc_vtables(interp);
 
+    /* a new type can change which method or multi candidate applies */
+    Parrot_invalidate_method_inline_caches(interp);
+
     return type_id;
 }
 
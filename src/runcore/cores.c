@@ -102,7 +102,11 @@ first class data items.
 
 Notice that computed goto is a feature only available in some compilers
 such as GCC, and will not be available in every distribution of Parrot,
-depending what compilers were used to build it.
+depending what compilers were used to build it.  Configure probes for it
+(F<config/auto/cgoto.pm>); when it is available, opsc emits the precomputed
+variant described below as C<core_cg_core> in F<src/ops/core_ops.c>, and
+it can be selected with C<-R cgoto>.  Without it, C<-R cgoto> runs the
+fast core.
 
 As was mentioned earlier, not all compilers support computed goto, which
 means that this core will not be built on platforms that don't support it.
@@ -188,6 +192,21 @@ The caveat of course is that the predereferenced computed goto core is only
 available with compilers that support computed goto, such as GCC. Parrot
 will not have access to this core if it is built with a different compiler.
 
+Parrot's C<cgoto> core keeps the threaded code in a table parallel to each
+bytecode segment, so the ops can still address their arguments through the
+original bytecode.  The table is filled lazily: each entry starts out as a
+decode label which looks up the op's label the first time it runs.  Ops
+from dynamic oplibs are dispatched through the segment's function table.
+
+=head2 Fused Ops
+
+Both the C<fast> and the C<cgoto> cores run I<fused ops> (superinstructions):
+opsc generates one op for each sequence listed in F<src/ops/ops.fuse>, and
+before a segment runs, the first op of every such sequence in it is replaced
+with the fused op.  The fused op executes the bodies of the whole sequence
+without dispatching in between.  The arguments and the following ops stay
+in place, so code that branches into the middle of a sequence still works.
+
 =head2 Tracing Core
 
 To come.
@@ -257,6 +276,25 @@ next opcode, or examine and manipulate data from the executing program.
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+static void cgoto_thread_segment(PARROT_INTERP,
+    ARGMOD(PackFile_ByteCode *cs))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*cs);
+
+PARROT_CAN_RETURN_NULL
+static void * prepare_fused_ops(PARROT_INTERP, Parrot_runcore_t *runcore)
+        __attribute__nonnull__(1);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static opcode_t * runops_cgoto_core(PARROT_INTERP,
+    ARGIN(Parrot_runcore_t *runcore),
+    ARGIN(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static opcode_t * runops_debugger_core(PARROT_INTERP,
@@ -304,6 +342,15 @@ static opcode_t * runops_trace_core(PARROT_INTERP, ARGIN(opcode_t *pc))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+#define ASSERT_ARGS_cgoto_thread_segment __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cs))
+#define ASSERT_ARGS_prepare_fused_ops __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_runops_cgoto_core __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(runcore) \
+    , PARROT_ASSERT_ARG(pc))
 #define ASSERT_ARGS_runops_debugger_core __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pc))
@@ -378,7 +425,37 @@ Parrot_runcore_fast_init(PARROT_INTERP)
     coredata->opinit           = PARROT_CORE_OPLIB_INIT;
     coredata->runops           = runops_fast_core;
     coredata->destroy          = NULL;
-    coredata->prepare_run      = NULL;
+    coredata->prepare_run      = prepare_fused_ops;
+    coredata->flags            = 0;
+
+    PARROT_RUNCORE_FUNC_TABLE_SET(coredata);
+
+    Parrot_runcore_register(interp, coredata);
+}
+
+
+/*
+
+=item C<void Parrot_runcore_cgoto_init(PARROT_INTERP)>
+
+Registers the computed goto runcore with Parrot.
+
+=cut
+
+*/
+
+void
+Parrot_runcore_cgoto_init(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_runcore_cgoto_init)
+
+    Parrot_runcore_t * const coredata = mem_gc_allocate_zeroed_typed(interp, Parrot_runcore_t);
+    coredata->name             = CONST_STRING(interp, "cgoto");
+    coredata->id               = PARROT_CGOTO_CORE;
+    coredata->opinit           = PARROT_CORE_OPLIB_INIT;
+    coredata->runops           = runops_cgoto_core;
+    coredata->destroy          = NULL;
+    coredata->prepare_run      = prepare_fused_ops;
     coredata->flags            = 0;
 
     PARROT_RUNCORE_FUNC_TABLE_SET(coredata);
@@ -475,6 +552,33 @@ Parrot_runcore_debugger_init(PARROT_INTERP)
 }
 
 
+/*
+
+=item C<static void * prepare_fused_ops(PARROT_INTERP, Parrot_runcore_t
+*runcore)>
+
+Prepares the code segment about to run for the C<fast> and C<cgoto> cores by
+rewriting its op sequences to the fused ops of F<src/ops/ops.fuse>, unless
+that happened already.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static void *
+prepare_fused_ops(PARROT_INTERP, SHIM(Parrot_runcore_t *runcore))
+{
+    ASSERT_ARGS(prepare_fused_ops)
+    PackFile_ByteCode * const cs = interp->code;
+
+    if (cs->fused_size != cs->base.size)
+        Parrot_pf_fuse_ops(interp, cs);
+
+    return NULL;
+}
+
+
 /*
 
 =item C<static opcode_t * runops_fast_core(PARROT_INTERP, Parrot_runcore_t
@@ -503,6 +607,94 @@ runops_fast_core(PARROT_INTERP, SHIM(Parrot_runcore_t *runcore), ARGIN(opcode_t
 }
 
 
+/*
+
+=item C<static opcode_t * runops_cgoto_core(PARROT_INTERP, Parrot_runcore_t
+*runcore, opcode_t *pc)>
+
+Runs the Parrot operations starting at C<pc> until there are no more
+operations, using the direct-threaded computed goto core generated into
+F<src/ops/core_ops.c>.  Ops jump straight to the next op's label instead
+of returning to this loop, and the current pc is not stored in the context
+for every op.  The loop is only re-entered when code switches segments,
+or to dispatch through the op function table while event checking is
+enabled.
+
+Without compiler support for computed goto this is the fast core.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static opcode_t *
+runops_cgoto_core(PARROT_INTERP, ARGIN(Parrot_runcore_t *runcore), ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(runops_cgoto_core)
+
+#ifdef PARROT_HAS_COMPUTED_GOTO
+    UNUSED(runcore);
+
+    while (pc) {
+        PackFile_ByteCode * const cs = interp->code;
+
+        if (cs->save_func_table) {
+            Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), pc);
+            DO_OP(pc, interp);
+        }
+        else {
+            if (cs->threaded_size != cs->base.size)
+                cgoto_thread_segment(interp, cs);
+
+            pc = core_cg_core(pc, interp);
+        }
+    }
+
+    return pc;
+#else
+    return runops_fast_core(interp, runcore, pc);
+#endif
+}
+
+
+/*
+
+=item C<static void cgoto_thread_segment(PARROT_INTERP, PackFile_ByteCode *cs)>
+
+(Re)builds the threaded code of C<cs> for the computed goto core.  Every
+entry starts out pointing at the core's decode label, which replaces it
+with the label of the op on first execution.
+
+=cut
+
+*/
+
+static void
+cgoto_thread_segment(PARROT_INTERP, ARGMOD(PackFile_ByteCode *cs))
+{
+    ASSERT_ARGS(cgoto_thread_segment)
+
+#ifdef PARROT_HAS_COMPUTED_GOTO
+    void * const * const labels = (void * const *)core_cg_core(NULL, interp);
+    void         * const decode = labels[PARROT_GET_CORE_OPLIB(interp)->op_count];
+    size_t               i;
+
+    if (cs->threaded_code)
+        mem_gc_free(interp, cs->threaded_code);
+
+    cs->threaded_code = mem_gc_allocate_n_typed(interp, cs->base.size, void *);
+    cs->threaded_size = cs->base.size;
+
+    for (i = 0; i < cs->base.size; ++i)
+        cs->threaded_code[i] = decode;
+#else
+    UNUSED(interp);
+    UNUSED(cs);
+#endif
+}
+
+
 #ifdef code_start
 #  undef code_start
 #endif
@@ -68,6 +68,7 @@ Parrot_runcore_init(PARROT_INTERP)
 
     Parrot_runcore_slow_init(interp);
     Parrot_runcore_fast_init(interp);
+    Parrot_runcore_cgoto_init(interp);
 
     Parrot_runcore_subprof_init(interp);
     Parrot_runcore_exec_init(interp);
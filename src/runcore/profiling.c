@@ -21,6 +21,7 @@ Functions controlling Parrot's profiling runcore.
 #include "parrot/extend.h"
 #include "parrot/runcore_profiling.h"
 #include "parrot/oplib/core_ops.h"
+#include "parrot/oplib/ops.h"
 
 #include "profiling.str"
 
@@ -30,6 +31,9 @@ Functions controlling Parrot's profiling runcore.
 
 #define PPROF_VERSION 2
 
+/* how many op sequences to report as fusion candidates */
+#define PPROF_FUSE_CANDIDATES 32
+
 #define code_start interp->code->base.data
 #define code_end (interp->code->base.data + interp->code->base.size)
 
@@ -123,6 +127,13 @@ static void record_op(PARROT_INTERP,
         __attribute__nonnull__(3)
         __attribute__nonnull__(4);
 
+static void record_op_sequence(PARROT_INTERP,
+    ARGIN(Parrot_profiling_runcore_t *runcore),
+    ARGIN(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 static void record_values_ascii_pprof(PARROT_INTERP,
     ARGIN(Parrot_profiling_runcore_t * runcore),
     ARGIN(PPROF_DATA *pprof_data),
@@ -151,6 +162,11 @@ static void store_postop_time(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void write_fuse_candidates(PARROT_INTERP,
+    ARGIN(Parrot_profiling_runcore_t *runcore))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 #define ASSERT_ARGS_destroy_basic_output __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(runcore))
 #define ASSERT_ARGS_destroy_profiling_core __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -196,6 +212,10 @@ static void store_postop_time(PARROT_INTERP,
     , PARROT_ASSERT_ARG(runcore) \
     , PARROT_ASSERT_ARG(pprof_data) \
     , PARROT_ASSERT_ARG(op_name))
+#define ASSERT_ARGS_record_op_sequence __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(runcore) \
+    , PARROT_ASSERT_ARG(pc))
 #define ASSERT_ARGS_record_values_ascii_pprof __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(runcore) \
     , PARROT_ASSERT_ARG(pprof_data))
@@ -210,6 +230,9 @@ static void store_postop_time(PARROT_INTERP,
 #define ASSERT_ARGS_store_postop_time __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(runcore))
+#define ASSERT_ARGS_write_fuse_candidates __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(runcore))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -264,6 +287,7 @@ init_profiling_core(PARROT_INTERP, ARGIN(Parrot_profiling_runcore_t *runcore), A
     ASSERT_ARGS(init_profiling_core)
 
     STRING *output_str;
+    STRING *fuse_env;
 
     /* initialize the runcore struct */
     runcore->runops  = (Parrot_runcore_runops_fn_t)  runops_profiling_core;
@@ -279,6 +303,17 @@ init_profiling_core(PARROT_INTERP, ARGIN(Parrot_profiling_runcore_t *runcore), A
     runcore->line_cache      = Parrot_hash_new_pointer_hash(interp);
     runcore->time            = mem_gc_allocate_n_typed(interp, runcore->time_size,
                                                     UHUGEINTVAL);
+    runcore->fuse_seqs       = NULL;
+    runcore->fuse_next       = NULL;
+
+    /* count op sequences, if somebody wants candidates for src/ops/ops.fuse */
+    fuse_env               = CONST_STRING(interp, "PARROT_PROFILING_FUSE_CANDIDATES");
+    runcore->fuse_filename = Parrot_getenv(interp, fuse_env);
+
+    if (!STRING_IS_NULL(runcore->fuse_filename)) {
+        Parrot_str_gc_register(interp, runcore->fuse_filename);
+        runcore->fuse_seqs = Parrot_hash_new_cstring_hash(interp);
+    }
 
     /* figure out what format the output should be in */
     output_str = Parrot_getenv(interp, CONST_STRING(interp, "PARROT_PROFILING_OUTPUT"));
@@ -386,6 +421,9 @@ ARGIN(opcode_t *pc))
         preop_opname          = interp->code->op_info_table[*pc]->name;
         preop_line_num        = get_line_num_from_cache(interp, runcore, preop_ctx_pmc);
 
+        if (runcore->fuse_seqs)
+            record_op_sequence(interp, runcore, pc);
+
         Profiling_exit_check_CLEAR(runcore);
 
         runcore->op_start  = Parrot_hires_get_time();
@@ -471,6 +509,127 @@ ARGIN(PPROF_DATA *pprof_data), ARGIN(PMC* ctx_pmc), ARGIN(opcode_t *pc))
 
 /*
 
+=item C<static void record_op_sequence(PARROT_INTERP, Parrot_profiling_runcore_t
+*runcore, opcode_t *pc)>
+
+Counts the sequences of core ops that end with the op at C<pc>, if the ops
+before it ran straight into it.  These are the candidates for fused ops (see
+F<src/ops/ops.fuse>).  Ops taking a variable number of arguments can only end
+a sequence, as they are C<:flow> ops.
+
+=cut
+
+*/
+
+static void
+record_op_sequence(PARROT_INTERP, ARGIN(Parrot_profiling_runcore_t *runcore),
+    ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(record_op_sequence)
+
+    op_info_t * const info    = interp->code->op_info_table[*pc];
+    size_t            op_size = info->op_count;
+    char              seq[256];
+    INTVAL            i;
+
+    if (info->lib != PARROT_GET_CORE_OPLIB(interp)) {
+        runcore->fuse_next = NULL;
+        return;
+    }
+
+    if (pc != runcore->fuse_next)
+        for (i = 0; i < PARROT_MAX_FUSED_OPS - 1; ++i)
+            runcore->fuse_prev[i] = NULL;
+
+    /* fuse_prev[0] ran right before this op, fuse_prev[1] before that... */
+    for (i = 0; i < PARROT_MAX_FUSED_OPS - 1 && runcore->fuse_prev[i]; ++i) {
+        HashBucket *bucket;
+        size_t      len = 0;
+        INTVAL      j;
+
+        for (j = i; j >= 0; --j)
+            len += snprintf(seq + len, sizeof (seq) - len, "%s ",
+                    runcore->fuse_prev[j]->full_name);
+        snprintf(seq + len, sizeof (seq) - len, "%s", info->full_name);
+
+        bucket = Parrot_hash_get_bucket(interp, runcore->fuse_seqs, seq);
+
+        if (bucket)
+            bucket->value = (void *)((INTVAL)bucket->value + 1);
+        else
+            Parrot_hash_put(interp, runcore->fuse_seqs, mem_sys_strdup(seq), (void *)1);
+    }
+
+    ADD_OP_VAR_PART(interp, interp->code, pc, op_size);
+
+    for (i = PARROT_MAX_FUSED_OPS - 2; i > 0; --i)
+        runcore->fuse_prev[i] = runcore->fuse_prev[i - 1];
+
+    runcore->fuse_prev[0] = op_size == (size_t)info->op_count ? info : NULL;
+    runcore->fuse_next    = pc + op_size;
+}
+
+/*
+
+=item C<static void write_fuse_candidates(PARROT_INTERP,
+Parrot_profiling_runcore_t *runcore)>
+
+Writes the most frequent op sequences counted by C<record_op_sequence> to the
+file named by C<PARROT_PROFILING_FUSE_CANDIDATES>, in the format of
+F<src/ops/ops.fuse>, and frees their names.
+
+=cut
+
+*/
+
+static void
+write_fuse_candidates(PARROT_INTERP, ARGIN(Parrot_profiling_runcore_t *runcore))
+{
+    ASSERT_ARGS(write_fuse_candidates)
+
+    const UINTVAL      n_seqs        = Parrot_hash_size(interp, runcore->fuse_seqs);
+    HashBucket       **seqs          = mem_gc_allocate_n_zeroed_typed(interp,
+                                            n_seqs + 1, HashBucket *);
+    char       * const filename_cstr = Parrot_str_to_cstring(interp, runcore->fuse_filename);
+    FILE       * const fd            = fopen(filename_cstr, "w");
+    UINTVAL            i             = 0;
+
+    parrot_hash_iterate(runcore->fuse_seqs,
+        seqs[i++] = _bucket;);
+
+    if (fd) {
+        fprintf(fd, "# fusion candidates, most frequent first (see src/ops/ops.fuse)\n");
+
+        /* only the top few are interesting, so select them one by one */
+        for (i = 0; i < n_seqs && i < PPROF_FUSE_CANDIDATES; ++i) {
+            HashBucket *max = seqs[i];
+            UINTVAL     j;
+
+            for (j = i + 1; j < n_seqs; ++j) {
+                if ((INTVAL)seqs[j]->value > (INTVAL)max->value) {
+                    seqs[i] = seqs[j];
+                    seqs[j] = max;
+                    max     = seqs[i];
+                }
+            }
+
+            fprintf(fd, "%-48s # %ld\n", (const char *)max->key, (long)(INTVAL)max->value);
+        }
+
+        fclose(fd);
+    }
+    else
+        fprintf(stderr, "unable to open %s for writing\n", filename_cstr);
+
+    for (i = 0; i < n_seqs; ++i)
+        mem_sys_free(seqs[i]->key);
+
+    Parrot_str_free_cstring(filename_cstr);
+    mem_gc_free(interp, seqs);
+}
+
+/*
+
 =item C<static INTVAL get_line_num_from_cache(PARROT_INTERP,
 Parrot_profiling_runcore_t *runcore, PMC *ctx_pmc)>
 
@@ -795,6 +954,11 @@ destroy_profiling_core(PARROT_INTERP, ARGIN(Parrot_profiling_runcore_t *runcore)
     Parrot_str_free_cstring(filename_cstr);
     Parrot_hash_destroy(interp, runcore->line_cache);
 
+    if (runcore->fuse_seqs) {
+        write_fuse_candidates(interp, runcore);
+        Parrot_hash_destroy(interp, runcore->fuse_seqs);
+    }
+
     RUNCORE_destroy(interp, runcore);
     mem_gc_free(interp, runcore->time);
 }
@@ -21,6 +21,7 @@ exceptions, async I/O, and concurrent tasks (threads).
 #include "parrot/runcore_api.h"
 #include "parrot/alarm.h"
 #include "parrot/scheduler.h"
+#include "parrot/thread.h"
 
 #include "pmc/pmc_scheduler.h"
 #include "pmc/pmc_task.h"
@@ -33,19 +34,83 @@ exceptions, async I/O, and concurrent tasks (threads).
 
 /* HEADERIZER HFILE: include/parrot/scheduler.h */
 
+/* How many ready handles Parrot_cx_check_io takes at once */
+#define IO_READY_BATCH 32
+
+/* A method called again after waiting for I/O */
+typedef struct io_retry {
+    PMC      *method;    /* The method */
+    opcode_t *next;      /* Where its caller continues */
+    opcode_t *dest;      /* Where to continue after the call */
+    PMC      *exception; /* What the method threw, if anything */
+} io_retry;
+
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+static void alarm_heap_down(
+    ARGMOD(Parrot_Scheduler_attributes *sched),
+    INTVAL index)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*sched);
+
+static void alarm_heap_remove(
+    ARGMOD(Parrot_Scheduler_attributes *sched),
+    INTVAL index)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*sched);
+
+static void alarm_heap_up(
+    ARGMOD(Parrot_Scheduler_attributes *sched),
+    INTVAL index)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*sched);
+
+static void catch_io_exception(PARROT_INTERP,
+    ARGIN_NULLOK(PMC *exception),
+    ARGIN_NULLOK(void *retry))
+        __attribute__nonnull__(1);
+
+static INTVAL io_waiters_which(PARROT_INTERP, ARGIN_NULLOK(PMC *waiters))
+        __attribute__nonnull__(1);
+
 static void Parrot_cx_disable_preemption(PARROT_INTERP)
         __attribute__nonnull__(1);
 
 static void Parrot_cx_enable_preemption(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+static void retry_io_method(PARROT_INTERP, ARGIN_NULLOK(void *retry))
+        __attribute__nonnull__(1);
+
+static void wake_io_task(PARROT_INTERP,
+    ARGMOD(Parrot_Scheduler_attributes *sched),
+    ARGIN(PMC *task))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*sched);
+
+#define ASSERT_ARGS_alarm_heap_down __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(sched))
+#define ASSERT_ARGS_alarm_heap_remove __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(sched))
+#define ASSERT_ARGS_alarm_heap_up __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(sched))
+#define ASSERT_ARGS_catch_io_exception __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_io_waiters_which __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_cx_disable_preemption __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_cx_enable_preemption __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_retry_io_method __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_wake_io_task __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sched) \
+    , PARROT_ASSERT_ARG(task))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -69,13 +134,15 @@ void
 Parrot_cx_init_scheduler(PARROT_INTERP)
 {
     ASSERT_ARGS(Parrot_cx_init_scheduler)
-    interp->quantum_done = Parrot_floatval_time() + PARROT_TASK_SWITCH_QUANTUM;
+    interp->quantum_done = Parrot_floatval_monotonic_time() + PARROT_TASK_SWITCH_QUANTUM;
 
     if (!interp->parent_interpreter) {
         interp->scheduler = Parrot_pmc_new(interp, enum_class_Scheduler);
 
-        /* Make sure the program can handle alarm signals */
-        Parrot_alarm_init();
+        /* Make sure the program can handle alarm signals. They are for
+         * the first interpreter, threads block them */
+        if (!Interp_flags_TEST(interp, PARROT_IS_THREAD))
+            Parrot_alarm_init();
     }
 }
 
@@ -134,7 +201,7 @@ Parrot_cx_outer_runloop(PARROT_INTERP)
     ASSERT_ARGS(Parrot_cx_outer_runloop)
     PMC * const scheduler = interp->scheduler;
     Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
-    INTVAL alarm_count;
+    INTVAL alarm_count, io_wait_count, worker_count;
 
     do {
         while (VTABLE_get_integer(interp, sched->task_queue) > 0) {
@@ -148,10 +215,56 @@ Parrot_cx_outer_runloop(PARROT_INTERP)
 
             /* add expired alarms to the task queue */
             Parrot_cx_check_alarms(interp, interp->scheduler);
+
+            /* and tasks whose handles are ready */
+            if (sched->io_wait_count > 0)
+                Parrot_cx_check_io(interp, interp->scheduler, 0.0);
+
+            /* and tasks waiting for tasks which ran on workers */
+            if (sched->workers)
+                Parrot_cx_check_workers(interp, interp->scheduler, 0.0);
         }
 
-        alarm_count = VTABLE_get_integer(interp, sched->alarms);
-        if (alarm_count > 0) {
+        alarm_count   = sched->alarm_count;
+        io_wait_count = sched->io_wait_count;
+        worker_count  = sched->workers ? Parrot_thread_pool_pending(sched->workers) : 0;
+
+        if (io_wait_count > 0) {
+            /* Wait for a handle to become ready, or the next alarm */
+            FLOATVAL timeout = -1.0;
+
+            if (alarm_count > 0) {
+                timeout = PARROT_ALARM(sched->alarms[0])->alarm_due
+                        - Parrot_floatval_monotonic_time();
+                if (timeout < 0.0)
+                    timeout = 0.0;
+            }
+
+            /* The signal of a worker may come before the wait starts */
+            if (worker_count > 0
+            && (timeout < 0.0 || timeout > PARROT_TASK_SWITCH_QUANTUM))
+                timeout = PARROT_TASK_SWITCH_QUANTUM;
+
+            Parrot_cx_check_io(interp, interp->scheduler, timeout);
+            Parrot_cx_check_alarms(interp, interp->scheduler);
+            if (worker_count > 0)
+                Parrot_cx_check_workers(interp, interp->scheduler, 0.0);
+        }
+        else if (worker_count > 0) {
+            /* Wait for a worker to finish a task, or the next alarm */
+            FLOATVAL timeout = -1.0;
+
+            if (alarm_count > 0) {
+                timeout = PARROT_ALARM(sched->alarms[0])->alarm_due
+                        - Parrot_floatval_monotonic_time();
+                if (timeout < 0.0)
+                    timeout = 0.0;
+            }
+
+            Parrot_cx_check_workers(interp, interp->scheduler, timeout);
+            Parrot_cx_check_alarms(interp, interp->scheduler);
+        }
+        else if (alarm_count > 0) {
 #ifdef _WIN32
             /* TODO: Implement on Windows */
 #else
@@ -160,7 +273,7 @@ Parrot_cx_outer_runloop(PARROT_INTERP)
 #endif
             Parrot_cx_check_alarms(interp, interp->scheduler);
         }
-    } while (alarm_count);
+    } while (alarm_count || io_wait_count || worker_count);
 }
 
 /*
@@ -175,7 +288,7 @@ void
 Parrot_cx_set_scheduler_alarm(PARROT_INTERP)
 {
     ASSERT_ARGS(Parrot_cx_set_scheduler_alarm)
-    const FLOATVAL time_now = Parrot_floatval_time();
+    const FLOATVAL time_now = Parrot_floatval_monotonic_time();
 
     interp->quantum_done = time_now + PARROT_TASK_SWITCH_QUANTUM;
 
@@ -209,7 +322,10 @@ Parrot_cx_next_task(PARROT_INTERP, ARGIN(PMC *scheduler))
 #ifdef _WIN32
     /* TODO: Implement on Windows */
 #else
-    if (VTABLE_get_integer(interp, sched->task_queue) > 0)
+    /* Tasks waiting for I/O need the outer runloop to check their handles
+     * now and then, too */
+    if (VTABLE_get_integer(interp, sched->task_queue) > 0
+    ||  sched->io_wait_count > 0)
         Parrot_cx_enable_preemption(interp);
     else
         Parrot_cx_disable_preemption(interp);
@@ -265,6 +381,7 @@ Parrot_cx_run_scheduler(PARROT_INTERP, ARGIN(PMC *scheduler), ARGIN(opcode_t *ne
     const Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(interp->scheduler);
 
     Parrot_cx_check_alarms(interp, scheduler);
+    Parrot_cx_check_workers(interp, scheduler, 0.0);
     Parrot_cx_check_quantum(interp, scheduler);
 
     if (SCHEDULER_resched_requested_TEST(scheduler)) {
@@ -304,7 +421,7 @@ Parrot_cx_check_quantum(PARROT_INTERP, ARGIN(PMC *scheduler))
 {
     ASSERT_ARGS(Parrot_cx_check_quantum)
     Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
-    const FLOATVAL time_now = Parrot_floatval_time();
+    const FLOATVAL time_now = Parrot_floatval_monotonic_time();
 
     if (sched->enable_preemption && time_now >= interp->quantum_done)
         SCHEDULER_resched_requested_SET(scheduler);
@@ -387,7 +504,8 @@ Parrot_cx_runloop_wake(PARROT_INTERP, ARGIN(PMC *scheduler))
 
 =item C<void Parrot_cx_runloop_end(PARROT_INTERP)>
 
-Schedule an event to terminate the scheduler runloop.
+Schedule an event to terminate the scheduler runloop. Stops the worker
+threads.
 
 =cut
 
@@ -397,6 +515,13 @@ void
 Parrot_cx_runloop_end(PARROT_INTERP)
 {
     ASSERT_ARGS(Parrot_cx_runloop_end)
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(interp->scheduler);
+
+    if (sched->workers) {
+        Parrot_thread_pool_destroy(interp, sched->workers);
+        sched->workers = NULL;
+    }
+
     SCHEDULER_terminate_requested_SET(interp->scheduler);
     /* Chandon TODO: Why is this here? */
     /* Parrot_cx_handle_tasks(interp, interp->scheduler); */
@@ -512,6 +637,190 @@ Parrot_cx_current_task(PARROT_INTERP)
 
 /*
 
+=item C<INTVAL Parrot_cx_start_workers(PARROT_INTERP, INTVAL count)>
+
+Starts C<count> worker threads, or one for each processor if C<count> is not
+positive, unless the workers are running already. Returns the number of
+workers.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+INTVAL
+Parrot_cx_start_workers(PARROT_INTERP, INTVAL count)
+{
+    ASSERT_ARGS(Parrot_cx_start_workers)
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(interp->scheduler);
+
+    if (Interp_flags_TEST(interp, PARROT_IS_THREAD))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_UNIMPLEMENTED,
+            "Workers can't start workers");
+
+    if (!sched->workers) {
+        sched->workers = Parrot_thread_pool_new(interp,
+                count > 0 ? (size_t)count : Parrot_thread_pool_default_size());
+
+        if (!sched->workers)
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_UNIMPLEMENTED,
+                "Worker threads are not available on this platform");
+    }
+
+    return (INTVAL)Parrot_thread_pool_size(sched->workers);
+}
+
+/*
+
+=item C<void Parrot_cx_schedule_worker(PARROT_INTERP, PMC *task)>
+
+Runs C<task> on a worker thread, starting the workers first if needed. The
+code of the task gets a copy of its data, and the task gets a copy of what
+the code returned as its C<result> once the worker is done. Until then the
+task is active, and tasks can wait for it.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_cx_schedule_worker(PARROT_INTERP, ARGIN(PMC *task))
+{
+    ASSERT_ARGS(Parrot_cx_schedule_worker)
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(interp->scheduler);
+    Parrot_Task_attributes *tdata;
+    PMC                    *task_id;
+
+    if (!VTABLE_isa(interp, task, CONST_STRING(interp, "Task")))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Can only schedule Tasks on workers.\n");
+
+    tdata = PARROT_TASK(task);
+
+    if (PMC_IS_NULL(tdata->code)
+    || !VTABLE_isa(interp, tdata->code, CONST_STRING(interp, "Sub")))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "The code of a Task for a worker must be a Sub.\n");
+
+    if (TASK_active_TEST(task))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Task is running already.\n");
+
+    if (!sched->workers)
+        Parrot_cx_start_workers(interp, 0);
+
+    Parrot_thread_pool_submit(interp, sched->workers, tdata->id,
+            tdata->code, tdata->data);
+
+    tdata->result = PMCNULL;
+
+    task_id = Parrot_pmc_new(interp, enum_class_Integer);
+    VTABLE_set_integer_native(interp, task_id, tdata->id);
+    VTABLE_set_pmc_keyed(interp, sched->all_tasks, task_id, task);
+
+    TASK_active_SET(task);
+    TASK_on_worker_SET(task);
+}
+
+/*
+
+=item C<void Parrot_cx_finish_task(PARROT_INTERP, PMC *task)>
+
+Takes the finished C<task> off the set of active tasks and schedules the
+tasks waiting for it.
+
+=cut
+
+*/
+
+void
+Parrot_cx_finish_task(PARROT_INTERP, ARGIN(PMC *task))
+{
+    ASSERT_ARGS(Parrot_cx_finish_task)
+    Parrot_Task_attributes * const tdata = PARROT_TASK(task);
+    PMC * const task_id = Parrot_pmc_new(interp, enum_class_Integer);
+    INTVAL      i, n = 0;
+
+    VTABLE_set_integer_native(interp, task_id, tdata->id);
+    TASK_active_CLEAR(task);
+    VTABLE_delete_keyed(interp, PARROT_SCHEDULER(interp->scheduler)->all_tasks, task_id);
+
+    if (!PMC_IS_NULL(tdata->waiters))
+        n = VTABLE_get_integer(interp, tdata->waiters);
+
+    for (i = 0; i < n; ++i) {
+        PMC * const wtask = VTABLE_get_pmc_keyed_int(interp, tdata->waiters, i);
+        Parrot_cx_schedule_task(interp, wtask);
+    }
+}
+
+/*
+
+=item C<void Parrot_cx_check_workers(PARROT_INTERP, PMC *scheduler, FLOATVAL
+timeout)>
+
+Hands the results of the tasks the workers finished to the tasks and
+finishes them. Waits up to C<timeout> seconds, or for ever if it is
+negative, for the first one.
+
+=cut
+
+*/
+
+void
+Parrot_cx_check_workers(PARROT_INTERP, ARGIN(PMC *scheduler), FLOATVAL timeout)
+{
+    ASSERT_ARGS(Parrot_cx_check_workers)
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
+    PMC    *result;
+    INTVAL  id;
+
+    if (!sched->workers)
+        return;
+
+    while ((result = Parrot_thread_pool_collect(interp, sched->workers, timeout, &id))) {
+        PMC * const task_id = Parrot_pmc_new(interp, enum_class_Integer);
+        PMC        *task;
+
+        timeout = 0.0;
+        VTABLE_set_integer_native(interp, task_id, id);
+        task = VTABLE_get_pmc_keyed(interp, sched->all_tasks, task_id);
+
+        if (PMC_IS_NULL(task))
+            continue;
+
+        PARROT_TASK(task)->result = result;
+        PARROT_GC_WRITE_BARRIER(interp, task);
+        TASK_on_worker_CLEAR(task);
+        Parrot_cx_finish_task(interp, task);
+    }
+}
+
+/*
+
+=item C<void Parrot_cx_wait_for_worker(PARROT_INTERP, PMC *task)>
+
+Waits until the worker running C<task> is done with it.
+
+=cut
+
+*/
+
+void
+Parrot_cx_wait_for_worker(PARROT_INTERP, ARGIN(PMC *task))
+{
+    ASSERT_ARGS(Parrot_cx_wait_for_worker)
+    PMC * const scheduler = interp->scheduler;
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
+
+    while (TASK_on_worker_TEST(task)
+    &&     sched->workers && Parrot_thread_pool_pending(sched->workers) > 0)
+        Parrot_cx_check_workers(interp, scheduler, -1.0);
+}
+
+/*
+
 =back
 
 =head2 Scheduler Message Interface Functions
@@ -550,7 +859,10 @@ Parrot_cx_send_message(PARROT_INTERP, ARGIN(STRING *messagetype), ARGIN(SHIM(PMC
 
 =item C<void Parrot_cx_schedule_alarm(PARROT_INTERP, PMC *alarm)>
 
-Schedule an alarm.
+Schedule an alarm. The alarms are kept in a binary heap ordered by the time
+they are due on the monotonic clock, so this takes O(log n) time. An alarm
+which is scheduled already is moved to its new time. Worker threads can't
+schedule alarms, the alarm signal belongs to the main thread.
 
 =cut
 
@@ -560,20 +872,72 @@ void
 Parrot_cx_schedule_alarm(PARROT_INTERP, ARGIN(PMC *alarm))
 {
     ASSERT_ARGS(Parrot_cx_schedule_alarm)
-    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(interp->scheduler);
-    FLOATVAL alarm_time = VTABLE_get_number(interp, alarm);
+    PMC * const scheduler = interp->scheduler;
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
+    Parrot_Alarm_attributes     * const adata = PARROT_ALARM(alarm);
+
+    if (Interp_flags_TEST(interp, PARROT_IS_THREAD))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_UNIMPLEMENTED,
+            "Alarms can't be scheduled in a worker thread");
 
-    Parrot_alarm_set(alarm_time);
+    /* The alarm time is given on the system clock, convert it once */
+    adata->alarm_due = Parrot_floatval_monotonic_time()
+                     + (adata->alarm_time - Parrot_floatval_time());
 
-    /* Insert new alarm at correct (ordered by time) position in array. */
-    Parrot_pmc_list_insert_by_number(interp, sched->alarms, alarm);
+    if (adata->heap_index >= 0) {
+        alarm_heap_up(sched, adata->heap_index);
+        alarm_heap_down(sched, adata->heap_index);
+    }
+    else {
+        if (sched->alarm_count == sched->alarm_size) {
+            sched->alarm_size = sched->alarm_size ? sched->alarm_size * 2 : 16;
+            sched->alarms     = sched->alarms
+                ? mem_gc_realloc_n_typed(interp, sched->alarms, sched->alarm_size, PMC *)
+                : mem_gc_allocate_n_typed(interp, sched->alarm_size, PMC *);
+        }
+
+        sched->alarms[sched->alarm_count] = alarm;
+        adata->heap_index                 = sched->alarm_count++;
+        alarm_heap_up(sched, adata->heap_index);
+        PARROT_GC_WRITE_BARRIER(interp, scheduler);
+    }
+
+    /* Only the earliest alarm needs the signal */
+    if (adata->heap_index == 0)
+        Parrot_alarm_set(adata->alarm_due);
+}
+
+/*
+
+=item C<INTVAL Parrot_cx_cancel_alarm(PARROT_INTERP, PMC *alarm)>
+
+Remove an alarm from the scheduler, in O(log n) time. Returns 1 if the alarm
+was scheduled and had not fired yet, 0 otherwise.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+INTVAL
+Parrot_cx_cancel_alarm(PARROT_INTERP, ARGIN(PMC *alarm))
+{
+    ASSERT_ARGS(Parrot_cx_cancel_alarm)
+    Parrot_Alarm_attributes * const adata = PARROT_ALARM(alarm);
+
+    if (adata->heap_index < 0 || !interp->scheduler)
+        return 0;
+
+    alarm_heap_remove(PARROT_SCHEDULER(interp->scheduler), adata->heap_index);
+    return 1;
 }
 
 /*
 
 =item C<void Parrot_cx_check_alarms(PARROT_INTERP, PMC *scheduler)>
 
-Add the subs attached to any expired alarms to the task queue.
+Add the subs attached to any expired alarms to the task queue. They run in
+the order the alarms were due.
 
 =cut
 
@@ -585,25 +949,462 @@ Parrot_cx_check_alarms(PARROT_INTERP, ARGIN(PMC *scheduler))
 {
     ASSERT_ARGS(Parrot_cx_check_alarms)
     Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
-    INTVAL alarm_count = VTABLE_get_integer(interp, sched->alarms);
-    const FLOATVAL now_time = Parrot_floatval_time();
+    FLOATVAL now_time;
+    INTVAL   end, i;
 
-    while (alarm_count) {
-        PMC * const alarm = VTABLE_shift_pmc(interp, sched->alarms);
-        const FLOATVAL alarm_time = VTABLE_get_number(interp, alarm);
+    if (sched->alarm_count == 0)
+        return;
 
-        if (alarm_time < now_time) {
-            Parrot_Alarm_attributes *data = PARROT_ALARM(alarm);
-            Parrot_cx_schedule_immediate(interp, data->alarm_task);
-        }
-        else {
-            Parrot_alarm_set(alarm_time);
-            VTABLE_unshift_pmc(interp, sched->alarms, alarm);
+    now_time = Parrot_floatval_monotonic_time();
+    end      = sched->alarm_count;
+
+    /* Each expired alarm is parked in the slot the heap gives up, so they
+     * end up behind it, the earliest last */
+    while (sched->alarm_count > 0) {
+        PMC * const alarm = sched->alarms[0];
+
+        if (PARROT_ALARM(alarm)->alarm_due >= now_time) {
+            Parrot_alarm_set(PARROT_ALARM(alarm)->alarm_due);
             break;
         }
 
-        alarm_count--;
+        alarm_heap_remove(sched, 0);
+        sched->alarms[sched->alarm_count] = alarm;
+    }
+
+    /* Tasks scheduled for immediate execution run latest scheduled first.
+     * The parked alarms are not marked any more. */
+    Parrot_block_GC_mark(interp);
+    for (i = sched->alarm_count; i < end; ++i) {
+        PMC * const alarm = sched->alarms[i];
+
+        sched->alarms[i] = NULL;
+        Parrot_cx_schedule_immediate(interp, PARROT_ALARM(alarm)->alarm_task);
     }
+    Parrot_unblock_GC_mark(interp);
+}
+
+/*
+
+=item C<static void alarm_heap_up(Parrot_Scheduler_attributes *sched, INTVAL
+index)>
+
+=item C<static void alarm_heap_down(Parrot_Scheduler_attributes *sched, INTVAL
+index)>
+
+Move the alarm at C<index> in the alarm heap towards the root, or the
+leaves, until it is in order again.
+
+=cut
+
+*/
+
+static void
+alarm_heap_up(ARGMOD(Parrot_Scheduler_attributes *sched), INTVAL index)
+{
+    ASSERT_ARGS(alarm_heap_up)
+    PMC * const    alarm = sched->alarms[index];
+    const FLOATVAL due   = PARROT_ALARM(alarm)->alarm_due;
+
+    while (index > 0) {
+        const INTVAL parent       = (index - 1) / 2;
+        PMC * const  parent_alarm = sched->alarms[parent];
+
+        if (PARROT_ALARM(parent_alarm)->alarm_due <= due)
+            break;
+
+        sched->alarms[index]                  = parent_alarm;
+        PARROT_ALARM(parent_alarm)->heap_index = index;
+        index                                  = parent;
+    }
+
+    sched->alarms[index]           = alarm;
+    PARROT_ALARM(alarm)->heap_index = index;
+}
+
+static void
+alarm_heap_down(ARGMOD(Parrot_Scheduler_attributes *sched), INTVAL index)
+{
+    ASSERT_ARGS(alarm_heap_down)
+    PMC * const    alarm = sched->alarms[index];
+    const FLOATVAL due   = PARROT_ALARM(alarm)->alarm_due;
+    const INTVAL   count = sched->alarm_count;
+
+    for (;;) {
+        INTVAL child = 2 * index + 1;
+        PMC   *child_alarm;
+
+        if (child >= count)
+            break;
+
+        /* The earlier of the two children */
+        if (child + 1 < count
+        &&  PARROT_ALARM(sched->alarms[child + 1])->alarm_due
+         <  PARROT_ALARM(sched->alarms[child])->alarm_due)
+            ++child;
+
+        child_alarm = sched->alarms[child];
+        if (due <= PARROT_ALARM(child_alarm)->alarm_due)
+            break;
+
+        sched->alarms[index]                 = child_alarm;
+        PARROT_ALARM(child_alarm)->heap_index = index;
+        index                                 = child;
+    }
+
+    sched->alarms[index]           = alarm;
+    PARROT_ALARM(alarm)->heap_index = index;
+}
+
+/*
+
+=item C<static void alarm_heap_remove(Parrot_Scheduler_attributes *sched, INTVAL
+index)>
+
+Remove the alarm at C<index> from the alarm heap.
+
+=cut
+
+*/
+
+static void
+alarm_heap_remove(ARGMOD(Parrot_Scheduler_attributes *sched), INTVAL index)
+{
+    ASSERT_ARGS(alarm_heap_remove)
+    PMC * const last = sched->alarms[--sched->alarm_count];
+
+    PARROT_ALARM(sched->alarms[index])->heap_index = -1;
+
+    /* Fill the hole with the last alarm and put that in order */
+    if (index < sched->alarm_count) {
+        sched->alarms[index]           = last;
+        PARROT_ALARM(last)->heap_index = index;
+        alarm_heap_up(sched, index);
+        alarm_heap_down(sched, PARROT_ALARM(last)->heap_index);
+    }
+
+    sched->alarms[sched->alarm_count] = NULL;
+}
+
+/*
+
+=back
+
+=head2 I/O Waiting Functions
+
+Tasks waiting for a handle are suspended in the middle of a method call on
+that handle. The method is called again with the same arguments once the
+handle is ready.
+
+=over 4
+
+=item C<INTVAL Parrot_cx_wait_for_io(PARROT_INTERP, PMC *handle, PIOHANDLE
+os_handle, STRING *method, INTVAL which)>
+
+Called by the method C<method> of C<handle> before an operation on
+C<os_handle> which might block. If the scheduler has other work to do
+meanwhile, suspends the current task until C<os_handle> is ready for
+C<which>, a combination of C<PIO_POLL_READ>, C<PIO_POLL_WRITE> and
+C<PIO_POLL_ERROR>, and returns 1. The method must then return at once,
+without results. It will be called again with the same arguments once the
+handle is ready, and this function then returns 0. Several tasks may wait
+for the same handle.
+
+Also returns 0, so that the operation just blocks, if there is nothing else
+to do, if the handle can't be waited for, or if the task can't be suspended
+here: like pre-emption, this needs the outer runloop, and the method must
+have been called by an op.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+INTVAL
+Parrot_cx_wait_for_io(PARROT_INTERP, ARGIN(PMC *handle), PIOHANDLE os_handle,
+        ARGIN(STRING *method), INTVAL which)
+{
+    ASSERT_ARGS(Parrot_cx_wait_for_io)
+    PMC * const task = interp->cur_task;
+    PMC * const cont = interp->current_cont;
+    Parrot_Scheduler_attributes *sched;
+    Parrot_Task_attributes      *tdata;
+    PMC                         *waiters;
+    opcode_t                    *next;
+    const INTVAL                 slot = (INTVAL)os_handle;
+
+    if (PMC_IS_NULL(task) || !interp->scheduler)
+        return 0;
+
+    /* Called again after the wait. Unless another task waiting for the
+     * handle drained it meanwhile, go ahead */
+    if (TASK_io_ready_TEST(task)) {
+        TASK_io_ready_CLEAR(task);
+        if (Parrot_io_internal_poll(interp, os_handle, which, 0, 0) & which)
+            return 0;
+    }
+
+    sched = PARROT_SCHEDULER(interp->scheduler);
+
+    if (!sched->enable_scheduling || interp->current_runloop_level > 1)
+        return 0;
+
+    if (VTABLE_get_integer(interp, sched->task_queue) == 0
+    &&  sched->alarm_count == 0
+    &&  sched->io_wait_count == 0)
+        return 0;
+
+    /* The op which called the method continues at the address of its
+     * continuation */
+    if (PMC_IS_NULL(cont) || cont->vtable->base_type != enum_class_Continuation
+    ||  PARROT_CONTINUATION(cont)->to_ctx != CURRENT_CONTEXT(interp))
+        return 0;
+
+    next = (opcode_t *)VTABLE_get_pointer(interp, cont);
+    if (!next)
+        return 0;
+
+    if (slot < 0)
+        return 0;
+
+    if (!sched->poller) {
+        sched->poller = Parrot_io_internal_poller_new(interp);
+        if (!sched->poller)
+            return 0;
+    }
+
+    /* Other tasks may wait for the same handle, maybe for something else */
+    waiters = VTABLE_get_pmc_keyed_int(interp, sched->io_waiters, slot);
+    if (Parrot_io_internal_poller_add(interp, sched->poller, os_handle,
+            which | io_waiters_which(interp, waiters)) < 0)
+        return 0;
+
+    if (PMC_IS_NULL(waiters)) {
+        waiters = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+        VTABLE_set_pmc_keyed_int(interp, sched->io_waiters, slot, waiters);
+    }
+
+    tdata            = PARROT_TASK(task);
+    tdata->io_method = VTABLE_find_method(interp, handle, method);
+    tdata->io_args   = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+    tdata->io_which  = which;
+    PARROT_GC_WRITE_BARRIER(interp, task);
+
+    VTABLE_push_pmc(interp, waiters, task);
+    ++sched->io_wait_count;
+
+    (void)Parrot_cx_stop_task(interp, next);
+    TASK_io_wait_SET(task);
+
+    return 1;
+}
+
+/*
+
+=item C<void Parrot_cx_check_io(PARROT_INTERP, PMC *scheduler, FLOATVAL
+timeout)>
+
+Add the tasks waiting for handles which are ready to the task queue. Waits
+up to C<timeout> seconds, or for ever if it is negative, for one to become
+ready.
+
+Of several tasks waiting for the same handle only the first one goes on, so
+the others don't find it drained and block. The handle is waited for again
+for the rest.
+
+=cut
+
+*/
+
+void
+Parrot_cx_check_io(PARROT_INTERP, ARGIN(PMC *scheduler), FLOATVAL timeout)
+{
+    ASSERT_ARGS(Parrot_cx_check_io)
+    Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(scheduler);
+    PIOHANDLE    ready[IO_READY_BATCH];
+    const INTVAL count = Parrot_io_internal_poller_wait(interp, sched->poller,
+                            timeout, ready, IO_READY_BATCH);
+    INTVAL       i;
+
+    for (i = 0; i < count; ++i) {
+        const INTVAL slot    = (INTVAL)ready[i];
+        PMC * const  waiters = VTABLE_get_pmc_keyed_int(interp, sched->io_waiters, slot);
+
+        if (PMC_IS_NULL(waiters) || VTABLE_get_integer(interp, waiters) == 0)
+            continue;
+
+        wake_io_task(interp, sched, VTABLE_shift_pmc(interp, waiters));
+
+        if (VTABLE_get_integer(interp, waiters) == 0)
+            VTABLE_set_pmc_keyed_int(interp, sched->io_waiters, slot, PMCNULL);
+        else if (Parrot_io_internal_poller_add(interp, sched->poller, ready[i],
+                    io_waiters_which(interp, waiters)) < 0)
+            Parrot_cx_io_closed(interp, ready[i]);
+    }
+}
+
+/*
+
+=item C<void Parrot_cx_io_closed(PARROT_INTERP, PIOHANDLE os_handle)>
+
+Called before C<os_handle> is closed. Stops waiting for it, and adds all
+tasks waiting for it to the task queue. The methods they wait in are
+called again and find the handle closed.
+
+=cut
+
+*/
+
+void
+Parrot_cx_io_closed(PARROT_INTERP, PIOHANDLE os_handle)
+{
+    ASSERT_ARGS(Parrot_cx_io_closed)
+    const INTVAL                 slot = (INTVAL)os_handle;
+    Parrot_Scheduler_attributes *sched;
+    PMC                         *waiters;
+
+    if (!interp->scheduler || slot < 0)
+        return;
+
+    sched = PARROT_SCHEDULER(interp->scheduler);
+    if (sched->io_wait_count == 0)
+        return;
+
+    waiters = VTABLE_get_pmc_keyed_int(interp, sched->io_waiters, slot);
+    if (PMC_IS_NULL(waiters))
+        return;
+
+    VTABLE_set_pmc_keyed_int(interp, sched->io_waiters, slot, PMCNULL);
+    Parrot_io_internal_poller_remove(interp, sched->poller, os_handle);
+
+    while (VTABLE_get_integer(interp, waiters) > 0)
+        wake_io_task(interp, sched, VTABLE_shift_pmc(interp, waiters));
+}
+
+/*
+
+=item C<static INTVAL io_waiters_which(PARROT_INTERP, PMC *waiters)>
+
+Returns what the tasks in C<waiters>, which may be null, wait for.
+
+=item C<static void wake_io_task(PARROT_INTERP, Parrot_Scheduler_attributes
+*sched, PMC *task)>
+
+Adds C<task>, which no longer waits for its handle, to the task queue.
+
+=cut
+
+*/
+
+static INTVAL
+io_waiters_which(PARROT_INTERP, ARGIN_NULLOK(PMC *waiters))
+{
+    ASSERT_ARGS(io_waiters_which)
+    INTVAL which = 0;
+    INTVAL i, n;
+
+    if (PMC_IS_NULL(waiters))
+        return 0;
+
+    n = VTABLE_get_integer(interp, waiters);
+    for (i = 0; i < n; ++i)
+        which |= PARROT_TASK(VTABLE_get_pmc_keyed_int(interp, waiters, i))->io_which;
+
+    return which;
+}
+
+static void
+wake_io_task(PARROT_INTERP, ARGMOD(Parrot_Scheduler_attributes *sched), ARGIN(PMC *task))
+{
+    ASSERT_ARGS(wake_io_task)
+
+    --sched->io_wait_count;
+    TASK_io_ready_SET(task);
+    Parrot_cx_schedule_task(interp, task);
+}
+
+/*
+
+=item C<void Parrot_cx_resume_io_task(PARROT_INTERP, PMC *task)>
+
+Runs C<task> again after the handle it waited for became ready: back in the
+context of the op which called the method that waited, call that method once
+more and go on after the op.
+
+=cut
+
+*/
+
+void
+Parrot_cx_resume_io_task(PARROT_INTERP, ARGIN(PMC *task))
+{
+    ASSERT_ARGS(Parrot_cx_resume_io_task)
+    Parrot_Task_attributes * const tdata = PARROT_TASK(task);
+    PMC * const cont        = tdata->code;
+    PMC * const ctx         = PARROT_CONTINUATION(cont)->to_ctx;
+    PMC * const call_object = tdata->io_args;
+    io_retry    retry;
+
+    retry.method    = tdata->io_method;
+    retry.exception = PMCNULL;
+    tdata->io_method = PMCNULL;
+    tdata->io_args   = PMCNULL;
+
+    /* The call object of the context was replaced since the method was
+     * called, restore it */
+    retry.next = VTABLE_invoke(interp, cont, NULL);
+    Parrot_pcc_set_signature(interp, ctx, call_object);
+    interp->current_cont = cont;
+
+    Parrot_ext_try(interp, retry_io_method, catch_io_exception, &retry);
+    TASK_io_ready_CLEAR(task);
+
+    /* Deliver exceptions the method threw in its caller */
+    if (!PMC_IS_NULL(retry.exception))
+        retry.dest = Parrot_ex_throw_from_op(interp, retry.exception, retry.next);
+
+    if (retry.dest) {
+        Parrot_runcore_t * const old_core = interp->run_core;
+
+        runops(interp, retry.dest - interp->code->base.data);
+        Interp_core_SET(interp, old_core);
+    }
+}
+
+/*
+
+=item C<static void retry_io_method(PARROT_INTERP, void *retry)>
+
+Calls the method which waited for I/O again, for C<Parrot_cx_resume_io_task>.
+Leaves the address to continue at in C<retry>.
+
+=item C<static void catch_io_exception(PARROT_INTERP, PMC *exception, void
+*retry)>
+
+Remembers the C<exception> thrown by the method in C<retry>.
+
+=cut
+
+*/
+
+static void
+retry_io_method(PARROT_INTERP, ARGIN_NULLOK(void *retry))
+{
+    ASSERT_ARGS(retry_io_method)
+    io_retry * const r = (io_retry *)retry;
+
+    r->dest = (opcode_t *)VTABLE_invoke(interp, r->method, r->next);
+}
+
+static void
+catch_io_exception(PARROT_INTERP, ARGIN_NULLOK(PMC *exception), ARGIN_NULLOK(void *retry))
+{
+    ASSERT_ARGS(catch_io_exception)
+    io_retry * const r = (io_retry *)retry;
+
+    UNUSED(interp);
+    r->exception = exception;
+    r->dest      = NULL;
 }
 
 /*
@@ -621,7 +1422,7 @@ opcode_t* to allow for changing the code flow.
 opcode_t *next)>
 
 Add a sleep timer to the scheduler. This function is called by the C<sleep>
-opcode.
+opcode. A worker thread has no tasks to switch to, it just sleeps.
 
 =cut
 
@@ -636,9 +1437,17 @@ Parrot_cx_schedule_sleep(PARROT_INTERP, FLOATVAL time, ARGIN_NULLOK(opcode_t *ne
     ASSERT_ARGS(Parrot_cx_schedule_sleep)
     const FLOATVAL now_time  = Parrot_floatval_time();
     const FLOATVAL done_time = now_time + time;
-    PMC * const alarm = Parrot_pmc_new(interp, enum_class_Alarm);
-    Parrot_Alarm_attributes * const adata = PARROT_ALARM(alarm);
-    PMC * const task = Parrot_cx_stop_task(interp, next);
+    PMC *alarm, *task;
+    Parrot_Alarm_attributes *adata;
+
+    if (Interp_flags_TEST(interp, PARROT_IS_THREAD)) {
+        Parrot_floatval_sleep(time);
+        return next;
+    }
+
+    alarm = Parrot_pmc_new(interp, enum_class_Alarm);
+    adata = PARROT_ALARM(alarm);
+    task  = Parrot_cx_stop_task(interp, next);
 
     adata->alarm_time = done_time;
     adata->alarm_task = task;
@@ -660,7 +1469,8 @@ Functions that are used by the scheduler itself.
 
 =item C<static void Parrot_cx_enable_preemption(PARROT_INTERP)>
 
-Enable preemption. Used when more than one task is runnable.
+Enable preemption. Used when more than one task is runnable. Worker threads
+run one task at a time and don't preempt it.
 
 =cut
 
@@ -674,6 +1484,10 @@ Parrot_cx_enable_preemption(PARROT_INTERP)
     /* TODO: Implement on Windows */
 #else
     Parrot_Scheduler_attributes * const sched = PARROT_SCHEDULER(interp->scheduler);
+
+    if (Interp_flags_TEST(interp, PARROT_IS_THREAD))
+        return;
+
     sched->enable_preemption = 1;
     Parrot_cx_set_scheduler_alarm(interp);
 #endif
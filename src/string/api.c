@@ -113,7 +113,8 @@ Creation, enlargement, etc.
 
 =item C<void Parrot_str_init(PARROT_INTERP)>
 
-Initializes the Parrot string subsystem.
+Initializes the Parrot string subsystem. The encodings and C<STRINGNULL> are
+set up once for the whole process, by the first interpreter.
 
 =cut
 
@@ -152,12 +153,17 @@ Parrot_str_init(PARROT_INTERP)
                                         Hash_key_type_cstring,
                                         n_parrot_cstrings);
     interp->const_cstring_hash  = const_cstring_hash;
-    Parrot_encodings_init(interp);
 
-    /* initialize STRINGNULL, but not in the constant table */
-    STRINGNULL = Parrot_str_new_init(interp, NULL, 0,
-                       Parrot_null_encoding_ptr,
-                       PObj_constant_FLAG);
+    /* Threads use the encodings and STRINGNULL of the process; their
+     * constant strings belong to their own heaps */
+    if (!Interp_flags_TEST(interp, PARROT_IS_THREAD)) {
+        Parrot_encodings_init(interp);
+
+        /* initialize STRINGNULL, but not in the constant table */
+        STRINGNULL = Parrot_str_new_init(interp, NULL, 0,
+                           Parrot_null_encoding_ptr,
+                           PObj_constant_FLAG);
+    }
 
     interp->const_cstring_table =
         mem_gc_allocate_n_zeroed_typed(interp, n_parrot_cstrings, STRING *);
@@ -197,7 +203,8 @@ Parrot_str_finish(PARROT_INTERP)
     if (!interp->parent_interpreter) {
         mem_internal_free(interp->const_cstring_table);
         interp->const_cstring_table = NULL;
-        Parrot_deinit_encodings(interp);
+        if (!Interp_flags_TEST(interp, PARROT_IS_THREAD))
+            Parrot_deinit_encodings(interp);
         Parrot_hash_destroy(interp, interp->const_cstring_hash);
     }
 }
@@ -407,6 +414,9 @@ Parrot_str_copy(PARROT_INTERP, ARGIN_NULLOK(const STRING *s))
      */
     d->flags &= ~PObj_GC_all_generation_FLAGS;
 
+    /* The character index belongs to the original header */
+    d->index = NULL;
+
     /* Clear live flag. It might be set on constant strings */
     PObj_live_CLEAR(d);
 
@@ -2285,6 +2295,32 @@ Parrot_str_free_cstring(ARGFREE(char *p))
 }
 
 
+/*
+
+=item C<void Parrot_str_free_index(PARROT_INTERP, STRING *s)>
+
+Frees the character index of C<s>, if it has one.  The GC calls this when it
+sweeps a string header, and code which rewrites the contents of a string
+buffer in place has to call it too.
+
+=cut
+
+*/
+
+void
+Parrot_str_free_index(PARROT_INTERP, ARGMOD(STRING *s))
+{
+    ASSERT_ARGS(Parrot_str_free_index)
+    Str_index * const index = s->index;
+
+    if (index) {
+        mem_gc_free(interp, index->bytepos);
+        mem_gc_free(interp, index);
+        s->index = NULL;
+    }
+}
+
+
 /*
 
 =item C<void Parrot_str_pin(PARROT_INTERP, STRING *s)>
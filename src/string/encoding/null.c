@@ -120,7 +120,8 @@ null_compare(SHIM_INTERP, SHIM(const STRING *lhs), ARGIN(const STRING *rhs))
 
 =item C<static size_t null_hash(PARROT_INTERP, const STRING *s, size_t hashval)>
 
-Returns the hashed value of the string, given a seed in hashval.
+Returns the hashed value of the string, given a seed in hashval.  This is the
+hash of an empty string, which compares equal to the null string.
 
 =cut
 
@@ -132,7 +133,7 @@ null_hash(SHIM_INTERP, SHIM(const STRING *s), size_t hashval)
 {
     ASSERT_ARGS(null_hash)
 
-    return hashval;
+    return Parrot_hash_buffer(NULL, 0, hashval);
 }
 
 
@@ -333,6 +333,7 @@ encoding_rindex(PARROT_INTERP, ARGIN(const STRING *src),
 =item C<size_t encoding_hash(PARROT_INTERP, const STRING *src, size_t hashval)>
 
 Computes the hash of the given STRING C<src> with starting seed value C<seed>.
+See C<Parrot_hash_buffer> for how codepoints are hashed.
 
 =cut
 
@@ -345,17 +346,25 @@ encoding_hash(PARROT_INTERP, ARGIN(const STRING *src), size_t hashval)
     ASSERT_ARGS(encoding_hash)
     DECL_CONST_CAST;
     STRING * const s = PARROT_const_cast(STRING *, src);
+    HashState   state;
     String_iter iter;
 
+    /* one byte per codepoint: plain ASCII in UTF-8 */
+    if (s->bufused == s->strlen) {
+        s->hashval = hashval = Parrot_hash_buffer(
+                (const unsigned char *)s->strstart, s->strlen, hashval);
+        return hashval;
+    }
+
+    Parrot_hash_state_init(&state, hashval);
     STRING_ITER_INIT(interp, &iter);
 
     while (iter.charpos < s->strlen) {
         const UINTVAL c = STRING_iter_get_and_advance(interp, s, &iter);
-        hashval += hashval << 5;
-        hashval += c;
+        Parrot_hash_state_add_codepoint(&state, c);
     }
 
-    s->hashval = hashval;
+    s->hashval = hashval = Parrot_hash_state_finish(&state, s->strlen);
 
     return hashval;
 }
@@ -723,6 +732,75 @@ encoding_decompose(PARROT_INTERP, SHIM(const STRING *src))
 }
 
 
+/*
+
+=item C<UINTVAL encoding_index_lookup(PARROT_INTERP, const STRING *src, UINTVAL
+idx, UINTVAL *bytepos, encoding_index_scan_t scan)>
+
+Finds the closest character at or before C<idx> in the variable width string
+C<src> whose byte offset is known, stores that offset in C<bytepos> and
+returns the character's position.  The caller skips the remaining (fewer than
+C<STR_INDEX_STRIDE>) characters itself.
+
+The offsets are kept in a character index hanging off the STRING header, which
+the GC frees together with the header.  They are filled in lazily with
+C<scan>, which must move a byte offset of C<src> forward by a number of
+characters, so indexing into a long string costs a single pass over it instead
+of a pass per access.  Like the cached hash value, the index doesn't change
+what the string means, so it is attached to strings passed as const.
+Constant strings may be shared between threads and are never indexed.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+UINTVAL
+encoding_index_lookup(PARROT_INTERP, ARGIN(const STRING *src), UINTVAL idx,
+        ARGOUT(UINTVAL *bytepos), ARGIN(encoding_index_scan_t scan))
+{
+    ASSERT_ARGS(encoding_index_lookup)
+    DECL_CONST_CAST;
+    STRING * const str   = PARROT_const_cast(STRING *, src);
+    const UINTVAL  n     = idx / STR_INDEX_STRIDE;
+    Str_index     *index = str->index;
+
+    if (PObj_constant_TEST(str)) {
+        *bytepos = 0;
+        return 0;
+    }
+
+    if (index
+    && (index->bufused  != str->bufused
+    ||  index->strlen   != str->strlen
+    ||  index->encoding != str->encoding))
+        Parrot_str_free_index(interp, str);
+
+    if (!str->index) {
+        const UINTVAL size = str->strlen / STR_INDEX_STRIDE + 1;
+
+        index             = mem_gc_allocate_typed(interp, Str_index);
+        index->bytepos    = mem_gc_allocate_n_typed(interp, size, UINTVAL);
+        index->size       = size;
+        index->bufused    = str->bufused;
+        index->strlen     = str->strlen;
+        index->encoding   = str->encoding;
+        index->count      = 1;
+        index->bytepos[0] = 0;
+        str->index        = index;
+    }
+
+    while (index->count <= n) {
+        index->bytepos[index->count] = scan(src,
+                index->bytepos[index->count - 1], STR_INDEX_STRIDE);
+        ++index->count;
+    }
+
+    *bytepos = index->bytepos[n];
+    return n * STR_INDEX_STRIDE;
+}
+
+
 /*
 
 =item C<STRING * fixed8_to_encoding(PARROT_INTERP, const STRING *src, const
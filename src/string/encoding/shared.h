@@ -11,6 +11,10 @@
 #ifndef PARROT_ENCODING_SHARED_H_GUARD
 #define PARROT_ENCODING_SHARED_H_GUARD
 
+/* moves byte offset bytepos of src forward by n characters */
+typedef UINTVAL (*encoding_index_scan_t)(ARGIN(const STRING *src),
+        UINTVAL bytepos, UINTVAL n);
+
 /* HEADERIZER BEGIN: src/string/encoding/shared.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -77,6 +81,18 @@ INTVAL encoding_index(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+PARROT_WARN_UNUSED_RESULT
+UINTVAL encoding_index_lookup(PARROT_INTERP,
+    ARGIN(const STRING *src),
+    UINTVAL idx,
+    ARGOUT(UINTVAL *bytepos),
+    ARGIN(encoding_index_scan_t scan))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*bytepos);
+
 PARROT_WARN_UNUSED_RESULT
 INTVAL encoding_is_cclass(PARROT_INTERP,
     INTVAL flags,
@@ -300,6 +316,11 @@ STRING* unicode_upcase_first(PARROT_INTERP, const STRING *src)
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(src) \
     , PARROT_ASSERT_ARG(search))
+#define ASSERT_ARGS_encoding_index_lookup __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(src) \
+    , PARROT_ASSERT_ARG(bytepos) \
+    , PARROT_ASSERT_ARG(scan))
 #define ASSERT_ARGS_encoding_is_cclass __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(src))
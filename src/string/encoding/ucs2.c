@@ -391,13 +391,12 @@ ucs2_hash(SHIM_INTERP, ARGIN(const STRING *src), size_t hashval)
     STRING * const s   = PARROT_const_cast(STRING *, src);
     const utf16_t *ptr = (utf16_t *)s->strstart;
     UINTVAL        len = s->strlen;
+    HashState      state;
 
-    while (len--) {
-        hashval += hashval << 5;
-        hashval += *(ptr++);
-    }
-
-    s->hashval = hashval;
+    Parrot_hash_state_init(&state, hashval);
+    while (len--)
+        Parrot_hash_state_add_codepoint(&state, *(ptr++));
+    s->hashval = hashval = Parrot_hash_state_finish(&state, s->strlen);
 
     return hashval;
 }
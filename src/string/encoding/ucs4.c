@@ -394,15 +394,11 @@ ucs4_hash(SHIM_INTERP, ARGIN(const STRING *src), size_t hashval)
     ASSERT_ARGS(ucs4_hash)
     DECL_CONST_CAST;
     STRING * const  s   = PARROT_const_cast(STRING *, src);
-    const utf32_t  *ptr = (utf32_t *)s->strstart;
-    UINTVAL         len = s->strlen;
+    HashState       state;
 
-    while (len--) {
-        hashval += hashval << 5;
-        hashval += *(ptr++);
-    }
-
-    s->hashval = hashval;
+    Parrot_hash_state_init(&state, hashval);
+    Parrot_hash_state_add_ucs4(&state, (const utf32_t *)s->strstart, s->strlen);
+    s->hashval = hashval = Parrot_hash_state_finish(&state, s->strlen);
 
     return hashval;
 }
@@ -39,6 +39,13 @@ static utf16_t * utf16_encode(PARROT_INTERP,
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*ptr);
 
+PARROT_WARN_UNUSED_RESULT
+static UINTVAL utf16_index_scan(
+    ARGIN(const STRING *src),
+    UINTVAL bytepos,
+    UINTVAL n)
+        __attribute__nonnull__(1);
+
 static UINTVAL utf16_iter_get(PARROT_INTERP,
     ARGIN(const STRING *str),
     ARGIN(const String_iter *i),
@@ -70,6 +77,7 @@ static void utf16_iter_skip(PARROT_INTERP,
     ARGIN(const STRING *str),
     ARGMOD(String_iter *i),
     INTVAL skip)
+        __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*i);
@@ -93,6 +101,14 @@ static void utf16_scan(PARROT_INTERP, ARGMOD(STRING *src))
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*src);
 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static const utf16_t * utf16_seek(PARROT_INTERP,
+    ARGIN(const STRING *src),
+    UINTVAL idx)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_CANNOT_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
 static const utf16_t * utf16_skip_backward(
@@ -118,6 +134,8 @@ static STRING * utf16_to_encoding(PARROT_INTERP, ARGIN(const STRING *src))
 #define ASSERT_ARGS_utf16_encode __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(ptr))
+#define ASSERT_ARGS_utf16_index_scan __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(src))
 #define ASSERT_ARGS_utf16_iter_get __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(str) \
@@ -131,7 +149,8 @@ static STRING * utf16_to_encoding(PARROT_INTERP, ARGIN(const STRING *src))
     , PARROT_ASSERT_ARG(str) \
     , PARROT_ASSERT_ARG(i))
 #define ASSERT_ARGS_utf16_iter_skip __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(str) \
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(str) \
     , PARROT_ASSERT_ARG(i))
 #define ASSERT_ARGS_utf16_ord __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -143,6 +162,9 @@ static STRING * utf16_to_encoding(PARROT_INTERP, ARGIN(const STRING *src))
 #define ASSERT_ARGS_utf16_scan __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(src))
+#define ASSERT_ARGS_utf16_seek __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(src))
 #define ASSERT_ARGS_utf16_skip_backward __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(p))
 #define ASSERT_ARGS_utf16_skip_forward __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -457,12 +479,74 @@ utf16_ord(PARROT_INTERP, ARGIN(const STRING *src), INTVAL idx)
     if ((UINTVAL)idx >= len)
         encoding_ord_error(interp, src, idx);
 
-    start = utf16_skip_forward((const utf16_t *)src->strstart, idx);
+    start = utf16_seek(interp, src, idx);
 
     return utf16_decode(interp, start);
 }
 
 
+/*
+
+=item C<static const utf16_t * utf16_seek(PARROT_INTERP, const STRING *src,
+UINTVAL idx)>
+
+Returns a pointer to the character at position C<idx> of C<src>.  Long strings
+are not scanned from the start but from the closest offset in their character
+index, see C<encoding_index_lookup>.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static const utf16_t *
+utf16_seek(PARROT_INTERP, ARGIN(const STRING *src), UINTVAL idx)
+{
+    ASSERT_ARGS(utf16_seek)
+    const utf16_t *ptr = (const utf16_t *)src->strstart;
+
+    /* every character in the BMP */
+    if (src->bufused == src->strlen * 2)
+        return ptr + idx;
+
+    if (idx >= STR_INDEX_STRIDE && src->strlen >= STR_INDEX_MIN_LENGTH) {
+        UINTVAL bytepos;
+        const UINTVAL charpos = encoding_index_lookup(interp, src, idx,
+                                    &bytepos, utf16_index_scan);
+
+        ptr  = (const utf16_t *)(src->strstart + bytepos);
+        idx -= charpos;
+    }
+
+    return utf16_skip_forward(ptr, idx);
+}
+
+
+/*
+
+=item C<static UINTVAL utf16_index_scan(const STRING *src, UINTVAL bytepos,
+UINTVAL n)>
+
+Returns the byte offset C<n> characters after C<bytepos> in C<src>.  Used to
+fill in the character index of C<src>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static UINTVAL
+utf16_index_scan(ARGIN(const STRING *src), UINTVAL bytepos, UINTVAL n)
+{
+    ASSERT_ARGS(utf16_index_scan)
+    const utf16_t * const ptr = (const utf16_t *)(src->strstart + bytepos);
+
+    return bytepos + ((const char *)utf16_skip_forward(ptr, n)
+                   -  (const char *)ptr);
+}
+
+
 /*
 
 =item C<static UINTVAL utf16_iter_get(PARROT_INTERP, const STRING *str, const
@@ -503,7 +587,7 @@ Moves the string iterator C<i> by C<skip> characters.
 */
 
 static void
-utf16_iter_skip(SHIM_INTERP,
+utf16_iter_skip(PARROT_INTERP,
     ARGIN(const STRING *str), ARGMOD(String_iter *i), INTVAL skip)
 {
     ASSERT_ARGS(utf16_iter_skip)
@@ -513,7 +597,9 @@ utf16_iter_skip(SHIM_INTERP,
 
     PARROT_ASSERT(i->charpos <= str->strlen);
 
-    if (skip > 0)
+    if (skip >= STR_INDEX_STRIDE || skip <= -STR_INDEX_STRIDE)
+        ptr = utf16_seek(interp, str, i->charpos);
+    else if (skip > 0)
         ptr = utf16_skip_forward(ptr, skip);
     else if (skip < 0)
         ptr = utf16_skip_backward(ptr, -skip);
@@ -35,6 +35,13 @@ static utf8_t * utf8_encode(PARROT_INTERP, ARGMOD(utf8_t *ptr), UINTVAL c)
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*ptr);
 
+PARROT_WARN_UNUSED_RESULT
+static UINTVAL utf8_index_scan(
+    ARGIN(const STRING *src),
+    UINTVAL bytepos,
+    UINTVAL n)
+        __attribute__nonnull__(1);
+
 static UINTVAL utf8_iter_get(PARROT_INTERP,
     ARGIN(const STRING *str),
     ARGIN(const String_iter *i),
@@ -65,6 +72,7 @@ static void utf8_iter_skip(PARROT_INTERP,
     ARGIN(const STRING *str),
     ARGMOD(String_iter *i),
     INTVAL skip)
+        __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*i);
@@ -86,6 +94,14 @@ static void utf8_scan(PARROT_INTERP, ARGMOD(STRING *src))
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*src);
 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static const utf8_t * utf8_seek(PARROT_INTERP,
+    ARGIN(const STRING *src),
+    UINTVAL idx)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
 static const utf8_t * utf8_skip_backward(
@@ -107,6 +123,8 @@ static STRING * utf8_to_encoding(PARROT_INTERP, ARGIN(const STRING *src))
 #define ASSERT_ARGS_utf8_encode __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(ptr))
+#define ASSERT_ARGS_utf8_index_scan __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(src))
 #define ASSERT_ARGS_utf8_iter_get __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(str) \
@@ -120,7 +138,8 @@ static STRING * utf8_to_encoding(PARROT_INTERP, ARGIN(const STRING *src))
     , PARROT_ASSERT_ARG(str) \
     , PARROT_ASSERT_ARG(i))
 #define ASSERT_ARGS_utf8_iter_skip __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(str) \
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(str) \
     , PARROT_ASSERT_ARG(i))
 #define ASSERT_ARGS_utf8_ord __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -132,6 +151,9 @@ static STRING * utf8_to_encoding(PARROT_INTERP, ARGIN(const STRING *src))
 #define ASSERT_ARGS_utf8_scan __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(src))
+#define ASSERT_ARGS_utf8_seek __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(src))
 #define ASSERT_ARGS_utf8_skip_backward __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(ptr))
 #define ASSERT_ARGS_utf8_skip_forward __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -331,7 +353,7 @@ utf8_ord(PARROT_INTERP, ARGIN(const STRING *src), INTVAL idx)
     if ((UINTVAL)idx >= len)
         encoding_ord_error(interp, src, idx);
 
-    start = utf8_skip_forward((utf8_t *)src->strstart, idx);
+    start = utf8_seek(interp, src, idx);
 
     return utf8_decode(interp, start);
 }
@@ -463,6 +485,68 @@ utf8_skip_backward(ARGIN(const utf8_t *ptr), UINTVAL n)
 }
 
 
+/*
+
+=item C<static const utf8_t * utf8_seek(PARROT_INTERP, const STRING *src,
+UINTVAL idx)>
+
+Returns a pointer to the character at position C<idx> of C<src>.  Long strings
+are not scanned from the start but from the closest offset in their character
+index, see C<encoding_index_lookup>.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static const utf8_t *
+utf8_seek(PARROT_INTERP, ARGIN(const STRING *src), UINTVAL idx)
+{
+    ASSERT_ARGS(utf8_seek)
+    const utf8_t *ptr = (const utf8_t *)src->strstart;
+
+    /* every character ASCII */
+    if (src->bufused == src->strlen)
+        return ptr + idx;
+
+    if (idx >= STR_INDEX_STRIDE && src->strlen >= STR_INDEX_MIN_LENGTH) {
+        UINTVAL bytepos;
+        const UINTVAL charpos = encoding_index_lookup(interp, src, idx,
+                                    &bytepos, utf8_index_scan);
+
+        ptr  = (const utf8_t *)(src->strstart + bytepos);
+        idx -= charpos;
+    }
+
+    return utf8_skip_forward(ptr, idx);
+}
+
+
+/*
+
+=item C<static UINTVAL utf8_index_scan(const STRING *src, UINTVAL bytepos,
+UINTVAL n)>
+
+Returns the byte offset C<n> characters after C<bytepos> in C<src>.  Used to
+fill in the character index of C<src>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static UINTVAL
+utf8_index_scan(ARGIN(const STRING *src), UINTVAL bytepos, UINTVAL n)
+{
+    ASSERT_ARGS(utf8_index_scan)
+    const utf8_t * const ptr = (const utf8_t *)(src->strstart + bytepos);
+
+    return bytepos + ((const char *)utf8_skip_forward(ptr, n)
+                   -  (const char *)ptr);
+}
+
+
 /*
 
 =item C<static UINTVAL utf8_iter_get(PARROT_INTERP, const STRING *str, const
@@ -504,7 +588,7 @@ Moves the string iterator C<i> by C<skip> characters.
 */
 
 static void
-utf8_iter_skip(SHIM_INTERP,
+utf8_iter_skip(PARROT_INTERP,
     ARGIN(const STRING *str), ARGMOD(String_iter *i), INTVAL skip)
 {
     ASSERT_ARGS(utf8_iter_skip)
@@ -514,7 +598,9 @@ utf8_iter_skip(SHIM_INTERP,
 
     PARROT_ASSERT(i->charpos <= str->strlen);
 
-    if (skip > 0)
+    if (skip >= STR_INDEX_STRIDE || skip <= -STR_INDEX_STRIDE)
+        ptr = utf8_seek(interp, str, i->charpos);
+    else if (skip > 0)
         ptr = utf8_skip_forward(ptr, skip);
     else if (skip < 0)
         ptr = utf8_skip_backward(ptr, -skip);
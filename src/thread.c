@@ -0,0 +1,973 @@
+/*
+Copyright (C) 2012, Parrot Foundation.
+
+=head1 NAME
+
+src/thread.c - Worker interpreters running tasks in their own threads
+
+=head1 DESCRIPTION
+
+A thread pool runs subs of the main interpreter on other cores.  Every
+worker is an OS thread with an interpreter of its own: its own GC heap,
+scheduler, namespaces and I/O buffers.  Nothing but the process wide,
+immutable parts of Parrot, like the encodings and C<PMCNULL>, is shared
+between the interpreters; see C<PARROT_IS_THREAD> for where those are set
+up and torn down only once.
+
+Data crosses threads in frozen form only.  The main interpreter freezes the
+argument of a job with C<Parrot_freeze>, the worker thaws it, calls the sub
+and freezes what it returned, and the main interpreter thaws that when it
+collects the result.  The code is packed once per bytecode segment into an
+image which all workers share read-only; every worker unpacks the image
+into a packfile of its own the first time it runs a sub of it, and keeps it
+for the following jobs.
+
+The main interpreter deals jobs out round robin to the deques of the
+workers.  A worker takes the oldest job of its own deque, or steals the
+newest one of another worker when its deque is empty.  Finished jobs are
+put on a list the main interpreter collects from; a worker wakes the main
+interpreter with an alarm signal unless it is waiting for results already.
+
+Worker threads need POSIX threads.  Elsewhere C<Parrot_thread_pool_new>
+returns NULL.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+#include "parrot/extend.h"
+#include "parrot/alarm.h"
+#include "parrot/thread.h"
+#include "parrot/oplib/core_ops.h"
+#include "pmc/pmc_sub.h"
+#include "pmc/pmc_exception.h"
+
+#if defined(PARROT_HAS_HEADER_PTHREAD) && !defined(_WIN32)
+#  define PARROT_HAS_WORKER_THREADS 1
+#  include <pthread.h>
+#  include <signal.h>
+#  include <sched.h>
+#endif
+
+/* HEADERIZER HFILE: include/parrot/thread.h */
+
+#ifdef PARROT_HAS_WORKER_THREADS
+
+/* Initial size of the job deques */
+#  define THREAD_DEQUE_SIZE 16
+
+/* The code of one bytecode segment of the main interpreter, packed */
+typedef struct Thread_Image {
+    struct Thread_Image *next;
+    PackFile_ByteCode   *seg;   /* The segment in the main interpreter */
+    size_t               seg_size;
+    char                *name;  /* Name of the segment */
+    char                *bytes; /* The packfile of the segment */
+    size_t               size;
+} Thread_Image;
+
+/* An image unpacked by a worker */
+typedef struct Thread_Code {
+    struct Thread_Code *next;
+    Thread_Image       *image;
+    PackFile_ByteCode  *bc;
+} Thread_Code;
+
+typedef struct Thread_Job {
+    struct Thread_Job     *next;      /* In the list of finished jobs */
+    INTVAL                 id;
+    Thread_Image          *image;     /* Code of the sub to call */
+    INTVAL                 sub_index; /* Constant of the sub in image */
+
+    /* The frozen argument, then the frozen result or the error message */
+    char                  *data;
+    size_t                 size;
+    int                    failed;
+    INTVAL                 error;     /* Type of the exception, if failed */
+
+    struct Thread_Worker  *worker;    /* Worker running the job */
+} Thread_Job;
+
+typedef struct Thread_Worker {
+    Parrot_thread_pool *pool;
+    pthread_t           thread;
+
+    /* Ring buffer of jobs. The worker takes the first one, thieves the
+     * last one. Changed under lock only */
+    pthread_mutex_t     lock;
+    Thread_Job        **jobs;
+    size_t              first;
+    size_t              count;
+    size_t              size;
+
+    /* Only used by the worker thread */
+    Thread_Code        *code;
+} Thread_Worker;
+
+struct Parrot_thread_pool {
+    Thread_Worker   *workers;
+    size_t           num_workers;  /* Workers running */
+    size_t           allocated;    /* Workers set up */
+
+    /* Only used by the main interpreter */
+    size_t           next_worker;  /* Gets the next job */
+    Thread_Image    *images;
+    INTVAL           pending;      /* Jobs submitted and not collected */
+
+    /* Frozen config hash for the worker interpreters */
+    char            *config;
+    size_t           config_size;
+    char            *gc_system;
+
+    pthread_mutex_t  lock;
+
+    /* Workers wait for jobs here */
+    pthread_cond_t   work;
+
+    /* The main interpreter waits for workers to start or to finish a job
+     * here */
+    pthread_cond_t   finished;
+
+    /* Protected by lock */
+    size_t           queued;       /* Jobs in deques no worker took on */
+    Thread_Job      *done;         /* Finished jobs, oldest first */
+    Thread_Job      *done_last;
+    size_t           started;
+    int              main_waiting;
+    int              shutdown;
+};
+
+/* Serializes the setup of interpreters in worker threads */
+static pthread_mutex_t thread_init_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static void free_job(ARGFREE_NOTNULL(Thread_Job *job))
+        __attribute__nonnull__(1);
+
+PARROT_CANNOT_RETURN_NULL
+static Thread_Image * pool_get_image(PARROT_INTERP,
+    ARGMOD(Parrot_thread_pool *pool),
+    ARGIN(PackFile_ByteCode *seg))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*pool);
+
+static void worker_call(PARROT_INTERP, ARGIN_NULLOK(void *data))
+        __attribute__nonnull__(1);
+
+static void worker_catch(PARROT_INTERP,
+    ARGIN_NULLOK(PMC *exception),
+    ARGIN_NULLOK(void *data))
+        __attribute__nonnull__(1);
+
+PARROT_CANNOT_RETURN_NULL
+static PMC * worker_get_sub(PARROT_INTERP,
+    ARGMOD(Thread_Worker *w),
+    ARGIN(Thread_Image *image),
+    INTVAL sub_index)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*w);
+
+PARROT_CAN_RETURN_NULL
+static void * worker_main(ARGIN(void *arg))
+        __attribute__nonnull__(1);
+
+PARROT_CAN_RETURN_NULL
+static Thread_Job * worker_take_job(ARGMOD(Thread_Worker *w))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*w);
+
+#define ASSERT_ARGS_free_job __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(job))
+#define ASSERT_ARGS_pool_get_image __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pool) \
+    , PARROT_ASSERT_ARG(seg))
+#define ASSERT_ARGS_worker_call __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_worker_catch __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_worker_get_sub __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(w) \
+    , PARROT_ASSERT_ARG(image))
+#define ASSERT_ARGS_worker_main __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(arg))
+#define ASSERT_ARGS_worker_take_job __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(w))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<static void * worker_main(void *arg)>
+
+Body of worker threads. Sets up the interpreter of the worker, runs jobs
+until the pool shuts down and destroys the interpreter again.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static void *
+worker_main(ARGIN(void *arg))
+{
+    ASSERT_ARGS(worker_main)
+    Thread_Worker      * const w    = (Thread_Worker *)arg;
+    Parrot_thread_pool * const pool = w->pool;
+    Parrot_GC_Init_Args args;
+    Interp             *interp;
+    int                 stacktop;
+
+    memset(&args, 0, sizeof (args));
+    args.stacktop = &stacktop;
+    args.system   = pool->gc_system;
+
+    pthread_mutex_lock(&thread_init_lock);
+    interp = Parrot_interp_allocate_interpreter(NULL, PARROT_IS_THREAD);
+    Parrot_interp_initialize_interpreter(interp, &args);
+    pthread_mutex_unlock(&thread_init_lock);
+
+    /* Calls and handlers set up from C return to the current code, so
+       there must be some before the first job */
+    {
+        STRING   * const name   = Parrot_str_new_constant(interp, "worker");
+        PackFile * const pf     = PackFile_new(interp, 0);
+        PMC      * const pf_pmc = Parrot_pf_get_packfile_pmc(interp, pf, name);
+
+        pf->cur_cs = Parrot_pf_create_default_segments(interp, pf_pmc, name, 1);
+        Parrot_pf_set_current_packfile(interp, pf_pmc);
+    }
+
+    if (pool->config) {
+        STRING * const image = Parrot_str_new_init(interp, pool->config,
+                pool->config_size, Parrot_binary_encoding_ptr, 0);
+
+        VTABLE_set_pmc_keyed_int(interp, interp->iglobals,
+                (INTVAL)IGLOBALS_CONFIG_HASH, Parrot_thaw(interp, image));
+        Parrot_lib_update_paths_from_config_hash(interp);
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    ++pool->started;
+    pthread_cond_broadcast(&pool->finished);
+
+    for (;;) {
+        Thread_Job *job;
+        int         wake;
+
+        while (!pool->shutdown && !pool->queued)
+            pthread_cond_wait(&pool->work, &pool->lock);
+
+        if (pool->shutdown)
+            break;
+
+        /* One of the queued jobs is ours now, wherever it is */
+        --pool->queued;
+        pthread_mutex_unlock(&pool->lock);
+
+        while (!(job = worker_take_job(w)))
+            sched_yield();
+
+        job->worker = w;
+        Parrot_ext_try(interp, worker_call, worker_catch, job);
+        Parrot_io_flush(interp, Parrot_io_STDOUT(interp));
+
+        pthread_mutex_lock(&pool->lock);
+        if (pool->done_last)
+            pool->done_last->next = job;
+        else
+            pool->done = job;
+        pool->done_last = job;
+        wake = !pool->main_waiting;
+        pthread_cond_signal(&pool->finished);
+
+        /* The main interpreter looks for results when an alarm went off */
+        if (wake) {
+            pthread_mutex_unlock(&pool->lock);
+            Parrot_alarm_now();
+            pthread_mutex_lock(&pool->lock);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    while (w->code) {
+        Thread_Code * const next = w->code->next;
+        mem_internal_free(w->code);
+        w->code = next;
+    }
+
+    /* The packfiles go with the rest of the heap */
+    Parrot_interp_really_destroy(interp, 0, NULL);
+
+    return NULL;
+}
+
+/*
+
+=item C<static Thread_Job * worker_take_job(Thread_Worker *w)>
+
+Takes the first job off the deque of C<w>, or steals the last job of another
+worker when that is empty. Returns NULL if there was no job anywhere.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static Thread_Job *
+worker_take_job(ARGMOD(Thread_Worker *w))
+{
+    ASSERT_ARGS(worker_take_job)
+    Parrot_thread_pool * const pool = w->pool;
+    Thread_Job *job = NULL;
+    size_t      i;
+
+    pthread_mutex_lock(&w->lock);
+    if (w->count) {
+        job      = w->jobs[w->first];
+        w->first = (w->first + 1) % w->size;
+        --w->count;
+    }
+    pthread_mutex_unlock(&w->lock);
+
+    for (i = 1; !job && i < pool->num_workers; ++i) {
+        Thread_Worker * const victim =
+            &pool->workers[(w - pool->workers + i) % pool->num_workers];
+
+        pthread_mutex_lock(&victim->lock);
+        if (victim->count) {
+            --victim->count;
+            job = victim->jobs[(victim->first + victim->count) % victim->size];
+        }
+        pthread_mutex_unlock(&victim->lock);
+    }
+
+    return job;
+}
+
+/*
+
+=item C<static PMC * worker_get_sub(PARROT_INTERP, Thread_Worker *w,
+Thread_Image *image, INTVAL sub_index)>
+
+Returns the sub C<sub_index> of C<image> in the interpreter of worker C<w>.
+Unpacks and loads the image if the worker didn't so before.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+worker_get_sub(PARROT_INTERP, ARGMOD(Thread_Worker *w),
+        ARGIN(Thread_Image *image), INTVAL sub_index)
+{
+    ASSERT_ARGS(worker_get_sub)
+    Thread_Code *code;
+
+    for (code = w->code; code; code = code->next)
+        if (code->image == image)
+            break;
+
+    if (!code) {
+        STRING * const bytes = Parrot_str_new_init(interp, image->bytes,
+                                    image->size, Parrot_binary_encoding_ptr, 0);
+        STRING * const name  = Parrot_str_new(interp, image->name, 0);
+        PackFile * const pf  = Parrot_pf_deserialize(interp, bytes);
+        PMC * const pf_pmc   = Parrot_pf_get_packfile_pmc(interp, pf, name);
+        PackFile_ByteCode * const bc = (PackFile_ByteCode *)
+                PackFile_find_segment(interp, &pf->directory, name, 1);
+
+        if (!bc || !bc->const_table
+        ||  sub_index >= bc->const_table->pmc.const_count)
+            Parrot_ex_throw_from_c_args(interp, NULL,
+                EXCEPTION_MALFORMED_PACKFILE,
+                "Can't find the code of the task in segment '%Ss'", name);
+
+        Parrot_pf_prepare_packfile_load(interp, pf_pmc);
+
+        code        = mem_internal_allocate_zeroed_typed(Thread_Code);
+        code->image = image;
+        code->bc    = bc;
+        code->next  = w->code;
+        w->code     = code;
+    }
+
+    return PF_PMC_CONSTANT(interp, code->bc->const_table, sub_index);
+}
+
+/*
+
+=item C<static void worker_call(PARROT_INTERP, void *data)>
+
+Runs the job C<data>: thaws its argument, calls its sub and leaves the
+frozen result in the job.
+
+=item C<static void worker_catch(PARROT_INTERP, PMC *exception, void *data)>
+
+Leaves the message of C<exception>, thrown while running the job C<data>,
+in the job and marks it as failed.
+
+=cut
+
+*/
+
+static void
+worker_call(PARROT_INTERP, ARGIN_NULLOK(void *data))
+{
+    ASSERT_ARGS(worker_call)
+    Thread_Job * const job = (Thread_Job *)data;
+    PMC * const sub        = worker_get_sub(interp, job->worker, job->image,
+                                    job->sub_index);
+    PMC        *arg        = PMCNULL;
+    PMC        *result     = PMCNULL;
+
+    if (job->data) {
+        STRING * const image = Parrot_str_new_init(interp, job->data,
+                                    job->size, Parrot_binary_encoding_ptr, 0);
+        mem_internal_free(job->data);
+        job->data = NULL;
+        job->size = 0;
+        arg       = Parrot_thaw(interp, image);
+    }
+
+    Parrot_ext_call(interp, sub, "P->P", arg, &result);
+
+    if (!PMC_IS_NULL(result)) {
+        STRING * const image = Parrot_freeze(interp, result);
+
+        job->size = Parrot_str_byte_length(interp, image);
+        job->data = (char *)mem_internal_allocate(job->size);
+        memcpy(job->data, image->strstart, job->size);
+    }
+}
+
+static void
+worker_catch(PARROT_INTERP, ARGIN_NULLOK(PMC *exception), ARGIN_NULLOK(void *data))
+{
+    ASSERT_ARGS(worker_catch)
+    Thread_Job * const job = (Thread_Job *)data;
+    char       * const message = PMC_IS_NULL(exception)
+                               ? NULL
+                               : Parrot_str_to_cstring(interp,
+                                    VTABLE_get_string(interp, exception));
+    const char * const text = message ? message : "task failed";
+
+    if (job->data)
+        mem_internal_free(job->data);
+
+    job->size   = strlen(text);
+    job->data   = (char *)mem_internal_allocate(job->size + 1);
+    job->failed = 1;
+    job->error  = !PMC_IS_NULL(exception)
+               && exception->vtable->base_type == enum_class_Exception
+                ? PARROT_EXCEPTION(exception)->type
+                : EXCEPTION_INVALID_OPERATION;
+    memcpy(job->data, text, job->size + 1);
+
+    if (message)
+        Parrot_str_free_cstring(message);
+}
+
+/*
+
+=item C<static Thread_Image * pool_get_image(PARROT_INTERP, Parrot_thread_pool
+*pool, PackFile_ByteCode *seg)>
+
+Returns the image of the segment C<seg>, packing it the first time.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static Thread_Image *
+pool_get_image(PARROT_INTERP, ARGMOD(Parrot_thread_pool *pool),
+        ARGIN(PackFile_ByteCode *seg))
+{
+    ASSERT_ARGS(pool_get_image)
+    Thread_Image *image;
+    STRING       *bytes;
+    char         *name;
+
+    /* Code that was added to the segment since is not in the image */
+    for (image = pool->images; image; image = image->next)
+        if (image->seg == seg && image->seg_size == seg->base.size)
+            return image;
+
+    bytes = Parrot_pf_serialize(interp, seg->base.pf);
+    name  = Parrot_str_to_cstring(interp, seg->base.name);
+
+    image           = mem_internal_allocate_zeroed_typed(Thread_Image);
+    image->seg      = seg;
+    image->seg_size = seg->base.size;
+    image->size     = Parrot_str_byte_length(interp, bytes);
+    image->bytes    = (char *)mem_internal_allocate(image->size);
+    image->name     = (char *)mem_internal_allocate(strlen(name) + 1);
+    memcpy(image->bytes, bytes->strstart, image->size);
+    strcpy(image->name, name);
+    Parrot_str_free_cstring(name);
+
+    image->next  = pool->images;
+    pool->images = image;
+
+    return image;
+}
+
+/*
+
+=item C<static void free_job(Thread_Job *job)>
+
+Frees C<job>.
+
+=cut
+
+*/
+
+static void
+free_job(ARGFREE_NOTNULL(Thread_Job *job))
+{
+    ASSERT_ARGS(free_job)
+
+    if (job->data)
+        mem_internal_free(job->data);
+    mem_internal_free(job);
+}
+
+#endif /* PARROT_HAS_WORKER_THREADS */
+
+/*
+
+=item C<Parrot_thread_pool * Parrot_thread_pool_new(PARROT_INTERP, size_t
+count)>
+
+Starts C<count> worker threads and returns when their interpreters are set
+up. The workers use the same kind of GC and the same configuration as
+C<interp>. Returns NULL when this platform has no worker threads.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+Parrot_thread_pool *
+Parrot_thread_pool_new(PARROT_INTERP, size_t count)
+{
+    ASSERT_ARGS(Parrot_thread_pool_new)
+#ifdef PARROT_HAS_WORKER_THREADS
+    PMC * const config = VTABLE_get_pmc_keyed_int(interp, interp->iglobals,
+                                (INTVAL)IGLOBALS_CONFIG_HASH);
+    op_lib_t * const core_ops = PARROT_GET_CORE_OPLIB(interp);
+    Parrot_thread_pool *pool;
+    sigset_t            all, old;
+    size_t              i;
+
+    if (!count)
+        return NULL;
+
+    pool              = mem_internal_allocate_zeroed_typed(Parrot_thread_pool);
+    pool->num_workers = count;
+    pool->allocated   = count;
+    pool->workers     = mem_internal_allocate_n_zeroed_typed(count, Thread_Worker);
+
+    pool->gc_system   = Parrot_str_to_cstring(interp, Parrot_gc_sys_name(interp));
+
+    if (!PMC_IS_NULL(config) && VTABLE_elements(interp, config)) {
+        STRING * const image = Parrot_freeze(interp, config);
+
+        pool->config_size = Parrot_str_byte_length(interp, image);
+        pool->config      = (char *)mem_internal_allocate(pool->config_size);
+        memcpy(pool->config, image->strstart, pool->config_size);
+    }
+
+    /* The op name table of the core ops is set up lazily and shared */
+    (void)core_ops->_op_code(interp, "end", 0);
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work, NULL);
+    pthread_cond_init(&pool->finished, NULL);
+
+    for (i = 0; i < count; ++i) {
+        Thread_Worker * const w = &pool->workers[i];
+
+        w->pool = pool;
+        w->size = THREAD_DEQUE_SIZE;
+        w->jobs = mem_internal_allocate_n_zeroed_typed(w->size, Thread_Job *);
+        pthread_mutex_init(&w->lock, NULL);
+    }
+
+    /* Signals are for the main interpreter. Workers inherit this mask */
+    sigfillset(&all);
+    pthread_sigmask(SIG_SETMASK, &all, &old);
+
+    for (i = 0; i < count; ++i)
+        if (pthread_create(&pool->workers[i].thread, NULL, worker_main,
+                &pool->workers[i])) {
+            /* Make do with the workers we have */
+            pool->num_workers = i;
+            break;
+        }
+
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->started < pool->num_workers)
+        pthread_cond_wait(&pool->finished, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+
+    if (!pool->num_workers) {
+        Parrot_thread_pool_destroy(interp, pool);
+        return NULL;
+    }
+
+    return pool;
+#else
+    UNUSED(interp);
+    UNUSED(count);
+    return NULL;
+#endif
+}
+
+/*
+
+=item C<void Parrot_thread_pool_destroy(PARROT_INTERP, Parrot_thread_pool
+*pool)>
+
+Stops the workers of C<pool> and frees it. Jobs which did not run yet are
+dropped, results which were not collected are lost.
+
+=cut
+
+*/
+
+void
+Parrot_thread_pool_destroy(PARROT_INTERP, ARGFREE_NOTNULL(Parrot_thread_pool *pool))
+{
+    ASSERT_ARGS(Parrot_thread_pool_destroy)
+#ifdef PARROT_HAS_WORKER_THREADS
+    size_t i;
+
+    UNUSED(interp);
+
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->work);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (i = 0; i < pool->num_workers; ++i)
+        pthread_join(pool->workers[i].thread, NULL);
+
+    for (i = 0; i < pool->allocated; ++i) {
+        Thread_Worker * const w = &pool->workers[i];
+
+        for (; w->count; --w->count, w->first = (w->first + 1) % w->size)
+            free_job(w->jobs[w->first]);
+
+        pthread_mutex_destroy(&w->lock);
+        mem_internal_free(w->jobs);
+    }
+
+    while (pool->done) {
+        Thread_Job * const next = pool->done->next;
+        free_job(pool->done);
+        pool->done = next;
+    }
+
+    while (pool->images) {
+        Thread_Image * const next = pool->images->next;
+        mem_internal_free(pool->images->bytes);
+        mem_internal_free(pool->images->name);
+        mem_internal_free(pool->images);
+        pool->images = next;
+    }
+
+    pthread_cond_destroy(&pool->finished);
+    pthread_cond_destroy(&pool->work);
+    pthread_mutex_destroy(&pool->lock);
+
+    if (pool->config)
+        mem_internal_free(pool->config);
+    Parrot_str_free_cstring(pool->gc_system);
+    mem_internal_free(pool->workers);
+#else
+    UNUSED(interp);
+#endif
+    mem_internal_free(pool);
+}
+
+/*
+
+=item C<size_t Parrot_thread_pool_size(const Parrot_thread_pool *pool)>
+
+Returns the number of workers of C<pool>.
+
+=item C<INTVAL Parrot_thread_pool_pending(const Parrot_thread_pool *pool)>
+
+Returns the number of jobs submitted to C<pool> whose results were not
+collected yet.
+
+=cut
+
+*/
+
+PARROT_PURE_FUNCTION
+size_t
+Parrot_thread_pool_size(ARGIN(const Parrot_thread_pool *pool))
+{
+    ASSERT_ARGS(Parrot_thread_pool_size)
+#ifdef PARROT_HAS_WORKER_THREADS
+    return pool->num_workers;
+#else
+    UNUSED(pool);
+    return 0;
+#endif
+}
+
+PARROT_PURE_FUNCTION
+INTVAL
+Parrot_thread_pool_pending(ARGIN(const Parrot_thread_pool *pool))
+{
+    ASSERT_ARGS(Parrot_thread_pool_pending)
+#ifdef PARROT_HAS_WORKER_THREADS
+    return pool->pending;
+#else
+    UNUSED(pool);
+    return 0;
+#endif
+}
+
+/*
+
+=item C<size_t Parrot_thread_pool_default_size(void)>
+
+Returns how many workers to start by default: one for each processor.
+
+=cut
+
+*/
+
+size_t
+Parrot_thread_pool_default_size(void)
+{
+    ASSERT_ARGS(Parrot_thread_pool_default_size)
+#ifdef _SC_NPROCESSORS_ONLN
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (count > 0)
+        return (size_t)count;
+#endif
+    return 1;
+}
+
+/*
+
+=item C<void Parrot_thread_pool_submit(PARROT_INTERP, Parrot_thread_pool *pool,
+INTVAL id, PMC *sub, PMC *arg)>
+
+Has a worker of C<pool> call C<sub> with a copy of C<arg>, or without
+arguments if C<arg> is null. C<sub> must be a sub loaded from bytecode; it
+runs without the lexicals of its outer subs.
+C<Parrot_thread_pool_collect> returns the result with C<id>.
+
+=cut
+
+*/
+
+void
+Parrot_thread_pool_submit(PARROT_INTERP, ARGMOD(Parrot_thread_pool *pool),
+        INTVAL id, ARGIN(PMC *sub), ARGIN_NULLOK(PMC *arg))
+{
+    ASSERT_ARGS(Parrot_thread_pool_submit)
+#ifdef PARROT_HAS_WORKER_THREADS
+    Parrot_Sub_attributes *sub_attrs;
+    PackFile_ConstTable   *ct;
+    Thread_Worker         *w;
+    Thread_Job            *job;
+    INTVAL                 i;
+
+    PMC_get_sub(interp, sub, sub_attrs);
+
+    if (!sub_attrs || !sub_attrs->seg || !sub_attrs->seg->const_table)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Only subs loaded from bytecode can run in a worker");
+
+    /* A closure is a copy of the constant sub, find that one */
+    ct = sub_attrs->seg->const_table;
+    for (i = 0; i < ct->pmc.const_count; ++i) {
+        PMC * const c = ct->pmc.constants[i];
+
+        if (c == sub)
+            break;
+
+        if (c && c->vtable->base_type == sub->vtable->base_type
+        &&  PARROT_SUB(c)->start_offs == sub_attrs->start_offs)
+            break;
+    }
+
+    if (i == ct->pmc.const_count)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Only subs loaded from bytecode can run in a worker");
+
+    job            = mem_internal_allocate_zeroed_typed(Thread_Job);
+    job->id        = id;
+    job->image     = pool_get_image(interp, pool, sub_attrs->seg);
+    job->sub_index = i;
+
+    if (!PMC_IS_NULL(arg)) {
+        STRING * const image = Parrot_freeze(interp, arg);
+
+        job->size = Parrot_str_byte_length(interp, image);
+        job->data = (char *)mem_internal_allocate(job->size);
+        memcpy(job->data, image->strstart, job->size);
+    }
+
+    w                 = &pool->workers[pool->next_worker];
+    pool->next_worker = (pool->next_worker + 1) % pool->num_workers;
+
+    pthread_mutex_lock(&w->lock);
+    if (w->count == w->size) {
+        Thread_Job ** const jobs =
+            mem_internal_allocate_n_zeroed_typed(w->size * 2, Thread_Job *);
+        size_t j;
+
+        for (j = 0; j < w->count; ++j)
+            jobs[j] = w->jobs[(w->first + j) % w->size];
+
+        mem_internal_free(w->jobs);
+        w->jobs  = jobs;
+        w->first = 0;
+        w->size *= 2;
+    }
+    w->jobs[(w->first + w->count) % w->size] = job;
+    ++w->count;
+    pthread_mutex_unlock(&w->lock);
+
+    pthread_mutex_lock(&pool->lock);
+    ++pool->queued;
+    pthread_cond_signal(&pool->work);
+    pthread_mutex_unlock(&pool->lock);
+
+    ++pool->pending;
+#else
+    UNUSED(pool);
+    UNUSED(id);
+    UNUSED(sub);
+    UNUSED(arg);
+    Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_UNIMPLEMENTED,
+        "Worker threads are not available on this platform");
+#endif
+}
+
+/*
+
+=item C<PMC * Parrot_thread_pool_collect(PARROT_INTERP, Parrot_thread_pool
+*pool, FLOATVAL timeout, INTVAL *id)>
+
+Returns the result of a finished job of C<pool> and stores its id in C<id>.
+The result is C<PMCNULL> if the sub returned nothing, and an Exception if it
+threw one. Waits up to C<timeout> seconds, or for ever if it is negative,
+for a job to finish. Returns NULL if no job finished in time, or if there
+are no jobs to wait for.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+PMC *
+Parrot_thread_pool_collect(PARROT_INTERP, ARGMOD(Parrot_thread_pool *pool),
+        FLOATVAL timeout, ARGOUT(INTVAL *id))
+{
+    ASSERT_ARGS(Parrot_thread_pool_collect)
+#ifdef PARROT_HAS_WORKER_THREADS
+    Thread_Job *job;
+    PMC        *result = PMCNULL;
+
+    if (!pool->pending)
+        return NULL;
+
+    pthread_mutex_lock(&pool->lock);
+    if (!pool->done && timeout != 0.0) {
+        pool->main_waiting = 1;
+
+        if (timeout < 0.0) {
+            while (!pool->done)
+                pthread_cond_wait(&pool->finished, &pool->lock);
+        }
+        else {
+            const FLOATVAL  until = Parrot_floatval_time() + timeout;
+            struct timespec ts;
+
+            ts.tv_sec  = (time_t)until;
+            ts.tv_nsec = (long)((until - (FLOATVAL)ts.tv_sec) * 1e9);
+
+            while (!pool->done)
+                if (pthread_cond_timedwait(&pool->finished, &pool->lock, &ts))
+                    break;
+        }
+
+        pool->main_waiting = 0;
+    }
+
+    job = pool->done;
+    if (job) {
+        pool->done = job->next;
+        if (!pool->done)
+            pool->done_last = NULL;
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    if (!job)
+        return NULL;
+
+    --pool->pending;
+    *id = job->id;
+
+    if (job->failed)
+        result = Parrot_ex_build_exception(interp, EXCEPT_error,
+                    job->error, Parrot_str_new(interp, job->data, 0));
+    else if (job->data)
+        result = Parrot_thaw(interp, Parrot_str_new_init(interp, job->data,
+                    job->size, Parrot_binary_encoding_ptr, 0));
+
+    free_job(job);
+    return result;
+#else
+    UNUSED(interp);
+    UNUSED(pool);
+    UNUSED(timeout);
+    UNUSED(id);
+    return NULL;
+#endif
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<include/parrot/thread.h>, F<src/scheduler.c>.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -1,5 +1,5 @@
 /*
-Copyright (C) 2001-2010, Parrot Foundation.
+Copyright (C) 2001-2012, Parrot Foundation.
 
 =head1 NAME
 
@@ -37,6 +37,15 @@ typedef struct parrot_prm_context {
     void *info;
 } parrot_prm_context;
 
+/* compares two elements of the array being sorted */
+typedef INTVAL (*sort_cmp_t)(PARROT_INTERP, void *, void *, PMC *, const char *);
+
+/* runs sorted by insertion before merging, or partitioning ends */
+#define SORT_RUN 16
+
+/* fewer INTVALs are sorted by insertion instead of radix sort */
+#define SORT_RADIX_MIN 64
+
 /* HEADERIZER HFILE: include/parrot/misc.h */
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
@@ -59,7 +68,54 @@ static INTVAL COMPARE(PARROT_INTERP,
         __attribute__nonnull__(4)
         __attribute__nonnull__(5);
 
+PARROT_INLINE
+PARROT_WARN_UNUSED_RESULT
+static INTVAL compare_floatvals(PARROT_INTERP,
+    FLOATVAL a,
+    FLOATVAL b,
+    ARGIN_NULLOK(PMC *cmp))
+        __attribute__nonnull__(1);
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL compare_strings(PARROT_INTERP,
+    ARGIN_NULLOK(void *a),
+    ARGIN_NULLOK(void *b),
+    PMC *cmp,
+    const char * cmp_signature)
+        __attribute__nonnull__(1);
+
+static void introsort_floatvals(PARROT_INTERP,
+    ARGMOD(FLOATVAL *data),
+    UINTVAL n,
+    ARGIN_NULLOK(PMC *cmp),
+    unsigned int depth)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*data);
+
+static void mergesort_with(PARROT_INTERP,
+    ARGMOD(void **data),
+    UINTVAL n,
+    ARGIN(PMC *cmp),
+    ARGIN(const char * cmp_signature),
+    ARGIN(sort_cmp_t compare))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        __attribute__nonnull__(6)
+        FUNC_MODIFIES(*data);
+
 static void next_rand(_rand_buf X);
+static void sift_down_floatvals(PARROT_INTERP,
+    ARGMOD(FLOATVAL *data),
+    UINTVAL root,
+    UINTVAL n,
+    ARGIN_NULLOK(PMC *cmp))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*data);
+
 #define ASSERT_ARGS__drand48 __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS__erand48 __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS__jrand48 __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
@@ -73,7 +129,23 @@ static void next_rand(_rand_buf X);
     , PARROT_ASSERT_ARG(b) \
     , PARROT_ASSERT_ARG(cmp) \
     , PARROT_ASSERT_ARG(cmp_signature))
+#define ASSERT_ARGS_compare_floatvals __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_compare_strings __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_introsort_floatvals __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(data))
+#define ASSERT_ARGS_mergesort_with __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(data) \
+    , PARROT_ASSERT_ARG(cmp) \
+    , PARROT_ASSERT_ARG(cmp_signature) \
+    , PARROT_ASSERT_ARG(compare))
 #define ASSERT_ARGS_next_rand __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_sift_down_floatvals __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(data))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -757,6 +829,467 @@ Parrot_util_quicksort(PARROT_INTERP, ARGMOD(void **data), UINTVAL n,
 
 /*
 
+=item C<void Parrot_util_mergesort(PARROT_INTERP, void **data, UINTVAL n, PMC
+*cmp, const char * cmp_signature)>
+
+Perform a stable merge sort on a PMC array, or on an array of STRINGs if
+C<cmp> is given. Elements comparing equal keep their order.
+
+This makes fewer calls to C<cmp> than C<Parrot_util_quicksort>: short runs
+are sorted by binary insertion, and two runs already in order are not
+merged. Runs are merged into a scratch buffer and copied back, so C<data>
+holds every element while C<cmp> runs and may trigger a GC.
+
+cmp_signature is PCC signature for C<cmp>. E.g. C<PP->I> for FPA.
+
+=cut
+
+*/
+
+void
+Parrot_util_mergesort(PARROT_INTERP, ARGMOD(void **data), UINTVAL n,
+        ARGIN(PMC *cmp),
+        ARGIN(const char * cmp_signature))
+{
+    ASSERT_ARGS(Parrot_util_mergesort)
+
+    mergesort_with(interp, data, n, cmp, cmp_signature, COMPARE);
+}
+
+/*
+
+=item C<void Parrot_util_sort_strings(PARROT_INTERP, STRING **data, UINTVAL n)>
+
+Sort an array of STRINGs by codepoint with a stable merge sort. NULL entries
+sort as empty strings.
+
+=cut
+
+*/
+
+void
+Parrot_util_sort_strings(PARROT_INTERP, ARGMOD(STRING **data), UINTVAL n)
+{
+    ASSERT_ARGS(Parrot_util_sort_strings)
+
+    mergesort_with(interp, (void **)data, n, PMCNULL, "SS->I", compare_strings);
+}
+
+/*
+
+=item C<void Parrot_util_sort_intvals(PARROT_INTERP, INTVAL *data, UINTVAL n)>
+
+Sort an array of INTVALs in ascending order with a least significant digit
+radix sort, one byte per pass. Passes where all the elements have the same
+byte are skipped. Short arrays are sorted by insertion.
+
+=cut
+
+*/
+
+void
+Parrot_util_sort_intvals(PARROT_INTERP, ARGMOD(INTVAL *data), UINTVAL n)
+{
+    ASSERT_ARGS(Parrot_util_sort_intvals)
+    const UINTVAL sign = (UINTVAL)1 << (8 * sizeof (INTVAL) - 1);
+    UINTVAL      *counts;
+    INTVAL       *tmp, *src, *dst;
+    UINTVAL       i;
+    unsigned int  pass;
+
+    if (n < SORT_RADIX_MIN) {
+        for (i = 1; i < n; i++) {
+            const INTVAL x = data[i];
+            UINTVAL      j = i;
+
+            for (; j > 0 && data[j - 1] > x; j--)
+                data[j] = data[j - 1];
+
+            data[j] = x;
+        }
+        return;
+    }
+
+    /* count the bytes for all passes at once; flipping the sign bit orders
+     * negative numbers before positive ones */
+    counts = mem_gc_allocate_n_zeroed_typed(interp, 256 * sizeof (INTVAL), UINTVAL);
+
+    for (i = 0; i < n; i++) {
+        const UINTVAL key = (UINTVAL)data[i] ^ sign;
+
+        for (pass = 0; pass < sizeof (INTVAL); pass++)
+            counts[256 * pass + ((key >> (8 * pass)) & 0xff)]++;
+    }
+
+    tmp = mem_gc_allocate_n_typed(interp, n, INTVAL);
+    src = data;
+    dst = tmp;
+
+    for (pass = 0; pass < sizeof (INTVAL); pass++) {
+        UINTVAL * const count = counts + 256 * pass;
+        const unsigned  shift = 8 * pass;
+        UINTVAL         total = 0;
+        INTVAL         *swap;
+
+        if (count[(((UINTVAL)src[0] ^ sign) >> shift) & 0xff] == n)
+            continue;
+
+        for (i = 0; i < 256; i++) {
+            const UINTVAL c = count[i];
+            count[i]        = total;
+            total          += c;
+        }
+
+        for (i = 0; i < n; i++)
+            dst[count[(((UINTVAL)src[i] ^ sign) >> shift) & 0xff]++] = src[i];
+
+        swap = src;
+        src  = dst;
+        dst  = swap;
+    }
+
+    if (src != data)
+        memcpy(data, src, n * sizeof (INTVAL));
+
+    mem_gc_free(interp, tmp);
+    mem_gc_free(interp, counts);
+}
+
+/*
+
+=item C<void Parrot_util_sort_floatvals(PARROT_INTERP, FLOATVAL *data, UINTVAL
+n, PMC *cmp)>
+
+Sort an array of FLOATVALs with an introsort: a quicksort with median of
+three pivots, which turns into a heap sort if it recurses too deep, and
+leaves short ranges to an insertion sort.
+
+Without C<cmp> the numbers are sorted in ascending order, with NaNs last.
+Otherwise C<cmp> is called with two numbers, as C<NN->I>.
+
+=cut
+
+*/
+
+void
+Parrot_util_sort_floatvals(PARROT_INTERP, ARGMOD(FLOATVAL *data), UINTVAL n,
+        ARGIN_NULLOK(PMC *cmp))
+{
+    ASSERT_ARGS(Parrot_util_sort_floatvals)
+    unsigned int depth = 0;
+    UINTVAL      i;
+
+    if (PMC_IS_NULL(cmp)) {
+        /* NaNs compare neither less nor greater, so move them out first */
+        UINTVAL last = n;
+
+        for (i = n; i > 0; i--) {
+            if (data[i - 1] != data[i - 1]) {
+                const FLOATVAL nan = data[i - 1];
+                data[i - 1]        = data[--last];
+                data[last]         = nan;
+            }
+        }
+
+        n = last;
+    }
+
+    for (i = n; i > 1; i >>= 1)
+        depth += 2;
+
+    introsort_floatvals(interp, data, n, cmp, depth);
+}
+
+/*
+
+=item C<static INTVAL compare_strings(PARROT_INTERP, void *a, void *b, PMC *cmp,
+const char * cmp_signature)>
+
+Compares two STRINGs by codepoint. Two strings in the same encoding, if its
+byte order is the codepoint order, are compared with C<memcmp>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+compare_strings(PARROT_INTERP, ARGIN_NULLOK(void *a), ARGIN_NULLOK(void *b),
+        SHIM(PMC *cmp), SHIM(const char * cmp_signature))
+{
+    ASSERT_ARGS(compare_strings)
+    const STRING * const s1 = a ? (const STRING *)a : STRINGNULL;
+    const STRING * const s2 = b ? (const STRING *)b : STRINGNULL;
+
+    if (s1->encoding == s2->encoding
+    &&  (s1->encoding == Parrot_utf8_encoding_ptr
+    ||   s1->encoding->max_bytes_per_codepoint == 1)) {
+        const UINTVAL l1  = s1->bufused;
+        const UINTVAL l2  = s2->bufused;
+        const UINTVAL len = l1 < l2 ? l1 : l2;
+        const int     ret = len ? memcmp(s1->strstart, s2->strstart, len) : 0;
+
+        if (ret)
+            return ret < 0 ? -1 : 1;
+
+        return l1 < l2 ? -1 : l1 > l2;
+    }
+
+    return STRING_compare(interp, s1, s2);
+}
+
+/*
+
+=item C<static void mergesort_with(PARROT_INTERP, void **data, UINTVAL n, PMC
+*cmp, const char * cmp_signature, sort_cmp_t compare)>
+
+Sorts C<data> with a bottom up merge sort, calling C<compare> to compare two
+elements.
+
+=cut
+
+*/
+
+static void
+mergesort_with(PARROT_INTERP, ARGMOD(void **data), UINTVAL n, ARGIN(PMC *cmp),
+        ARGIN(const char * cmp_signature), ARGIN(sort_cmp_t compare))
+{
+    ASSERT_ARGS(mergesort_with)
+    void   **tmp;
+    UINTVAL  lo, width;
+
+    /* binary insertion sort of short runs */
+    for (lo = 0; lo < n; lo += SORT_RUN) {
+        const UINTVAL hi = lo + SORT_RUN < n ? lo + SORT_RUN : n;
+        UINTVAL       i;
+
+        for (i = lo + 1; i < hi; i++) {
+            void * const x = data[i];
+            UINTVAL      l = lo, r = i;
+
+            /* after the last element not greater than x */
+            while (l < r) {
+                const UINTVAL m = l + (r - l) / 2;
+
+                if (compare(interp, x, data[m], cmp, cmp_signature) < 0)
+                    r = m;
+                else
+                    l = m + 1;
+            }
+
+            if (l < i) {
+                memmove(data + l + 1, data + l, (i - l) * sizeof (void *));
+                data[l] = x;
+            }
+        }
+    }
+
+    if (n <= SORT_RUN)
+        return;
+
+    tmp = mem_gc_allocate_n_typed(interp, n, void *);
+
+    for (width = SORT_RUN; width < n; width *= 2) {
+        for (lo = 0; lo + width < n; lo += 2 * width) {
+            const UINTVAL mid = lo + width;
+            const UINTVAL hi  = mid + width < n ? mid + width : n;
+            UINTVAL       i   = lo, j = mid, k = lo;
+
+            /* the runs are in order already */
+            if (compare(interp, data[mid - 1], data[mid], cmp, cmp_signature) <= 0)
+                continue;
+
+            while (i < mid && j < hi) {
+                if (compare(interp, data[j], data[i], cmp, cmp_signature) < 0)
+                    tmp[k++] = data[j++];
+                else
+                    tmp[k++] = data[i++];
+            }
+
+            while (i < mid)
+                tmp[k++] = data[i++];
+
+            while (j < hi)
+                tmp[k++] = data[j++];
+
+            memcpy(data + lo, tmp + lo, (hi - lo) * sizeof (void *));
+        }
+    }
+
+    mem_gc_free(interp, tmp);
+}
+
+/*
+
+=item C<static INTVAL compare_floatvals(PARROT_INTERP, FLOATVAL a, FLOATVAL b,
+PMC *cmp)>
+
+Compares two numbers, with C<cmp> if it isn't null.
+
+=cut
+
+*/
+
+PARROT_INLINE
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+compare_floatvals(PARROT_INTERP, FLOATVAL a, FLOATVAL b, ARGIN_NULLOK(PMC *cmp))
+{
+    ASSERT_ARGS(compare_floatvals)
+    INTVAL result = 0;
+
+    if (PMC_IS_NULL(cmp))
+        return a < b ? -1 : a > b;
+
+    Parrot_ext_call(interp, cmp, "NN->I", a, b, &result);
+    return result;
+}
+
+/*
+
+=item C<static void introsort_floatvals(PARROT_INTERP, FLOATVAL *data, UINTVAL
+n, PMC *cmp, unsigned int depth)>
+
+Sorts C<data> by quicksort, with heap sort after C<depth> levels. The
+partitioning stays in bounds even if C<cmp> is inconsistent.
+
+=cut
+
+*/
+
+static void
+introsort_floatvals(PARROT_INTERP, ARGMOD(FLOATVAL *data), UINTVAL n,
+        ARGIN_NULLOK(PMC *cmp), unsigned int depth)
+{
+    ASSERT_ARGS(introsort_floatvals)
+    UINTVAL i;
+
+    while (n > SORT_RUN) {
+        UINTVAL  j, ln, rn;
+        FLOATVAL temp;
+
+        if (!depth--) {
+            /* heap sort */
+            UINTVAL end = n;
+
+            for (i = n / 2; i-- > 0;)
+                sift_down_floatvals(interp, data, i, n, cmp);
+
+            while (--end > 0) {
+                temp      = data[0];
+                data[0]   = data[end];
+                data[end] = temp;
+                sift_down_floatvals(interp, data, 0, end, cmp);
+            }
+
+            return;
+        }
+
+        /* the median of the first, middle and last elements as pivot */
+        i = n / 2;
+        j = n - 1;
+
+        if (compare_floatvals(interp, data[i], data[0], cmp) < 0) {
+            temp = data[i]; data[i] = data[0]; data[0] = temp;
+        }
+        if (compare_floatvals(interp, data[j], data[i], cmp) < 0) {
+            temp = data[j]; data[j] = data[i]; data[i] = temp;
+            if (compare_floatvals(interp, data[i], data[0], cmp) < 0) {
+                temp = data[i]; data[i] = data[0]; data[0] = temp;
+            }
+        }
+
+        temp    = data[0];
+        data[0] = data[i];
+        data[i] = temp;
+
+        for (i = 0, j = n; ;) {
+            do
+                --j;
+            while (j > 0 && compare_floatvals(interp, data[j], data[0], cmp) > 0);
+
+            do
+                ++i;
+            while (i < j && compare_floatvals(interp, data[i], data[0], cmp) < 0);
+
+            if (i >= j)
+                break;
+
+            temp    = data[i];
+            data[i] = data[j];
+            data[j] = temp;
+        }
+
+        temp    = data[j];
+        data[j] = data[0];
+        data[0] = temp;
+
+        ln = j;
+        rn = n - ++j;
+
+        if (ln < rn) {
+            introsort_floatvals(interp, data, ln, cmp, depth);
+            data += j;
+            n     = rn;
+        }
+        else {
+            introsort_floatvals(interp, data + j, rn, cmp, depth);
+            n = ln;
+        }
+    }
+
+    for (i = 1; i < n; i++) {
+        const FLOATVAL x = data[i];
+        UINTVAL        j = i;
+
+        for (; j > 0 && compare_floatvals(interp, data[j - 1], x, cmp) > 0; j--)
+            data[j] = data[j - 1];
+
+        data[j] = x;
+    }
+}
+
+/*
+
+=item C<static void sift_down_floatvals(PARROT_INTERP, FLOATVAL *data, UINTVAL
+root, UINTVAL n, PMC *cmp)>
+
+Moves C<data[root]> down the heap of the first C<n> elements of C<data> until
+no child is greater.
+
+=cut
+
+*/
+
+static void
+sift_down_floatvals(PARROT_INTERP, ARGMOD(FLOATVAL *data), UINTVAL root, UINTVAL n,
+        ARGIN_NULLOK(PMC *cmp))
+{
+    ASSERT_ARGS(sift_down_floatvals)
+
+    for (;;) {
+        UINTVAL  child = 2 * root + 1;
+        FLOATVAL temp;
+
+        if (child >= n)
+            return;
+
+        if (child + 1 < n
+        &&  compare_floatvals(interp, data[child], data[child + 1], cmp) < 0)
+            child++;
+
+        if (compare_floatvals(interp, data[root], data[child], cmp) >= 0)
+            return;
+
+        temp        = data[root];
+        data[root]  = data[child];
+        data[child] = temp;
+        root        = child;
+    }
+}
+
+/*
+
 =back
 
 =head1 SEE ALSO
@@ -1,10 +1,10 @@
 #!perl
-# Copyright (C) 2005-2008, Parrot Foundation.
+# Copyright (C) 2005-2012, Parrot Foundation.
 
 use strict;
 use warnings;
 use lib qw( . lib ../lib ../../lib );
-use Parrot::Test tests => 10;
+use Parrot::Test tests => 13;
 
 pir_output_is( <<'CODE', <<'OUT', "alligator" );
 # if the side-effect of set_label/continuation isn't
@@ -140,6 +140,92 @@ CODE
 ok
 OUT
 
+{
+    local $ENV{TEST_PROG_ARGS} = ( $ENV{TEST_PROG_ARGS} || '' ) . ' -O1';
+
+pir_output_is( <<'CODE', <<'OUT', "-O1 shares registers with disjoint live ranges" );
+.sub main :main
+    $P0 = get_global 'f'
+    $I0 = $P0.'__get_regs_used'('I')
+    say $I0
+    $I0 = $P0.'__get_regs_used'('S')
+    say $I0
+    f()
+.end
+.sub f
+    $I0 = 1
+    $I1 = $I0 + 2
+    say $I1
+    $I2 = 3
+    $I3 = $I2 * 4
+    say $I3
+    $I4 = 0
+  loop:
+    $I5 = $I4 * 2
+    say $I5
+    inc $I4
+    if $I4 < 3 goto loop
+    $S0 = "a"
+    $S1 = concat $S0, "b"
+    say $S1
+.end
+CODE
+2
+2
+3
+12
+0
+2
+4
+ab
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "-O1 keeps registers used in exception handlers" );
+.sub main :main
+    $I0 = 42
+    $S0 = "caught "
+    push_eh handler
+    $I1 = 1
+    say $I1
+    die "oops"
+    $I2 = 2
+    say $I2
+  handler:
+    pop_eh
+    $I3 = 3
+    print $S0
+    say $I0
+.end
+CODE
+1
+caught 42
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "-O1 keeps values live around loops and calls" );
+.sub main :main
+    .local int i, sum
+    .local string s
+    s   = "sum "
+    sum = 0
+    i   = 0
+  loop:
+    $I0 = double(i)
+    sum += $I0
+    inc i
+    if i < 5 goto loop
+    print s
+    say sum
+.end
+.sub double
+    .param int n
+    $I0 = n * 2
+    .return ($I0)
+.end
+CODE
+sum 20
+OUT
+}
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
@@ -0,0 +1,138 @@
+#!perl
+# Copyright (C) 2012, Parrot Foundation.
+
+use strict;
+use warnings;
+use lib qw( . lib ../lib ../../lib );
+use Parrot::Test tests => 6;
+
+# The -O3 passes: copy propagation, common subexpressions and loop invariant
+# code motion. The results must be the same as without them.
+
+$ENV{TEST_PROG_ARGS} = ( $ENV{TEST_PROG_ARGS} || '' ) . ' -O3';
+
+pir_output_is( <<'CODE', <<'OUT', "copies and invariants in a loop" );
+.sub main :main
+    .local int i, n, a, b
+    n = 10
+    i = 0
+  loop:
+    a = n * 3
+    b = a
+    $I0 = b + 1
+    $I1 = a + 1
+    $I2 = $I0 + $I1
+    inc i
+    if i < n goto loop
+    say $I2
+    say i
+.end
+CODE
+62
+10
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "copies are not propagated past a new value" );
+.sub main :main
+    $I0 = 1
+    $I1 = $I0
+    $I0 = 2
+    $I2 = $I1 + 10
+    say $I2
+    $S0 = "a"
+    $S1 = $S0
+    $S0 = "b"
+    say $S1
+    say $S0
+.end
+CODE
+11
+a
+b
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "subexpressions are recomputed where values meet" );
+.sub main :main
+    .param pmc args
+    $I9 = elements args
+    $I0 = 2
+    if $I9 > 5 goto other
+    $I0 = 3
+  other:
+    $I1 = $I0 * 7
+    $I0 = 4
+    $I2 = $I0 * 7
+    say $I1
+    say $I2
+.end
+CODE
+21
+28
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "values changed in the loop stay in the loop" );
+.sub main :main
+    .local int i, sum, step
+    sum  = 0
+    step = 1
+    i    = 0
+  loop:
+    $I0  = step * 2
+    sum += $I0
+    step = i + 1
+    inc i
+    if i < 4 goto loop
+    say sum
+.end
+CODE
+14
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "operations which may throw stay in the loop" );
+.sub main :main
+    .local int i, d
+    d = 0
+    i = 0
+    push_eh handler
+  loop:
+    if i >= 0 goto done
+    $I0 = 10 / d
+    say $I0
+    inc i
+    goto loop
+  done:
+    pop_eh
+    say "no division"
+    .return ()
+  handler:
+    say "caught"
+.end
+CODE
+no division
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "registers used by exception handlers" );
+.sub main :main
+    $I0 = 5
+    $I1 = $I0
+    push_eh handler
+    $I2 = $I1 * 2
+    die "oops"
+    say $I2
+  handler:
+    pop_eh
+    $I3 = $I1 * 2
+    say $I3
+    say $I1
+.end
+CODE
+10
+5
+OUT
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -1,18 +1,23 @@
 #!./parrot-nqp
 # Copyright (C) 2010, Parrot Foundation.
 
-# Checking for OpLib num and skip files parsing.
+# Checking for OpLib num, skip and fuse files parsing.
 
 pir::load_bytecode("opsc.pbc");
 
-plan(2);
+plan(4);
 
 my $lib := Ops::OpLib.new(
     :skip_file('src/ops/ops.skip'),
+    :fuse_file('src/ops/ops.fuse'),
 );
 
 ok( $lib.op_skip_table<abs_i_ic>,       "'abs_i_ic' in skiptable");
 ok( $lib.op_skip_table<ne_nc_nc_ic>,    "'ne_nc_nc_ic' in skiptable");
 #_dumper($lib.skiptable);
 
+ok( +$lib.op_fuse_list > 0,                      "ops.fuse lists sequences");
+ok( join(' ', |$lib.op_fuse_list[0]) eq 'set_i_ic lt_i_ic_ic',
+                                                 "first sequence parsed");
+
 # vim: expandtab shiftwidth=4 ft=perl6:
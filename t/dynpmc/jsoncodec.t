@@ -0,0 +1,276 @@
+#!./parrot
+# Copyright (C) 2012, Parrot Foundation.
+
+=head1 NAME
+
+t/dynpmc/jsoncodec.t - test the JSONCodec PMC
+
+=head1 SYNOPSIS
+
+    % prove t/dynpmc/jsoncodec.t
+
+=head1 DESCRIPTION
+
+Tests the JSONCodec PMC: decoding whole texts, chunks and handles, encoding,
+and the errors for malformed text.
+
+=cut
+
+.sub main :main
+    .include 'test_more.pir'
+    plan(50)
+
+    loadlib $P0, 'jsoncodec'
+    test_decode_scalars()
+    test_decode_containers()
+    test_decode_chunks()
+    test_decode_errors()
+    test_encode()
+    test_handles()
+.end
+
+.sub test_decode_scalars
+    .local pmc codec
+    codec = new 'JSONCodec'
+
+    $P0 = codec.'decode'('42')
+    $S0 = typeof $P0
+    is($S0, 'Integer', 'integer decodes to an Integer')
+    is($P0, 42, '... with its value')
+
+    $P0 = codec.'decode'(' -9223372036854775808 ')
+    $S0 = typeof $P0
+    is($S0, 'Integer', 'the smallest INTVAL is still an Integer')
+
+    $P0 = codec.'decode'('18446744073709551616')
+    $S0 = typeof $P0
+    is($S0, 'Float', 'integer too large for an INTVAL decodes to a Float')
+
+    $P0 = codec.'decode'('-2.5e3')
+    $S0 = typeof $P0
+    is($S0, 'Float', 'number with a fraction decodes to a Float')
+    is($P0, -2500.0, '... with its value')
+
+    $P0 = codec.'decode'('"a\"b\\c\/d\nA"')
+    is($P0, "a\"b\\c/d\nA", 'string escapes')
+
+    $P0 = codec.'decode'('"caf\u00e9 \ud83d\ude00"')
+    $S0 = $P0
+    $I0 = length $S0
+    is($I0, 6, 'unicode escapes and surrogate pairs decode to codepoints')
+    $I0 = ord $S0, 5
+    is($I0, 0x1f600, '... the pair to one codepoint')
+
+    $P0 = codec.'decode'(utf8:"\"\x{263a}\"")
+    $S0 = $P0
+    $I0 = ord $S0
+    is($I0, 0x263a, 'UTF-8 text in strings')
+
+    $P0 = codec.'decode'('true')
+    $S0 = typeof $P0
+    is($S0, 'Boolean', 'true decodes to a Boolean')
+    ok($P0, '... which is true')
+    $P0 = codec.'decode'('false')
+    nok($P0, 'false decodes to a false Boolean')
+    $P0 = codec.'decode'('null')
+    $I0 = isnull $P0
+    ok($I0, 'null decodes to a null PMC')
+.end
+
+.sub test_decode_containers
+    .local pmc codec, doc
+    codec = new 'JSONCodec'
+    doc   = codec.'decode'(<<'JSON')
+{
+    "name": "parrot",
+    "list": [1, [2, 3], {}, [], null],
+    "nested": {"a": {"b": true}},
+    "name": "last one wins"
+}
+JSON
+
+    $S0 = typeof doc
+    is($S0, 'Hash', 'object decodes to a Hash')
+    $I0 = elements doc
+    is($I0, 3, '... with one entry per name')
+    $S0 = doc['name']
+    is($S0, 'last one wins', '... the last of a repeated name')
+
+    $P0 = doc['list']
+    $S0 = typeof $P0
+    is($S0, 'ResizablePMCArray', 'array decodes to a ResizablePMCArray')
+    $I0 = elements $P0
+    is($I0, 5, '... with all its elements')
+    $I0 = $P0[1;1]
+    is($I0, 3, '... nested arrays')
+    $P1 = $P0[4]
+    $I0 = isnull $P1
+    ok($I0, '... null elements')
+
+    $I0 = doc['nested';'a';'b']
+    ok($I0, 'nested objects')
+.end
+
+.sub test_decode_chunks
+    .local pmc codec, doc
+    .local string text
+    .local int i, n, done
+    codec = new 'JSONCodec'
+    text  = '{"key": ["value", 12345, -0.5e1, true, null], "k2": "x"}'
+    n     = length text
+    i     = 0
+  feed:
+    $S0  = substr text, i, 1
+    done = codec.'feed'($S0)
+    inc i
+    if i == n goto fed
+    if done goto early
+    goto feed
+  early:
+    ok(0, 'value completed before the last chunk')
+  fed:
+    ok(done, 'fed one character at a time')
+    doc = codec.'finish'()
+    $S0 = doc['key';0]
+    is($S0, 'value', '... escapes split between chunks')
+    $I0 = doc['key';1]
+    is($I0, 12345, '... numbers split between chunks')
+    $N0 = doc['key';2]
+    is($N0, -5.0, '... exponents split between chunks')
+
+    done = codec.'feed'('[12')
+    nok(done, 'incomplete array')
+    codec.'feed'('34]')
+    $P0 = codec.'finish'()
+    $I0 = $P0[0]
+    is($I0, 1234, 'number continued in the next chunk')
+
+    done = codec.'feed'('42')
+    nok(done, 'top level number may continue')
+    $P0 = codec.'finish'()
+    is($P0, 42, '... until finished')
+.end
+
+.sub test_decode_errors
+    .local pmc codec
+    codec = new 'JSONCodec'
+
+    decode_fails(codec, '[1,]', "expected a value at offset 3", 'trailing comma')
+    decode_fails(codec, '{"a" 1}', "expected ':' at offset 5", 'missing colon')
+    decode_fails(codec, '[1', 'unexpected end of input at offset 2', 'unclosed array')
+    decode_fails(codec, '01', 'unexpected text after the value at offset 1', 'leading zero')
+    decode_fails(codec, 'nul', 'unexpected end of input', 'truncated literal')
+    decode_fails(codec, '"\q"', 'invalid escape at offset 2', 'invalid escape')
+    decode_fails(codec, '"\ud800"', 'unpaired surrogate', 'unpaired surrogate')
+
+    $P0 = codec.'decode'('[7]')
+    $I0 = $P0[0]
+    is($I0, 7, 'codec decodes again after an error')
+.end
+
+.sub decode_fails
+    .param pmc codec
+    .param string text
+    .param string expected
+    .param string description
+    push_eh caught
+    codec.'decode'(text)
+    pop_eh
+    ok(0, description)
+    .return ()
+  caught:
+    .get_results ($P0)
+    pop_eh
+    $S0 = $P0['message']
+    $I0 = index $S0, expected
+    $I0 = $I0 >= 0
+    ok($I0, description)
+.end
+
+.sub test_encode
+    .local pmc codec, doc, list
+    codec = new 'JSONCodec'
+
+    $P0 = box 42
+    $S0 = codec.'encode'($P0)
+    is($S0, '42', 'encode an Integer')
+
+    $P0 = box -1.5
+    $S0 = codec.'encode'($P0)
+    is($S0, '-1.5', 'encode a Float')
+    $P0 = box 2.0
+    $S0 = codec.'encode'($P0)
+    is($S0, '2.0', '... which stays a float')
+
+    $P0 = box utf8:"a\"b\\c\n\x{1}\x{e9}"
+    $S0 = codec.'encode'($P0)
+    is($S0, utf8:"\"a\\\"b\\\\c\\n\\u0001\x{e9}\"", 'encode a String')
+
+    null $P0
+    $S0 = codec.'encode'($P0)
+    is($S0, 'null', 'encode a null PMC')
+
+    list = new 'ResizablePMCArray'
+    push list, 1
+    push list, 'two'
+    $P0 = new 'Boolean'
+    $P0 = 1
+    push list, $P0
+    $P0 = new 'Undef'
+    push list, $P0
+    $P0 = new 'ResizablePMCArray'
+    push list, $P0
+    $S0 = codec.'encode'(list)
+    is($S0, '[1,"two",true,null,[]]', 'encode an array')
+
+    doc = new 'Hash'
+    doc['list'] = list
+    $S0 = codec.'encode'(doc)
+    is($S0, '{"list":[1,"two",true,null,[]]}', 'encode a hash')
+
+    $P0 = codec.'decode'($S0)
+    $S1 = codec.'encode'($P0)
+    is($S1, $S0, 'decoding and encoding again gives the same text')
+
+    $P0 = new 'FixedIntegerArray', 2
+    $P0[0] = 3
+    $P0[1] = -4
+    $S0 = codec.'encode'($P0)
+    is($S0, '[3,-4]', 'encode anything which does array')
+
+    push list, list
+    push_eh caught
+    codec.'encode'(list)
+    pop_eh
+    ok(0, 'cyclic structure')
+    .return ()
+  caught:
+    pop_eh
+    ok(1, 'cyclic structure')
+.end
+
+.sub test_handles
+    .local pmc codec, sh, doc
+    .local string text
+    codec = new 'JSONCodec'
+
+    sh = new 'StringHandle'
+    sh.'open'('json', 'w')
+    doc = codec.'decode'('{"a": [1, 2, {"b": "c"}]}')
+    codec.'encode_handle'(doc, sh)
+    sh.'close'()
+    text = sh.'readall'()
+    is(text, '{"a":[1,2,{"b":"c"}]}', 'encode to a handle')
+
+    sh.'open'('json', 'r')
+    $P0 = codec.'decode_handle'(sh)
+    sh.'close'()
+    $S0 = $P0['a';2;'b']
+    is($S0, 'c', 'decode from a handle')
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
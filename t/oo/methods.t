@@ -22,13 +22,15 @@ Tests features related to the creation, addition, and execution of OO methods.
 
     create_library()
 
-    plan(6)
+    plan(11)
 
     loading_methods_from_file()
     loading_methods_from_eval()
     overridden_find_method()
 
     overridden_core_pmc()
+    call_site_many_types()
+    call_site_method_added()
 
     try_delete_library()
 
@@ -142,6 +144,109 @@ END
     .return(1)
 .end
 
+.namespace []
+
+.sub 'call_site_many_types'
+    .local pmc objs, it
+    .local string seen
+    .const 'Sub' poly_who = 'poly_who'
+    objs = new ['ResizablePMCArray']
+    $I0 = 0
+  make_classes:
+    $S0 = 'Poly'
+    $S1 = $I0
+    $S0 .= $S1
+    $P0 = newclass $S0
+    $P0.'add_method'('who', poly_who)
+    $P1 = new $P0
+    push objs, $P1
+    inc $I0
+    if $I0 < 6 goto make_classes
+    $P1 = new ['ResizablePMCArray']
+    push objs, $P1
+
+    seen = ''
+    $I0 = 0
+  twice:
+    it = iter objs
+  loop:
+    unless it goto next
+    $P0 = shift it
+    $S0 = call_who($P0)
+    seen .= $S0
+    goto loop
+  next:
+    inc $I0
+    if $I0 < 2 goto twice
+    $S0 = 'Poly0Poly1Poly2Poly3Poly4Poly5RPA'
+    $S0 = repeat $S0, 2
+    is(seen, $S0, 'one call site finds methods for many receiver types')
+.end
+
+.sub 'call_who'
+    .param pmc obj
+    $S0 = obj.'who'()
+    .return ($S0)
+.end
+
+.sub 'poly_who' :method
+    $P0 = typeof self
+    $S0 = $P0
+    .return ($S0)
+.end
+
+.sub 'call_site_method_added'
+    .local pmc parent, child, obj
+    .const 'Sub' parent_greet = 'parent_greet'
+    .const 'Sub' child_greet  = 'child_greet'
+    parent = newclass 'CacheParent'
+    child  = subclass parent, 'CacheChild'
+    parent.'add_method'('greet', parent_greet)
+    obj = new child
+    $S0 = call_greet(obj)
+    $S0 = call_greet(obj)
+    is($S0, 'parent', 'inherited method found')
+
+    child.'add_method'('greet', child_greet)
+    child.'clear_method_cache'()
+    $S0 = call_greet(obj)
+    is($S0, 'child', 'method added to the class is found by the same call site')
+
+    child.'remove_method'('greet')
+    child.'clear_method_cache'()
+    $S0 = call_greet(obj)
+    is($S0, 'parent', 'removed method is no longer found')
+
+    $P0 = new ['ResizablePMCArray']
+    $S0 = call_greet($P0)
+    is($S0, 'rpa', 'method of a core PMC found by the same call site')
+.end
+
+.sub 'call_greet'
+    .param pmc obj
+    $S0 = obj.'greet'()
+    .return ($S0)
+.end
+
+.sub 'parent_greet' :method
+    .return ('parent')
+.end
+
+.sub 'child_greet' :method
+    .return ('child')
+.end
+
+.namespace ['ResizablePMCArray']
+.sub 'greet' :method
+    .return ('rpa')
+.end
+
+.sub 'who' :method
+    .return ('RPA')
+.end
+
+.namespace []
+
 # Local Variables:
 #   mode: pir
 #   fill-column: 100
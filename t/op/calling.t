@@ -1,12 +1,12 @@
 #!perl
-# Copyright (C) 2001-2011, Parrot Foundation.
+# Copyright (C) 2001-2012, Parrot Foundation.
 
 use strict;
 use warnings;
 use lib qw( . lib ../lib ../../lib );
 
 use Test::More;
-use Parrot::Test tests => 104;
+use Parrot::Test tests => 105;
 
 =head1 NAME
 
@@ -2637,6 +2637,63 @@ p2
 p1
 OUTPUT
 
+pir_output_is( <<'CODE', <<'OUTPUT', "positionals of every type, matching and not" );
+.sub main :main
+    $S0 = "s"
+    $P0 = box 4
+    ($I1, $N1, $S1, $P1) = same(1, 2.5, $S0, $P0)
+    say $I1
+    say $N1
+    say $S1
+    say $P1
+    ($P2, $I2, $S2) = coerce(7, "8", 9.5)
+    $S3 = typeof $P2
+    say $S3
+    say $P2
+    say $I2
+    say $S2
+    push_eh too_few
+    same(1, 2.5, $S0)
+    say "not reached"
+  too_few:
+    pop_eh
+    say "too few"
+    push_eh too_many
+    coerce(1, 2, 3, 4)
+    say "not reached"
+  too_many:
+    pop_eh
+    say "too many"
+.end
+
+.sub same
+    .param int i
+    .param num n
+    .param string s
+    .param pmc p
+    inc p
+    .return (i, n, s, p)
+.end
+
+.sub coerce
+    .param pmc p
+    .param int i
+    .param string s
+    .return (p, i, s)
+.end
+CODE
+1
+2.5
+s
+5
+Integer
+7
+8
+9.5
+too few
+too many
+OUTPUT
+
 pir_error_output_like( <<'CODE', <<'OUTPUT', "Don't coerce NULL PMCs into values");
 .sub main :main
     foo($P0)
@@ -0,0 +1,137 @@
+#!./parrot
+# Copyright (C) 2012, Parrot Foundation.
+
+=head1 NAME
+
+t/op/fused.t - Fused ops
+
+=head1 SYNOPSIS
+
+    % prove t/op/fused.t
+
+=head1 DESCRIPTION
+
+Runs op sequences listed in F<src/ops/ops.fuse>.  Under the C<fast> and
+C<cgoto> runcores they are rewritten to use fused ops, so the results have to
+be the same as running the ops one by one, including when code branches into
+the middle of a sequence.  Fused ops must never be written out when the code
+is serialized.
+
+=cut
+
+.sub main :main
+    .include 'test_more.pir'
+
+    plan(8)
+    test_set_lt()
+    test_branch_into_sequence()
+    test_inc_lt()
+    test_add_lt()
+    test_sub_if()
+    test_dec_if()
+    test_serialize_unfused()
+.end
+
+.sub test_set_lt
+    $I0 = 0
+    $I2 = 0
+  loop:
+    $I1 = 3
+    if $I1 < 10 goto next
+    $I2 = 1
+  next:
+    inc $I0
+    if $I0 < 10 goto loop
+    is($I2, 0, "set_i_ic lt_i_ic_ic takes the branch")
+.end
+
+.sub test_branch_into_sequence
+    $I0 = 0
+    $I1 = 20
+    $I2 = 0
+    goto middle
+  loop:
+    $I1 = 3
+  middle:
+    if $I1 < 10 goto next
+    inc $I2
+  next:
+    inc $I0
+    if $I0 < 5 goto loop
+    is($I2, 1, "branching into the middle of a sequence runs the rest")
+.end
+
+.sub test_inc_lt
+    $I0 = 0
+    $I1 = 100
+    $I2 = 0
+  loop:
+    $I2 += 2
+    inc $I0
+    if $I0 < $I1 goto loop
+    is($I2, 200, "inc_i lt_i_i_ic loops")
+.end
+
+.sub test_add_lt
+    $I0 = 0
+    $I1 = 0
+  loop:
+    inc $I0
+    $I1 = $I1 + $I0
+    if $I1 < 1000 goto loop
+    is($I0, 45, "add_i_i_i lt_i_ic_ic loops")
+.end
+
+.sub test_sub_if
+    $I0 = 50
+    $I1 = 5
+    $I2 = 0
+  loop:
+    inc $I2
+    $I0 = $I0 - $I1
+    if $I0 goto loop
+    is($I2, 10, "sub_i_i_i if_i_ic loops")
+.end
+
+.sub test_dec_if
+    $I0 = 7
+    $I1 = 0
+  loop:
+    $I1 += 3
+    dec $I0
+    if $I0 goto loop
+    is($I1, 21, "dec_i if_i_ic loops")
+.end
+
+.sub test_serialize_unfused
+    .local pmc compiler, view, subs, counter
+    .local string before, after
+    compiler = compreg 'PIR'
+    view     = compiler.'compile'(<<'CODE')
+.sub 'count' :tag('count')
+    $I0 = 0
+    $I1 = 0
+  loop:
+    $I1 += 2
+    inc $I0
+    if $I0 < 100 goto loop
+    .return ($I1)
+.end
+CODE
+
+    before  = view.'serialize'()
+    subs    = view.'subs_by_tag'('count')
+    counter = subs[0]
+    $I0     = counter()
+    is($I0, 200, "code compiled at runtime runs its fused ops")
+
+    after = view.'serialize'()
+    $I0   = iseq after, before
+    ok($I0, "running fused ops does not change the serialized code")
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
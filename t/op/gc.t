@@ -1,5 +1,5 @@
 #!./parrot
-# Copyright (C) 2001-2011, Parrot Foundation.
+# Copyright (C) 2001-2012, Parrot Foundation.
 
 =head1 NAME
 
@@ -34,6 +34,8 @@ GC related bugs.
     collect_toggle()
     collect_toggle_nested()
     "stats"()
+    pause_stats()
+    nursery_reuse()
     vanishing_singleton_PMC()
     vanishing_ret_continuation()
     regsave_marked()
@@ -156,6 +158,75 @@ GC related bugs.
     ok($I2, "Number of total PMCs is greater than active")
 .end
 
+.sub pause_stats
+    sweep 1
+    $I0 = interpinfo .INTERPINFO_GC_PAUSE_P50
+    $I1 = interpinfo .INTERPINFO_GC_PAUSE_P99
+    $I2 = interpinfo .INTERPINFO_GC_PAUSE_MAX
+    $I3 = $I0 <= $I1
+    ok($I3, "median pause is not above 99th percentile")
+    $I3 = $I1 <= $I2
+    ok($I3, "99th percentile pause is not above maximum")
+
+    $P0 = getinterp
+    $P1 = $P0.'gc_events'()
+    $I0 = elements $P1
+    ok($I0, "recent collections are recorded")
+
+    $P2 = $P1[-1]
+    $I0 = $P2['gc']
+    $I1 = interpinfo .INTERPINFO_GC_MARK_RUNS
+    $I3 = $I0 >= $I1
+    ok($I3, "last recorded collection is the last mark run")
+    $N0 = $P2['pause']
+    $N1 = $P2['end']
+    $N2 = $P2['start']
+    $N1 -= $N2
+    is($N0, $N1, "pause is end - start", 1e-9)
+.end
+
+# Allocate 400000 PMCs keeping every 200th, collecting in between. Slots of the dead ones must be
+# reused after each collection, and the survivors stay intact.
+.sub nursery_reuse
+    .local pmc keep
+    .local int i, intact
+    keep = new ['ResizablePMCArray']
+    i = 0
+  loop:
+    $P0 = new ['Integer']
+    $P0 = i
+    $P1 = new ['Float']
+    $I0 = i % 100
+    if $I0 goto next
+    push keep, $P0
+  next:
+    inc i
+    $I0 = i % 10000
+    if $I0 goto loop
+    sweep 1
+    if i < 200000 goto loop
+
+    $I1 = interpinfo .INTERPINFO_TOTAL_PMCS
+    $I0 = $I1 < 100000
+    ok($I0, "dead PMCs make room for new ones")
+    $I2 = interpinfo .INTERPINFO_ACTIVE_PMCS
+    $I0 = $I2 < $I1
+    ok($I0, "dead PMCs aren't active")
+
+    intact = 1
+    i = 0
+  check:
+    $P0 = keep[i]
+    $I0 = $P0
+    $I3 = i * 100
+    if $I0 == $I3 goto checked
+    intact = 0
+  checked:
+    inc i
+    if i < 2000 goto check
+    ok(intact, "surviving PMCs are intact")
+.end
+
 .sub vanishing_singleton_PMC
     $P16 = new 'Env'
     $P16['Foo'] = 'bar'
@@ -1,11 +1,14 @@
 #!perl
-# Copyright (C) 2006-2007, Parrot Foundation.
+# Copyright (C) 2006-2012, Parrot Foundation.
 
 use strict;
 use warnings;
 use lib qw( . lib ../lib ../../lib );
 use Test::More;
-use Parrot::Test tests => 3;
+use Parrot::Test tests => 9;
+use File::Temp qw( tempdir );
+use File::Spec;
+use File::Copy qw( copy );
 
 =head1 NAME
 
@@ -17,7 +20,8 @@ t/op/load_bytecode.t - loading bytecode tests
 
 =head1 DESCRIPTION
 
-Tests the C<load_bytecode> operation.
+Tests the C<load_bytecode> operation, including the compiled bytecode cache
+used for source files when C<PARROT_PBC_CACHE> is set.
 
 =cut
 
@@ -45,6 +49,82 @@ CODE
 /"load_bytecode" couldn't find file 'no_file_by_this_name'/
 OUTPUT
 
+{
+    my $cache_dir = tempdir( CLEANUP => 1 );
+    my $lib_dir   = tempdir( CLEANUP => 1 );
+    my $lib       = File::Spec->catfile( $lib_dir, 'cached_lib.pir' );
+    my $code      = <<"CODE";
+.sub main :main
+    load_bytecode '$lib'
+    \$P0 = get_global 'cached_answer'
+    \$I0 = \$P0()
+    say \$I0
+.end
+CODE
+
+    my $write_lib = sub {
+        my ($answer) = @_;
+        open my $fh, '>', $lib or die "Can't write $lib: $!";
+        print {$fh} <<"LIB";
+.sub 'init' :load
+    say 'loaded'
+.end
+
+.sub 'cached_answer'
+    .return ($answer)
+.end
+LIB
+        close $fh;
+    };
+    my $cache_entries = sub {
+        opendir my $dh, $cache_dir or die "Can't read $cache_dir: $!";
+        return scalar grep { /\.pbc\z/ } readdir $dh;
+    };
+
+    local $ENV{PARROT_PBC_CACHE} = $cache_dir;
+    $write_lib->(42);
+
+    pir_output_is( $code, <<'OUTPUT', "source compiled and cached" );
+loaded
+42
+OUTPUT
+
+    pir_output_is( $code, <<'OUTPUT', "source loaded from the cache" );
+loaded
+42
+OUTPUT
+
+    is( $cache_entries->(), 1, "one cache entry for unchanged source" );
+
+    $write_lib->(43);
+    pir_output_is( $code, <<'OUTPUT', "edited source is compiled again" );
+loaded
+43
+OUTPUT
+
+    # the same source elsewhere gets an entry of its own
+    my $other_dir = tempdir( CLEANUP => 1 );
+    my $other     = File::Spec->catfile( $other_dir, 'cached_lib.pir' );
+    copy( $lib, $other ) or die "Can't copy $lib: $!";
+    ( my $other_code = $code ) =~ s/\Q$lib\E/$other/;
+    my %before = map { $_ => 1 } glob File::Spec->catfile( $cache_dir, '*.pbc' );
+    $write_lib->(44);
+    copy( $lib, $other ) or die "Can't copy $lib: $!";
+    $write_lib->(43);
+    pir_output_is( $other_code, <<'OUTPUT', "same source at another path is cached apart" );
+loaded
+44
+OUTPUT
+
+    # an entry recording another source is not used
+    my ($other_entry) = grep { !$before{$_} } glob File::Spec->catfile( $cache_dir, '*.pbc' );
+    copy( $other_entry, $_ ) or die "Can't copy $other_entry: $!" for keys %before;
+    pir_output_is( $code, <<'OUTPUT', "entry compiled from another source is ignored" );
+loaded
+43
+OUTPUT
+}
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
@@ -5,7 +5,7 @@ use strict;
 use warnings;
 use lib qw( . lib ../lib ../../lib );
 use Test::More;
-use Parrot::Test tests => 48;
+use Parrot::Test tests => 50;
 use Parrot::Config;
 
 =head1 NAME
@@ -1194,6 +1194,102 @@ ok
 ok
 OUTPUT
 
+pir_output_is( <<'CODE', <<'OUT', 'random access into long variable width strings' );
+.sub 'main' :main
+    .local string base
+    base = ucs4:"a\x{e9}\x{4e2d}\x{1f600}b"
+    base = repeat base, 300
+    base = base . ucs4:"\x{1f600}end"
+
+    test_encoding(base, 'utf8')
+    test_encoding(base, 'utf16')
+.end
+
+.sub 'test_encoding'
+    .param string base
+    .param string encoding
+    .local string str
+    .local int len, i, pos, c1, c2, bad
+    $I0 = find_encoding encoding
+    str = trans_encoding base, $I0
+    len = length str
+    bad = 0
+    i = 0
+  loop:
+    if i >= len goto check_substr
+    # visit every position once, far apart from the previous one
+    pos = i * 97
+    pos = pos % len
+    c1 = ord base, pos
+    c2 = ord str, pos
+    if c1 == c2 goto next
+    inc bad
+  next:
+    inc i
+    goto loop
+
+  check_substr:
+    $S0 = substr base, 1200, 5
+    $S1 = substr str, 1200, 5
+    if $S0 == $S1 goto check_index
+    inc bad
+  check_index:
+    $I0 = index str, "end", 700
+    if $I0 == 1501 goto check_rindex
+    inc bad
+  check_rindex:
+    $S0 = ucs4:"\x{1f600}"
+    $I0 = rindex str, $S0, 1000
+    if $I0 == 998 goto done
+    inc bad
+  done:
+    print encoding
+    print ' '
+    print len
+    print ' '
+    say bad
+.end
+CODE
+utf8 1504 0
+utf16 1504 0
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', 'indexed strings are copied and swept' );
+.sub 'main' :main
+    .local string str, part
+    .local int round, bad, utf8
+    utf8  = find_encoding 'utf8'
+    bad   = 0
+    round = 0
+  loop:
+    $I0  = 0x100 + round
+    $S0  = chr $I0
+    $S0  = $S0 . ucs4:"\x{1f600}"
+    $S0  = trans_encoding $S0, utf8
+    str  = repeat $S0, 200
+    $I1  = ord str, 398
+    if $I1 == $I0 goto sub_string
+    inc bad
+  sub_string:
+    # shares the buffer of str, but needs its own offsets
+    part = substr str, 1, 300
+    $I1  = ord part, 297
+    if $I1 == $I0 goto again
+    inc bad
+  again:
+    $I1  = ord str, 396
+    if $I1 == $I0 goto next
+    inc bad
+  next:
+    sweep 1
+    inc round
+    if round < 100 goto loop
+    say bad
+.end
+CODE
+0
+OUT
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
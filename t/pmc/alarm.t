@@ -19,7 +19,7 @@
 
   run_unix_tests:
 
-    plan(7)
+    plan(9)
 
     $P0 = new 'Integer'
     $P0 = 0
@@ -63,6 +63,9 @@ done:
 good:
     ok(1, "Alarms actually waited")
 
+    alarm_cancel()
+    alarm_order()
+
     $P1 = get_global 'alarm_finish'
     $N0 = time
     $N0 = $N0 + 0.1
@@ -87,6 +90,84 @@ good:
     $P1[.PARROT_ALARM_TASK] = proc
 
     $P1()
+    .return($P1)
+.end
+
+.sub alarm_cancel
+    $N0 = time
+    $N0 = $N0 + 0.05
+    $P0 = get_global 'alarm_cancelled'
+    $P1 = make_alarm($N0, $P0)
+
+    $I0 = $P1.'cancel'()
+    $I1 = $P1.'cancel'()
+    $I0 = $I0 - $I1
+    is($I0, 1, "Alarm cancelled once")
+
+    # Would run alarm_cancelled by now
+    sleep 0.1
+.end
+
+.sub alarm_cancelled
+    ok(0, "Alarm cancelled once")
+.end
+
+.sub alarm_order
+    .local pmc order, task, index
+    .local num first
+    .local int i
+
+    order = new 'ResizableIntegerArray'
+    set_global 'ORDER', order
+
+    # Schedule the latest alarm first
+    first = time
+    first = first + 0.05
+    i = 50
+  schedule_loop:
+    dec i
+    $N0 = i * 0.002
+    $N0 = $N0 + first
+    $P0 = get_global 'alarm_record'
+    task = new 'Task', $P0
+    index = new 'Integer'
+    index = i
+    task.'data'(index)
+    make_alarm($N0, task)
+    if i > 0 goto schedule_loop
+
+    # Conditional branches don't check the scheduler, so all of the alarms
+    # expire together and have to be put in order
+    $N1 = first + 0.1
+  spin_loop:
+    $N0 = time
+    if $N0 < $N1 goto spin_loop
+
+  wait_loop:
+    $I0 = elements order
+    if $I0 == 50 goto check_order
+    goto wait_loop
+
+  check_order:
+
+    i = 0
+  check_loop:
+    $I0 = order[i]
+    if $I0 != i goto bad_order
+    inc i
+    if i < 50 goto check_loop
+    ok(1, "Alarms fire in time order")
+    .return()
+
+  bad_order:
+    ok(0, "Alarms fire in time order")
+.end
+
+.sub alarm_record
+    .param pmc index
+    $P0 = get_global 'ORDER'
+    $I0 = index
+    push $P0, $I0
 .end
 
 .sub inc_A
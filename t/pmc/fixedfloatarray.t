@@ -1,5 +1,5 @@
 #!./parrot
-# Copyright (C) 2001-2010, Parrot Foundation.
+# Copyright (C) 2001-2012, Parrot Foundation.
 
 =head1 NAME
 
@@ -19,7 +19,7 @@ out-of-bounds test. Checks INT and PMC keys.
 .sub main :main
     .include 'fp_equality.pasm'
     .include 'test_more.pir'
-    plan(32)
+    plan(36)
 
     array_size_tests()
     element_set_tests()
@@ -32,6 +32,7 @@ out-of-bounds test. Checks INT and PMC keys.
     test_new_style_init()
     test_invalid_init_tt1509()
     test_get_string()
+    test_sort()
 .end
 
 .sub array_size_tests
@@ -284,6 +285,71 @@ CODE
     is($S0, '[ -1.5, 0, 3.14 ]', 'has string representation')
 .end
 
+.sub test_sort
+    .local pmc a, cmp
+    a = new 'FixedFloatArray', 5
+    a[0] = 2.5
+    a[1] = -1.5
+    $N0 = 'NaN'
+    a[2] = $N0
+    a[3] = 0
+    a[4] = -10
+    a.'sort'()
+    $S0 = join ' ', a
+    is($S0, '-10 -1.5 0 2.5 NaN', 'default sort puts NaN last')
+
+    cmp = get_global 'reverse_cmp'
+    a = new 'FixedFloatArray', 4
+    a[0] = 1.5
+    a[1] = 3
+    a[2] = -2
+    a[3] = 0.25
+    a.'sort'(cmp)
+    $S0 = join ' ', a
+    is($S0, '3 1.5 0.25 -2', 'sort with custom cmp function')
+
+    .local int i, ok
+    a = new 'FixedFloatArray', 500
+    i = 0
+  fill:
+    $I0 = i * 7919
+    $I0 %= 500
+    $N0 = $I0
+    $N0 /= 4
+    a[i] = $N0
+    inc i
+    if i < 500 goto fill
+
+    a.'sort'()
+    ok = 1
+    i = 0
+  check:
+    $N0 = a[i]
+    $N1 = i
+    $N1 /= 4
+    if $N0 == $N1 goto next
+    ok = 0
+  next:
+    inc i
+    if i < 500 goto check
+    is(ok, 1, 'default sort of a large array')
+
+    a = new 'ResizableFloatArray'
+    push a, 3.5
+    push a, -3.5
+    push a, 1.0
+    a.'sort'()
+    $S0 = join ' ', a
+    is($S0, '-3.5 1 3.5', 'ResizableFloatArray inherits sort')
+.end
+
+.sub reverse_cmp
+    .param num a
+    .param num b
+    $I0 = cmp b, a
+    .return ($I0)
+.end
+
 # Local Variables:
 #   mode: pir
 #   fill-column: 100
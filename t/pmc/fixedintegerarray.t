@@ -1,5 +1,5 @@
 #!./parrot
-# Copyright (C) 2001-2010, Parrot Foundation.
+# Copyright (C) 2001-2012, Parrot Foundation.
 
 =head1 NAME
 
@@ -31,6 +31,7 @@ out-of-bounds test. Checks INT and PMC keys.
     test_equality()
     test_repr()
     test_sort()
+    test_sort_large()
     test_new_style_init()
     test_invalid_init_tt1509()
     test_custom_cmp()
@@ -292,6 +293,39 @@ out-of-bounds test. Checks INT and PMC keys.
     is($I0, 1, 'default sort')
 .end
 
+.sub 'test_sort_large'
+    .local pmc a
+    .local int i, x, prev, ok
+    a = new ['FixedIntegerArray'], 1000
+    x = 12345
+    i = 0
+  fill:
+    x *= 1103515245
+    x += 12345
+    x &= 0xffffff
+    $I0 = x - 0x800000
+    $I0 *= 257
+    a[i] = $I0
+    inc i
+    if i < 1000 goto fill
+    a[10] = 0
+    a[20] = -1
+
+    a.'sort'()
+    ok = 1
+    prev = a[0]
+    i = 1
+  check:
+    $I0 = a[i]
+    if $I0 >= prev goto next
+    ok = 0
+  next:
+    prev = $I0
+    inc i
+    if i < 1000 goto check
+    is(ok, 1, 'default sort of a large array with negative numbers')
+.end
+
 .sub test_invalid_init_tt1509
     throws_substring(<<'CODE', 'FixedIntegerArray: Cannot set array size to a negative number (-10)', 'New style init does not dump core for negative array lengths')
     .sub main :main
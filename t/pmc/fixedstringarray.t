@@ -1,5 +1,5 @@
 #!./parrot
-# Copyright (C) 2001-2010, Parrot Foundation.
+# Copyright (C) 2001-2012, Parrot Foundation.
 
 =head1 NAME
 
@@ -18,7 +18,7 @@ out-of-bounds test. Checks INT and PMC keys.
 
 .sub 'main' :main
     .include 'test_more.pir'
-    plan(50)
+    plan(54)
 
     test_set_size()
     test_reset_size()
@@ -39,6 +39,7 @@ out-of-bounds test. Checks INT and PMC keys.
     test_number()
     test_new_style_init()
     test_invalid_init_tt1509()
+    test_sort()
 .end
 
 .sub 'test_set_size'
@@ -403,6 +404,57 @@ CODE
 CODE
 .end
 
+.sub test_sort
+    .local pmc a, cmp
+    a = new 'FixedStringArray', 5
+    a[0] = 'pear'
+    a[1] = 'apple'
+    a[2] = 'Pear'
+    a[3] = 'app'
+    a[4] = ''
+    a.'sort'()
+    $S0 = join ',', a
+    is($S0, ',Pear,app,apple,pear', 'default sort by codepoint')
+
+    a = new 'FixedStringArray', 4
+    a[0] = utf8:"\x{e9}t\x{e9}"
+    a[1] = 'zebra'
+    a[2] = utf8:"\x{263a}"
+    a[3] = 'eta'
+    a.'sort'()
+    $S0 = join ',', a
+    $S1 = utf8:"eta,zebra,\x{e9}t\x{e9},\x{263a}"
+    is($S0, $S1, 'default sort of mixed encodings')
+
+    cmp = get_global 'length_cmp'
+    a = new 'FixedStringArray', 5
+    a[0] = 'ccc'
+    a[1] = 'b'
+    a[2] = 'aaa'
+    a[3] = 'dd'
+    a[4] = 'a'
+    a.'sort'(cmp)
+    $S0 = join ',', a
+    is($S0, 'b,a,dd,ccc,aaa', 'sort with custom cmp function is stable')
+
+    a = new 'ResizableStringArray'
+    push a, 'b'
+    push a, 'c'
+    push a, 'a'
+    a.'sort'()
+    $S0 = join ',', a
+    is($S0, 'a,b,c', 'ResizableStringArray inherits sort')
+.end
+
+.sub length_cmp
+    .param string a
+    .param string b
+    $I0 = length a
+    $I1 = length b
+    $I2 = cmp $I0, $I1
+    .return ($I2)
+.end
+
 # Local Variables:
 #   mode: pir
 #   fill-column: 100
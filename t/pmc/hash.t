@@ -1,5 +1,5 @@
 #!./parrot
-# Copyright (C) 2001-2010, Parrot Foundation.
+# Copyright (C) 2001-2012, Parrot Foundation.
 
 =head1 NAME
 
@@ -78,6 +78,9 @@ well.
     update()
     update_mixed()
     lexed_key()
+    keys_in_other_encodings()
+    delete_and_insert_many_times()
+    insert_while_iterating_int_keys()
 
     'done_testing'()
 .end
@@ -1572,6 +1575,145 @@ postit_end:
     is($S1, 'TEST', 'access with a lexed key works')
 .end
 
+.sub 'keys_in_other_encodings'
+    .local pmc hash
+    hash = new ['Hash']
+    hash['a_rather_long_identifier'] = 1
+    hash[''] = 2
+    hash[unicode:"caf\u00e9_au_lait_and_more"] = 3
+    hash[unicode:"\u03bb_lambda_\u03bc_mu_\u03bd_nu"] = 4
+
+    check_key_in_encodings(hash, 'a_rather_long_identifier', 1)
+    check_key_in_encodings(hash, '', 2)
+    check_key_in_encodings(hash, unicode:"caf\u00e9_au_lait_and_more", 3)
+    check_key_in_encodings(hash, unicode:"\u03bb_lambda_\u03bc_mu_\u03bd_nu", 4)
+.end
+
+.sub 'delete_and_insert_many_times'
+    .local pmc hash
+    .local int round, i, key, missing, stale
+    hash = new ['Hash']
+    hash = .Hash_key_type_int
+    round   = 0
+    missing = 0
+    stale   = 0
+  next_round:
+    i = 0
+  insert:
+    key = round * 100
+    key += i
+    hash[key] = round
+    inc i
+    if i < 100 goto insert
+
+    if round == 0 goto check
+    i = 0
+  delete:
+    key = round - 1
+    key *= 100
+    key += i
+    delete hash[key]
+    $I0 = exists hash[key]
+    stale += $I0
+    inc i
+    if i < 100 goto delete
+
+  check:
+    i = 0
+  lookup:
+    key = round * 100
+    key += i
+    $I0 = hash[key]
+    if $I0 == round goto found
+    inc missing
+  found:
+    inc i
+    if i < 100 goto lookup
+
+    inc round
+    if round < 200 goto next_round
+
+    is(missing, 0, 'keys found while others come and go')
+    is(stale, 0, 'deleted keys stay deleted')
+    $I0 = elements hash
+    is($I0, 100, 'only the last round is left')
+.end
+
+.sub 'insert_while_iterating_int_keys'
+    .local pmc hash, seen, it
+    .local int i, key, added, twice, unexpected, missing
+    hash = new ['Hash']
+    hash = .Hash_key_type_int
+    i = 0
+  fill:
+    hash[i] = i
+    inc i
+    if i < 100 goto fill
+    i = 50
+  drop:
+    delete hash[i]
+    inc i
+    if i < 100 goto drop
+
+    # Inserting leaves the index crowded with deleted slots, so it gets
+    # compacted while the iterator is still walking the entries
+    seen       = new ['Hash']
+    seen       = .Hash_key_type_int
+    added      = 1000
+    twice      = 0
+    unexpected = 0
+    it = iter hash
+  walk:
+    unless it goto walked
+    key = shift it
+    if key >= 1000 goto insert
+    if key < 50 goto record
+    inc unexpected
+  record:
+    $I0 = exists seen[key]
+    twice += $I0
+    seen[key] = 1
+  insert:
+    if added >= 1100 goto walk
+    hash[added] = added
+    inc added
+    goto walk
+  walked:
+
+    missing = 0
+    i = 0
+  check:
+    $I0 = exists seen[i]
+    if $I0 goto checked
+    inc missing
+  checked:
+    inc i
+    if i < 50 goto check
+
+    is(missing, 0, 'inserting while iterating visits every int key, 0 too')
+    is(twice, 0, 'inserting while iterating visits no int key twice')
+    is(unexpected, 0, 'inserting while iterating skips deleted int keys')
+.end
+
+.sub 'check_key_in_encodings'
+    .param pmc hash
+    .param string key
+    .param int value
+    .local pmc encodings, it
+    encodings = split ' ', 'utf8 utf16 ucs2 ucs4'
+    it = iter encodings
+  loop:
+    unless it goto done
+    $S0 = shift it
+    $I0 = find_encoding $S0
+    $S1 = trans_encoding key, $I0
+    $I1 = hash[$S1]
+    $S2 = concat 'key found in ', $S0
+    is($I1, value, $S2)
+    goto loop
+  done:
+.end
+
 .namespace ['Foo']
 .sub '' :method :vtable('hashvalue')
     $P0 = box 42
@@ -19,7 +19,7 @@ Tests the creation and invocation of Perl6 multi subs.
 .sub main :main
     .include 'test_more.pir'
 
-    plan( 8 )
+    plan( 13 )
 
     $P0 = new ['MultiSub']
     $I0 = defined $P0
@@ -51,6 +51,47 @@ Tests the creation and invocation of Perl6 multi subs.
     $S0 = foo($P1 :flat, $P2 :flat)
     is($S0, "testing 42, goodbye", "Int and String double :flat")
 
+    dispatch_cache()
+.end
+
+.sub dispatch_cache
+    .local pmc multi, int_arg, str_arg, candidate
+    multi   = get_global 'bar'
+    int_arg = box 1
+    str_arg = box 'x'
+
+    $S0 = bar(int_arg)
+    $S0 = bar(int_arg)
+    is($S0, 'Integer', 'repeated call dispatches to the same candidate')
+    $S0 = bar(str_arg)
+    is($S0, 'any', 'other argument types get their own candidate')
+
+    candidate = get_global 'bar_string'
+    candidate = candidate[0]
+    push multi, candidate
+    $S0 = bar(str_arg)
+    is($S0, 'String', 'pushed candidate is used by later calls')
+    $S0 = bar(int_arg)
+    is($S0, 'Integer', 'other candidates are still found')
+
+    $P0 = pop multi
+    $S0 = bar(str_arg)
+    is($S0, 'any', 'removed candidate is no longer used')
+.end
+
+.sub bar :multi(_)
+    .param pmc arg
+    .return ('any')
+.end
+
+.sub bar :multi(Integer)
+    .param pmc arg
+    .return ('Integer')
+.end
+
+.sub bar_string :multi(String)
+    .param pmc arg
+    .return ('String')
 .end
 
 .sub foo :multi()
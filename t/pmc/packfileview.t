@@ -1,10 +1,10 @@
 #!./parrot
-# Copyright (C) 2011, Parrot Foundation.
+# Copyright (C) 2011-2012, Parrot Foundation.
 
 .sub 'main' :main
     .include 'test_more.pir'
 
-    plan(20)
+    plan(21)
 
     test_create()
     test_interp_same_after_compile()
@@ -20,6 +20,7 @@
     test_method_serialize()
     test_method_all_subs()
     test_method_read_from_file()
+    test_strings_outlive_mapped_file()
     test_method_write_to_file()
     test_method_deserialize()
 .end
@@ -197,6 +198,47 @@ __EOCODE__
     # TODO: Would really like temporary files for this. GH #517
 .end
 
+# String constants of a mapped .pbc are used in place, so the file has to
+# stay mapped after its PackfileView is collected.
+.sub 'test_strings_outlive_mapped_file'
+    .local string file, str, expected
+    file = 'packfileview_t_strings.pbc'
+    $P0 = compreg 'PIR'
+    $P1 = $P0.'compile'(".sub 'f' :anon\n.return('a mapped string constant')\n.end\n")
+    $P1.'write_to_file'(file)
+
+    str      = 'last_string_constant'(file)
+    expected = str . '!'
+    'churn'()
+    $S0 = str . '!'
+    is($S0, expected, "string constants outlive the PackfileView of a mapped file")
+
+    $P2 = new ['OS']
+    $P2.'rm'(file)
+.end
+
+.sub 'last_string_constant'
+    .param string file
+    .local pmc view
+    view = new ['PackfileView']
+    view.'read_from_file'(file)
+    $P0 = view.'constant_counts'()
+    $I0 = $P0[1]
+    dec $I0
+    $S0 = view[$I0]
+    .return($S0)
+.end
+
+.sub 'churn'
+    $I0 = 0
+  loop:
+    $P0 = new ['ResizablePMCArray']
+    $P0[100] = 1
+    inc $I0
+    if $I0 < 10000 goto loop
+    sweep 1
+.end
+
 # Subs with :tag syntax
 .sub 'tag1' :tag("tag-a")
     .return('tag1')
@@ -1,5 +1,5 @@
 #!./parrot
-# Copyright (C) 2001-2011, Parrot Foundation.
+# Copyright (C) 2001-2012, Parrot Foundation.
 
 =head1 NAME
 
@@ -22,7 +22,7 @@ out-of-bounds test. Checks INT and PMC keys.
     .include 'fp_equality.pasm'
     .include 'test_more.pir'
 
-    plan(151)
+    plan(152)
 
     init_tests()
     resize_tests()
@@ -56,6 +56,7 @@ out-of-bounds test. Checks INT and PMC keys.
     sort_with_broken_cmp()
     equality_tests()
     sort_tailcall()
+    sort_stable()
     push_to_subclasses_array()
     test_assign_from_another()
     test_assign_self()
@@ -1133,6 +1134,54 @@ end:
     .tailcall 'cmp_func_tailcall'(a, b)
 .end
 
+.sub 'sort_stable'
+    .local pmc array, pair, prev
+    .local int i, ok
+    array = new 'ResizablePMCArray'
+    i = 0
+  fill:
+    pair = new 'FixedIntegerArray', 2
+    $I0 = i * 7
+    $I0 %= 5
+    pair[0] = $I0
+    pair[1] = i
+    push array, pair
+    inc i
+    if i < 100 goto fill
+
+    .const 'Sub' cmp_first = 'cmp_first_element'
+    array.'sort'(cmp_first)
+
+    ok = 1
+    prev = array[0]
+    i = 1
+  check:
+    pair = array[i]
+    $I0 = prev[0]
+    $I1 = pair[0]
+    if $I0 < $I1 goto next
+    if $I0 > $I1 goto bad
+    $I0 = prev[1]
+    $I1 = pair[1]
+    if $I0 < $I1 goto next
+  bad:
+    ok = 0
+  next:
+    prev = pair
+    inc i
+    if i < 100 goto check
+    is(ok, 1, "sort keeps the order of equal elements")
+.end
+
+.sub 'cmp_first_element'
+    .param pmc a
+    .param pmc b
+    $I0 = a[0]
+    $I1 = b[0]
+    $I2 = cmp $I0, $I1
+    .return ($I2)
+.end
+
 # Regression test for TT#835
 .sub 'push_to_subclasses_array'
     .local pmc cl, array_one
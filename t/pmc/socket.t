@@ -20,11 +20,13 @@ stack, so we don't need to check if this parrot is IPv6-aware.
 
 .include 'socket.pasm'
 .include 'iglobals.pasm'
+.include 'sysinfo.pasm'
+.loadlib 'sys_ops'
 
 .sub main :main
     .include 'test_more.pir'
 
-    plan(19)
+    plan(24)
 
     test_init()
     test_get_fd()
@@ -38,6 +40,8 @@ stack, so we don't need to check if this parrot is IPv6-aware.
     test_udp_socket()
     test_udp_socket6()
     test_server()
+    test_task_io()
+    test_task_io_waiters()
 
 .end
 
@@ -178,6 +182,178 @@ stack, so we don't need to check if this parrot is IPv6-aware.
     nok(status, 'Exit status of server process')
 .end
 
+.sub test_task_io
+    .local pmc server, address, sock, task, log
+    .local string str
+    .local int port
+
+    $S0 = sysinfo .SYSINFO_PARROT_OS
+    if $S0 != 'MSWin32' goto run_tests
+    skip(3, 'tasks block in I/O on Win32')
+    .return ()
+
+  run_tests:
+    server = new 'Socket'
+    server.'socket'(.PIO_PF_INET, .PIO_SOCK_STREAM, .PIO_PROTO_TCP)
+    port = 1244
+    push_eh error
+  retry:
+    address = server.'sockaddr'('localhost', port)
+    server.'bind'(address)
+    goto bound
+  error:
+    inc port
+    if port < 1254 goto retry
+    pop_eh
+    skip(3, "couldn't bind to a free port")
+    .return ()
+
+  bound:
+    pop_eh
+    server.'listen'(5)
+    set_global 'io_server', server
+    log = new 'ResizableStringArray'
+    set_global 'io_log', log
+
+    $P0 = get_global 'io_echo'
+    task = new 'Task', $P0
+    schedule task
+
+    sock = new 'Socket'
+    sock.'socket'(.PIO_PF_INET, .PIO_SOCK_STREAM, .PIO_PROTO_TCP)
+    address = sock.'sockaddr'('localhost', port)
+    sock.'connect'(address)
+
+    # The echo task waits for data in recv, which lets us go on
+    pass
+    push log, 'send'
+    sock.'send'('ping')
+    str = sock.'recv'()
+    is(str, 'ping', 'recv in a task waiting for another one')
+    sock.'close'()
+    server.'close'()
+
+    # The echo task finished before the reply got here
+    str = join ',', log
+    is(str, 'accept,send,recv ping', 'task suspended while waiting for I/O')
+.end
+
+.sub io_echo
+    .local pmc server, conn, log
+    .local string str
+
+    server = get_global 'io_server'
+    log = get_global 'io_log'
+    conn = server.'accept'()
+    push log, 'accept'
+    str = conn.'recv'()
+    $S0 = 'recv ' . str
+    push log, $S0
+    conn.'send'(str)
+    conn.'close'()
+    ok(1, 'echo task done')
+.end
+
+.sub test_task_io_waiters
+    .local pmc server, address, sock, conn, task, log
+    .local string str
+    .local int port
+
+    $S0 = sysinfo .SYSINFO_PARROT_OS
+    if $S0 != 'MSWin32' goto run_tests
+    skip(2, 'tasks block in I/O on Win32')
+    .return ()
+
+  run_tests:
+    server = new 'Socket'
+    server.'socket'(.PIO_PF_INET, .PIO_SOCK_STREAM, .PIO_PROTO_TCP)
+    port = 1254
+    push_eh error
+  retry:
+    address = server.'sockaddr'('localhost', port)
+    server.'bind'(address)
+    goto bound
+  error:
+    inc port
+    if port < 1264 goto retry
+    pop_eh
+    skip(2, "couldn't bind to a free port")
+    .return ()
+
+  bound:
+    pop_eh
+    server.'listen'(5)
+    set_global 'io_server', server
+    log = new 'ResizableStringArray'
+    set_global 'io_log', log
+
+    $P0 = get_global 'io_accept'
+    task = new 'Task', $P0
+    schedule task
+
+    sock = new 'Socket'
+    sock.'socket'(.PIO_PF_INET, .PIO_SOCK_STREAM, .PIO_PROTO_TCP)
+    address = sock.'sockaddr'('localhost', port)
+    sock.'connect'(address)
+
+    # Two readers wait for the same socket, each gets one message
+    sock.'send'('one')
+    str = sock.'recv'()
+    sock.'send'('two')
+    str = sock.'recv'()
+    str = join ',', log
+    is(str, 'one,two', 'several tasks wait for one handle')
+
+    # Closing the socket wakes a reader waiting for it
+    $P0 = get_global 'io_reader'
+    task = new 'Task', $P0
+    schedule task
+    pass
+    conn = get_global 'io_conn'
+    conn.'close'()
+    pass
+    str = join ',', log
+    is(str, 'one,two,closed', 'closing a handle wakes the tasks waiting for it')
+
+    sock.'close'()
+    server.'close'()
+.end
+
+.sub io_accept
+    .local pmc server, conn, task
+    server = get_global 'io_server'
+    conn = server.'accept'()
+    set_global 'io_conn', conn
+
+    $P0 = get_global 'io_reader'
+    task = new 'Task', $P0
+    schedule task
+    task = new 'Task', $P0
+    schedule task
+.end
+
+.sub io_reader
+    .local pmc conn, log
+    .local string str
+
+    conn = get_global 'io_conn'
+    log = get_global 'io_log'
+    push_eh failed
+    str = conn.'recv'()
+    pop_eh
+    if null str goto closed
+    if str == '' goto closed
+    push log, str
+    conn.'send'(str)
+    .return ()
+
+  failed:
+    .get_results ($P0)
+    pop_eh
+  closed:
+    push log, 'closed'
+.end
+
 # Local Variables:
 #   mode: pir
 #   fill-column: 100
@@ -1,5 +1,5 @@
 #!./parrot
-# Copyright (C) 2010-2011, Parrot Foundation.
+# Copyright (C) 2010-2012, Parrot Foundation.
 
 .include 'sysinfo.pasm'
 .loadlib 'sys_ops'
@@ -25,11 +25,12 @@
     exit 0
 
   run_unix_tests:
-    plan(10)
+    plan(16)
     tasks_run()
     task_send_recv()
     task_kill()
     task_wait()
+    task_workers()
     preempt_and_exit()
 .end
 
@@ -129,6 +130,71 @@
     ok(1, "in wait_sub1")
 .end
 
+.sub task_workers
+    .local pmc interp, tasks, task, code, result
+    .local int i, sum
+
+    interp = getinterp
+    $I0 = interp.'start_workers'(2)
+    is($I0, 2, "Start workers")
+    $I0 = interp.'start_workers'(4)
+    is($I0, 2, "Workers start once")
+
+    tasks = new 'ResizablePMCArray'
+    code  = get_global 'square'
+    i = 1
+  schedule_loop:
+    task = new 'Task'
+    setattribute task, 'code', code
+    $P0 = box i
+    setattribute task, 'data', $P0
+    interp.'schedule_worker'(task)
+    push tasks, task
+    inc i
+    if i <= 6 goto schedule_loop
+
+    sum = 0
+  result_loop:
+    task = shift tasks
+    result = task.'result'()
+    $I0 = result
+    sum += $I0
+    if tasks goto result_loop
+    is(sum, 91, "Results of tasks run on workers")
+
+    task = new 'Task'
+    code = get_global 'worker_die'
+    setattribute task, 'code', code
+    interp.'schedule_worker'(task)
+    result = task.'result'()
+    $I0 = isa result, 'Exception'
+    ok($I0, "Exception thrown on a worker is the result")
+    $S0 = result['message']
+    is($S0, "worker died", "Message of exception thrown on a worker")
+
+    task = new 'Task'
+    code = get_global 'square'
+    setattribute task, 'code', code
+    $P0 = box 12
+    setattribute task, 'data', $P0
+    interp.'schedule_worker'(task)
+    wait task
+    result = task.'result'()
+    is(result, 144, "Wait for task run on a worker")
+.end
+
+.sub square
+    .param pmc n
+    $I0 = n
+    $I0 *= $I0
+    .return ($I0)
+.end
+
+.sub worker_die
+    .param pmc unused
+    die "worker died"
+.end
+
 .sub preempt_and_exit
     $P0 = get_global 'exit0'
     $P1 = new 'Task', $P0
@@ -23,13 +23,14 @@ Tests the Timer PMC.
 .sub main :main
     .include 'test_more.pir'
     .include "timer.pasm"
-    plan(17)
+    plan(19)
     timer_setup()
     timer_initialize()
     timer_start_stop()
     timer_repeat()
     timer_start()
     timer_stop()
+    timer_cancel()
 .end
 
 .sub timer_stop
@@ -162,6 +163,23 @@ Tests the Timer PMC.
     ok(1,'slept after stopping timer')
 .end
 
+.sub timer_cancel
+    $P1 = new ['FixedPMCArray'], 6
+    set $P1[0], .PARROT_TIMER_NSEC
+    set $P1[1], 0.2
+    set $P1[2], .PARROT_TIMER_HANDLER
+    get_global $P2, "_timer_sub"
+    set $P1[3], $P2
+    set $P1[4], .PARROT_TIMER_RUNNING
+    set $P1[5], 1
+
+    $P0 = new ['Timer'], $P1
+    $P0.'cancel'()
+    ok(1,'cancelled Timer')
+    sleep 0.5
+    ok(1,'slept after cancelling timer')
+.end
+
 .sub _timer_sub
     print "never\n"
     returncc
@@ -1,5 +1,5 @@
 #!perl
-# Copyright (C) 2005-2010, Parrot Foundation.
+# Copyright (C) 2005-2012, Parrot Foundation.
 
 =head1 NAME
 
@@ -19,9 +19,9 @@ use strict;
 use warnings;
 use lib qw( lib . ../lib ../../lib );
 
-use Test::More tests => 35;
+use Test::More tests => 55;
 use Parrot::Config;
-use File::Temp 0.13 qw/tempfile/;
+use File::Temp 0.13 qw/tempfile tempdir/;
 use File::Spec;
 
 my $PARROT = ".$PConfig{slash}$PConfig{test_prog}";
@@ -75,8 +75,9 @@ is( `"$PARROT" --trace "$first_pir_file" "$second_pir_file" $redir`,
 {
 my $cmd;
 
-## this test assumes these cores work on all platforms (a safe assumption)
-for my $val (qw/ slow fast bounds trace /) {
+## this test assumes these cores work on all platforms (a safe assumption;
+## cgoto runs the fast core where computed goto is not available)
+for my $val (qw/ slow fast bounds trace cgoto /) {
     for my $opt ( '-R ', '--runcore ', '--runcore=' ) {
         $cmd = qq{"$PARROT" $opt$val "$second_pir_file" $redir};
         is( qx{$cmd}, "second\n", "<$opt$val> option)" ) or diag $cmd;
@@ -115,6 +116,205 @@ like( $output, qr/maximum GC nursery size is 50%/,
                  '--gc-nursery-size max warning' );
 is( $exit, 0, '... and should not crash' );
 
+# GMS collection policy goals
+$output = qx{$PARROT --gc-throughput-goal=100 2>&1 };
+like( $output, qr/GC throughput goal must be below 100%/,
+                 '--gc-throughput-goal max warning' );
+
+$output = qx{$PARROT --gc-pause-goal=soon 2>&1 };
+like( $output, qr/invalid GC pause goal specified/,
+                 '--gc-pause-goal needs a number' );
+
+$output = qx{$PARROT --gc-max-heap=1.5 2>&1 };
+like( $output, qr/invalid GC max heap specified/,
+                 '--gc-max-heap needs KB' );
+
+is( qx{$PARROT --gc gms --gc-nursery-size=0.01 --gc-max-heap=64 --gc-pause-goal=0.5 --gc-throughput-goal=90 "$first_pir_file"},
+    "first\n", 'GMS runs with collection policy goals' );
+
+# Marking with helper threads
+$output = qx{$PARROT --gc-mark-threads=many 2>&1 };
+like( $output, qr/invalid GC mark threads specified/,
+                 '--gc-mark-threads needs a number' );
+
+for my $gc (qw/gms ms2/) {
+    is( qx{$PARROT --gc $gc --gc-mark-threads=3 "$first_pir_file"}, "first\n",
+        "$gc marks with helper threads" );
+}
+
+{
+    my ( $pir_fh, $pir_file ) = tempfile( SUFFIX => '.pir', UNLINK => 1 );
+    print $pir_fh <<'END_PIR';
+.include 'interpinfo.pasm'
+
+.sub main :main
+    .param pmc args
+    .local string dir
+    .local int round, before, after
+    dir   = args[1]
+    round = 0
+  cycle:
+    $S0 = round
+    $S1 = dir . '/'
+    $S1 .= $S0
+    unclosed($S1, $S0)
+    garbage()
+    sweep 1
+    inc round
+    if round != 5 goto next
+    before = interpinfo .INTERPINFO_TOTAL_MEM_ALLOC
+  next:
+    if round < 40 goto cycle
+
+    after = interpinfo .INTERPINFO_TOTAL_MEM_ALLOC
+    $I0   = before * 3
+    $I0   = $I0 / 2
+    if after > $I0 goto grew
+    say "reused"
+    .return ()
+  grew:
+    say "grew"
+.end
+
+.sub garbage
+    $I0 = 0
+  loop:
+    $P0 = new ['ResizablePMCArray']
+    push $P0, $I0
+    inc $I0
+    if $I0 < 5000 goto loop
+.end
+
+# Only the destructor flushes and closes the file
+.sub unclosed
+    .param string path
+    .param string text
+    $P0 = new ['FileHandle']
+    $P0.'open'(path, 'w')
+    $P0.'print'(text)
+.end
+END_PIR
+    close $pir_fh;
+
+    for my $gc (qw/ms gms/) {
+        my $dir = tempdir( CLEANUP => 1 );
+
+        is( qx{$PARROT --gc $gc --gc-lazy-sweep "$pir_file" "$dir"}, "reused\n",
+            "$gc reuses lazily swept PMCs" );
+
+        my @unflushed = grep {
+            open my $in, '<', "$dir/$_" or die "Can't read $dir/$_: $!";
+            local $/;
+            my $text = <$in>;
+            close $in;
+            !defined $text || $text ne $_;
+        } 0 .. 39;
+        is( "@unflushed", '', "$gc destroys PMCs it sweeps lazily" );
+    }
+}
+
+{
+    my ( $pir_fh, $pir_file ) = tempfile( SUFFIX => '.pir', UNLINK => 1 );
+    print $pir_fh <<'END_PIR';
+.sub main :main
+    sweep 1
+    say "swept"
+.end
+END_PIR
+    close $pir_fh;
+
+    my ( $log_fh, $log_file ) = tempfile( SUFFIX => '.log', UNLINK => 1 );
+    close $log_fh;
+
+    is( qx{$PARROT --gc-log="$log_file" "$pir_file"}, "swept\n",
+        'option --gc-log' );
+
+    open my $in, '<', $log_file or die "Can't read $log_file: $!";
+    my $first = <$in>;
+    close $in;
+    like( $first, qr/^\{"gc":1,"start":[\d.]+,"end":[\d.]+,"pause":[\d.]+,/,
+        '--gc-log writes a line per collection' );
+}
+
+{
+    my ( $pir_fh, $pir_file ) = tempfile( SUFFIX => '.pir', UNLINK => 1 );
+    print $pir_fh <<'END_PIR';
+.sub main :main
+    .local pmc keep
+    keep = new ['ResizablePMCArray']
+    $I0 = 0
+  fill:
+    $S0 = repeat 'x', 500
+    $S1 = $I0
+    $S0 .= $S1
+    $I1 = $I0 % 5
+    if $I1 goto skip
+    push keep, $S0
+  skip:
+    inc $I0
+    if $I0 < 50000 goto fill
+
+    $I0 = 0
+  check:
+    $S0 = keep[$I0]
+    $S1 = substr $S0, 500
+    $I1 = $I0 * 5
+    $I2 = $S1
+    if $I1 != $I2 goto bad
+    inc $I0
+    if $I0 < 10000 goto check
+    say "intact"
+    .return ()
+  bad:
+    say $S1
+.end
+END_PIR
+    close $pir_fh;
+
+    is( qx{$PARROT --gc-compact-limit=16 "$pir_file"}, "intact\n",
+        'option --gc-compact-limit' );
+}
+
+{
+    my ( $pir_fh, $pir_file ) = tempfile( SUFFIX => '.pir', UNLINK => 1 );
+    my ( $old_fh, $old_file ) = tempfile( SUFFIX => '.json', UNLINK => 1 );
+    my ( $new_fh, $new_file ) = tempfile( SUFFIX => '.json', UNLINK => 1 );
+    close $old_fh;
+    close $new_fh;
+    print $pir_fh <<"END_PIR";
+.sub main :main
+    \$P0 = getinterp
+    \$P0.'heap_snapshot'('$old_file')
+    \$P1 = new 'ResizablePMCArray'
+    \$I0 = 0
+  loop:
+    \$P2 = new 'Hash'
+    push \$P1, \$P2
+    inc \$I0
+    if \$I0 < 100 goto loop
+    \$P0.'heap_snapshot'('$new_file')
+    say "snapped"
+.end
+END_PIR
+    close $pir_fh;
+
+    is( qx{$PARROT --gc-alloc-sites "$pir_file"}, "snapped\n",
+        'option --gc-alloc-sites' );
+
+    open my $in, '<', $new_file or die "Can't read $new_file: $!";
+    my @hashes = grep { /"kind":"pmc","type":"Hash",.*"site":[1-9]/ } <$in>;
+    close $in;
+    cmp_ok( scalar @hashes, '>=', 100,
+        'heap snapshot has the allocation sites of new PMCs' );
+
+    my $heap_diff = ".$PConfig{slash}heap_diff$PConfig{exe}";
+  SKIP: {
+        skip 'heap_diff not built', 1 unless -x $heap_diff;
+        like( qx{$heap_diff "$old_file" "$new_file"},
+            qr/^\s+\d+\s+\+1\d\d\s+\d+\s+\+\d+\s+Hash$/m,
+            'heap_diff counts the new PMCs' );
+    }
+}
 
 # Test --leak-test. See issue GH #765
 is( qx{$PARROT --leak-test "$first_pir_file"}, "first\n", '--leak-test' );
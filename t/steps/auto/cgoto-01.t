@@ -0,0 +1,81 @@
+#!perl
+# Copyright (C) 2001-2012, Parrot Foundation.
+# auto/cgoto-01.t
+
+use strict;
+use warnings;
+use Test::More tests =>  12;
+use lib qw( lib t/configure/testlib );
+use_ok('config::auto::cgoto');
+use Parrot::Configure;
+use Parrot::Configure::Options qw( process_options );
+use Parrot::Configure::Step::Test;
+use Parrot::Configure::Test qw(
+    test_step_constructor_and_description
+);
+
+########## regular ##########
+
+my ($args, $step_list_ref) = process_options( {
+    argv => [ ],
+    mode => q{configure},
+} );
+
+my $conf = Parrot::Configure::Step::Test->new;
+$conf->include_config_results( $args );
+
+my $pkg = q{auto::cgoto};
+
+$conf->add_steps($pkg);
+$conf->options->set( %{$args} );
+my $step = test_step_constructor_and_description($conf);
+ok($step->runstep($conf), "${pkg}::runstep() returned true value");
+
+##### _handle_cgoto #####
+
+my ($fail_message, $exp);
+
+$conf->data->set( HAS_COMPUTED_GOTO => undef );
+$fail_message = 'There was a problem';
+$exp = 'no';
+$step->_handle_cgoto($conf, $fail_message);
+ok(defined $conf->data->get('HAS_COMPUTED_GOTO'),
+    "HAS_COMPUTED_GOTO is defined" );
+ok(! $conf->data->get('HAS_COMPUTED_GOTO'),
+    "HAS_COMPUTED_GOTO is not true, as expected" );
+is($step->result(), $exp, "Got expected result '$exp'");
+
+$conf->data->set( HAS_COMPUTED_GOTO => undef );
+$fail_message = '';
+$exp = 'yes';
+$step->_handle_cgoto($conf, $fail_message);
+ok(defined $conf->data->get('HAS_COMPUTED_GOTO'),
+    "HAS_COMPUTED_GOTO is defined" );
+ok($conf->data->get('HAS_COMPUTED_GOTO'),
+    "HAS_COMPUTED_GOTO is true, as expected" );
+is($step->result(), $exp, "Got expected result '$exp'");
+
+pass("Completed all tests in $0");
+
+################### DOCUMENTATION ###################
+
+=head1 NAME
+
+t/steps/auto/cgoto-01.t - tests Parrot::Configure step auto::cgoto
+
+=head1 SYNOPSIS
+
+    prove t/steps/auto/cgoto-01.t
+
+=head1 DESCRIPTION
+
+This file holds tests for auto::cgoto.
+
+=cut
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4: